@@ -0,0 +1,109 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSCloudWatchResources.h"
+
+static const NSUInteger AWSCloudWatchSerializationTestsDatumCount = 500;
+
+@interface AWSQueryStringRequestSerializer()
+
+- (void)processParameters:(NSDictionary *)parameters queryString:(NSMutableString *)queryString;
+
+@end
+
+@interface AWSCloudWatchSerializationTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+
+@end
+
+@implementation AWSCloudWatchSerializationTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSCloudWatchResources sharedInstance] JSONObject];
+}
+
+- (NSDictionary *)putMetricDataParams {
+    NSMutableArray *metricData = [NSMutableArray arrayWithCapacity:AWSCloudWatchSerializationTestsDatumCount];
+    NSDate *timestamp = [NSDate dateWithTimeIntervalSince1970:1792411200];
+    for (NSUInteger i = 0; i < AWSCloudWatchSerializationTestsDatumCount; i++) {
+        [metricData addObject:@{@"MetricName": [NSString stringWithFormat:@"Latency %lu", (unsigned long)(i % 20)],
+                                @"Dimensions": @[@{@"Name": @"Endpoint", @"Value": [NSString stringWithFormat:@"/v1/items/%lu?expand=true", (unsigned long)i]},
+                                                 @{@"Name": @"Region", @"Value": @"us-east-1"}],
+                                @"Timestamp": timestamp,
+                                @"Values": @[@(i * 0.5), @(i * 1.5), @12.25],
+                                @"Counts": @[@1, @(i), @3],
+                                @"Unit": @"Milliseconds",
+                                @"StorageResolution": @60}];
+    }
+    return @{@"Namespace": @"App/Requests", @"MetricData": metricData};
+}
+
+- (NSData *)dictionaryFormDataForParams:(NSDictionary *)params {
+    NSDictionary *formattedParams = [AWSQueryParamBuilder buildFormattedParams:params
+                                                                    actionName:@"PutMetricData"
+                                                         serviceDefinitionRule:self.definition
+                                                                         error:nil];
+    NSMutableString *queryString = [NSMutableString new];
+    [[AWSQueryStringRequestSerializer new] processParameters:formattedParams queryString:queryString];
+    return [queryString dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSCountedSet *)pairsForData:(NSData *)data {
+    NSString *body = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    return [NSCountedSet setWithArray:[body componentsSeparatedByString:@"&"]];
+}
+
+- (void)testPutMetricDataFormDataMatchesDictionary {
+    NSDictionary *params = [self putMetricDataParams];
+    NSData *data = [AWSQueryParamBuilder formDataForParams:params
+                                                actionName:@"PutMetricData"
+                                     serviceDefinitionRule:self.definition];
+    XCTAssertNotNil(data);
+
+    NSData *expected = [self dictionaryFormDataForParams:params];
+    XCTAssertEqual(data.length, expected.length);
+    NSCountedSet *pairs = [self pairsForData:data];
+    XCTAssertEqualObjects(pairs, [self pairsForData:expected]);
+    XCTAssertTrue([pairs containsObject:@"MetricData.member.8.Dimensions.member.1.Value=%2Fv1%2Fitems%2F7%3Fexpand%3Dtrue"]);
+    XCTAssertTrue([pairs containsObject:@"MetricData.member.8.Counts.member.2=7"]);
+}
+
+- (void)testPutMetricDataFormDataPerformance {
+    NSDictionary *params = [self putMetricDataParams];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSData *data = [AWSQueryParamBuilder formDataForParams:params
+                                                        actionName:@"PutMetricData"
+                                             serviceDefinitionRule:self.definition];
+            XCTAssertGreaterThan(data.length, 0);
+        }];
+    }
+}
+
+- (void)testPutMetricDataDictionaryPerformance {
+    NSDictionary *params = [self putMetricDataParams];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSData *data = [self dictionaryFormDataForParams:params];
+            XCTAssertGreaterThan(data.length, 0);
+        }];
+    }
+}
+
+@end
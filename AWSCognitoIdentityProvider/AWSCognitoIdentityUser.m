@@ -32,6 +32,10 @@ static const NSString * AWSCognitoIdentityUserAsfDeviceId = @"asf.device.id";
 static const NSString * AWSCognitoIdentityUserDeviceSecret = @"device.secret";
 static const NSString * AWSCognitoIdentityUserDeviceGroup = @"device.group";
 static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttributes.";
+// Sessions are never handed out when they expire within this window.
+static const NSTimeInterval AWSCognitoIdentityUserSessionExpiryWindow = 2 * 60;
+// Sessions are refreshed in the background once they expire within this window.
+static const NSTimeInterval AWSCognitoIdentityUserSessionRefreshAheadWindow = 5 * 60;
 
 -(instancetype) initWithUsername: (NSString *)username pool:(AWSCognitoIdentityUserPool *)pool {
     self = [super init];
@@ -185,28 +189,23 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
     }];
 }
 
-- (BOOL) isSessionValid:(AWSCognitoIdentityUserSession * _Nonnull)session {
-    // If id token is not present we only need to check the accessToken to determine the validity of the token.
-    if (!session.idToken) {
-        return [self isTokenValid:session.accessToken];
-    } else {
-        return [self isTokenValid:session.accessToken] && [self isTokenValid:session.idToken];
-    }
-    return false;
+// Check if the session is valid for at least `interval` seconds. We need to check both accessToken and id Token
+// expiry since user can change both of them in Cognito console. If id token is not present we only need to check
+// the accessToken to determine the validity of the session.
+- (BOOL) isSession:(AWSCognitoIdentityUserSession * _Nonnull)session validFor:(NSTimeInterval)interval {
+    NSDate *validUntil = [NSDate dateWithTimeIntervalSinceNow:interval];
+    return (session.accessToken
+            && [session.expirationTime compare:validUntil] == NSOrderedDescending
+            && [self isToken:session.accessToken validUntil:validUntil]
+            && (!session.idToken || [self isToken:session.idToken validUntil:validUntil]));
 }
 
-// Check if the token is valid or not. Returns true if the token is valid.
-//
-// The token is consider invalid if the token expiry is less than or equal to 2 min. This 2 minute buffer is
-// given so that we do not hand over a token to the user which will get expired immediately. This guarrantees that the
-// returned session tokens are valid for atleast 2 min.
-- (BOOL) isTokenValid:(AWSCognitoIdentityUserSessionToken * _Nonnull)token {
-    if ([token.tokenClaims valueForKey:@"exp"]) {
-        int expiryWindow = 2 * 60;
-        NSTimeInterval expiryInterval = [[token.tokenClaims valueForKey:@"exp"] doubleValue];
-        NSDate *tokenExpiration =  [NSDate dateWithTimeIntervalSince1970:expiryInterval];
-        return (tokenExpiration &&
-                [tokenExpiration compare:[NSDate dateWithTimeIntervalSinceNow:expiryWindow]] == NSOrderedDescending);
+// Check if the token is valid or not. Returns true if the token expires after `validUntil`.
+- (BOOL) isToken:(AWSCognitoIdentityUserSessionToken * _Nonnull)token validUntil:(NSDate *)validUntil {
+    id expiry = [token.tokenClaims valueForKey:@"exp"];
+    if (expiry) {
+        NSDate *tokenExpiration =  [NSDate dateWithTimeIntervalSince1970:[expiry doubleValue]];
+        return [tokenExpiration compare:validUntil] == NSOrderedDescending;
     }
     return false;
 }
@@ -217,87 +216,143 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 -(AWSTask<AWSCognitoIdentityUserSession*> *) getSession {
     
     //check to see if we have valid tokens
-    __block NSString * keyChainNamespace = [self keyChainNamespaceClientId];
-    NSString * expirationTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserTokenExpiration];
-    NSString * expirationDate = self.pool.keychain[expirationTokenKey];
+    NSString * keyChainNamespace = [self keyChainNamespaceClientId];
+    AWSCognitoIdentityUserSession * session = [self cachedSession:keyChainNamespace];
     
-    if(expirationDate){
-        NSDate *expiration = [NSDate aws_dateFromString:expirationDate format:AWSDateISO8601DateFormat1];
-        NSString * refreshToken = [self refreshTokenFromKeyChain:keyChainNamespace];
-
+    if(session){
         // Token exists, the user is confirmed
         self.confirmedStatus = AWSCognitoIdentityUserStatusConfirmed;
 
-        NSString * accessTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserAccessToken];
-        NSString * idTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserIdToken];
-        
-        NSString * idToken = self.pool.keychain[idTokenKey];
-        NSString * accessToken = self.pool.keychain[accessTokenKey];
-        
-        AWSCognitoIdentityUserSession * session;
-        
-        // Session is available if we have expiration and accessToken.
-        if (expiration && accessToken) {
-            session = [[AWSCognitoIdentityUserSession alloc] initWithIdToken:idToken
-                                                                 accessToken:accessToken
-                                                                refreshToken:refreshToken
-                                                              expirationTime:expiration];
-        }
-
-        // If the session expires > 2 minutes return it. We need to check both accessToken and id Token expiry
-        // since user can change both of them in Cognito console.
-        if(session
-           && [self isSessionValid:session]
-           && [expiration compare:[NSDate dateWithTimeIntervalSinceNow:2 * 60]] == NSOrderedDescending) {
+        // If the session expires > 2 minutes return it. This 2 minute buffer is given so that we do not hand over a
+        // token to the user which will get expired immediately.
+        if([self isSession:session validFor:AWSCognitoIdentityUserSessionExpiryWindow]) {
+            // Close to expiry, refresh in the background so later callers do not have to wait for it.
+            if(session.refreshToken
+               && ![self isSession:session validFor:AWSCognitoIdentityUserSessionRefreshAheadWindow]) {
+                [self refreshSession:session keyChainNamespace:keyChainNamespace];
+            }
             return [AWSTask taskWithResult:session];
         }
         //else refresh it using the refresh token
-        else if(refreshToken){
-            AWSCognitoIdentityProviderInitiateAuthRequest * request = [AWSCognitoIdentityProviderInitiateAuthRequest new];
-            request.authFlow = AWSCognitoIdentityProviderAuthFlowTypeRefreshTokenAuth;
-            request.clientId = self.pool.userPoolConfiguration.clientId;
-            request.analyticsMetadata = [self.pool analyticsMetadata];
-            request.userContextData = [self.pool userContextData:self.username deviceId: [self asfDeviceId]];
-            
-            NSMutableDictionary * authParameters = [[NSMutableDictionary alloc] initWithDictionary:@{@"REFRESH_TOKEN" : refreshToken}];
-            
-            //refresh token secret hash is actually client secret for this api, set it if it is supplied
-            if(self.pool.userPoolConfiguration.clientSecret != nil){
-                [authParameters setObject:self.pool.userPoolConfiguration.clientSecret forKey:@"SECRET_HASH"];
-            }
-            
-            [self addDeviceKey:authParameters];
-            
-            request.authParameters = authParameters;
-            return [[self.pool.client initiateAuth:request] continueWithBlock:^id _Nullable(AWSTask<AWSCognitoIdentityProviderInitiateAuthResponse *> * _Nonnull task) {
-                if(task.error){
-                    //If this token is no longer valid, fall back on interactive auth.
-                    if(task.error.code == AWSCognitoIdentityProviderErrorNotAuthorized) {
-                        return [self interactiveAuth];
-                    } else {
-                        return task;
-                    }
+        else if(session.refreshToken){
+            return [[self refreshSession:session keyChainNamespace:keyChainNamespace] continueWithBlock:^id _Nullable(AWSTask<AWSCognitoIdentityUserSession *> * _Nonnull task) {
+                //If this token is no longer valid, fall back on interactive auth.
+                if(task.error.code == AWSCognitoIdentityProviderErrorNotAuthorized) {
+                    return [self interactiveAuth];
                 }
-                
-                AWSCognitoIdentityProviderInitiateAuthResponse *response = task.result;
-                AWSCognitoIdentityProviderAuthenticationResultType *authResult = response.authenticationResult;
-                /** Check to see if refreshToken is received in the response.
-                 If not, load it from the keychain.
-                 */
-                NSString * refreshToken = authResult.refreshToken;
-                if (refreshToken == nil){
-                    NSString * keyChainNamespace = [self keyChainNamespaceClientId];
-                    refreshToken = [self refreshTokenFromKeyChain:keyChainNamespace];
-                }
-                AWSCognitoIdentityUserSession * session = [[AWSCognitoIdentityUserSession alloc] initWithIdToken: authResult.idToken accessToken:authResult.accessToken refreshToken:refreshToken expiresIn:authResult.expiresIn];
-                [self updateUsernameAndPersistTokens:session];
-                return [AWSTask taskWithResult:session];
+                return task;
             }];
         }
     }
     return [self setConfirmationStatus: [self interactiveAuth]];
 }
 
+/**
+ Returns the session for this user, decoding it from the keychain only when it is not cached on the pool.
+ A session is returned whenever a token expiration is stored, even if it only carries a refresh token.
+
+ Other pool instances, AWSCognitoAuth and app extensions write the same keychain items, so a cached session is only
+ returned while its access token is still the one stored in the keychain.
+ */
+- (AWSCognitoIdentityUserSession *) cachedSession:(NSString *) keyChainNamespace {
+    NSString * accessTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserAccessToken];
+    @synchronized (self.pool.sessions) {
+        AWSCognitoIdentityUserSession * session = self.pool.sessions[keyChainNamespace];
+        if(session){
+            NSString * storedAccessToken = self.pool.keychain[accessTokenKey];
+            NSString * cachedAccessToken = session.accessToken.tokenString;
+            if(storedAccessToken == cachedAccessToken || [storedAccessToken isEqualToString:cachedAccessToken]){
+                return session;
+            }
+            [self.pool.sessions removeObjectForKey:keyChainNamespace];
+        }
+
+        NSString * expirationTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserTokenExpiration];
+        NSString * idTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserIdToken];
+        NSString * refreshTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserRefreshToken];
+        NSDictionary<NSString *, NSString *> * tokens = [self.pool.keychain stringsForKeys:@[expirationTokenKey, idTokenKey, accessTokenKey, refreshTokenKey]];
+
+        NSString * expirationDate = tokens[expirationTokenKey];
+        if(!expirationDate){
+            return nil;
+        }
+        session = [[AWSCognitoIdentityUserSession alloc] initWithIdToken:tokens[idTokenKey]
+                                                             accessToken:tokens[accessTokenKey]
+                                                            refreshToken:tokens[refreshTokenKey]
+                                                          expirationTime:[NSDate aws_dateFromString:expirationDate format:AWSDateISO8601DateFormat1]];
+        self.pool.sessions[keyChainNamespace] = session;
+        return session;
+    }
+}
+
+/**
+ Refreshes the session with `REFRESH_TOKEN_AUTH`. Concurrent callers for the same user share one in-flight request.
+ */
+- (AWSTask<AWSCognitoIdentityUserSession*>*) refreshSession:(AWSCognitoIdentityUserSession *) session
+                                          keyChainNamespace:(NSString *) keyChainNamespace {
+    AWSTaskCompletionSource<AWSCognitoIdentityUserSession *> * refreshSource = nil;
+    AWSTask<AWSCognitoIdentityUserSession *> * refreshTask = nil;
+    @synchronized (self.pool.sessions) {
+        refreshTask = self.pool.sessionRefreshTasks[keyChainNamespace];
+        if(!refreshTask){
+            refreshSource = [AWSTaskCompletionSource taskCompletionSource];
+            refreshTask = refreshSource.task;
+            self.pool.sessionRefreshTasks[keyChainNamespace] = refreshTask;
+        }
+    }
+    if(!refreshSource){
+        return refreshTask;
+    }
+
+    [[self refreshSessionWithRefreshToken:session.refreshToken.tokenString] continueWithBlock:^id _Nullable(AWSTask<AWSCognitoIdentityUserSession *> * _Nonnull task) {
+        @synchronized (self.pool.sessions) {
+            [self.pool.sessionRefreshTasks removeObjectForKey:keyChainNamespace];
+        }
+        if(task.error){
+            AWSDDLogDebug(@"Unable to refresh the session: %@", task.error);
+            [refreshSource setError:task.error];
+        } else if(task.isCancelled){
+            [refreshSource cancel];
+        } else {
+            [refreshSource setResult:task.result];
+        }
+        return nil;
+    }];
+    return refreshTask;
+}
+
+- (AWSTask<AWSCognitoIdentityUserSession*>*) refreshSessionWithRefreshToken:(NSString *) refreshToken {
+    AWSCognitoIdentityProviderInitiateAuthRequest * request = [AWSCognitoIdentityProviderInitiateAuthRequest new];
+    request.authFlow = AWSCognitoIdentityProviderAuthFlowTypeRefreshTokenAuth;
+    request.clientId = self.pool.userPoolConfiguration.clientId;
+    request.analyticsMetadata = [self.pool analyticsMetadata];
+    request.userContextData = [self.pool userContextData:self.username deviceId: [self asfDeviceId]];
+    
+    NSMutableDictionary * authParameters = [[NSMutableDictionary alloc] initWithDictionary:@{@"REFRESH_TOKEN" : refreshToken}];
+    
+    //refresh token secret hash is actually client secret for this api, set it if it is supplied
+    if(self.pool.userPoolConfiguration.clientSecret != nil){
+        [authParameters setObject:self.pool.userPoolConfiguration.clientSecret forKey:@"SECRET_HASH"];
+    }
+    
+    [self addDeviceKey:authParameters];
+    
+    request.authParameters = authParameters;
+    return [[self.pool.client initiateAuth:request] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCognitoIdentityProviderInitiateAuthResponse *> * _Nonnull task) {
+        AWSCognitoIdentityProviderInitiateAuthResponse *response = task.result;
+        AWSCognitoIdentityProviderAuthenticationResultType *authResult = response.authenticationResult;
+        /** Check to see if refreshToken is received in the response.
+         If not, keep using the current one.
+         */
+        AWSCognitoIdentityUserSession * session = [[AWSCognitoIdentityUserSession alloc] initWithIdToken:authResult.idToken
+                                                                                              accessToken:authResult.accessToken
+                                                                                             refreshToken:authResult.refreshToken ?: refreshToken
+                                                                                                expiresIn:authResult.expiresIn];
+        [self updateUsernameAndPersistTokens:session];
+        return [AWSTask taskWithResult:session];
+    }];
+}
+
 - (AWSTask<AWSCognitoIdentityUserSession*>*) getSession:(NSString *) username
                                                password:(NSString *) password
                                          validationData:(NSArray<AWSCognitoIdentityUserAttributeType*>*) validationData
@@ -448,6 +503,8 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 
 - (AWSTask<AWSCognitoIdentityUserSession*>*) startPasswordAuthenticationUI:(AWSCognitoIdentityProviderRespondToAuthChallengeResponse*) lastChallenge {
     if([self.pool.delegate respondsToSelector:@selector(startPasswordAuthentication)]){
+        // Get the SRP key pair ready while the user types their password.
+        [AWSCognitoIdentityProviderSrpHelper precomputeEphemeralKey];
         id<AWSCognitoIdentityPasswordAuthentication> authenticationDelegate = [self.pool.delegate startPasswordAuthentication];
         return [self passwordAuthInternal:authenticationDelegate lastChallenge:lastChallenge isInitialCustomChallenge:lastChallenge == nil];
     }else {
@@ -962,6 +1019,10 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
                                                                           lastChallenge:(AWSCognitoIdentityProviderRespondToAuthChallengeResponse*) lastChallenge isInitialCustomChallenge:(BOOL) isInitialCustomChallenge {
     self.username = username;
     AWSCognitoIdentityProviderSrpHelper *srpHelper = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:self.username password:password];
+    if([self getDeviceCredentials]){
+        // Device SRP follows, compute its key pair while this round trip is in flight.
+        [AWSCognitoIdentityProviderSrpHelper precomputeEphemeralKey];
+    }
     NSMutableDictionary * challengeResponses = [[NSMutableDictionary alloc] initWithDictionary:@{@"SRP_A" : [srpHelper.clientState.publicA stringValueWithRadix:16]}];
     [self addSecretHashDeviceKeyAndUsername:challengeResponses];
     
@@ -1450,12 +1511,15 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 
 -(void) signOut {
     if(self.username){
-        NSArray *keys = self.pool.keychain.allKeys;
-        NSString *keyChainPrefix = [[self keyChainNamespaceClientId] stringByAppendingString:@"."];
-        for (NSString *key in keys) {
-            //clear tokens associated with this user
-            if([key hasPrefix:keyChainPrefix]){
-                [self.pool.keychain removeItemForKey:key];
+        @synchronized (self.pool.sessions) {
+            [self.pool.sessions removeObjectForKey:[self keyChainNamespaceClientId]];
+            NSArray *keys = self.pool.keychain.allKeys;
+            NSString *keyChainPrefix = [[self keyChainNamespaceClientId] stringByAppendingString:@"."];
+            for (NSString *key in keys) {
+                //clear tokens associated with this user
+                if([key hasPrefix:keyChainPrefix]){
+                    [self.pool.keychain removeItemForKey:key];
+                }
             }
         }
     }
@@ -1471,8 +1535,11 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
         NSString * keyChainNamespace = [self keyChainNamespaceClientId];
         NSString * idTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserIdToken];
         NSString * accessTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserAccessToken];
-        [self.pool.keychain removeItemForKey:idTokenKey];
-        [self.pool.keychain removeItemForKey:accessTokenKey];
+        @synchronized (self.pool.sessions) {
+            [self.pool.sessions removeObjectForKey:keyChainNamespace];
+            [self.pool.keychain setStrings:@{idTokenKey: [NSNull null],
+                                             accessTokenKey: [NSNull null]}];
+        }
     }
 }
 
@@ -1616,21 +1683,31 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 - (void) updateUsernameAndPersistTokens: (AWSCognitoIdentityUserSession *) session {
     [self.pool setCurrentUser:self.username];
     NSString * keyChainNamespace = [self keyChainNamespaceClientId];
+    NSMutableDictionary<NSString *, NSString *> * tokens = [NSMutableDictionary new];
     if(session.idToken){
         NSString * idTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserIdToken];
-        self.pool.keychain[idTokenKey] = session.idToken.tokenString;
+        tokens[idTokenKey] = session.idToken.tokenString;
     }
     if(session.accessToken){
         NSString * accessTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserAccessToken];
-        self.pool.keychain[accessTokenKey] = session.accessToken.tokenString;
+        tokens[accessTokenKey] = session.accessToken.tokenString;
     }
     if(session.refreshToken){
         NSString * refreshTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserRefreshToken];
-        self.pool.keychain[refreshTokenKey] = session.refreshToken.tokenString;
+        tokens[refreshTokenKey] = session.refreshToken.tokenString;
     }
     if(session.expirationTime){
         NSString * expirationTokenKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserTokenExpiration];
-        self.pool.keychain[expirationTokenKey] = [session.expirationTime aws_stringValue:AWSDateISO8601DateFormat1];
+        tokens[expirationTokenKey] = [session.expirationTime aws_stringValue:AWSDateISO8601DateFormat1];
+    }
+    @synchronized (self.pool.sessions) {
+        [self.pool.keychain setStrings:tokens];
+        // A partial session leaves older tokens in the keychain, so only a complete one can be cached as is.
+        if(session.idToken && session.accessToken && session.refreshToken && session.expirationTime){
+            self.pool.sessions[keyChainNamespace] = session;
+        } else {
+            [self.pool.sessions removeObjectForKey:keyChainNamespace];
+        }
     }
 }
 
@@ -1654,11 +1731,11 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 - (void) forgetDeviceInternal {
     NSString * keyChainNamespace = [self keyChainNamespacePoolId];
     NSString * deviceIdKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserDeviceId];
-    self.pool.keychain[deviceIdKey] = nil;
     NSString * deviceSecretKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserDeviceSecret];
-    self.pool.keychain[deviceSecretKey] = nil;
     NSString * deviceGroupKey = [self keyChainKey:keyChainNamespace key:AWSCognitoIdentityUserDeviceGroup];
-    self.pool.keychain[deviceGroupKey] = nil;
+    [self.pool.keychain setStrings:@{deviceIdKey: [NSNull null],
+                                     deviceSecretKey: [NSNull null],
+                                     deviceGroupKey: [NSNull null]}];
 }
 
 - (AWSCognitoIdentityUserDeviceCredentials *) getDeviceCredentials {
@@ -1734,7 +1811,9 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
 }
 @end
 
-@implementation AWSCognitoIdentityUserSessionToken
+@implementation AWSCognitoIdentityUserSessionToken {
+    NSDictionary<NSString *, id> *_tokenClaims;
+}
 
 -(instancetype) initWithToken:(NSString *)token {
     if(token == nil){
@@ -1751,7 +1830,26 @@ static const NSString * AWSCognitoIdentityUserUserAttributePrefix = @"userAttrib
     return [self tokenClaims];
 }
 
+-(void) setTokenString:(NSString *)tokenString {
+    @synchronized (self) {
+        _tokenString = tokenString;
+        _tokenClaims = nil;
+    }
+}
+
+/**
+ The claims are decoded once per token; the token string never changes after the session is created.
+ */
 -(NSDictionary<NSString *, id> *) tokenClaims {
+    @synchronized (self) {
+        if (_tokenClaims == nil) {
+            _tokenClaims = [self decodeTokenClaims] ?: @{};
+        }
+        return _tokenClaims;
+    }
+}
+
+-(NSDictionary<NSString *, id> *) decodeTokenClaims {
     NSDictionary * result = @{};
     NSArray *pieces = [self.tokenString componentsSeparatedByString:@"."];
     if(pieces.count > 2){
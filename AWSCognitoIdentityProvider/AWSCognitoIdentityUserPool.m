@@ -172,6 +172,8 @@ static NSString *const AWSPinpointContextKeychainUniqueIdKey = @"com.amazonaws.A
 
         _keychain = [AWSUICKeyChainStore keyChainStoreWithService:[NSString stringWithFormat:@"%@.%@", [NSBundle mainBundle].bundleIdentifier, [AWSCognitoIdentityUserPool class]]];
         [_keychain migrateToCurrentAccessibility];
+        _sessions = [NSMutableDictionary new];
+        _sessionRefreshTasks = [NSMutableDictionary new];
         
         //If Pinpoint is setup, get the endpoint or create one.
         if(userPoolConfiguration.pinpointAppId) {
@@ -283,6 +285,9 @@ static NSString *const AWSPinpointContextKeychainUniqueIdKey = @"com.amazonaws.A
 }
 
 - (void) clearAll {
+    @synchronized (self.sessions) {
+        [self.sessions removeAllObjects];
+    }
     NSArray *keys = self.keychain.allKeys;
     NSString *keyChainPrefix = [NSString stringWithFormat:@"%@.", self.userPoolConfiguration.clientId];
     for (NSString *key in keys) {
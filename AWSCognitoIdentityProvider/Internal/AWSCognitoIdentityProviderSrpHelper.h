@@ -18,6 +18,27 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g k:(AWSJKBigInteger *)k;
 - (AWSJKBigInteger*)calculateK:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g;
 
+/**
+ The shared 3072-bit group state. Its Montgomery context for N and fixed-base table for g are built once per process.
+ */
++ (instancetype)defaultCommonState;
+
+/**
+ Returns g^exponent mod N, using the fixed-base table when one has been built.
+ */
+- (AWSJKBigInteger *)gPow:(AWSJKBigInteger *)exponent;
+
+/**
+ Returns base^exponent mod N, reusing the Montgomery context when one has been built.
+ */
+- (AWSJKBigInteger *)pow:(AWSJKBigInteger *)base exponent:(AWSJKBigInteger *)exponent;
+
+/**
+ When `YES`, `gPow:` and `pow:exponent:` run in time independent of the exponent's bits: a masked comb table scan for
+ g and a Montgomery ladder of fixed length for other bases. `YES` for `defaultCommonState`.
+ */
+@property(atomic, assign) BOOL usesConstantTimeExponentiation;
+
 @property(nonatomic, retain) AWSJKBigInteger *N;
 @property(nonatomic, retain) AWSJKBigInteger *g;
 @property(nonatomic, retain) AWSJKBigInteger *k;
@@ -79,6 +100,12 @@ NS_ASSUME_NONNULL_BEGIN
 + (instancetype)beginUserAuthentication:(NSString*)userName
                            password:(NSString*)password;
 
+/**
+ Computes an ephemeral (a, A) pair in the background so the next call to `beginUserAuthentication:password:` does not
+ have to. Each precomputed pair is handed out once.
+ */
++ (void)precomputeEphemeralKey;
+
 - (instancetype)init:(NSString *)userName password:(NSString *)password;
 - (instancetype)initWithClientState:(AWSCognitoIdentityProviderSrpClientState *)clientState;
 - (instancetype)initWithPoolName:(NSString *)poolName userName:(NSString *)userName password:(NSString *)password;
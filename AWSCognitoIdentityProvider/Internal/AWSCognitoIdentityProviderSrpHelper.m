@@ -23,8 +23,93 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx);
 
 static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
 
+// The fixed-base table covers exponents up to 256 bits, which is the size of both a and x.
+static const int AWSCognitoIdentityProviderSrpCombBits = 256;
+static const int AWSCognitoIdentityProviderSrpCombTeeth = 6;
+// The exponent of S is a + u * x, at most 513 bits. The ladder always runs this many steps.
+static const int AWSCognitoIdentityProviderSrpLadderBits = 2 * AWSCognitoIdentityProviderSrpCombBits + 1;
+
+static AWSJKBigInteger *AWSCognitoIdentityProviderSrpPrecomputedPrivateA = nil;
+static AWSJKBigInteger *AWSCognitoIdentityProviderSrpPrecomputedPublicA = nil;
+
 #pragma mark - Srp State
-@implementation AWSCognitoIdentityProviderSrpCommonState
+@implementation AWSCognitoIdentityProviderSrpCommonState {
+    aws_mp_mont_ctx _montgomeryContext;
+    aws_mp_comb _gComb;
+    BOOL _hasMontgomeryContext;
+    BOOL _hasGComb;
+}
+
++ (instancetype)defaultCommonState {
+    static AWSCognitoIdentityProviderSrpCommonState *_defaultCommonState = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _defaultCommonState = [AWSCognitoIdentityProviderSrpCommonState new];
+        _defaultCommonState.usesConstantTimeExponentiation = YES;
+        [_defaultCommonState precompute];
+    });
+    return _defaultCommonState;
+}
+
+- (void)precompute {
+    if (aws_mp_mont_ctx_init(&_montgomeryContext, self.N.value) != AWS_MP_OKAY) {
+        AWSDDLogError(@"Unable to set up the Montgomery context for N.");
+        return;
+    }
+    _hasMontgomeryContext = YES;
+
+    if (aws_mp_comb_init(&_gComb, self.g.value, &_montgomeryContext, AWSCognitoIdentityProviderSrpCombBits, AWSCognitoIdentityProviderSrpCombTeeth) != AWS_MP_OKAY) {
+        AWSDDLogError(@"Unable to build the fixed-base table for g.");
+        return;
+    }
+    _hasGComb = YES;
+}
+
+- (void)dealloc {
+    if (_hasGComb) {
+        aws_mp_comb_clear(&_gComb);
+    }
+    if (_hasMontgomeryContext) {
+        aws_mp_mont_ctx_clear(&_montgomeryContext);
+    }
+}
+
+- (AWSJKBigInteger *)gPow:(AWSJKBigInteger *)exponent {
+    if (!_hasGComb || exponent.value->sign == AWS_MP_NEG) {
+        return [self.g pow:exponent andMod:self.N];
+    }
+
+    aws_mp_int output;
+    aws_mp_init(&output);
+    AWSJKBigInteger *result = nil;
+    int err = (self.usesConstantTimeExponentiation && _gComb.digits != NULL)
+        ? aws_mp_exptmod_comb_ct(&_gComb, exponent.value, &output)
+        : aws_mp_exptmod_comb(&_gComb, exponent.value, &output);
+    if (err == AWS_MP_OKAY) {
+        result = [[AWSJKBigInteger alloc] initWithValue:&output];
+    }
+    aws_mp_clear(&output);
+    return result;
+}
+
+- (AWSJKBigInteger *)pow:(AWSJKBigInteger *)base exponent:(AWSJKBigInteger *)exponent {
+    if (!_hasMontgomeryContext || exponent.value->sign == AWS_MP_NEG) {
+        return [base pow:exponent andMod:self.N];
+    }
+
+    aws_mp_int output;
+    aws_mp_init(&output);
+    AWSJKBigInteger *result = nil;
+    int err = (self.usesConstantTimeExponentiation && _montgomeryContext.N.used == AWS_MP_3072_DIGITS)
+        ? aws_mp_exptmod_ladder(base.value, exponent.value, &_montgomeryContext, AWSCognitoIdentityProviderSrpLadderBits, &output)
+        : aws_mp_exptmod_mont(base.value, exponent.value, &_montgomeryContext, &output);
+    if (err == AWS_MP_OKAY) {
+        result = [[AWSJKBigInteger alloc] initWithValue:&output];
+    }
+    aws_mp_clear(&output);
+    return result;
+}
+
 - (instancetype)init {
     if (self = [super init]) {
             self.N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
@@ -90,10 +175,7 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     me.privateA = [AWSCognitoIdentityProviderSrpHelper
             generatePrivateABigInt:commonState.N];
 
-    me.publicA = [AWSCognitoIdentityProviderSrpHelper
-            generatePublicABigInt:me.privateA
-                                N:commonState.N
-                                g:commonState.g];
+    me.publicA = [commonState gPow:me.privateA];
 
     me.timestamp = [NSDate date];
     return me;
@@ -150,14 +232,61 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
             ];
 }
 
++ (dispatch_queue_t)ephemeralKeyQueue {
+    static dispatch_queue_t _ephemeralKeyQueue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0);
+        _ephemeralKeyQueue = dispatch_queue_create("com.amazonaws.AWSCognitoIdentityProviderSrpHelper.ephemeralKey", attributes);
+    });
+    return _ephemeralKeyQueue;
+}
+
++ (void)precomputeEphemeralKey {
+    dispatch_async([self ephemeralKeyQueue], ^{
+        if (AWSCognitoIdentityProviderSrpPrecomputedPrivateA == nil) {
+            AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+            AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+            AWSCognitoIdentityProviderSrpPrecomputedPublicA = [commonState gPow:privateA];
+            AWSCognitoIdentityProviderSrpPrecomputedPrivateA = privateA;
+        }
+    });
+}
+
+/**
+ Hands out the precomputed pair if there is one, waiting for a precomputation already in progress, and computes a new
+ pair otherwise.
+ */
++ (void)takeEphemeralKey:(AWSCognitoIdentityProviderSrpCommonState *)commonState
+                privateA:(AWSJKBigInteger * __autoreleasing *)privateA
+                 publicA:(AWSJKBigInteger * __autoreleasing *)publicA {
+    __block AWSJKBigInteger *precomputedPrivateA = nil;
+    __block AWSJKBigInteger *precomputedPublicA = nil;
+    dispatch_sync([self ephemeralKeyQueue], ^{
+        precomputedPrivateA = AWSCognitoIdentityProviderSrpPrecomputedPrivateA;
+        precomputedPublicA = AWSCognitoIdentityProviderSrpPrecomputedPublicA;
+        AWSCognitoIdentityProviderSrpPrecomputedPrivateA = nil;
+        AWSCognitoIdentityProviderSrpPrecomputedPublicA = nil;
+    });
+
+    if (precomputedPrivateA && precomputedPublicA) {
+        *privateA = precomputedPrivateA;
+        *publicA = precomputedPublicA;
+    } else {
+        *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+        *publicA = [commonState gPow:*privateA];
+    }
+}
+
 #pragma mark - Initializers
 - (instancetype) init:(NSString*)userName
              password:(NSString*)password  {
     if (self = [super init]) {
-        self.commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
+        self.commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
 
-        AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:self.commonState.N];
-        AWSJKBigInteger *publicA = [AWSCognitoIdentityProviderSrpHelper generatePublicABigInt:privateA N:self.commonState.N g:self.commonState.g];
+        AWSJKBigInteger *privateA = nil;
+        AWSJKBigInteger *publicA = nil;
+        [AWSCognitoIdentityProviderSrpHelper takeEphemeralKey:self.commonState privateA:&privateA publicA:&publicA];
 
         self.clientState = [AWSCognitoIdentityProviderSrpClientState
                 clientStateForUserName:userName password:password privateA:privateA publicA:publicA];
@@ -167,7 +296,7 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 
 - (instancetype)initWithClientState:(AWSCognitoIdentityProviderSrpClientState *)clientState {
     if (self = [super init]) {
-        self.commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
+        self.commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
         self.clientState = clientState;
     }
     return self;
@@ -183,12 +312,8 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
                               password:password
                               salt:self.salt];
 
-        AWSJKBigInteger *N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
-                                       andRadix:16];
-        AWSJKBigInteger *g = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
-        
         //calculate v
-        self.v = [g pow:x andMod:N];
+        self.v = [[AWSCognitoIdentityProviderSrpCommonState defaultCommonState] gPow:x];
     }
     return self;
 }
@@ -270,17 +395,16 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     self.u = [AWSCognitoIdentityProviderSrpHelper hashBigInts:@[self.clientState.publicA, B]];
 
     AWSJKBigInteger *k = self.commonState.k;
-    AWSJKBigInteger *g = self.commonState.g;
     AWSJKBigInteger *N = self.commonState.N;
 
     AWSJKBigInteger *a = self.clientState.privateA;
     AWSJKBigInteger *exp = [a add:[self.u multiply:self.x]];
-    AWSJKBigInteger *base = [B subtract:[k multiply:[g pow:self.x andMod:N]]];
+    AWSJKBigInteger *base = [B subtract:[k multiply:[self.commonState gPow:self.x]]];
 
     //Need this for negative base #s
     base = [AWSCognitoIdentityProviderSrpHelper mod:base divisor:N];
 
-    AWSJKBigInteger *S = [base pow:exp andMod:N];
+    AWSJKBigInteger *S = [self.commonState pow:base exponent:exp];
     S = [AWSCognitoIdentityProviderSrpHelper mod:S divisor:N];
     
     return S;
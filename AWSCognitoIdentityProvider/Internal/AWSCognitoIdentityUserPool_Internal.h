@@ -9,9 +9,18 @@
 #import "AWSCognitoIdentityUserPool.h"
 
 @class AWSUICKeyChainStore;
+@class AWSCognitoIdentityUserSession;
 
 @interface AWSCognitoIdentityUserPool()
 @property (nonatomic, strong) AWSUICKeyChainStore * _Nonnull keychain;
+/**
+ Decoded sessions keyed by the user's client id keychain namespace. Guarded by `@synchronized` on the dictionary.
+ */
+@property (nonatomic, readonly) NSMutableDictionary<NSString *, AWSCognitoIdentityUserSession *> * _Nonnull sessions;
+/**
+ In-flight `REFRESH_TOKEN_AUTH` requests keyed like `sessions`. Guarded by `@synchronized` on `sessions`.
+ */
+@property (nonatomic, readonly) NSMutableDictionary<NSString *, AWSTask<AWSCognitoIdentityUserSession *> *> * _Nonnull sessionRefreshTasks;
 @property (nonatomic, readonly) AWSCognitoIdentityProviderAnalyticsMetadataType * _Nullable analyticsMetadata;
 
 - (NSString * _Nullable) calculateSecretHash: (NSString* _Nonnull) userName;
@@ -45,8 +45,10 @@ extern "C" {
 #endif
 
 
-/* detect 64-bit mode if possible */
-#if defined(__x86_64__) 
+/* detect 64-bit mode if possible, any LP64 target with a 128-bit integer type
+ * [x86_64, arm64] gets 60-bit digits
+ */
+#if defined(__x86_64__) || (defined(__LP64__) && defined(__SIZEOF_INT128__) && (defined(__aarch64__) || defined(__arm64__)))
    #if !(defined(AWS_MP_64BIT) && defined(AWS_MP_16BIT) && defined(AWS_MP_8BIT))
       #define AWS_MP_64BIT
    #endif
@@ -74,7 +76,11 @@ extern "C" {
 #endif
 
    typedef unsigned long      aws_mp_digit;
+#ifdef __SIZEOF_INT128__
+   typedef unsigned __int128  aws_mp_word;
+#else
    typedef unsigned long      aws_mp_word __attribute__ ((mode(TI)));
+#endif
 
    #define AWS_DIGIT_BIT          60
 #else
@@ -128,6 +134,9 @@ extern "C" {
 #endif
 
 #define AWS_MP_DIGIT_BIT     AWS_DIGIT_BIT
+
+/* digits in a 3072-bit operand, the size of the fixed-size kernels */
+#define AWS_MP_3072_DIGITS   ((3072 + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT)
 #define AWS_MP_MASK          ((((aws_mp_digit)1)<<((aws_mp_digit)AWS_DIGIT_BIT))-((aws_mp_digit)1))
 #define AWS_MP_DIGIT_MAX     AWS_MP_MASK
 
@@ -443,6 +452,59 @@ int aws_mp_reduce_2k_l(aws_mp_int *a, aws_mp_int *n, aws_mp_int *d);
 /* d = a**b (mod c) */
 int aws_mp_exptmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
 
+/* ---> Fixed modulus and fixed base exponentiation <--- */
+
+/* Montgomery constants precomputed once for a fixed odd modulus */
+typedef struct {
+   aws_mp_int   N,       /* the modulus */
+                R,       /* R mod N, one in Montgomery form */
+                RR;      /* R**2 mod N */
+   aws_mp_digit rho;     /* -1/N mod 2**AWS_DIGIT_BIT */
+   int        (*redux)(aws_mp_int *, aws_mp_int *, aws_mp_digit);
+} aws_mp_mont_ctx;
+
+/* sets up ctx for the odd modulus N */
+int aws_mp_mont_ctx_init(aws_mp_mont_ctx *ctx, aws_mp_int *N);
+void aws_mp_mont_ctx_clear(aws_mp_mont_ctx *ctx);
+
+/* c = a*b/R (mod N) and b = a*a/R (mod N) for a, b in Montgomery form */
+int aws_mp_mont_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_mont_ctx *ctx);
+int aws_mp_mont_sqr(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx);
+
+/* converts into [b = a*R mod N] and out of [b = a/R mod N] Montgomery form */
+int aws_mp_to_mont(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx);
+int aws_mp_from_mont(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx);
+
+/* Y = G**X (mod N) for X >= 0 */
+int aws_mp_exptmod_mont(aws_mp_int *G, aws_mp_int *X, aws_mp_mont_ctx *ctx, aws_mp_int *Y);
+
+/* fixed-base comb table for G**X (mod N) with X of at most "bits" bits */
+typedef struct {
+   aws_mp_mont_ctx *ctx;
+   int              teeth, spacing, bits;
+   aws_mp_int      *table;   /* 2**teeth entries in Montgomery form */
+   aws_mp_digit    *digits;  /* the table as zero padded 3072-bit digit arrays, or NULL */
+} aws_mp_comb;
+
+/* builds the comb table for G, ctx must outlive the table */
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *G, aws_mp_mont_ctx *ctx, int bits, int teeth);
+void aws_mp_comb_clear(aws_mp_comb *comb);
+
+/* Y = G**X (mod N) for X >= 0 */
+int aws_mp_exptmod_comb(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y);
+
+/* ---> Constant time 3072-bit exponentiation <--- */
+
+/* Y = G**X (mod N) with a Montgomery ladder of max(bits, bits in X) steps,
+ * N must have exactly AWS_MP_3072_DIGITS digits
+ */
+int aws_mp_exptmod_ladder(aws_mp_int *G, aws_mp_int *X, aws_mp_mont_ctx *ctx, int bits, aws_mp_int *Y);
+
+/* Y = G**X (mod N) using the comb table with masked table scans,
+ * comb->digits must be set [N of exactly AWS_MP_3072_DIGITS digits]
+ */
+int aws_mp_exptmod_comb_ct(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y);
+
 /* ---> Primes <--- */
 
 /* number of primes */
@@ -559,6 +621,11 @@ int aws_fast_s_mp_mul_high_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int
 int aws_s_mp_mul_high_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs);
 int aws_fast_s_mp_sqr(aws_mp_int *a, aws_mp_int *b);
 int aws_s_mp_sqr(aws_mp_int *a, aws_mp_int *b);
+int aws_s_mp_mul_3072(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
+int aws_s_mp_sqr_3072(aws_mp_int *a, aws_mp_int *b);
+void aws_s_mp_mul_comba_3072(const aws_mp_digit *A, const aws_mp_digit *B, aws_mp_digit *C);
+void aws_s_mp_sqr_comba_3072(const aws_mp_digit *A, aws_mp_digit *C);
+void aws_s_mp_mont_reduce_3072(const aws_mp_digit *T, const aws_mp_digit *N, aws_mp_digit rho, aws_mp_digit *out);
 int aws_mp_karatsuba_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_toom_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_karatsuba_sqr(aws_mp_int *a, aws_mp_int *b);
@@ -40,7 +40,10 @@
 #define AWS_BN_MP_EXCH_C
 #define AWS_BN_MP_EXPT_D_C
 #define AWS_BN_MP_EXPTMOD_C
+#define AWS_BN_MP_EXPTMOD_COMB_C
 #define AWS_BN_MP_EXPTMOD_FAST_C
+#define AWS_BN_MP_EXPTMOD_LADDER_C
+#define AWS_BN_MP_EXPTMOD_MONT_C
 #define AWS_BN_MP_EXTEUCLID_C
 #define AWS_BN_MP_FREAD_C
 #define AWS_BN_MP_FWRITE_C
@@ -67,6 +70,7 @@
 #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
 #define AWS_BN_MP_MONTGOMERY_REDUCE_C
 #define AWS_BN_MP_MONTGOMERY_SETUP_C
+#define AWS_BN_MP_MONT_CTX_C
 #define AWS_BN_MP_MUL_C
 #define AWS_BN_MP_MUL_2_C
 #define AWS_BN_MP_MUL_2D_C
@@ -121,6 +125,7 @@
 #define AWS_BN_PRIME_TAB_C
 #define AWS_BN_REVERSE_C
 #define AWS_BN_S_MP_ADD_C
+#define AWS_BN_S_MP_COMBA_3072_C
 #define AWS_BN_S_MP_EXPTMOD_C
 #define AWS_BN_S_MP_MUL_DIGS_C
 #define AWS_BN_S_MP_MUL_HIGH_DIGS_C
@@ -337,6 +342,16 @@
    #define AWS_BN_MP_EXPTMOD_FAST_C
 #endif
 
+#if defined(AWS_BN_MP_EXPTMOD_COMB_C)
+   #define AWS_BN_MP_MONT_CTX_C
+   #define AWS_BN_MP_EXPTMOD_MONT_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
 #if defined(AWS_BN_MP_EXPTMOD_FAST_C)
    #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_INIT_C
@@ -358,6 +373,24 @@
    #define AWS_BN_MP_EXCH_C
 #endif
 
+#if defined(AWS_BN_MP_EXPTMOD_LADDER_C)
+   #define AWS_BN_S_MP_COMBA_3072_C
+   #define AWS_BN_MP_MONT_CTX_C
+   #define AWS_BN_MP_EXPTMOD_COMB_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_MONT_C)
+   #define AWS_BN_MP_MONT_CTX_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
 #if defined(AWS_BN_MP_EXTEUCLID_C)
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_SET_C
@@ -548,6 +581,21 @@
    #define AWS_BN_S_MP_SUB_C
 #endif
 
+#if defined(AWS_BN_MP_MONT_CTX_C)
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_MONTGOMERY_SETUP_C
+   #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+   #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_MULMOD_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_CMP_MAG_C
+#endif
+
 #if defined(AWS_BN_MP_MONTGOMERY_SETUP_C)
 #endif
 
@@ -938,6 +986,11 @@
    #define AWS_BN_MP_CLAMP_C
 #endif
 
+#if defined(AWS_BN_S_MP_COMBA_3072_C)
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+#endif
+
 #if defined(AWS_BN_S_MP_EXPTMOD_C)
    #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_INIT_C
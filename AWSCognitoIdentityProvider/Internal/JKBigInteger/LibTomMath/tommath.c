@@ -3298,6 +3298,13 @@ aws_mp_sqr(aws_mp_int *a, aws_mp_int *b)
 {
   int     res;
 
+#ifdef AWS_BN_S_MP_COMBA_3072_C
+  /* 3072-bit operand? */
+  if (a->used <= AWS_MP_3072_DIGITS &&
+      a->used > AWS_MP_3072_DIGITS - AWS_MP_3072_DIGITS / 8) {
+    res = aws_s_mp_sqr_3072(a, b);
+  } else
+#endif
 #ifdef AWS_BN_MP_TOOM_SQR_C
   /* use Toom-Cook? */
   if (a->used >= AWS_TOOM_SQR_CUTOFF) {
@@ -4592,6 +4599,817 @@ aws_mp_clear(&M[1]);
 }
 #endif
 
+#ifdef AWS_BN_MP_MONT_CTX_C
+
+/* Precomputes the Montgomery constants for a fixed odd modulus so repeated
+ * exponentiations with the same modulus skip the setup and the normalization
+ * (which costs one shift and compare per bit of the modulus).
+ */
+int aws_mp_mont_ctx_init(aws_mp_mont_ctx *ctx, aws_mp_int *N)
+{
+  int err;
+
+  if (N->sign == AWS_MP_NEG || aws_mp_isodd(N) == AWS_MP_NO) {
+     return AWS_MP_VAL;
+  }
+
+  if ((err = aws_mp_init_multi(&ctx->N, &ctx->R, &ctx->RR, NULL)) != AWS_MP_OKAY) {
+     return err;
+  }
+
+  if ((err = aws_mp_copy(N, &ctx->N)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_montgomery_setup(N, &ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* R mod N is the Montgomery form of one */
+  if ((err = aws_mp_montgomery_calc_normalization(&ctx->R, N)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* R**2 mod N converts into Montgomery form with a single multiply and reduce */
+  if ((err = aws_mp_mulmod(&ctx->R, &ctx->R, N, &ctx->RR)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* automatically pick the comba one if available [see aws_mp_exptmod_fast] */
+#ifdef AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+  if (((N->used * 2 + 1) < AWS_MP_WARRAY) &&
+       N->used < (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
+     ctx->redux = aws_fast_mp_montgomery_reduce;
+  } else
+#endif
+  {
+     ctx->redux = aws_mp_montgomery_reduce;
+  }
+  return AWS_MP_OKAY;
+
+LBL_ERR:
+  aws_mp_clear_multi(&ctx->N, &ctx->R, &ctx->RR, NULL);
+  return err;
+}
+
+void aws_mp_mont_ctx_clear(aws_mp_mont_ctx *ctx)
+{
+  aws_mp_clear_multi(&ctx->N, &ctx->R, &ctx->RR, NULL);
+}
+
+/* c = a * b / R (mod N) */
+int aws_mp_mont_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_mont_ctx *ctx)
+{
+  int err;
+
+  if ((err = aws_mp_mul(a, b, c)) != AWS_MP_OKAY) {
+     return err;
+  }
+  return ctx->redux(c, &ctx->N, ctx->rho);
+}
+
+/* b = a * a / R (mod N) */
+int aws_mp_mont_sqr(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx)
+{
+  int err;
+
+  if ((err = aws_mp_sqr(a, b)) != AWS_MP_OKAY) {
+     return err;
+  }
+  return ctx->redux(b, &ctx->N, ctx->rho);
+}
+
+/* b = a * R (mod N) */
+int aws_mp_to_mont(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx)
+{
+  int err;
+
+  if (a->sign == AWS_MP_NEG || aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT) {
+     if ((err = aws_mp_mod(a, &ctx->N, b)) != AWS_MP_OKAY) {
+        return err;
+     }
+     a = b;
+  }
+  return aws_mp_mont_mul(a, &ctx->RR, b, ctx);
+}
+
+/* b = a / R (mod N) */
+int aws_mp_from_mont(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx)
+{
+  int err;
+
+  if ((err = aws_mp_copy(a, b)) != AWS_MP_OKAY) {
+     return err;
+  }
+  return ctx->redux(b, &ctx->N, ctx->rho);
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_MONT_C
+
+#ifndef TAB_SIZE
+#ifdef AWS_MP_LOW_MEM
+   #define TAB_SIZE 32
+#else
+   #define TAB_SIZE 256
+#endif
+#endif
+
+/* computes Y == G**X mod N with a precomputed Montgomery context.
+ *
+ * Same left-to-right k-ary sliding window as aws_mp_exptmod_fast, minus the
+ * per call reduction setup.
+ */
+int aws_mp_exptmod_mont(aws_mp_int *G, aws_mp_int *X, aws_mp_mont_ctx *ctx, aws_mp_int *Y)
+{
+  aws_mp_int M[TAB_SIZE], res;
+  aws_mp_digit buf;
+  int     err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize;
+
+  if (X->sign == AWS_MP_NEG) {
+     return AWS_MP_VAL;
+  }
+
+  /* find window size */
+  x = aws_mp_count_bits(X);
+  if (x <= 7) {
+    winsize = 2;
+  } else if (x <= 36) {
+    winsize = 3;
+  } else if (x <= 140) {
+    winsize = 4;
+  } else if (x <= 450) {
+    winsize = 5;
+  } else if (x <= 1303) {
+    winsize = 6;
+  } else if (x <= 3529) {
+    winsize = 7;
+  } else {
+    winsize = 8;
+  }
+
+#ifdef AWS_MP_LOW_MEM
+  if (winsize > 5) {
+     winsize = 5;
+  }
+#endif
+
+  /* init M[1] and the upper half of the table */
+  if ((err = aws_mp_init(&M[1])) != AWS_MP_OKAY) {
+     return err;
+  }
+  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
+    if ((err = aws_mp_init(&M[x])) != AWS_MP_OKAY) {
+      for (y = 1<<(winsize-1); y < x; y++) {
+          aws_mp_clear(&M[y]);
+      }
+        aws_mp_clear(&M[1]);
+      return err;
+    }
+  }
+
+  /* res starts as one in Montgomery form */
+  if ((err = aws_mp_init_copy(&res, &ctx->R)) != AWS_MP_OKAY) {
+    goto LBL_M;
+  }
+
+  /* M[1] = G * R mod N */
+  if ((err = aws_mp_to_mont(G, &M[1], ctx)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
+  if ((err = aws_mp_copy(&M[1], &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+  for (x = 0; x < (winsize - 1); x++) {
+    if ((err = aws_mp_mont_sqr(&M[1 << (winsize - 1)], &M[1 << (winsize - 1)], ctx)) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+  }
+
+  /* create upper table */
+  for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
+    if ((err = aws_mp_mont_mul(&M[x - 1], &M[1], &M[x], ctx)) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+  }
+
+  /* set initial mode and bit cnt */
+  mode   = 0;
+  bitcnt = 1;
+  buf    = 0;
+  digidx = X->used - 1;
+  bitcpy = 0;
+  bitbuf = 0;
+
+  for (;;) {
+    /* grab next digit as required */
+    if (--bitcnt == 0) {
+      if (digidx == -1) {
+        break;
+      }
+      buf    = X->dp[digidx--];
+      bitcnt = (int)AWS_DIGIT_BIT;
+    }
+
+    /* grab the next msb from the exponent */
+    y     = (aws_mp_digit)(buf >> (AWS_DIGIT_BIT - 1)) & 1;
+    buf <<= (aws_mp_digit)1;
+
+    /* skip the leading zero bits */
+    if (mode == 0 && y == 0) {
+      continue;
+    }
+
+    /* if the bit is zero and mode == 1 then we square */
+    if (mode == 1 && y == 0) {
+      if ((err = aws_mp_mont_sqr(&res, &res, ctx)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+      continue;
+    }
+
+    /* else we add it to the window */
+    bitbuf |= (y << (winsize - ++bitcpy));
+    mode    = 2;
+
+    if (bitcpy == winsize) {
+      /* ok window is filled so square as required and multiply  */
+      for (x = 0; x < winsize; x++) {
+        if ((err = aws_mp_mont_sqr(&res, &res, ctx)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+      }
+      if ((err = aws_mp_mont_mul(&res, &M[bitbuf], &res, ctx)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+
+      /* empty window and reset */
+      bitcpy = 0;
+      bitbuf = 0;
+      mode   = 1;
+    }
+  }
+
+  /* if bits remain then square/multiply */
+  if (mode == 2 && bitcpy > 0) {
+    for (x = 0; x < bitcpy; x++) {
+      if ((err = aws_mp_mont_sqr(&res, &res, ctx)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+
+      /* get next bit of the window */
+      bitbuf <<= 1;
+      if ((bitbuf & (1 << winsize)) != 0) {
+        if ((err = aws_mp_mont_mul(&res, &M[1], &res, ctx)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+      }
+    }
+  }
+
+  /* leave the Montgomery system */
+  if ((err = aws_mp_from_mont(&res, Y, ctx)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+  err = AWS_MP_OKAY;
+LBL_RES:
+aws_mp_clear(&res);
+LBL_M:
+aws_mp_clear(&M[1]);
+  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
+      aws_mp_clear(&M[x]);
+  }
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_COMB_C
+
+/* returns bit b of |a| */
+static int aws_s_mp_get_bit(aws_mp_int *a, int b)
+{
+  int d = b / AWS_DIGIT_BIT;
+
+  if (d >= a->used) {
+     return 0;
+  }
+  return (int)((a->dp[d] >> ((aws_mp_digit)(b % AWS_DIGIT_BIT))) & 1);
+}
+
+/* Builds a fixed-base comb table for G [HAC pp.619, Algorithm 14.113, Lim-Lee].
+ *
+ * An exponent of at most "bits" bits is read as "teeth" rows of
+ * spacing = ceil(bits/teeth) bits.  Entry j of the table holds the product
+ * of G**(2**(i*spacing)) over the bits i set in j, in Montgomery form, so an
+ * exponentiation costs "spacing" squarings and at most "spacing" multiplies.
+ */
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *G, aws_mp_mont_ctx *ctx, int bits, int teeth)
+{
+  int err, x, y, size;
+
+  if (teeth < 1 || teeth > 8 || bits < 1) {
+     return AWS_MP_VAL;
+  }
+
+  size = 1 << teeth;
+  comb->ctx = ctx;
+  comb->teeth = teeth;
+  comb->bits = bits;
+  comb->spacing = (bits + teeth - 1) / teeth;
+  comb->digits = NULL;
+  comb->table = AWS_OPT_CAST(aws_mp_int) AWS_XCALLOC((size_t)size, sizeof(aws_mp_int));
+  if (comb->table == NULL) {
+     return AWS_MP_MEM;
+  }
+
+  for (x = 0; x < size; x++) {
+    if ((err = aws_mp_init(&comb->table[x])) != AWS_MP_OKAY) {
+      for (y = 0; y < x; y++) {
+          aws_mp_clear(&comb->table[y]);
+      }
+      AWS_XFREE(comb->table);
+      comb->table = NULL;
+      return err;
+    }
+  }
+
+  /* table[0] is one, table[1] is G */
+  if ((err = aws_mp_copy(&ctx->R, &comb->table[0])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_to_mont(G, &comb->table[1], ctx)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* table[2**i] = table[2**(i-1)]**(2**spacing) */
+  for (x = 1; x < teeth; x++) {
+    if ((err = aws_mp_copy(&comb->table[1 << (x - 1)], &comb->table[1 << x])) != AWS_MP_OKAY) {
+       goto LBL_ERR;
+    }
+    for (y = 0; y < comb->spacing; y++) {
+      if ((err = aws_mp_mont_sqr(&comb->table[1 << x], &comb->table[1 << x], ctx)) != AWS_MP_OKAY) {
+         goto LBL_ERR;
+      }
+    }
+  }
+
+  /* every other entry is its lowest set bit times the rest */
+  for (x = 3; x < size; x++) {
+    if ((x & (x - 1)) == 0) {
+       continue;
+    }
+    if ((err = aws_mp_mont_mul(&comb->table[x & (x - 1)], &comb->table[x & -x], &comb->table[x], ctx)) != AWS_MP_OKAY) {
+       goto LBL_ERR;
+    }
+  }
+
+#ifdef AWS_BN_MP_EXPTMOD_LADDER_C
+  /* flat copy of the table for aws_mp_exptmod_comb_ct */
+  if (ctx->N.used == AWS_MP_3072_DIGITS) {
+    comb->digits = AWS_OPT_CAST(aws_mp_digit) AWS_XCALLOC((size_t)(size * AWS_MP_3072_DIGITS), sizeof(aws_mp_digit));
+    if (comb->digits == NULL) {
+       err = AWS_MP_MEM;
+       goto LBL_ERR;
+    }
+    for (x = 0; x < size; x++) {
+      for (y = 0; y < comb->table[x].used; y++) {
+          comb->digits[x * AWS_MP_3072_DIGITS + y] = comb->table[x].dp[y];
+      }
+    }
+  }
+#endif
+  return AWS_MP_OKAY;
+
+LBL_ERR:
+  aws_mp_comb_clear(comb);
+  return err;
+}
+
+void aws_mp_comb_clear(aws_mp_comb *comb)
+{
+  int x;
+
+  if (comb->digits != NULL) {
+     AWS_XFREE(comb->digits);
+     comb->digits = NULL;
+  }
+  if (comb->table == NULL) {
+     return;
+  }
+  for (x = 0; x < (1 << comb->teeth); x++) {
+      aws_mp_clear(&comb->table[x]);
+  }
+  AWS_XFREE(comb->table);
+  comb->table = NULL;
+}
+
+/* computes Y == G**X mod N using the comb table for G.  Exponents wider
+ * than the table fall back to aws_mp_exptmod_mont.
+ */
+int aws_mp_exptmod_comb(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y)
+{
+  aws_mp_int res;
+  int     err, col, i, idx, one;
+
+  if (X->sign == AWS_MP_NEG) {
+     return AWS_MP_VAL;
+  }
+
+  if (aws_mp_count_bits(X) > comb->bits) {
+     aws_mp_int G;
+     if ((err = aws_mp_init(&G)) != AWS_MP_OKAY) {
+        return err;
+     }
+     if ((err = aws_mp_from_mont(&comb->table[1], &G, comb->ctx)) == AWS_MP_OKAY) {
+        err = aws_mp_exptmod_mont(&G, X, comb->ctx, Y);
+     }
+     aws_mp_clear(&G);
+     return err;
+  }
+
+  if ((err = aws_mp_init_copy(&res, &comb->table[0])) != AWS_MP_OKAY) {
+     return err;
+  }
+
+  /* one is set while res is still one, so the leading squarings are skipped */
+  one = 1;
+  for (col = comb->spacing - 1; col >= 0; col--) {
+    if (one == 0) {
+      if ((err = aws_mp_mont_sqr(&res, &res, comb->ctx)) != AWS_MP_OKAY) {
+         goto LBL_RES;
+      }
+    }
+
+    idx = 0;
+    for (i = 0; i < comb->teeth; i++) {
+        idx |= aws_s_mp_get_bit(X, i * comb->spacing + col) << i;
+    }
+    if (idx == 0) {
+       continue;
+    }
+
+    if (one == 1) {
+       err = aws_mp_copy(&comb->table[idx], &res);
+       one = 0;
+    } else {
+       err = aws_mp_mont_mul(&res, &comb->table[idx], &res, comb->ctx);
+    }
+    if (err != AWS_MP_OKAY) {
+       goto LBL_RES;
+    }
+  }
+
+  err = aws_mp_from_mont(&res, Y, comb->ctx);
+LBL_RES:
+aws_mp_clear(&res);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_S_MP_COMBA_3072_C
+
+/* Fixed-size Comba kernels for 3072-bit operands [AWS_MP_3072_DIGITS digits].
+ *
+ * Operands are zero padded digit arrays so the loop bounds are compile time
+ * constants and the sequence of operations does not depend on the values.
+ * The inner loops are unrolled four times.
+ */
+#define AWS_S_MP_3072_D AWS_MP_3072_DIGITS
+
+/* C[0..2D-1] = A * B */
+void aws_s_mp_mul_comba_3072(const aws_mp_digit *A, const aws_mp_digit *B, aws_mp_digit *C)
+{
+  aws_mp_word _W;
+  int ix, tx, ty, iy;
+  const aws_mp_digit *tmpx, *tmpy;
+
+  _W = 0;
+  for (ix = 0; ix < 2 * AWS_S_MP_3072_D - 1; ix++) {
+      /* A[tx..] times B[..ty] going down */
+      ty = AWS_MIN(AWS_S_MP_3072_D - 1, ix);
+      tx = ix - ty;
+      iy = AWS_MIN(AWS_S_MP_3072_D - tx, ty + 1);
+      tmpx = A + tx;
+      tmpy = B + ty;
+
+      for (; iy >= 4; iy -= 4) {
+          _W += ((aws_mp_word)tmpx[0]) * ((aws_mp_word)tmpy[0]);
+          _W += ((aws_mp_word)tmpx[1]) * ((aws_mp_word)tmpy[-1]);
+          _W += ((aws_mp_word)tmpx[2]) * ((aws_mp_word)tmpy[-2]);
+          _W += ((aws_mp_word)tmpx[3]) * ((aws_mp_word)tmpy[-3]);
+          tmpx += 4;
+          tmpy -= 4;
+      }
+      for (; iy > 0; iy--) {
+          _W += ((aws_mp_word)*tmpx++) * ((aws_mp_word)*tmpy--);
+      }
+
+      C[ix] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+      _W = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+  C[2 * AWS_S_MP_3072_D - 1] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+}
+
+/* C[0..2D-1] = A * A, each cross product is computed once and doubled */
+void aws_s_mp_sqr_comba_3072(const aws_mp_digit *A, aws_mp_digit *C)
+{
+  aws_mp_word _W, W1;
+  int ix, tx, ty, iy;
+  const aws_mp_digit *tmpx, *tmpy;
+
+  W1 = 0;
+  for (ix = 0; ix < 2 * AWS_S_MP_3072_D - 1; ix++) {
+      ty = AWS_MIN(AWS_S_MP_3072_D - 1, ix);
+      tx = ix - ty;
+      /* number of cross products below the diagonal */
+      iy = (ty - tx + 1) >> 1;
+      tmpx = A + tx;
+      tmpy = A + ty;
+
+      _W = 0;
+      for (; iy >= 4; iy -= 4) {
+          _W += ((aws_mp_word)tmpx[0]) * ((aws_mp_word)tmpy[0]);
+          _W += ((aws_mp_word)tmpx[1]) * ((aws_mp_word)tmpy[-1]);
+          _W += ((aws_mp_word)tmpx[2]) * ((aws_mp_word)tmpy[-2]);
+          _W += ((aws_mp_word)tmpx[3]) * ((aws_mp_word)tmpy[-3]);
+          tmpx += 4;
+          tmpy -= 4;
+      }
+      for (; iy > 0; iy--) {
+          _W += ((aws_mp_word)*tmpx++) * ((aws_mp_word)*tmpy--);
+      }
+
+      /* double the inner product and add carry */
+      _W = _W + _W + W1;
+
+      /* even columns have the square term */
+      if ((ix & 1) == 0) {
+          _W += ((aws_mp_word)A[ix >> 1]) * ((aws_mp_word)A[ix >> 1]);
+      }
+
+      C[ix] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+      W1 = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+  C[2 * AWS_S_MP_3072_D - 1] = ((aws_mp_digit)W1) & AWS_MP_MASK;
+}
+
+/* out[0..D-1] = T / R (mod N) for T < N * R, with a masked final subtraction
+ * [see aws_fast_mp_montgomery_reduce]
+ */
+void aws_s_mp_mont_reduce_3072(const aws_mp_digit *T, const aws_mp_digit *N, aws_mp_digit rho, aws_mp_digit *out)
+{
+  aws_mp_word W[2 * AWS_S_MP_3072_D + 1];
+  aws_mp_digit t[AWS_S_MP_3072_D + 1], r[AWS_S_MP_3072_D], mu, u, mask;
+  int ix, iy;
+
+  for (ix = 0; ix < 2 * AWS_S_MP_3072_D; ix++) {
+      W[ix] = T[ix];
+  }
+  W[2 * AWS_S_MP_3072_D] = 0;
+
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      aws_mp_word *_W = W + ix;
+      const aws_mp_digit *tmpn = N;
+
+      mu = (aws_mp_digit) (((W[ix] & AWS_MP_MASK) * rho) & AWS_MP_MASK);
+
+      for (iy = AWS_S_MP_3072_D; iy >= 4; iy -= 4) {
+          _W[0] += ((aws_mp_word)mu) * ((aws_mp_word)tmpn[0]);
+          _W[1] += ((aws_mp_word)mu) * ((aws_mp_word)tmpn[1]);
+          _W[2] += ((aws_mp_word)mu) * ((aws_mp_word)tmpn[2]);
+          _W[3] += ((aws_mp_word)mu) * ((aws_mp_word)tmpn[3]);
+          _W += 4;
+          tmpn += 4;
+      }
+      for (; iy > 0; iy--) {
+          *_W++ += ((aws_mp_word)mu) * ((aws_mp_word)*tmpn++);
+      }
+
+      /* now fix carry for next digit, W[ix+1] */
+      W[ix + 1] += W[ix] >> ((aws_mp_word) AWS_DIGIT_BIT);
+  }
+
+  /* shift the upper half down and propagate the carries */
+  for (ix = AWS_S_MP_3072_D; ix < 2 * AWS_S_MP_3072_D; ix++) {
+      W[ix + 1] += W[ix] >> ((aws_mp_word) AWS_DIGIT_BIT);
+      t[ix - AWS_S_MP_3072_D] = (aws_mp_digit) (W[ix] & ((aws_mp_word) AWS_MP_MASK));
+  }
+  t[AWS_S_MP_3072_D] = (aws_mp_digit) (W[2 * AWS_S_MP_3072_D] & ((aws_mp_word) AWS_MP_MASK));
+
+  /* r = t - N, keep t when that borrows */
+  u = 0;
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      aws_mp_digit d = t[ix] - N[ix] - u;
+      u = d >> ((aws_mp_digit)(CHAR_BIT * sizeof (aws_mp_digit) - 1));
+      r[ix] = d & AWS_MP_MASK;
+  }
+  u = (t[AWS_S_MP_3072_D] - u) >> ((aws_mp_digit)(CHAR_BIT * sizeof (aws_mp_digit) - 1));
+  mask = ((aws_mp_digit)0) - u;
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      out[ix] = (t[ix] & mask) | (r[ix] & ~mask);
+  }
+}
+
+/* copies |a| into a zero padded array of D digits */
+static void aws_s_mp_get_digits_3072(aws_mp_int *a, aws_mp_digit *d)
+{
+  int ix;
+
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      d[ix] = (ix < a->used) ? a->dp[ix] : 0;
+  }
+}
+
+/* a = d[0..n-1] */
+static int aws_s_mp_set_digits(aws_mp_int *a, const aws_mp_digit *d, int n)
+{
+  int ix, olduse, res;
+
+  if (a->alloc < n) {
+     if ((res = aws_mp_grow(a, n)) != AWS_MP_OKAY) {
+        return res;
+     }
+  }
+  olduse = a->used;
+  for (ix = 0; ix < n; ix++) {
+      a->dp[ix] = d[ix];
+  }
+  for (; ix < olduse; ix++) {
+      a->dp[ix] = 0;
+  }
+  a->used = n;
+  a->sign = AWS_MP_ZPOS;
+  aws_mp_clamp(a);
+  return AWS_MP_OKAY;
+}
+
+/* c = |a| * |b| for operands of at most D digits */
+int aws_s_mp_mul_3072(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  aws_mp_digit A[AWS_S_MP_3072_D], B[AWS_S_MP_3072_D], C[2 * AWS_S_MP_3072_D];
+
+  aws_s_mp_get_digits_3072(a, A);
+  aws_s_mp_get_digits_3072(b, B);
+  aws_s_mp_mul_comba_3072(A, B, C);
+  return aws_s_mp_set_digits(c, C, 2 * AWS_S_MP_3072_D);
+}
+
+/* b = a * a for an operand of at most D digits */
+int aws_s_mp_sqr_3072(aws_mp_int *a, aws_mp_int *b)
+{
+  aws_mp_digit A[AWS_S_MP_3072_D], C[2 * AWS_S_MP_3072_D];
+
+  aws_s_mp_get_digits_3072(a, A);
+  aws_s_mp_sqr_comba_3072(A, C);
+  return aws_s_mp_set_digits(b, C, 2 * AWS_S_MP_3072_D);
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_LADDER_C
+
+/* R0 and R1 trade places when mask is all ones */
+static void aws_s_mp_cswap_3072(aws_mp_digit *R0, aws_mp_digit *R1, aws_mp_digit mask)
+{
+  int ix;
+
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      aws_mp_digit t = mask & (R0[ix] ^ R1[ix]);
+      R0[ix] ^= t;
+      R1[ix] ^= t;
+  }
+}
+
+/* returns bit b of |a| */
+static aws_mp_digit aws_s_mp_ladder_bit(aws_mp_int *a, int b)
+{
+  int d = b / AWS_DIGIT_BIT;
+
+  if (d >= a->used) {
+     return 0;
+  }
+  return (a->dp[d] >> ((aws_mp_digit)(b % AWS_DIGIT_BIT))) & 1;
+}
+
+/* leaves Montgomery form, Y = R0 / R (mod N) */
+static int aws_s_mp_from_mont_3072(const aws_mp_digit *R0, const aws_mp_digit *N, aws_mp_digit rho, aws_mp_int *Y)
+{
+  aws_mp_digit T[2 * AWS_S_MP_3072_D], out[AWS_S_MP_3072_D];
+  int ix;
+
+  for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+      T[ix] = R0[ix];
+      T[ix + AWS_S_MP_3072_D] = 0;
+  }
+  aws_s_mp_mont_reduce_3072(T, N, rho, out);
+  return aws_s_mp_set_digits(Y, out, AWS_S_MP_3072_D);
+}
+
+/* computes Y == G**X mod N with a Montgomery ladder for a 3072-bit modulus.
+ *
+ * Every one of the "bits" steps does one multiply and one square on fixed
+ * size operands, and the operands are swapped with masks instead of branches,
+ * so the running time does not depend on the bits of X.  Pass the largest
+ * size X can have as "bits" so the length of X does not show either.
+ */
+int aws_mp_exptmod_ladder(aws_mp_int *G, aws_mp_int *X, aws_mp_mont_ctx *ctx, int bits, aws_mp_int *Y)
+{
+  aws_mp_digit R0[AWS_S_MP_3072_D], R1[AWS_S_MP_3072_D], N[AWS_S_MP_3072_D], T[2 * AWS_S_MP_3072_D], mask;
+  aws_mp_int g;
+  int err, ix;
+
+  if (X->sign == AWS_MP_NEG || ctx->N.used != AWS_S_MP_3072_D) {
+     return AWS_MP_VAL;
+  }
+  if (aws_mp_count_bits(X) > bits) {
+     bits = aws_mp_count_bits(X);
+  }
+
+  if ((err = aws_mp_init(&g)) != AWS_MP_OKAY) {
+     return err;
+  }
+  if ((err = aws_mp_to_mont(G, &g, ctx)) != AWS_MP_OKAY) {
+     aws_mp_clear(&g);
+     return err;
+  }
+  aws_s_mp_get_digits_3072(&g, R1);
+  aws_mp_clear(&g);
+  aws_s_mp_get_digits_3072(&ctx->R, R0);
+  aws_s_mp_get_digits_3072(&ctx->N, N);
+
+  /* invariant: R1 = R0 * G */
+  for (ix = bits - 1; ix >= 0; ix--) {
+      mask = ((aws_mp_digit)0) - aws_s_mp_ladder_bit(X, ix);
+      aws_s_mp_cswap_3072(R0, R1, mask);
+      aws_s_mp_mul_comba_3072(R0, R1, T);
+      aws_s_mp_mont_reduce_3072(T, N, ctx->rho, R1);
+      aws_s_mp_sqr_comba_3072(R0, T);
+      aws_s_mp_mont_reduce_3072(T, N, ctx->rho, R0);
+      aws_s_mp_cswap_3072(R0, R1, mask);
+  }
+
+  return aws_s_mp_from_mont_3072(R0, N, ctx->rho, Y);
+}
+
+/* computes Y == G**X mod N from the comb table without exponent dependent
+ * branches or table lookups: every column squares and multiplies, and the
+ * entry is selected by scanning the whole table with masks.
+ */
+int aws_mp_exptmod_comb_ct(aws_mp_comb *comb, aws_mp_int *X, aws_mp_int *Y)
+{
+  aws_mp_digit res[AWS_S_MP_3072_D], E[AWS_S_MP_3072_D], N[AWS_S_MP_3072_D], T[2 * AWS_S_MP_3072_D], mask, m;
+  int col, i, ix, idx, size;
+
+  if (X->sign == AWS_MP_NEG || comb->digits == NULL) {
+     return AWS_MP_VAL;
+  }
+
+  if (aws_mp_count_bits(X) > comb->bits) {
+     aws_mp_int G;
+     int err;
+     if ((err = aws_mp_init(&G)) != AWS_MP_OKAY) {
+        return err;
+     }
+     if ((err = aws_mp_from_mont(&comb->table[1], &G, comb->ctx)) == AWS_MP_OKAY) {
+        err = aws_mp_exptmod_ladder(&G, X, comb->ctx, aws_mp_count_bits(X), Y);
+     }
+     aws_mp_clear(&G);
+     return err;
+  }
+
+  size = 1 << comb->teeth;
+  aws_s_mp_get_digits_3072(&comb->ctx->R, res);
+  aws_s_mp_get_digits_3072(&comb->ctx->N, N);
+
+  for (col = comb->spacing - 1; col >= 0; col--) {
+      aws_s_mp_sqr_comba_3072(res, T);
+      aws_s_mp_mont_reduce_3072(T, N, comb->ctx->rho, res);
+
+      idx = 0;
+      for (i = 0; i < comb->teeth; i++) {
+          idx |= (int)aws_s_mp_ladder_bit(X, i * comb->spacing + col) << i;
+      }
+
+      for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+          E[ix] = 0;
+      }
+      for (i = 0; i < size; i++) {
+          /* all ones when i == idx */
+          m = (aws_mp_digit)(i ^ idx);
+          mask = ((m | (((aws_mp_digit)0) - m)) >> ((aws_mp_digit)(CHAR_BIT * sizeof (aws_mp_digit) - 1))) - 1;
+          for (ix = 0; ix < AWS_S_MP_3072_D; ix++) {
+              E[ix] |= comb->digits[i * AWS_S_MP_3072_D + ix] & mask;
+          }
+      }
+
+      aws_s_mp_mul_comba_3072(res, E, T);
+      aws_s_mp_mont_reduce_3072(T, N, comb->ctx->rho, res);
+  }
+
+  return aws_s_mp_from_mont_3072(res, N, comb->ctx->rho, Y);
+}
+#endif
+
 #ifdef AWS_BN_S_MP_ADD_C
 
 /* low level addition, based on HAC pp.594, Algorithm 14.7 */
@@ -5041,6 +5859,13 @@ int aws_mp_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
   int     res, neg;
   neg = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
 
+#ifdef AWS_BN_S_MP_COMBA_3072_C
+  /* 3072-bit operands? */
+  if (AWS_MAX (a->used, b->used) <= AWS_MP_3072_DIGITS &&
+      AWS_MIN (a->used, b->used) > AWS_MP_3072_DIGITS - AWS_MP_3072_DIGITS / 8) {
+    res = aws_s_mp_mul_3072(a, b, c);
+  } else
+#endif
   /* use Toom-Cook? */
 #ifdef AWS_BN_MP_TOOM_MUL_C
   if (AWS_MIN (a->used, b->used) >= AWS_TOOM_MUL_CUTOFF) {
@@ -0,0 +1,158 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <Security/Security.h>
+
+// The SRP classes are internal to AWSCognitoIdentityProvider; declare the parts exercised here.
+@interface AWSJKBigInteger : NSObject
+- (id)initWithString:(NSString *)string andRadix:(int)radix;
+- (id)pow:(AWSJKBigInteger *)exponent andMod:(AWSJKBigInteger *)modulus;
+- (NSString *)stringValueWithRadix:(int)radix;
+@end
+
+@interface AWSCognitoIdentityProviderSrpCommonState : NSObject
+@property (nonatomic, retain) AWSJKBigInteger *N;
+@property (nonatomic, retain) AWSJKBigInteger *g;
++ (instancetype)defaultCommonState;
+- (AWSJKBigInteger *)gPow:(AWSJKBigInteger *)exponent;
+- (AWSJKBigInteger *)pow:(AWSJKBigInteger *)base exponent:(AWSJKBigInteger *)exponent;
+@property (atomic, assign) BOOL usesConstantTimeExponentiation;
+@end
+
+@interface AWSCognitoIdentityProviderSrpClientState : NSObject
+@property (nonatomic, strong) AWSJKBigInteger *privateA;
+@property (nonatomic, strong) AWSJKBigInteger *publicA;
+@end
+
+@interface AWSCognitoIdentityProviderSrpServerState : NSObject
++ (instancetype)serverStateForPoolName:(NSString *)poolName
+                      publicBHexString:(NSString *)publicBHexString
+                         saltHexString:(NSString *)saltHexString
+                        derivedKeyInfo:(const NSString *)derivedKeyInfo
+                        derivedKeySize:(NSInteger)derivedKeyLength
+                    serviceSecretBlock:(NSData *)serviceSecretBlock;
+@end
+
+@interface AWSCognitoIdentityProviderSrpHelper : NSObject
+@property (nonatomic, strong) AWSCognitoIdentityProviderSrpClientState *clientState;
++ (instancetype)beginUserAuthentication:(NSString *)userName password:(NSString *)password;
++ (void)precomputeEphemeralKey;
+- (NSData *)completeAuthentication:(AWSCognitoIdentityProviderSrpServerState *)serverState;
+@end
+
+static NSString *AWSTestRandomHexString(NSUInteger length) {
+    NSMutableData *bytes = [NSMutableData dataWithLength:length];
+    (void)SecRandomCopyBytes(kSecRandomDefault, length, bytes.mutableBytes);
+    NSMutableString *hex = [NSMutableString stringWithCapacity:length * 2];
+    const uint8_t *buffer = bytes.bytes;
+    for (NSUInteger i = 0; i < length; i++) {
+        [hex appendFormat:@"%02X", buffer[i]];
+    }
+    return hex;
+}
+
+@interface AWSCognitoIdentityProviderSrpHelperTests : XCTestCase
+
+@end
+
+@implementation AWSCognitoIdentityProviderSrpHelperTests
+
+- (void)testFixedBasePowMatchesGenericPow {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+
+    // 32 bytes is covered by the fixed-base table, 64 bytes falls back to the Montgomery context.
+    for (NSNumber *length in @[@1, @16, @32, @32, @32, @64]) {
+        AWSJKBigInteger *exponent = [[AWSJKBigInteger alloc] initWithString:AWSTestRandomHexString(length.unsignedIntegerValue) andRadix:16];
+        AWSJKBigInteger *expected = [commonState.g pow:exponent andMod:commonState.N];
+        XCTAssertEqualObjects([[commonState gPow:exponent] stringValueWithRadix:16], [expected stringValueWithRadix:16]);
+    }
+
+    AWSJKBigInteger *zero = [[AWSJKBigInteger alloc] initWithString:@"0" andRadix:16];
+    XCTAssertEqualObjects([[commonState gPow:zero] stringValueWithRadix:16], @"1");
+}
+
+- (void)testPowMatchesGenericPow {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+
+    for (int i = 0; i < 4; i++) {
+        AWSJKBigInteger *base = [[AWSJKBigInteger alloc] initWithString:AWSTestRandomHexString(384) andRadix:16];
+        AWSJKBigInteger *exponent = [[AWSJKBigInteger alloc] initWithString:AWSTestRandomHexString(64) andRadix:16];
+        AWSJKBigInteger *expected = [base pow:exponent andMod:commonState.N];
+        XCTAssertEqualObjects([[commonState pow:base exponent:exponent] stringValueWithRadix:16], [expected stringValueWithRadix:16]);
+    }
+}
+
+- (void)testKnownAnswersWithAndWithoutConstantTimeExponentiation {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+    XCTAssertTrue(commonState.usesConstantTimeExponentiation);
+
+    AWSJKBigInteger *x = [[AWSJKBigInteger alloc] initWithString:@"9F5B2C41E7D3A8067C1E4F3B2A5D6C7E8F9011223344556677889900AABBCCDD" andRadix:16];
+    NSString *gx = @"d9d3277fcfb99221d0e4151f733888ccf768c095b0cb113fb571bef4a7f2b87344ac4a9bd2642f8503049745e49dcbd9cc8dfc3c1ed3a97f52abe514c940c6df6de1b7a2b053eaf2fb0b2a693b11051e2eb4883caf0c7a69bbec7a9630c177cd5b3bcfd945a4f8874530f698679a27050b4a2a623cca8985a58d07c011ba0fb48b3a86e8a9bc9c8c448be8bad905ed40acecf55167813bd1ab372273890f4357190eeec88c473562a4f2a94390be8b9209260e3e73609981ab4568cb9665a31e2cb957745b91c7cb4ff56098d0aa7847ea4ab8a7227777f62bc2e7e5f2ab00f7aaa0589631455835b7780c7caf81416fedab13c454f4483d66a02be3c86215cee52deebd2ba2a2857daeae6c38dfc4131c5af4ac92a79e6887048465288eb6310e4d208fc7788c87b2f2491f8c6d998b1f1c70384def71e28d541a214b4caa29225c40a55d63dff1c93411c8080ca15a127bb739cff7831e9ee9ef9aff19cec4342b9c1c4eeface12435ff3492565a4cdaf3becaeac54454bbcf748c01531432";
+
+    // The exponent is wider than the 513 steps the ladder runs by default.
+    NSMutableString *baseHex = [NSMutableString new];
+    NSMutableString *exponentHex = [NSMutableString stringWithString:@"1"];
+    for (int i = 0; i < 48; i++) {
+        [baseHex appendString:@"0123456789ABCDEF"];
+    }
+    for (int i = 0; i < 16; i++) {
+        [exponentHex appendString:@"F0E1D2C3B4A59687"];
+    }
+    AWSJKBigInteger *base = [[AWSJKBigInteger alloc] initWithString:baseHex andRadix:16];
+    AWSJKBigInteger *exponent = [[AWSJKBigInteger alloc] initWithString:exponentHex andRadix:16];
+    NSString *be = @"f46174b8a746ae4b3e72e6e2b95631cda22ef76210f6c4d164d157952aacd9c87db38273e6c4a70b841380c1036308c89e3a344409b057a1eb77e4368d5c77684a3ded3299744330ea8e5969d6436a25881256517d9e218fa31f6e070d16d4d711ec85e5404fff0a912c25158a9b4c250a289a4510501c4a5ea7ddff359634e61505d5533143d3dfb7851d37252d9b7818f1cc100a2a8be4d0f2071486b3468b6f35fddb86c60476a805da66efc379ca325546a12fabe046af7bddb2aea5e9dd1dde0f81348cdfae4844018b1ad5a66b62b76e7634e77ff7113a7bd2e8c10f0b247a91a6affff5b06dfdd64ddceb142db521b3ced3278da968b17be10b4056b8896d63ab75280c2b2c765068a3653a7ece9c13f4015bc950099becfd8a6a627a8c5c00779fdc8e2a7f2d46b535d1938362902bce560631e49c8c57a2602b69c34c5da2f6f5b7967fa9b4addebec0ba5978c0008cac497ede033b0916bfc6984a7b99cbac8743a0aad1c094f3187517c8d1b606574c4c55f967a20c5fa463205";
+
+    for (NSNumber *constantTime in @[@YES, @NO]) {
+        commonState.usesConstantTimeExponentiation = constantTime.boolValue;
+        XCTAssertEqualObjects([[commonState gPow:x] stringValueWithRadix:16], gx);
+        XCTAssertEqualObjects([[commonState pow:base exponent:exponent] stringValueWithRadix:16], be);
+        XCTAssertEqualObjects([[commonState.g pow:x andMod:commonState.N] stringValueWithRadix:16], gx);
+    }
+    commonState.usesConstantTimeExponentiation = YES;
+}
+
+- (void)testPrecomputedEphemeralKeyIsHandedOutOnce {
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+
+    [AWSCognitoIdentityProviderSrpHelper precomputeEphemeralKey];
+    AWSCognitoIdentityProviderSrpHelper *first = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:@"user" password:@"password"];
+    AWSCognitoIdentityProviderSrpHelper *second = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:@"user" password:@"password"];
+
+    XCTAssertNotEqualObjects([first.clientState.privateA stringValueWithRadix:16], [second.clientState.privateA stringValueWithRadix:16]);
+    for (AWSCognitoIdentityProviderSrpHelper *helper in @[first, second]) {
+        AWSJKBigInteger *expected = [commonState.g pow:helper.clientState.privateA andMod:commonState.N];
+        XCTAssertEqualObjects([helper.clientState.publicA stringValueWithRadix:16], [expected stringValueWithRadix:16]);
+    }
+}
+
+- (void)testSignInComputationPerformance {
+    AWSCognitoIdentityProviderSrpServerState *serverState = [AWSCognitoIdentityProviderSrpServerState serverStateForPoolName:@"testPool"
+                                                                                                             publicBHexString:AWSTestRandomHexString(383)
+                                                                                                                saltHexString:AWSTestRandomHexString(16)
+                                                                                                               derivedKeyInfo:@"Caldera Derived Key"
+                                                                                                               derivedKeySize:16
+                                                                                                           serviceSecretBlock:[NSData data]];
+    [AWSCognitoIdentityProviderSrpCommonState defaultCommonState];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 10; i++) {
+            AWSCognitoIdentityProviderSrpHelper *helper = [AWSCognitoIdentityProviderSrpHelper beginUserAuthentication:@"user" password:@"password"];
+            XCTAssertNotNil([helper completeAuthentication:serverState]);
+        }
+    }];
+}
+
+@end
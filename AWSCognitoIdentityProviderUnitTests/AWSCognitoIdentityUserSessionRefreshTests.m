@@ -0,0 +1,221 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSCognitoIdentityProvider.h"
+#import "AWSCognitoIdentityProvider+TestUtils.h"
+
+static NSString *const AWSTestUserPoolKey = @"AWSCognitoIdentityUserSessionRefreshTests";
+static NSString *const AWSTestClientId = @"testClientId";
+static NSString *const AWSTestUsername = @"testUser";
+
+@interface AWSCognitoIdentityProvider()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+@interface AWSCognitoIdentityUserPool()
+
+@property (nonatomic, strong) AWSCognitoIdentityProvider *client;
+@property (nonatomic, strong) AWSUICKeyChainStore *keychain;
+
+@end
+
+static NSString *AWSTestToken(NSTimeInterval lifetime, NSString *tokenId) {
+    NSDictionary *claims = @{@"exp": @((long long)[[NSDate dateWithTimeIntervalSinceNow:lifetime] timeIntervalSince1970]),
+                             @"jti": tokenId};
+    NSData *claimsData = [NSJSONSerialization dataWithJSONObject:claims options:kNilOptions error:nil];
+    NSString *encodedClaims = [[[[claimsData base64EncodedStringWithOptions:kNilOptions]
+                                 stringByReplacingOccurrencesOfString:@"=" withString:@""]
+                                stringByReplacingOccurrencesOfString:@"+" withString:@"-"]
+                               stringByReplacingOccurrencesOfString:@"/" withString:@"_"];
+    return [NSString stringWithFormat:@"eyJhbGciOiJub25lIn0.%@.signature", encodedClaims];
+}
+
+/**
+ Local stand-in for the user pool that answers `REFRESH_TOKEN_AUTH` after a fixed delay.
+ */
+@interface AWSTestCognitoIdentityProvider : AWSCognitoIdentityProvider
+
+@property (atomic, assign) NSInteger requestCount;
+@property (nonatomic, assign) int delayInMilliseconds;
+
+@end
+
+@implementation AWSTestCognitoIdentityProvider
+
+- (AWSTask<AWSCognitoIdentityProviderInitiateAuthResponse *> *)initiateAuth:(AWSCognitoIdentityProviderInitiateAuthRequest *)request {
+    NSInteger requestNumber;
+    @synchronized (self) {
+        requestNumber = ++self.requestCount;
+    }
+
+    return [[AWSTask taskWithDelay:self.delayInMilliseconds] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        AWSCognitoIdentityProviderAuthenticationResultType *authenticationResult = [AWSCognitoIdentityProviderAuthenticationResultType new];
+        authenticationResult.accessToken = AWSTestToken(60 * 60, [NSString stringWithFormat:@"access%ld", (long)requestNumber]);
+        authenticationResult.idToken = AWSTestToken(60 * 60, [NSString stringWithFormat:@"id%ld", (long)requestNumber]);
+        authenticationResult.expiresIn = @(60 * 60);
+
+        AWSCognitoIdentityProviderInitiateAuthResponse *response = [AWSCognitoIdentityProviderInitiateAuthResponse new];
+        response.authenticationResult = authenticationResult;
+        return [AWSTask taskWithResult:response];
+    }];
+}
+
+@end
+
+@interface AWSCognitoIdentityUserSessionRefreshTests : XCTestCase
+
+@property (nonatomic, strong) AWSCognitoIdentityUserPool *pool;
+@property (nonatomic, strong) AWSTestCognitoIdentityProvider *client;
+
+@end
+
+@implementation AWSCognitoIdentityUserSessionRefreshTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1
+                                                                         credentialsProvider:[AWSAnonymousCredentialsProvider new]];
+    AWSCognitoIdentityUserPoolConfiguration *userPoolConfiguration = [[AWSCognitoIdentityUserPoolConfiguration alloc] initWithClientId:AWSTestClientId
+                                                                                                                          clientSecret:nil
+                                                                                                                                poolId:@"us-east-1_testPool"];
+    [AWSCognitoIdentityUserPool registerCognitoIdentityUserPoolWithConfiguration:configuration
+                                                           userPoolConfiguration:userPoolConfiguration
+                                                                          forKey:AWSTestUserPoolKey];
+    self.pool = [AWSCognitoIdentityUserPool CognitoIdentityUserPoolForKey:AWSTestUserPoolKey];
+    [self.pool clearAll];
+
+    self.client = [[AWSTestCognitoIdentityProvider alloc] initWithConfiguration:configuration];
+    self.client.delayInMilliseconds = 200;
+    self.pool.client = self.client;
+}
+
+- (void)tearDown {
+    [self.pool clearAll];
+    [AWSCognitoIdentityUserPool removeCognitoIdentityUserPoolForKey:AWSTestUserPoolKey];
+    [super tearDown];
+}
+
+- (void)storeTokensWithLifetime:(NSTimeInterval)lifetime {
+    NSString *namespace = [NSString stringWithFormat:@"%@.%@", AWSTestClientId, AWSTestUsername];
+    [self.pool.keychain setStrings:@{[namespace stringByAppendingString:@".idToken"]: AWSTestToken(lifetime, @"id0"),
+                                     [namespace stringByAppendingString:@".accessToken"]: AWSTestToken(lifetime, @"access0"),
+                                     [namespace stringByAppendingString:@".refreshToken"]: @"refreshToken",
+                                     [namespace stringByAppendingString:@".tokenExpiration"]: [[NSDate dateWithTimeIntervalSinceNow:lifetime] aws_stringValue:AWSDateISO8601DateFormat1]}];
+}
+
+- (void)testConcurrentGetSessionSharesOneRefresh {
+    [self storeTokensWithLifetime:-60];
+    AWSCognitoIdentityUser *user = [self.pool getUser:AWSTestUsername];
+
+    NSMutableArray<AWSTask<AWSCognitoIdentityUserSession *> *> *tasks = [NSMutableArray new];
+    NSObject *lock = [NSObject new];
+    dispatch_apply(100, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        AWSTask<AWSCognitoIdentityUserSession *> *task = [user getSession];
+        @synchronized (lock) {
+            [tasks addObject:task];
+        }
+    });
+
+    [[AWSTask taskForCompletionOfAllTasks:tasks] waitUntilFinished];
+
+    for (AWSTask<AWSCognitoIdentityUserSession *> *task in tasks) {
+        XCTAssertNil(task.error);
+        XCTAssertEqualObjects(task.result.accessToken.tokenClaims[@"jti"], @"access1");
+        XCTAssertEqualObjects(task.result.refreshToken.tokenString, @"refreshToken");
+    }
+    XCTAssertEqual(self.client.requestCount, 1);
+
+    AWSTask<AWSCognitoIdentityUserSession *> *cachedTask = [[self.pool getUser:AWSTestUsername] getSession];
+    XCTAssertTrue(cachedTask.isCompleted);
+    XCTAssertEqualObjects(cachedTask.result.accessToken.tokenClaims[@"jti"], @"access1");
+    XCTAssertEqual(self.client.requestCount, 1);
+}
+
+- (void)testSessionIsRefreshedAheadOfExpiry {
+    [self storeTokensWithLifetime:4 * 60];
+    AWSCognitoIdentityUser *user = [self.pool getUser:AWSTestUsername];
+
+    // The session is still valid, so it is returned immediately while the refresh runs in the background.
+    AWSTask<AWSCognitoIdentityUserSession *> *staleTask = [user getSession];
+    XCTAssertTrue(staleTask.isCompleted);
+    XCTAssertEqualObjects(staleTask.result.accessToken.tokenClaims[@"jti"], @"access0");
+
+    [NSThread sleepForTimeInterval:1];
+
+    AWSTask<AWSCognitoIdentityUserSession *> *refreshedTask = [user getSession];
+    XCTAssertTrue(refreshedTask.isCompleted);
+    XCTAssertEqualObjects(refreshedTask.result.accessToken.tokenClaims[@"jti"], @"access1");
+    XCTAssertEqual(self.client.requestCount, 1);
+}
+
+- (void)testSignOutDropsCachedSession {
+    [self storeTokensWithLifetime:60 * 60];
+    AWSCognitoIdentityUser *user = [self.pool getUser:AWSTestUsername];
+    XCTAssertNotNil([user getSession].result);
+
+    [user signOut];
+    XCTAssertFalse(user.isSignedIn);
+    XCTAssertNil([self.pool.keychain stringForKey:[NSString stringWithFormat:@"%@.%@.accessToken", AWSTestClientId, AWSTestUsername]]);
+}
+
+- (void)testCachedSessionFollowsKeychainChanges {
+    [self storeTokensWithLifetime:60 * 60];
+    AWSCognitoIdentityUser *user = [self.pool getUser:AWSTestUsername];
+    XCTAssertEqualObjects([user getSession].result.accessToken.tokenClaims[@"jti"], @"access0");
+
+    // Another writer of the shared keychain, such as AWSCognitoAuth, rotates the tokens behind the cache.
+    NSString *namespace = [NSString stringWithFormat:@"%@.%@", AWSTestClientId, AWSTestUsername];
+    [self.pool.keychain setStrings:@{[namespace stringByAppendingString:@".idToken"]: AWSTestToken(60 * 60, @"idRotated"),
+                                     [namespace stringByAppendingString:@".accessToken"]: AWSTestToken(60 * 60, @"accessRotated")}];
+    AWSTask<AWSCognitoIdentityUserSession *> *rotatedTask = [user getSession];
+    XCTAssertTrue(rotatedTask.isCompleted);
+    XCTAssertEqualObjects(rotatedTask.result.accessToken.tokenClaims[@"jti"], @"accessRotated");
+    XCTAssertEqualObjects(rotatedTask.result.idToken.tokenClaims[@"jti"], @"idRotated");
+
+    // And then signs the user out.
+    for (NSString *key in @[@".idToken", @".accessToken", @".refreshToken", @".tokenExpiration"]) {
+        [self.pool.keychain removeItemForKey:[namespace stringByAppendingString:key]];
+    }
+    AWSTask<AWSCognitoIdentityUserSession *> *signedOutTask = [user getSession];
+    [signedOutTask waitUntilFinished];
+    XCTAssertNil(signedOutTask.result);
+    XCTAssertEqual(self.client.requestCount, 0);
+}
+
+- (void)testTokenClaimsAreDecodedOnce {
+    AWSCognitoIdentityUserSessionToken *token = [[AWSCognitoIdentityUserSessionToken alloc] initWithToken:AWSTestToken(60, @"jti")];
+    NSDictionary *claims = token.tokenClaims;
+    XCTAssertEqualObjects(claims[@"jti"], @"jti");
+    XCTAssertTrue(claims == token.tokenClaims);
+}
+
+- (void)testCachedGetSessionPerformance {
+    [self storeTokensWithLifetime:60 * 60];
+    AWSCognitoIdentityUser *user = [self.pool getUser:AWSTestUsername];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 10000; i++) {
+            [user getSession];
+        }
+    }];
+}
+
+@end
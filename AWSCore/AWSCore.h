@@ -53,6 +53,9 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 #import "AWSSynchronizedMutableDictionary.h"
 #import "AWSXMLDictionary.h"
 #import "AWSSerialization.h"
+#import "AWSServiceDefinition.h"
+#import "AWSJSONModelCodec.h"
+#import "AWSXMLStreamDecoder.h"
 #import "AWSTimestampSerialization.h"
 #import "AWSURLRequestSerialization.h"
 #import "AWSURLResponseSerialization.h"
@@ -65,6 +68,7 @@ FOUNDATION_EXPORT const unsigned char AWSCoreVersionString[] DEPRECATED_MSG_ATTR
 
 #import "AWSBolts.h"
 #import "AWSGZIP.h"
+#import "AWSGZIPInputStream.h"
 #import "AWSFMDB.h"
 #import "AWSKSReachability.h"
 #import "AWSUICKeyChainStore.h"
@@ -183,6 +183,11 @@ typedef NS_ENUM(NSInteger, AWSCognitoCredentialsProviderErrorType) {
  */
 @property (nonatomic, strong, readonly) NSString *identityPoolId;
 
+/**
+ The fraction of the remaining lifetime of newly cached credentials after which they are refreshed in the background. Until the background refresh completes, the cached credentials keep being returned without blocking the caller. The default value is `0.75`. Set to `1.0` or greater to only refresh once the credentials are about to expire.
+ */
+@property (atomic, assign) double refreshAheadRatio;
+
 /**
  Initializer for credentials provider with enhanced authentication flow. This is the recommended constructor for first time Amazon Cognito developers. Will create an instance of `AWSEnhancedCognitoIdentityProvider`.
 
@@ -28,6 +28,10 @@ static NSString *const AWSCredentialsProviderKeychainSessionToken = @"sessionKey
 static NSString *const AWSCredentialsProviderKeychainExpiration = @"expiration";
 static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
+// A failed refresh is returned to callers for this long, doubling with each consecutive failure up to the maximum.
+static NSTimeInterval const AWSCognitoCredentialsProviderRefreshFailureInterval = 1;
+static NSTimeInterval const AWSCognitoCredentialsProviderMaximumRefreshFailureInterval = 60;
+
 @interface AWSCognitoIdentity()
 
 - (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
@@ -52,6 +56,9 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (nullable instancetype)initFromKeychain:(nonnull AWSUICKeyChainStore *)keychain;
 
+// The keychain entries of `credentials`, with `NSNull` for the missing ones, so that setting them clears the old values.
++ (NSDictionary<NSString *, id> *)keychainValuesForCredentials:(nullable AWSCredentials *)credentials;
+
 
 @end
 
@@ -59,14 +66,18 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (nullable instancetype)initFromKeychain:(nonnull AWSUICKeyChainStore *)keychain {
     if (self = [super init]) {
-        if (keychain[AWSCredentialsProviderKeychainAccessKeyId]
-            && keychain[AWSCredentialsProviderKeychainSecretAccessKey]) {
+        NSDictionary<NSString *, NSString *> *values = [keychain stringsForKeys:@[AWSCredentialsProviderKeychainAccessKeyId,
+                                                                                  AWSCredentialsProviderKeychainSecretAccessKey,
+                                                                                  AWSCredentialsProviderKeychainSessionToken,
+                                                                                  AWSCredentialsProviderKeychainExpiration]];
+        if (values[AWSCredentialsProviderKeychainAccessKeyId]
+            && values[AWSCredentialsProviderKeychainSecretAccessKey]) {
             AWSDDLogVerbose(@"Retrieving credentials from keychain");
-            _accessKey = keychain[AWSCredentialsProviderKeychainAccessKeyId];
-            _secretKey = keychain[AWSCredentialsProviderKeychainSecretAccessKey];
-            _sessionKey = keychain[AWSCredentialsProviderKeychainSessionToken];
+            _accessKey = values[AWSCredentialsProviderKeychainAccessKeyId];
+            _secretKey = values[AWSCredentialsProviderKeychainSecretAccessKey];
+            _sessionKey = values[AWSCredentialsProviderKeychainSessionToken];
 
-            NSString *expirationString = keychain[AWSCredentialsProviderKeychainExpiration];
+            NSString *expirationString = values[AWSCredentialsProviderKeychainExpiration];
             if (expirationString) {
                 _expiration = [NSDate dateWithTimeIntervalSince1970:[expirationString doubleValue]];
             }
@@ -90,6 +101,14 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
     return self;
 }
 
++ (NSDictionary<NSString *, id> *)keychainValuesForCredentials:(AWSCredentials *)credentials {
+    NSNull *null = [NSNull null];
+    return @{AWSCredentialsProviderKeychainAccessKeyId: credentials.accessKey ?: null,
+             AWSCredentialsProviderKeychainSecretAccessKey: credentials.secretKey ?: null,
+             AWSCredentialsProviderKeychainSessionToken: credentials.sessionKey ?: null,
+             AWSCredentialsProviderKeychainExpiration: credentials.expiration ? [NSString stringWithFormat:@"%f", [credentials.expiration timeIntervalSince1970]] : null};
+}
+
 - (NSString *)description {
     return [NSString stringWithFormat:@"{\nAWSCredentials\nAccessKey: %@\nSecretKey: %@\nSessionKey: %@\nExpiration: %@\n}",
             self.accessKey,
@@ -279,14 +298,7 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
     @synchronized (self) {
         _internalCredentials = internalCredentials;
 
-        self.keychain[AWSCredentialsProviderKeychainAccessKeyId] = internalCredentials.accessKey;
-        self.keychain[AWSCredentialsProviderKeychainSecretAccessKey] = internalCredentials.secretKey;
-        self.keychain[AWSCredentialsProviderKeychainSessionToken] = internalCredentials.sessionKey;
-        if (internalCredentials.expiration) {
-            self.keychain[AWSCredentialsProviderKeychainExpiration] = [NSString stringWithFormat:@"%f", [internalCredentials.expiration timeIntervalSince1970]];
-        } else {
-            self.keychain[AWSCredentialsProviderKeychainExpiration] = nil;
-        }
+        [self.keychain setStrings:[AWSCredentials keychainValuesForCredentials:internalCredentials]];
     }
 }
 
@@ -300,10 +312,14 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 @property (nonatomic, strong) AWSCognitoIdentity *cognitoIdentity;
 @property (nonatomic, strong) AWSUICKeyChainStore *keychain;
 @property (nonatomic, strong) AWSExecutor *refreshExecutor;
-@property (nonatomic, strong) dispatch_semaphore_t semaphore;
+@property (nonatomic, strong) dispatch_queue_t persistenceQueue;
 @property (atomic, assign) BOOL useEnhancedFlow;
 @property (atomic, strong) AWSCredentials *internalCredentials;
-@property (atomic, assign, getter=isRefreshingCredentials) BOOL refreshingCredentials;
+@property (atomic, strong) NSDate *refreshAheadDate;
+@property (atomic, strong) AWSTask<AWSCredentials *> *refreshTask;
+@property (nonatomic, strong) AWSTask<AWSCredentials *> *refreshFailureTask;
+@property (nonatomic, strong) NSDate *refreshFailureExpiration;
+@property (nonatomic, assign) NSUInteger refreshFailureCount;
 @property (atomic, strong) NSDictionary<NSString *, NSString *> *cachedLogins;
 // This is a temporary solution to bypass the requirement of protocol check for `AWSIdentityProviderManager`.
 @property (nonatomic, strong) NSString *customRoleArnOverride;
@@ -312,7 +328,9 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 @end
 
-@implementation AWSCognitoCredentialsProvider
+@implementation AWSCognitoCredentialsProvider {
+    BOOL _internalCredentialsLoaded;
+}
 
 @synthesize internalCredentials = _internalCredentials;
 
@@ -411,8 +429,8 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
                 authRoleArn:(NSString *)authRoleArn
   identityPoolConfiguration:(AWSServiceConfiguration *)configuration {
     _refreshExecutor = [AWSExecutor executorWithOperationQueue:[NSOperationQueue new]];
-    _refreshingCredentials = NO;
-    _semaphore = dispatch_semaphore_create(0);
+    _persistenceQueue = dispatch_queue_create("com.amazonaws.AWSCognitoCredentialsProvider.persistence", DISPATCH_QUEUE_SERIAL);
+    _refreshAheadRatio = 0.75;
 
     _identityProvider = identityProvider;
     _unAuthRoleArn = unauthRoleArn;
@@ -421,6 +439,7 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
     // initialize keychain - name spaced by app bundle and identity pool id
     _keychain = [AWSUICKeyChainStore keyChainStoreWithService:[NSString stringWithFormat:@"%@.%@.%@", [NSBundle mainBundle].bundleIdentifier, [AWSCognitoCredentialsProvider class], identityProvider.identityPoolId]];
+    _keychain.cachesValues = YES;
     [_keychain migrateToCurrentAccessibility];
     
     // If the identity provider has an identity id, use it
@@ -440,6 +459,8 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
     }
 
     _internalCredentials = [[AWSCredentials alloc] initFromKeychain:self.keychain];
+    _internalCredentialsLoaded = YES;
+    _refreshAheadDate = [self refreshAheadDateForCredentials:_internalCredentials];
 }
 
 - (void)setUpWithRegionType:(AWSRegionType)regionType
@@ -498,8 +519,9 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
                                                                       expiration:webIdentityResponse.credentials.expiration];
 
             return [AWSTask taskWithResult:self.internalCredentials];
-        } else {
-            // reset the values for the credentials
+        } else if (!self.internalCredentials.isValid) {
+            // reset the values for the credentials, unless a background refresh failed
+            // while the cached credentials are still usable
             [self clearCredentials];
         }
 
@@ -626,16 +648,76 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
         return [AWSTask cancelledTask];
     }
     
-    __block AWSCredentials *credentials = self.internalCredentials.copy;
+    AWSCredentials *credentials = self.internalCredentials.copy;
     // Returns cached credentials when all of the following conditions are true:
     // 1. The cached credentials are not nil.
     // 2. The credentials do not expire within 10 minutes.
     if (credentials && credentials.isValid) {
+        // Past the refresh-ahead date, keep serving the cached credentials and refresh them in the background.
+        if ([self shouldRefreshAhead]) {
+            [self refreshCredentials];
+        }
         return [AWSTask taskWithResult:credentials];
     }
     
+    // A caller's cancellation only stops it from waiting; the shared refresh keeps going for the other callers.
+    return [[self refreshCredentials] continueWithBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        if (cancellationTokenSource.isCancellationRequested) {
+            return [AWSTask cancelledTask];
+        }
+        return task;
+    }];
+}
+
+- (AWSTask<AWSCredentials *> *)refreshCredentials {
+    AWSTaskCompletionSource<AWSCredentials *> *refreshSource = nil;
+    @synchronized (self) {
+        // Concurrent callers share the refresh that is already in flight.
+        if (self.refreshTask) {
+            return self.refreshTask;
+        }
+        // Callers share the error of a recent failed refresh instead of each starting a new one.
+        if (self.refreshFailureTask && [self.refreshFailureExpiration timeIntervalSinceNow] > 0) {
+            return self.refreshFailureTask;
+        }
+        refreshSource = [AWSTaskCompletionSource taskCompletionSource];
+        self.refreshTask = refreshSource.task;
+    }
+
+    [[self refreshTaskWithCancellationToken:nil] continueWithBlock:^id(AWSTask *task) {
+        if (task.error) {
+            AWSDDLogError(@"Unable to refresh. Error is [%@]", task.error);
+        }
+
+        @synchronized (self) {
+            self.refreshTask = nil;
+            if (task.error) {
+                NSTimeInterval failureInterval = MIN(AWSCognitoCredentialsProviderRefreshFailureInterval * pow(2, self.refreshFailureCount),
+                                                     AWSCognitoCredentialsProviderMaximumRefreshFailureInterval);
+                self.refreshFailureCount++;
+                self.refreshFailureTask = [AWSTask taskWithError:task.error];
+                self.refreshFailureExpiration = [NSDate dateWithTimeIntervalSinceNow:failureInterval];
+            } else {
+                [self resetRefreshFailure];
+            }
+        }
+
+        if (task.isCancelled) {
+            [refreshSource cancel];
+        } else if (task.error) {
+            [refreshSource setError:task.error];
+        } else {
+            [refreshSource setResult:task.result];
+        }
+        return nil;
+    }];
+
+    return refreshSource.task;
+}
+
+- (AWSTask<AWSCredentials *> *)refreshTaskWithCancellationToken:(AWSCancellationTokenSource *) cancellationTokenSource {
     id<AWSCognitoCredentialsProviderHelper> providerRef = self.identityProvider;
-    return [[[providerRef logins] continueWithExecutor:self.refreshExecutor withSuccessBlock:^id _Nullable(AWSTask<NSDictionary<NSString *,NSString *> *> * _Nonnull task) {
+    return [[providerRef logins] continueWithExecutor:self.refreshExecutor withSuccessBlock:^id _Nullable(AWSTask<NSDictionary<NSString *,NSString *> *> * _Nonnull task) {
         
         if (cancellationTokenSource.isCancellationRequested) {
             return [AWSTask cancelledTask];
@@ -662,36 +744,16 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
             // 1. The cached logins are different from the one the identity provider provided.
             // 2. The cached credentials is nil.
             // 3. The credentials expire within 10 minutes.
-            credentials = self.internalCredentials.copy;
+            // 4. The credentials are past their refresh-ahead date.
+            AWSCredentials *credentials = self.internalCredentials.copy;
             NSDictionary<NSString *, NSString *> *cachedLogins = self.cachedLogins;
             if ((!cachedLogins || [cachedLogins isEqualToDictionary:logins])
                 && credentials
-                && credentials.isValid) {
+                && credentials.isValid
+                && ![self shouldRefreshAhead]) {
                 return [AWSTask taskWithResult:credentials];
             }
             
-            if (self.isRefreshingCredentials) {
-                // Waits up to 60 seconds for the Google SDK to refresh a token.
-                if (dispatch_semaphore_wait(self.semaphore, dispatch_time(DISPATCH_TIME_NOW, 60 * NSEC_PER_SEC)) != 0) {
-                    NSError *error = [NSError errorWithDomain:AWSCognitoCredentialsProviderErrorDomain
-                                                         code:AWSCognitoCredentialsProviderCredentialsRefreshTimeout
-                                                     userInfo:nil];
-                    return [AWSTask taskWithError:error];
-                }
-            }
-            
-            if (cancellationTokenSource.isCancellationRequested) {
-                return [AWSTask cancelledTask];
-            }
-            credentials = self.internalCredentials.copy;
-            cachedLogins = self.cachedLogins;
-            if ((!cachedLogins || [cachedLogins isEqualToDictionary:logins])
-                && credentials
-                && credentials.isValid) {
-                return [AWSTask taskWithResult:credentials];
-            }
-            
-            self.refreshingCredentials = YES;
             self.cachedLogins = logins;
             
             if (self.useEnhancedFlow) {
@@ -713,18 +775,22 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
             }
             
         }];
-    }] continueWithBlock:^id(AWSTask *task) {
-        if (task.error) {
-            AWSDDLogError(@"Unable to refresh. Error is [%@]", task.error);
-        }
-        
-        self.refreshingCredentials = NO;
-        dispatch_semaphore_signal(self.semaphore);
-        
-        return task;
     }];
 }
 
+- (BOOL)shouldRefreshAhead {
+    NSDate *refreshAheadDate = self.refreshAheadDate;
+    return refreshAheadDate && [refreshAheadDate timeIntervalSinceNow] <= 0;
+}
+
+- (NSDate *)refreshAheadDateForCredentials:(AWSCredentials *)credentials {
+    if (!credentials.expiration || self.refreshAheadRatio >= 1.0) {
+        return nil;
+    }
+    NSTimeInterval remainingLifetime = MAX([credentials.expiration timeIntervalSinceNow], 0);
+    return [NSDate dateWithTimeIntervalSinceNow:remainingLifetime * MAX(self.refreshAheadRatio, 0)];
+}
+
 #pragma mark - AWSCredentialsProvider methods
 
 - (AWSTask<AWSCredentials *> *)credentials {
@@ -733,6 +799,15 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (void)invalidateCachedTemporaryCredentials {
     self.internalCredentials = nil;
+    @synchronized (self) {
+        [self resetRefreshFailure];
+    }
+}
+
+- (void)resetRefreshFailure {
+    self.refreshFailureTask = nil;
+    self.refreshFailureExpiration = nil;
+    self.refreshFailureCount = 0;
 }
 
 #pragma mark -
@@ -826,8 +901,10 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (AWSCredentials *)internalCredentials {
     @synchronized (self) {
-        if (!_internalCredentials) {
+        // The keychain is only read once; afterwards the in-memory copy is authoritative.
+        if (!_internalCredentialsLoaded) {
             _internalCredentials = [[AWSCredentials alloc] initFromKeychain:self.keychain];
+            _internalCredentialsLoaded = YES;
         }
         return _internalCredentials;
     }
@@ -836,15 +913,15 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 - (void)setInternalCredentials:(AWSCredentials *)internalCredentials {
     @synchronized (self) {
         _internalCredentials = internalCredentials;
-
-        self.keychain[AWSCredentialsProviderKeychainAccessKeyId] = internalCredentials.accessKey;
-        self.keychain[AWSCredentialsProviderKeychainSecretAccessKey] = internalCredentials.secretKey;
-        self.keychain[AWSCredentialsProviderKeychainSessionToken] = internalCredentials.sessionKey;
-        if (internalCredentials.expiration) {
-            self.keychain[AWSCredentialsProviderKeychainExpiration] = [NSString stringWithFormat:@"%f", [internalCredentials.expiration timeIntervalSince1970]];
-        } else {
-            self.keychain[AWSCredentialsProviderKeychainExpiration] = nil;
-        }
+        _internalCredentialsLoaded = YES;
+        self.refreshAheadDate = [self refreshAheadDateForCredentials:internalCredentials];
+
+        // Persist to the keychain off the calling thread. The serial queue keeps the writes in order.
+        AWSUICKeyChainStore *keychain = self.keychain;
+        NSDictionary<NSString *, id> *keychainValues = [AWSCredentials keychainValuesForCredentials:internalCredentials];
+        dispatch_async(self.persistenceQueue, ^{
+            [keychain setStrings:keychainValues];
+        });
     }
 }
 
@@ -18,8 +18,8 @@ NS_ASSUME_NONNULL_BEGIN
 @interface AWSExecutor : NSObject
 
 /*!
- Returns a default executor, which runs continuations immediately until the call stack gets too
- deep, then dispatches to a new GCD queue.
+ Returns a default executor, which runs continuations immediately until they are nested too
+ deeply on one thread, then dispatches them to a global queue.
  */
 + (instancetype)defaultExecutor;
 
@@ -33,6 +33,32 @@ NS_ASSUME_NONNULL_BEGIN
  */
 + (instancetype)mainThreadExecutor;
 
+/*!
+ Returns an executor that runs continuations on the SDK's bounded pool of threads, at the given quality of service.
+
+ The executors of every quality of service share the pool. At most `maximumConcurrentBlockCount` blocks run at once,
+ and a freed slot goes to the waiting block with the highest quality of service. A block blocked in
+ `-[AWSTask waitUntilFinished]` gives up its slot until the task completes. Blocks that wait in any other way, such as
+ on a semaphore, keep their slot, so continuations that wait on each other that way can deadlock the pool and belong
+ on the default executor instead.
+
+ @param qualityOfService The quality of service to run continuations at.
+ */
++ (instancetype)executorWithQualityOfService:(NSQualityOfService)qualityOfService;
+
+/*!
+ The number of blocks the pool behind `executorWithQualityOfService:` runs at once. Defaults to twice the number of
+ active processors.
+ */
++ (NSUInteger)maximumConcurrentBlockCount;
+
+/*!
+ Sets the number of blocks the pool behind `executorWithQualityOfService:` runs at once.
+
+ @param maximumConcurrentBlockCount The number of blocks, at least 1.
+ */
++ (void)setMaximumConcurrentBlockCount:(NSUInteger)maximumConcurrentBlockCount;
+
 /*!
  Returns a new executor that uses the given block to execute continuations.
  @param block The block to use.
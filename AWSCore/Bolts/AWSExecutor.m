@@ -10,31 +10,212 @@
 
 #import "AWSExecutor.h"
 
-#import <pthread.h>
+#import <os/lock.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
-/*!
- Get the remaining stack-size of the current thread.
+// The default executor dispatches continuations nested deeper than this on one thread.
+static NSUInteger const AWSExecutorMaximumInlineDepth = 20;
+
+static _Thread_local NSUInteger AWSExecutorInlineDepth = 0;
+static _Thread_local BOOL AWSExecutorRunningPoolBlock = NO;
 
- @param totalSize The total stack size of the current thread.
+// The pool's queues, in order of precedence.
+typedef NS_ENUM(NSUInteger, AWSExecutorLane) {
+    AWSExecutorLaneUserInteractive,
+    AWSExecutorLaneUserInitiated,
+    AWSExecutorLaneDefault,
+    AWSExecutorLaneUtility,
+    AWSExecutorLaneBackground,
+    AWSExecutorLaneCount,
+};
+
+static AWSExecutorLane AWSExecutorLaneForQualityOfService(qos_class_t qualityOfService) {
+    switch (qualityOfService) {
+        case QOS_CLASS_USER_INTERACTIVE:
+            return AWSExecutorLaneUserInteractive;
+        case QOS_CLASS_USER_INITIATED:
+            return AWSExecutorLaneUserInitiated;
+        case QOS_CLASS_UTILITY:
+            return AWSExecutorLaneUtility;
+        case QOS_CLASS_BACKGROUND:
+            return AWSExecutorLaneBackground;
+        default:
+            return AWSExecutorLaneDefault;
+    }
+}
 
- @return The remaining size, in bytes, available to the current thread.
+static qos_class_t const AWSExecutorLaneQualityOfService[AWSExecutorLaneCount] = {
+    QOS_CLASS_USER_INTERACTIVE,
+    QOS_CLASS_USER_INITIATED,
+    QOS_CLASS_DEFAULT,
+    QOS_CLASS_UTILITY,
+    QOS_CLASS_BACKGROUND,
+};
 
- @note This function cannot be inlined, as otherwise the internal implementation could fail to report the proper
- remaining stack space.
+/*!
+ Runs blocks on the global queues, but no more than `limit` at a time, so that a burst of continuations which block
+ doesn't make GCD spawn a thread for each of them.
  */
-__attribute__((noinline)) static size_t remaining_stack_size(size_t *restrict totalSize) {
-    pthread_t currentThread = pthread_self();
+@interface AWSExecutorPool : NSObject {
+    os_unfair_lock _lock;
+    NSMutableArray<dispatch_block_t> *_lanes[AWSExecutorLaneCount];
+    NSUInteger _limit;
+    NSUInteger _running;
+    // Running blocks waiting for a task, which don't count against the limit.
+    NSUInteger _blocked;
+}
+
++ (instancetype)sharedPool;
+
+- (NSUInteger)limit;
+- (void)setLimit:(NSUInteger)limit;
+- (void)enqueueBlock:(dispatch_block_t)block lane:(AWSExecutorLane)lane;
+- (void)willBlock;
+- (void)didUnblock;
+
+@end
+
+@implementation AWSExecutorPool
+
++ (instancetype)sharedPool {
+    static AWSExecutorPool *sharedPool = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedPool = [AWSExecutorPool new];
+    });
+    return sharedPool;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        for (NSUInteger lane = 0; lane < AWSExecutorLaneCount; lane++) {
+            _lanes[lane] = [NSMutableArray new];
+        }
+        _limit = MAX([NSProcessInfo processInfo].activeProcessorCount * 2, 2);
+    }
+    return self;
+}
+
+- (NSUInteger)limit {
+    os_unfair_lock_lock(&_lock);
+    NSUInteger limit = _limit;
+    os_unfair_lock_unlock(&_lock);
+    return limit;
+}
+
+- (void)setLimit:(NSUInteger)limit {
+    os_unfair_lock_lock(&_lock);
+    _limit = MAX(limit, 1);
+    [self startWorkersLocked];
+}
+
+- (void)enqueueBlock:(dispatch_block_t)block lane:(AWSExecutorLane)lane {
+    os_unfair_lock_lock(&_lock);
+    [_lanes[lane] addObject:[block copy]];
+    [self startWorkersLocked];
+}
+
+- (void)willBlock {
+    os_unfair_lock_lock(&_lock);
+    _blocked++;
+    [self startWorkersLocked];
+}
+
+- (void)didUnblock {
+    os_unfair_lock_lock(&_lock);
+    _blocked--;
+    os_unfair_lock_unlock(&_lock);
+}
+
+// Takes the next block in order of precedence. Must be called with the lock held.
+- (nullable dispatch_block_t)dequeueBlockLocked:(AWSExecutorLane *)lane {
+    for (AWSExecutorLane candidate = 0; candidate < AWSExecutorLaneCount; candidate++) {
+        NSMutableArray<dispatch_block_t> *queue = _lanes[candidate];
+        if (queue.count > 0) {
+            dispatch_block_t block = queue.firstObject;
+            [queue removeObjectAtIndex:0];
+            *lane = candidate;
+            return block;
+        }
+    }
+    return nil;
+}
+
+// Starts as many workers as there are free slots and waiting blocks, and releases the lock.
+- (void)startWorkersLocked {
+    NSMutableArray<dispatch_block_t> *blocks = nil;
+    NSMutableArray<NSNumber *> *lanes = nil;
+    while (_running < _limit + _blocked) {
+        AWSExecutorLane lane;
+        dispatch_block_t block = [self dequeueBlockLocked:&lane];
+        if (!block) {
+            break;
+        }
+        if (!blocks) {
+            blocks = [NSMutableArray new];
+            lanes = [NSMutableArray new];
+        }
+        [blocks addObject:block];
+        [lanes addObject:@(lane)];
+        _running++;
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    for (NSUInteger i = 0; i < blocks.count; i++) {
+        [self startWorkerWithBlock:blocks[i] lane:lanes[i].unsignedIntegerValue];
+    }
+}
+
+- (void)startWorkerWithBlock:(dispatch_block_t)block lane:(AWSExecutorLane)lane {
+    dispatch_async(dispatch_get_global_queue(AWSExecutorLaneQualityOfService[lane], 0), ^{
+        [self runWorkerWithBlock:block lane:lane];
+    });
+}
+
+- (void)runWorkerWithBlock:(dispatch_block_t)block lane:(AWSExecutorLane)lane {
+    while (block) {
+        AWSExecutorRunningPoolBlock = YES;
+        @try {
+            @autoreleasepool {
+                block();
+            }
+        } @finally {
+            AWSExecutorRunningPoolBlock = NO;
+        }
+
+        AWSExecutorLane nextLane;
+        os_unfair_lock_lock(&_lock);
+        // A slot given up by a blocked block is only borrowed, so it goes back once the block has unblocked.
+        dispatch_block_t next = _running <= _limit + _blocked ? [self dequeueBlockLocked:&nextLane] : nil;
+        if (!next) {
+            _running--;
+        }
+        os_unfair_lock_unlock(&_lock);
+
+        block = nil;
+        if (next && nextLane == lane) {
+            block = next;
+        } else if (next) {
+            // Runs at the quality of service of its own lane.
+            [self startWorkerWithBlock:next lane:nextLane];
+        }
+    }
+}
 
-    // NOTE: We must store stack pointers as uint8_t so that the pointer math is well-defined
-    uint8_t *endStack = pthread_get_stackaddr_np(currentThread);
-    *totalSize = pthread_get_stacksize_np(currentThread);
+@end
 
-    // NOTE: If the function is inlined, this value could be incorrect
-    uint8_t *frameAddr = __builtin_frame_address(0);
+void awsbf_executorWillBlock(void) {
+    if (AWSExecutorRunningPoolBlock) {
+        [[AWSExecutorPool sharedPool] willBlock];
+    }
+}
 
-    return (*totalSize) - (size_t)(endStack - frameAddr);
+void awsbf_executorDidUnblock(void) {
+    if (AWSExecutorRunningPoolBlock) {
+        [[AWSExecutorPool sharedPool] didUnblock];
+    }
 }
 
 @interface AWSExecutor ()
@@ -53,16 +234,20 @@ __attribute__((noinline)) static size_t remaining_stack_size(size_t *restrict to
     dispatch_once(&onceToken, ^{
         defaultExecutor = [self executorWithBlock:^void(void(^block)(void)) {
             // We prefer to run everything possible immediately, so that there is callstack information
-            // when debugging. However, we don't want the stack to get too deep, so if the remaining stack space
-            // is less than 10% of the total space, we dispatch to another GCD queue.
-            size_t totalStackSize = 0;
-            size_t remainingStackSize = remaining_stack_size(&totalStackSize);
-
-            if (remainingStackSize < (totalStackSize / 10)) {
-                dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), block);
+            // when debugging. However, we don't want the stack to get too deep, so past a fixed depth of
+            // nested continuations we dispatch to a global queue, at the quality of service of the current thread.
+            // Continuations of the default executor may block in ways the pool can't see, such as semaphores, so
+            // they don't go through the bounded pool.
+            if (AWSExecutorInlineDepth >= AWSExecutorMaximumInlineDepth) {
+                dispatch_async(dispatch_get_global_queue(qos_class_self(), 0), block);
             } else {
-                @autoreleasepool {
-                    block();
+                AWSExecutorInlineDepth++;
+                @try {
+                    @autoreleasepool {
+                        block();
+                    }
+                } @finally {
+                    AWSExecutorInlineDepth--;
                 }
             }
         }];
@@ -98,6 +283,27 @@ __attribute__((noinline)) static size_t remaining_stack_size(size_t *restrict to
     return mainThreadExecutor;
 }
 
++ (instancetype)executorWithQualityOfService:(NSQualityOfService)qualityOfService {
+    static AWSExecutor *executors[AWSExecutorLaneCount];
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        for (AWSExecutorLane lane = 0; lane < AWSExecutorLaneCount; lane++) {
+            executors[lane] = [self executorWithBlock:^void(void(^block)(void)) {
+                [[AWSExecutorPool sharedPool] enqueueBlock:block lane:lane];
+            }];
+        }
+    });
+    return executors[AWSExecutorLaneForQualityOfService((qos_class_t)qualityOfService)];
+}
+
++ (NSUInteger)maximumConcurrentBlockCount {
+    return [AWSExecutorPool sharedPool].limit;
+}
+
++ (void)setMaximumConcurrentBlockCount:(NSUInteger)maximumConcurrentBlockCount {
+    [AWSExecutorPool sharedPool].limit = maximumConcurrentBlockCount;
+}
+
 + (instancetype)executorWithBlock:(void(^)(void(^block)(void)))block {
     return [[self alloc] initWithBlock:block];
 }
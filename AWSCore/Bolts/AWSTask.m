@@ -21,23 +21,48 @@ __attribute__ ((noinline)) void awsbf_warnBlockingOperationOnMainThread(void) {
           " Break on awsbf_warnBlockingOperationOnMainThread() to debug.");
 }
 
+// Defined in AWSExecutor.m. Lets a block running on the executor pool give up its slot while it waits.
+extern void awsbf_executorWillBlock(void);
+extern void awsbf_executorDidUnblock(void);
+
 NSString *const AWSTaskErrorDomain = @"bolts";
 NSInteger const kAWSMultipleErrorsError = 80175001;
 
 NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
 
+// A continuation waiting for the task to complete. The first one is stored in the task itself, so the common case of a
+// single continuation allocates nothing.
+typedef struct AWSTaskContinuation {
+    struct AWSTaskContinuation *next;
+    // A retained `dispatch_block_t`.
+    void *block;
+    // A retained `AWSExecutor`, or `NULL` for a `waitUntilFinished` call, which is woken up before the others run.
+    void *executor;
+} AWSTaskContinuation;
+
+// Replaces the continuation list when the task completes. Nothing can be added after it.
+#define AWSTaskContinuationsSealed ((AWSTaskContinuation *)(uintptr_t)1)
+
+enum {
+    AWSTaskStatePending = 0,
+    // One of the `trySet` methods won and is storing the outcome.
+    AWSTaskStateCompleting,
+    AWSTaskStateCompleted,
+};
+
 @interface AWSTask () {
     id _result;
     NSError *_error;
-}
-
-@property (nonatomic, assign, readwrite, getter=isCancelled) BOOL cancelled;
-@property (nonatomic, assign, readwrite, getter=isFaulted) BOOL faulted;
-@property (nonatomic, assign, readwrite, getter=isCompleted) BOOL completed;
+    BOOL _cancelled;
+    BOOL _faulted;
 
-@property (nonatomic, strong) NSObject *lock;
-@property (nonatomic, strong) NSCondition *condition;
-@property (nonatomic, strong) NSMutableArray *callbacks;
+    // The outcome above is only read once the state is completed, and never written after that.
+    _Atomic(int) _state;
+    // Continuations in reverse order of registration, or `AWSTaskContinuationsSealed`.
+    _Atomic(AWSTaskContinuation *) _continuations;
+    _Atomic(bool) _inlineContinuationClaimed;
+    AWSTaskContinuation _inlineContinuation;
+}
 
 @end
 
@@ -45,17 +70,6 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
 
 #pragma mark - Initializer
 
-- (instancetype)init {
-    self = [super init];
-    if (!self) return self;
-
-    _lock = [[NSObject alloc] init];
-    _condition = [[NSCondition alloc] init];
-    _callbacks = [NSMutableArray array];
-
-    return self;
-}
-
 - (instancetype)initWithResult:(nullable id)result {
     self = [super init];
     if (!self) return self;
@@ -118,8 +132,7 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
                 atomic_fetch_add(&cancelled, 1);
             }
 
-            atomic_fetch_sub(&total, 1);
-            if (total == 0) {
+            if (atomic_fetch_sub(&total, 1) == 1) {
                 if (errors.count > 0) {
                     if (errors.count == 1) {
                         tcs.error = [errors firstObject];
@@ -176,9 +189,8 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
                 }
             }
 
-            atomic_fetch_sub(&total, 1);
             BOOL expected = NO;
-            if (total == 0 && atomic_compare_exchange_strong(&completed, &expected, YES)) {
+            if (atomic_fetch_sub(&total, 1) == 1 && atomic_compare_exchange_strong(&completed, &expected, YES)) {
                 if (cancelled > 0) {
                     [source cancel];
                 } else if (errors.count > 0) {
@@ -234,82 +246,133 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
 
 #pragma mark - Custom Setters/Getters
 
-- (nullable id)result {
-    @synchronized(self.lock) {
-        return _result;
-    }
+- (BOOL)isCompleted {
+    return atomic_load_explicit(&_state, memory_order_acquire) == AWSTaskStateCompleted;
 }
 
-- (BOOL)trySetResult:(nullable id)result {
-    @synchronized(self.lock) {
-        if (self.completed) {
-            return NO;
-        }
-        self.completed = YES;
-        _result = result;
-        [self runContinuations];
-        return YES;
-    }
+- (nullable id)result {
+    return self.completed ? _result : nil;
 }
 
 - (nullable NSError *)error {
-    @synchronized(self.lock) {
-        return _error;
-    }
+    return self.completed ? _error : nil;
+}
+
+- (BOOL)isCancelled {
+    return self.completed && _cancelled;
+}
+
+- (BOOL)isFaulted {
+    return self.completed && _faulted;
+}
+
+- (BOOL)trySetResult:(nullable id)result {
+    return [self completeWithResult:result error:nil faulted:NO cancelled:NO];
 }
 
 - (BOOL)trySetError:(NSError *)error {
-    @synchronized(self.lock) {
-        if (self.completed) {
-            return NO;
-        }
-        self.completed = YES;
-        self.faulted = YES;
-        _error = error;
-        [self runContinuations];
-        return YES;
-    }
+    return [self completeWithResult:nil error:error faulted:YES cancelled:NO];
 }
 
-- (BOOL)isCancelled {
-    @synchronized(self.lock) {
-        return _cancelled;
-    }
+- (BOOL)trySetCancelled {
+    return [self completeWithResult:nil error:nil faulted:NO cancelled:YES];
 }
 
-- (BOOL)isFaulted {
-    @synchronized(self.lock) {
-        return _faulted;
+- (BOOL)completeWithResult:(nullable id)result
+                     error:(nullable NSError *)error
+                   faulted:(BOOL)faulted
+                 cancelled:(BOOL)cancelled {
+    int expected = AWSTaskStatePending;
+    if (!atomic_compare_exchange_strong_explicit(&_state, &expected, AWSTaskStateCompleting,
+                                                 memory_order_acquire, memory_order_relaxed)) {
+        return NO;
     }
+
+    _result = result;
+    _error = error;
+    _faulted = faulted;
+    _cancelled = cancelled;
+    atomic_store_explicit(&_state, AWSTaskStateCompleted, memory_order_release);
+
+    [self runContinuations];
+    return YES;
 }
 
-- (BOOL)trySetCancelled {
-    @synchronized(self.lock) {
-        if (self.completed) {
-            return NO;
+- (void)runContinuations {
+    AWSTaskContinuation *continuations = atomic_exchange_explicit(&_continuations, AWSTaskContinuationsSealed, memory_order_acq_rel);
+
+    // Restores the order of registration.
+    AWSTaskContinuation *ordered = NULL;
+    while (continuations) {
+        AWSTaskContinuation *next = continuations->next;
+        continuations->next = ordered;
+        ordered = continuations;
+        continuations = next;
+    }
+
+    for (AWSTaskContinuation *continuation = ordered; continuation; continuation = continuation->next) {
+        if (!continuation->executor) {
+            ((__bridge dispatch_block_t)continuation->block)();
         }
-        self.completed = YES;
-        self.cancelled = YES;
-        [self runContinuations];
-        return YES;
     }
-}
 
-- (BOOL)isCompleted {
-    @synchronized(self.lock) {
-        return _completed;
+    AWSTaskContinuation *inlineContinuation = &_inlineContinuation;
+    while (ordered) {
+        AWSTaskContinuation *continuation = ordered;
+        ordered = continuation->next;
+
+        dispatch_block_t block = (__bridge_transfer dispatch_block_t)continuation->block;
+        AWSExecutor *executor = (__bridge_transfer AWSExecutor *)continuation->executor;
+        if (continuation != inlineContinuation) {
+            free(continuation);
+        }
+        // The task may be deallocated once its last continuation has run, so it isn't touched after this.
+        [executor execute:block];
     }
 }
 
-- (void)runContinuations {
-    @synchronized(self.lock) {
-        [self.condition lock];
-        [self.condition broadcast];
-        [self.condition unlock];
-        for (void (^callback)(void) in self.callbacks) {
-            callback();
+// Returns NO without adding the block when the task has already completed.
+- (BOOL)addContinuation:(dispatch_block_t)block executor:(nullable AWSExecutor *)executor {
+    AWSTaskContinuation *continuation = NULL;
+    if (!atomic_exchange_explicit(&_inlineContinuationClaimed, true, memory_order_relaxed)) {
+        continuation = &_inlineContinuation;
+    } else {
+        continuation = malloc(sizeof(AWSTaskContinuation));
+    }
+    continuation->block = (__bridge_retained void *)[block copy];
+    continuation->executor = (__bridge_retained void *)executor;
+
+    AWSTaskContinuation *head = atomic_load_explicit(&_continuations, memory_order_acquire);
+    do {
+        if (head == AWSTaskContinuationsSealed) {
+            CFRelease(continuation->block);
+            if (continuation->executor) {
+                CFRelease(continuation->executor);
+            }
+            if (continuation != &_inlineContinuation) {
+                free(continuation);
+            }
+            return NO;
         }
-        [self.callbacks removeAllObjects];
+        continuation->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&_continuations, &head, continuation,
+                                                    memory_order_release, memory_order_acquire));
+    return YES;
+}
+
+- (void)dealloc {
+    // A task that never completed still owns its continuations.
+    AWSTaskContinuation *continuation = atomic_exchange_explicit(&_continuations, AWSTaskContinuationsSealed, memory_order_acquire);
+    while (continuation && continuation != AWSTaskContinuationsSealed) {
+        AWSTaskContinuation *next = continuation->next;
+        CFRelease(continuation->block);
+        if (continuation->executor) {
+            CFRelease(continuation->executor);
+        }
+        if (continuation != &_inlineContinuation) {
+            free(continuation);
+        }
+        continuation = next;
     }
 }
 
@@ -358,16 +421,7 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
         }
     };
 
-    BOOL completed;
-    @synchronized(self.lock) {
-        completed = self.completed;
-        if (!completed) {
-            [self.callbacks addObject:[^{
-                [executor execute:executionBlock];
-            } copy]];
-        }
-    }
-    if (completed) {
+    if (self.completed || ![self addContinuation:executionBlock executor:executor]) {
         [executor execute:executionBlock];
     }
 
@@ -422,35 +476,27 @@ NSString *const AWSTaskMultipleErrorsUserInfoKey = @"errors";
         [self warnOperationOnMainThread];
     }
 
-    @synchronized(self.lock) {
-        if (self.completed) {
-            return;
-        }
-        [self.condition lock];
+    if (self.completed) {
+        return;
     }
-    // TODO: (nlutsenko) Restructure this to use Bolts-Swift thread access synchronization architecture
-    // In the meantime, it's absolutely safe to get `_completed` aka an ivar, as long as it's a `BOOL` aka less than word size.
-    while (!_completed) {
-        [self.condition wait];
+    // Waiting is rare, so nothing to wait on is created until someone does.
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    if ([self addContinuation:^{
+        dispatch_semaphore_signal(semaphore);
+    } executor:nil]) {
+        awsbf_executorWillBlock();
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        awsbf_executorDidUnblock();
     }
-    [self.condition unlock];
 }
 
 #pragma mark - NSObject
 
 - (NSString *)description {
-    // Acquire the data from the locked properties
-    BOOL completed;
-    BOOL cancelled;
-    BOOL faulted;
-    NSString *resultDescription = nil;
-
-    @synchronized(self.lock) {
-        completed = self.completed;
-        cancelled = self.cancelled;
-        faulted = self.faulted;
-        resultDescription = completed ? [NSString stringWithFormat:@" result = %@", self.result] : @"";
-    }
+    BOOL completed = self.completed;
+    BOOL cancelled = self.cancelled;
+    BOOL faulted = self.faulted;
+    NSString *resultDescription = completed ? [NSString stringWithFormat:@" result = %@", self.result] : @"";
 
     // Description string includes status information and, if available, the
     // result since in some ways this is what a promise actually "is".
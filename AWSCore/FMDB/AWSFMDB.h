@@ -6,3 +6,4 @@
 
 // AWS Helpers
 #import "AWSFMDB+AWSHelpers.h"
+#import "AWSFMDatabaseStore.h"
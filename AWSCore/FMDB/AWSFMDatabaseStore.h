@@ -0,0 +1,135 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSFMDatabasePool.h"
+#import "AWSFMDatabaseQueue.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The number of reader connections of a store created with `+storeWithPath:`.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSFMDatabaseStoreDefaultMaximumNumberOfReaders;
+
+/**
+ How long a connection of a store created with `+storeWithPath:` retries a statement while the database is locked.
+ */
+FOUNDATION_EXPORT NSTimeInterval const AWSFMDatabaseStoreDefaultBusyTimeout;
+
+/**
+ The checkpoint modes of `sqlite3_wal_checkpoint_v2`.
+ */
+typedef NS_ENUM(NSInteger, AWSFMDatabaseCheckpointMode) {
+    /** Copies as many frames as possible without waiting for readers or writers. */
+    AWSFMDatabaseCheckpointModePassive = 0,
+    /** Waits for the writer and copies every frame, waiting for readers of older frames. */
+    AWSFMDatabaseCheckpointModeFull = 1,
+    /** Like `AWSFMDatabaseCheckpointModeFull`, then waits until the log can be restarted from its beginning. */
+    AWSFMDatabaseCheckpointModeRestart = 2,
+    /** Like `AWSFMDatabaseCheckpointModeRestart`, then truncates the log file to zero bytes. */
+    AWSFMDatabaseCheckpointModeTruncate = 3,
+};
+
+/**
+ A SQLite database in write-ahead logging (WAL) mode with one writer connection and a bounded set of reader connections.
+
+ Writes are serialized on the writer connection the same way `AWSFMDatabaseQueue` serializes every statement. Reads run
+ on their own connections and see the last committed state of the database, so they neither wait for a write in
+ progress nor block it.
+
+ `inDatabase:` and `inTransaction:` use the writer, so code written against `AWSFMDatabaseQueue` keeps working after
+ changing the type, and only statements that don't write have to be moved to `inReadDatabase:`.
+ */
+@interface AWSFMDatabaseStore : NSObject
+
+/**
+ Opens the database at `path`, creating it if necessary, with `AWSFMDatabaseStoreDefaultMaximumNumberOfReaders` readers
+ and a busy timeout of `AWSFMDatabaseStoreDefaultBusyTimeout`.
+
+ @param path The file path of the database.
+
+ @return The store. `nil` on error.
+ */
++ (nullable instancetype)storeWithPath:(NSString *)path;
+
+/**
+ Opens the database at `path`, creating it if necessary, and switches it to WAL mode.
+
+ @param path                   The file path of the database.
+ @param maximumNumberOfReaders The number of reader connections. `inReadDatabase:` waits while all of them are in use.
+                               Must be at least 1.
+ @param busyTimeout            How long each connection retries a statement while the database is locked, for example
+                               by a checkpoint or another process.
+
+ @return The store. `nil` on error.
+ */
+- (nullable instancetype)initWithPath:(NSString *)path
+               maximumNumberOfReaders:(NSUInteger)maximumNumberOfReaders
+                          busyTimeout:(NSTimeInterval)busyTimeout NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) NSString *path;
+
+@property (nonatomic, assign, readonly) NSUInteger maximumNumberOfReaders;
+
+@property (nonatomic, assign, readonly) NSTimeInterval busyTimeout;
+
+/**
+ The number of pages in the log after which a commit runs a passive checkpoint. `0` turns automatic checkpoints off.
+ The default is SQLite's, 1000 pages.
+ */
+@property (atomic, assign) NSUInteger autoCheckpointPageCount;
+
+/**
+ The size in bytes of the database file and its log.
+ */
+@property (nonatomic, assign, readonly) unsigned long long fileSize;
+
+/**
+ Runs `block` on the writer connection. Blocks until the writer is free.
+ */
+- (void)inDatabase:(void (^)(AWSFMDatabase *db))block;
+
+/**
+ Runs `block` in an exclusive transaction on the writer connection. Blocks until the writer is free.
+ */
+- (void)inTransaction:(void (^)(AWSFMDatabase *db, BOOL *rollback))block;
+
+/**
+ Runs `block` in a read transaction on a reader connection, so every statement in it sees the same committed state of
+ the database. Blocks while all readers are in use; don't nest calls. The connection is opened read-only.
+ */
+- (void)inReadDatabase:(void (^)(AWSFMDatabase *db))block;
+
+/**
+ Copies the frames of the log into the database file.
+
+ @param mode  The checkpoint mode.
+ @param error The error, if the checkpoint failed or was interrupted by a lock held past `busyTimeout`.
+
+ @return `YES` on success.
+ */
+- (BOOL)checkpointWithMode:(AWSFMDatabaseCheckpointMode)mode error:(NSError **)error;
+
+/**
+ Closes every connection. The store can't be used afterwards.
+ */
+- (void)close;
+
+@end
+
+NS_ASSUME_NONNULL_END
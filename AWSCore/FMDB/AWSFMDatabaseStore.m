@@ -0,0 +1,190 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <sqlite3.h>
+#import "AWSFMDatabaseStore.h"
+#import "AWSFMDatabase.h"
+#import "AWSFMDatabaseAdditions.h"
+#import "AWSFMDB+AWSHelpers.h"
+#import "AWSCocoaLumberjack.h"
+
+NSUInteger const AWSFMDatabaseStoreDefaultMaximumNumberOfReaders = 4;
+NSTimeInterval const AWSFMDatabaseStoreDefaultBusyTimeout = 5;
+
+@interface AWSFMDatabaseStore()
+
+@property (nonatomic, strong) AWSFMDatabaseQueue *writer;
+@property (nonatomic, strong) AWSFMDatabasePool *readers;
+@property (nonatomic, strong) dispatch_semaphore_t readerSemaphore;
+
+@end
+
+@implementation AWSFMDatabaseStore
+
+@synthesize autoCheckpointPageCount = _autoCheckpointPageCount;
+
++ (instancetype)storeWithPath:(NSString *)path {
+    return [[self alloc] initWithPath:path
+               maximumNumberOfReaders:AWSFMDatabaseStoreDefaultMaximumNumberOfReaders
+                          busyTimeout:AWSFMDatabaseStoreDefaultBusyTimeout];
+}
+
+- (instancetype)init {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:@"`- init` is not a valid initializer. Use `+ storeWithPath:` instead."
+                                 userInfo:nil];
+}
+
+- (instancetype)initWithPath:(NSString *)path
+      maximumNumberOfReaders:(NSUInteger)maximumNumberOfReaders
+                 busyTimeout:(NSTimeInterval)busyTimeout {
+    if (self = [super init]) {
+        _path = [path copy];
+        _maximumNumberOfReaders = MAX(maximumNumberOfReaders, 1);
+        _busyTimeout = busyTimeout;
+
+        _writer = [AWSFMDatabaseQueue serialDatabaseQueueWithPath:_path];
+        if (!_writer) {
+            AWSDDLogError(@"Unable to open the database at [%@]", _path);
+            return nil;
+        }
+
+        __block NSUInteger autoCheckpointPageCount = 0;
+        [_writer inDatabase:^(AWSFMDatabase *db) {
+            [db setMaxBusyRetryTimeInterval:busyTimeout];
+            db.shouldCacheStatements = YES;
+
+            // The journal mode is stored in the database file; readers opened later find it there.
+            NSString *journalMode = [db stringForQuery:@"PRAGMA journal_mode = WAL"];
+            if (![journalMode isEqualToString:@"wal"]) {
+                AWSDDLogError(@"Failed to enable WAL mode, the journal mode is '%@'. %@", journalMode, db.lastError);
+            }
+            // Commits in WAL mode stay durable across crashes without a sync on every commit.
+            if (![db executeStatements:@"PRAGMA synchronous = NORMAL"]) {
+                AWSDDLogError(@"Failed to set 'synchronous' to 'NORMAL'. %@", db.lastError);
+            }
+            autoCheckpointPageCount = (NSUInteger)MAX([db longForQuery:@"PRAGMA wal_autocheckpoint"], 0);
+        }];
+        _autoCheckpointPageCount = autoCheckpointPageCount;
+
+        _readers = [AWSFMDatabasePool databasePoolWithPath:_path
+                                                     flags:SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX];
+        _readers.maximumNumberOfDatabasesToCreate = _maximumNumberOfReaders;
+        _readers.delegate = self;
+        _readerSemaphore = dispatch_semaphore_create((long)_maximumNumberOfReaders);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    _readers.delegate = nil;
+}
+
+#pragma mark - AWSFMDatabasePoolDelegate
+
+- (void)databasePool:(AWSFMDatabasePool *)pool didAddDatabase:(AWSFMDatabase *)database {
+    [database setMaxBusyRetryTimeInterval:self.busyTimeout];
+    database.shouldCacheStatements = YES;
+}
+
+#pragma mark -
+
+- (NSUInteger)autoCheckpointPageCount {
+    @synchronized (self) {
+        return _autoCheckpointPageCount;
+    }
+}
+
+- (void)setAutoCheckpointPageCount:(NSUInteger)autoCheckpointPageCount {
+    @synchronized (self) {
+        _autoCheckpointPageCount = autoCheckpointPageCount;
+    }
+    [self.writer inDatabase:^(AWSFMDatabase *db) {
+        NSString *statement = [NSString stringWithFormat:@"PRAGMA wal_autocheckpoint = %lu", (unsigned long)autoCheckpointPageCount];
+        if (![db executeStatements:statement]) {
+            AWSDDLogError(@"Failed to set 'wal_autocheckpoint'. %@", db.lastError);
+        }
+    }];
+}
+
+- (unsigned long long)fileSize {
+    unsigned long long fileSize = 0;
+    for (NSString *suffix in @[@"", @"-wal"]) {
+        NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:[self.path stringByAppendingString:suffix]
+                                                                                    error:nil];
+        fileSize += [attributes fileSize];
+    }
+    return fileSize;
+}
+
+- (void)inDatabase:(void (^)(AWSFMDatabase *db))block {
+    [self.writer inDatabase:block];
+}
+
+- (void)inTransaction:(void (^)(AWSFMDatabase *db, BOOL *rollback))block {
+    [self.writer inTransaction:block];
+}
+
+- (void)inReadDatabase:(void (^)(AWSFMDatabase *db))block {
+    // The pool hands out `nil` instead of waiting when every reader is checked out.
+    dispatch_semaphore_wait(self.readerSemaphore, DISPATCH_TIME_FOREVER);
+    __block BOOL opened = NO;
+    [self.readers inDatabase:^(AWSFMDatabase *db) {
+        if (!db) {
+            return;
+        }
+        opened = YES;
+        if (![db beginDeferredTransaction]) {
+            AWSDDLogError(@"Failed to begin a read transaction. %@", db.lastError);
+        }
+        block(db);
+        if ([db inTransaction] && ![db commit]) {
+            AWSDDLogError(@"Failed to end a read transaction. %@", db.lastError);
+        }
+    }];
+    dispatch_semaphore_signal(self.readerSemaphore);
+
+    if (!opened) {
+        AWSDDLogError(@"Unable to open a reader for [%@]; reading on the writer.", self.path);
+        [self.writer inDatabase:block];
+    }
+}
+
+- (BOOL)checkpointWithMode:(AWSFMDatabaseCheckpointMode)mode error:(NSError **)error {
+    __block NSError *checkpointError = nil;
+    [self.writer inDatabase:^(AWSFMDatabase *db) {
+        int logFrameCount = 0;
+        int checkpointedFrameCount = 0;
+        int result = sqlite3_wal_checkpoint_v2(db.sqliteHandle, NULL, (int)mode, &logFrameCount, &checkpointedFrameCount);
+        if (result != SQLITE_OK) {
+            checkpointError = db.lastError;
+            AWSDDLogError(@"Failed to checkpoint [%@]. %@", self.path, checkpointError);
+        } else {
+            AWSDDLogVerbose(@"Checkpointed %d of %d frames of [%@].", checkpointedFrameCount, logFrameCount, self.path);
+        }
+    }];
+
+    if (checkpointError && error) {
+        *error = checkpointError;
+    }
+    return checkpointError == nil;
+}
+
+- (void)close {
+    [self.readers releaseAllDatabases];
+    [self.writer close];
+}
+
+@end
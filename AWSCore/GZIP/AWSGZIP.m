@@ -33,12 +33,136 @@
 
 #import "AWSGZIP.h"
 #import <zlib.h>
+#import <os/lock.h>
 
 void awsgzip_loadGZIP(void){
 }
 
 static const NSUInteger ChunkSize = 16384;
 
+// The largest output deflate can produce for one byte of input is 1032 bytes, which bounds how much a gzip trailer
+// can make us allocate up front.
+static const NSUInteger MaxCompressionRatio = 1032;
+
+// One deflate and one inflate state are kept between calls and reset instead of being set up and torn down each
+// time, which saves allocating zlib's window and hash tables for every small body. Concurrent callers that find the
+// cached state taken set up their own.
+typedef struct
+{
+    z_stream stream;
+    int level;
+} AWSGZIPDeflater;
+
+static os_unfair_lock CachedStreamsLock = OS_UNFAIR_LOCK_INIT;
+static AWSGZIPDeflater *CachedDeflater = NULL;
+static z_stream *CachedInflater = NULL;
+
+static AWSGZIPDeflater *AWSGZIPTakeDeflater(int level)
+{
+    os_unfair_lock_lock(&CachedStreamsLock);
+    AWSGZIPDeflater *deflater = CachedDeflater;
+    CachedDeflater = NULL;
+    os_unfair_lock_unlock(&CachedStreamsLock);
+
+    if (deflater)
+    {
+        if (deflater->level == level && deflateReset(&deflater->stream) == Z_OK)
+        {
+            return deflater;
+        }
+        deflateEnd(&deflater->stream);
+        free(deflater);
+    }
+
+    // zlib keeps a pointer to the z_stream in its state, so it has to stay at the same address until deflateEnd.
+    deflater = calloc(1, sizeof(AWSGZIPDeflater));
+    if (deflater == NULL)
+    {
+        return NULL;
+    }
+    if (deflateInit2(&deflater->stream, level, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        free(deflater);
+        return NULL;
+    }
+    deflater->level = level;
+    return deflater;
+}
+
+static void AWSGZIPReturnDeflater(AWSGZIPDeflater *deflater)
+{
+    os_unfair_lock_lock(&CachedStreamsLock);
+    AWSGZIPDeflater *previous = CachedDeflater;
+    CachedDeflater = deflater;
+    os_unfair_lock_unlock(&CachedStreamsLock);
+
+    if (previous)
+    {
+        deflateEnd(&previous->stream);
+        free(previous);
+    }
+}
+
+static z_stream *AWSGZIPTakeInflater(void)
+{
+    os_unfair_lock_lock(&CachedStreamsLock);
+    z_stream *inflater = CachedInflater;
+    CachedInflater = NULL;
+    os_unfair_lock_unlock(&CachedStreamsLock);
+
+    if (inflater)
+    {
+        if (inflateReset(inflater) == Z_OK)
+        {
+            return inflater;
+        }
+        inflateEnd(inflater);
+        free(inflater);
+    }
+
+    inflater = calloc(1, sizeof(z_stream));
+    if (inflater == NULL)
+    {
+        return NULL;
+    }
+    // 47 accepts both gzip and zlib headers.
+    if (inflateInit2(inflater, 47) != Z_OK)
+    {
+        free(inflater);
+        return NULL;
+    }
+    return inflater;
+}
+
+static void AWSGZIPReturnInflater(z_stream *inflater)
+{
+    os_unfair_lock_lock(&CachedStreamsLock);
+    z_stream *previous = CachedInflater;
+    CachedInflater = inflater;
+    os_unfair_lock_unlock(&CachedStreamsLock);
+
+    if (previous)
+    {
+        inflateEnd(previous);
+        free(previous);
+    }
+}
+
+// Returns the size to allocate for the inflated data: the length recorded in the gzip trailer when there is one, or a
+// guess that the output grows from.
+static NSUInteger AWSGZIPInflatedLengthHint(const uint8_t *bytes, NSUInteger length)
+{
+    NSUInteger hint = length + length / 2;
+    if (length >= 18 && bytes[0] == 0x1f && bytes[1] == 0x8b)
+    {
+        const uint8_t *trailer = bytes + length - 4;
+        hint = (NSUInteger)trailer[0] | (NSUInteger)trailer[1] << 8 | (NSUInteger)trailer[2] << 16 | (NSUInteger)trailer[3] << 24;
+        // The trailer is only the length modulo 2^32, and can't be trusted beyond what the input can inflate to.
+        hint = MIN(hint, length * MaxCompressionRatio);
+    }
+    // One spare byte lets inflate report the end of the stream without asking for more room.
+    return hint + 1;
+}
 
 @implementation NSData (AWSGZIP)
 
@@ -46,32 +170,39 @@ static const NSUInteger ChunkSize = 16384;
 {
     if ([self length])
     {
-        z_stream stream;
-        stream.zalloc = Z_NULL;
-        stream.zfree = Z_NULL;
-        stream.opaque = Z_NULL;
-        stream.avail_in = (uint)[self length];
-        stream.next_in = (Bytef *)[self bytes];
-        stream.total_out = 0;
-        stream.avail_out = 0;
-        
         int compression = (level < 0.0f)? Z_DEFAULT_COMPRESSION: (int)(roundf(level * 9));
-        if (deflateInit2(&stream, compression, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) == Z_OK)
+        AWSGZIPDeflater *deflater = AWSGZIPTakeDeflater(compression);
+        if (deflater)
         {
-            NSMutableData *data = [NSMutableData dataWithLength:ChunkSize];
-            while (stream.avail_out == 0)
+            z_stream *stream = &deflater->stream;
+            const uint8_t *bytes = [self bytes];
+            NSUInteger length = [self length];
+
+            // deflateBound is large enough for deflate to finish in one pass, so the output never has to grow.
+            NSMutableData *data = [NSMutableData dataWithLength:(NSUInteger)deflateBound(stream, (uLong)length)];
+            uint8_t *output = [data mutableBytes];
+            NSUInteger consumed = 0;
+            NSUInteger produced = 0;
+            int status = Z_OK;
+            while (status == Z_OK)
             {
-                if (stream.total_out >= [data length])
-                {
-                    data.length += ChunkSize;
-                }
-                stream.next_out = (uint8_t *)[data mutableBytes] + stream.total_out;
-                stream.avail_out = (uInt)([data length] - stream.total_out);
-                deflate(&stream, Z_FINISH);
+                // avail_in and avail_out are 32 bits wide, so bodies over 4 GB are fed in pieces.
+                stream->next_in = (Bytef *)bytes + consumed;
+                stream->avail_in = (uInt)MIN(length - consumed, (NSUInteger)UINT_MAX);
+                stream->next_out = output + produced;
+                stream->avail_out = (uInt)MIN([data length] - produced, (NSUInteger)UINT_MAX);
+                uInt availableIn = stream->avail_in;
+                uInt availableOut = stream->avail_out;
+                status = deflate(stream, (consumed + availableIn == length)? Z_FINISH: Z_NO_FLUSH);
+                consumed += availableIn - stream->avail_in;
+                produced += availableOut - stream->avail_out;
+            }
+            AWSGZIPReturnDeflater(deflater);
+            if (status == Z_STREAM_END)
+            {
+                data.length = produced;
+                return data;
             }
-            deflateEnd(&stream);
-            data.length = stream.total_out;
-            return data;
         }
     }
     return nil;
@@ -86,35 +217,43 @@ static const NSUInteger ChunkSize = 16384;
 {
     if ([self length])
     {
-        z_stream stream;
-        stream.zalloc = Z_NULL;
-        stream.zfree = Z_NULL;
-        stream.avail_in = (uint)[self length];
-        stream.next_in = (Bytef *)[self bytes];
-        stream.total_out = 0;
-        stream.avail_out = 0;
-        
-        NSMutableData *data = [NSMutableData dataWithLength:(NSUInteger)([self length] * 1.5)];
-        if (inflateInit2(&stream, 47) == Z_OK)
+        z_stream *stream = AWSGZIPTakeInflater();
+        if (stream)
         {
+            const uint8_t *bytes = [self bytes];
+            NSUInteger length = [self length];
+
+            NSMutableData *data = [NSMutableData dataWithLength:AWSGZIPInflatedLengthHint(bytes, length)];
+            NSUInteger consumed = 0;
+            NSUInteger produced = 0;
             int status = Z_OK;
-            while (status == Z_OK)
+            while (status == Z_OK || status == Z_BUF_ERROR)
             {
-                if (stream.total_out >= [data length])
+                if (produced == [data length])
                 {
-                    data.length += [self length] / 2;
+                    // Grow geometrically, so a wrong guess costs a few copies rather than one per chunk.
+                    data.length += MAX([data length], ChunkSize);
                 }
-                stream.next_out = (uint8_t *)[data mutableBytes] + stream.total_out;
-                stream.avail_out = (uInt)([data length] - stream.total_out);
-                status = inflate (&stream, Z_SYNC_FLUSH);
-            }
-            if (inflateEnd(&stream) == Z_OK)
-            {
-                if (status == Z_STREAM_END)
+                else if (status == Z_BUF_ERROR)
                 {
-                    data.length = stream.total_out;
-                    return data;
+                    // The input ended before the end of the stream.
+                    break;
                 }
+                stream->next_in = (Bytef *)bytes + consumed;
+                stream->avail_in = (uInt)MIN(length - consumed, (NSUInteger)UINT_MAX);
+                stream->next_out = (uint8_t *)[data mutableBytes] + produced;
+                stream->avail_out = (uInt)MIN([data length] - produced, (NSUInteger)UINT_MAX);
+                uInt availableIn = stream->avail_in;
+                uInt availableOut = stream->avail_out;
+                status = inflate(stream, Z_NO_FLUSH);
+                consumed += availableIn - stream->avail_in;
+                produced += availableOut - stream->avail_out;
+            }
+            AWSGZIPReturnInflater(stream);
+            if (status == Z_STREAM_END)
+            {
+                data.length = produced;
+                return data;
             }
         }
     }
@@ -0,0 +1,85 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSGZIPInputStreamErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSGZIPInputStreamErrorType) {
+    AWSGZIPInputStreamErrorUnknown,
+    AWSGZIPInputStreamErrorCorruptData,
+    AWSGZIPInputStreamErrorTruncatedData,
+};
+
+typedef NS_ENUM(NSInteger, AWSGZIPInputStreamMode) {
+    /**
+     Reads the wrapped stream gzip compressed.
+     */
+    AWSGZIPInputStreamModeCompress,
+    /**
+     Reads the wrapped gzip or zlib stream decompressed. Concatenated gzip members are read one after the other.
+     */
+    AWSGZIPInputStreamModeDecompress,
+};
+
+/**
+ An input stream that compresses or decompresses another input stream as it is read.
+
+ Only one buffer of the wrapped stream is held in memory at a time, so a large body can be compressed for upload from a
+ file, or a downloaded gzip file decompressed, without reading all of it into an `NSData` first. The zlib state is set
+ up once when the stream is opened and reused for every read.
+
+ Reads block until the wrapped stream returns data, like `AWSS3ChunkedEncodingInputStream`. The length of the output is
+ not known in advance, so a compressing stream is sent with chunked transfer encoding when used as an `HTTPBodyStream`.
+ */
+@interface AWSGZIPInputStream : NSInputStream <NSStreamDelegate>
+
+/**
+ Returns a stream that reads `stream` compressed with the default compression level.
+ */
++ (instancetype)compressingStreamWithInputStream:(NSInputStream *)stream;
+
+/**
+ Returns a stream that reads the gzip or zlib compressed `stream` decompressed.
+ */
++ (instancetype)decompressingStreamWithInputStream:(NSInputStream *)stream;
+
+/**
+ Initializes a stream.
+
+ @param stream The stream to read from. It is opened and closed with the receiver.
+ @param mode   Whether to compress or decompress `stream`.
+ @param level  The compression level between `0.0` and `1.0`, or a negative number for zlib's default. It is ignored
+               when decompressing.
+ */
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                               mode:(AWSGZIPInputStreamMode)mode
+                   compressionLevel:(float)level;
+
+/**
+ The number of bytes read from the wrapped stream so far.
+ */
+@property (nonatomic, assign, readonly) uint64_t totalBytesIn;
+
+/**
+ The number of bytes returned by the receiver so far.
+ */
+@property (nonatomic, assign, readonly) uint64_t totalBytesOut;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,277 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSGZIPInputStream.h"
+#import <zlib.h>
+
+NSString *const AWSGZIPInputStreamErrorDomain = @"com.amazonaws.AWSGZIPInputStreamErrorDomain";
+
+// How much of the wrapped stream is read at a time.
+static const NSUInteger AWSGZIPInputStreamBufferSize = 64 * 1024;
+
+@interface AWSGZIPInputStream()
+
+@property (nonatomic, strong) NSInputStream *stream;
+@property (nonatomic, assign) AWSGZIPInputStreamMode mode;
+@property (nonatomic, assign) int compressionLevel;
+@property (nonatomic, assign) NSStreamStatus status;
+@property (nonatomic, strong) NSError *error;
+@property (nonatomic, assign) uint64_t totalBytesIn;
+@property (nonatomic, assign) uint64_t totalBytesOut;
+
+@end
+
+@implementation AWSGZIPInputStream {
+    z_stream _zstream;
+    BOOL _zstreamInitialized;
+    uint8_t *_buffer;
+    // The wrapped stream has returned 0 from a read.
+    BOOL _streamAtEnd;
+    // A decompressing stream has finished a gzip member and not yet started another one.
+    BOOL _betweenMembers;
+}
+
+@synthesize delegate = _delegate;
+
++ (instancetype)compressingStreamWithInputStream:(NSInputStream *)stream {
+    return [[self alloc] initWithInputStream:stream
+                                        mode:AWSGZIPInputStreamModeCompress
+                            compressionLevel:-1.0f];
+}
+
++ (instancetype)decompressingStreamWithInputStream:(NSInputStream *)stream {
+    return [[self alloc] initWithInputStream:stream
+                                        mode:AWSGZIPInputStreamModeDecompress
+                            compressionLevel:-1.0f];
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                               mode:(AWSGZIPInputStreamMode)mode
+                   compressionLevel:(float)level {
+    if (self = [super init]) {
+        _stream = stream;
+        _stream.delegate = self;
+        _mode = mode;
+        _compressionLevel = (level < 0.0f) ? Z_DEFAULT_COMPRESSION : (int)roundf(MIN(level, 1.0f) * 9);
+        _status = NSStreamStatusNotOpen;
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    [self endZStream];
+}
+
+- (void)endZStream {
+    if (_zstreamInitialized) {
+        if (self.mode == AWSGZIPInputStreamModeCompress) {
+            deflateEnd(&_zstream);
+        } else {
+            inflateEnd(&_zstream);
+        }
+        _zstreamInitialized = NO;
+    }
+    free(_buffer);
+    _buffer = NULL;
+}
+
+- (void)failWithCode:(AWSGZIPInputStreamErrorType)code underlyingError:(NSError *)underlyingError {
+    NSMutableDictionary *userInfo = [NSMutableDictionary new];
+    userInfo[NSLocalizedDescriptionKey] = (code == AWSGZIPInputStreamErrorTruncatedData
+                                           ? @"The compressed stream ended unexpectedly."
+                                           : @"The stream could not be compressed or decompressed.");
+    userInfo[NSUnderlyingErrorKey] = underlyingError;
+    if (_zstream.msg) {
+        userInfo[NSLocalizedFailureReasonErrorKey] = @(_zstream.msg);
+    }
+    self.error = [NSError errorWithDomain:AWSGZIPInputStreamErrorDomain
+                                     code:code
+                                 userInfo:userInfo];
+    self.status = NSStreamStatusError;
+}
+
+- (void)stream:(NSStream *)aStream handleEvent:(NSStreamEvent)eventCode {
+    // The wrapped stream ends before the receiver has returned its last bytes.
+    if ((eventCode & NSStreamEventEndEncountered) && self.status != NSStreamStatusAtEnd) {
+        eventCode ^= NSStreamEventEndEncountered;
+        eventCode |= NSStreamEventHasBytesAvailable;
+    }
+    if ([self.delegate respondsToSelector:@selector(stream:handleEvent:)]) {
+        [self.delegate stream:self handleEvent:eventCode];
+    }
+}
+
+#pragma mark NSInputStream methods
+
+- (void)open {
+    if (self.status != NSStreamStatusNotOpen) {
+        return;
+    }
+
+    memset(&_zstream, 0, sizeof(_zstream));
+    int status = Z_OK;
+    if (self.mode == AWSGZIPInputStreamModeCompress) {
+        status = deflateInit2(&_zstream, self.compressionLevel, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY);
+    } else {
+        // 47 accepts both gzip and zlib headers.
+        status = inflateInit2(&_zstream, 47);
+    }
+    _buffer = malloc(AWSGZIPInputStreamBufferSize);
+    if (status != Z_OK || _buffer == NULL) {
+        _zstreamInitialized = (status == Z_OK);
+        [self failWithCode:AWSGZIPInputStreamErrorUnknown underlyingError:nil];
+        return;
+    }
+    _zstreamInitialized = YES;
+
+    [self.stream open];
+    self.status = NSStreamStatusOpen;
+}
+
+- (void)close {
+    [self.stream close];
+    [self endZStream];
+    self.status = NSStreamStatusClosed;
+}
+
+- (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)len {
+    if (self.status == NSStreamStatusAtEnd) {
+        return 0;
+    }
+    if (self.status != NSStreamStatusOpen || len == 0) {
+        return (self.status == NSStreamStatusOpen) ? 0 : -1;
+    }
+
+    _zstream.next_out = buffer;
+    _zstream.avail_out = (uInt)MIN(len, (NSUInteger)UINT_MAX);
+    uInt capacity = _zstream.avail_out;
+
+    while (_zstream.avail_out > 0) {
+        if (_zstream.avail_in == 0 && !_streamAtEnd) {
+            // Return what is ready instead of blocking on a stream that has nothing to read yet.
+            if (_zstream.avail_out < capacity && ![self.stream hasBytesAvailable]) {
+                break;
+            }
+
+            NSInteger read = [self.stream read:_buffer maxLength:AWSGZIPInputStreamBufferSize];
+            if (read < 0) {
+                [self failWithCode:AWSGZIPInputStreamErrorUnknown underlyingError:self.stream.streamError];
+                return -1;
+            }
+            _streamAtEnd = (read == 0);
+            _zstream.next_in = _buffer;
+            _zstream.avail_in = (uInt)read;
+            self.totalBytesIn += read;
+        }
+
+        uInt availableIn = _zstream.avail_in;
+        int status = Z_OK;
+        if (self.mode == AWSGZIPInputStreamModeCompress) {
+            status = deflate(&_zstream, _streamAtEnd ? Z_FINISH : Z_NO_FLUSH);
+        } else {
+            status = inflate(&_zstream, Z_NO_FLUSH);
+        }
+
+        if (status == Z_STREAM_END) {
+            if (self.mode == AWSGZIPInputStreamModeDecompress && (_zstream.avail_in > 0 || !_streamAtEnd)) {
+                // Another gzip member may follow.
+                inflateReset(&_zstream);
+                _betweenMembers = YES;
+                continue;
+            }
+            self.status = NSStreamStatusAtEnd;
+            break;
+        }
+
+        if (_betweenMembers && status == Z_DATA_ERROR) {
+            // Like gzip, ignore what follows the last member when it isn't another member.
+            self.status = NSStreamStatusAtEnd;
+            break;
+        }
+
+        if (status == Z_BUF_ERROR && _streamAtEnd && _zstream.avail_in == 0 && _zstream.avail_out > 0) {
+            if (_betweenMembers) {
+                self.status = NSStreamStatusAtEnd;
+                break;
+            }
+            [self failWithCode:AWSGZIPInputStreamErrorTruncatedData underlyingError:nil];
+            return -1;
+        }
+
+        if (status != Z_OK && status != Z_BUF_ERROR) {
+            [self failWithCode:AWSGZIPInputStreamErrorCorruptData underlyingError:nil];
+            return -1;
+        }
+
+        if (_zstream.avail_in < availableIn) {
+            _betweenMembers = NO;
+        }
+    }
+
+    NSInteger produced = capacity - _zstream.avail_out;
+    self.totalBytesOut += produced;
+    return produced;
+}
+
+- (BOOL)hasBytesAvailable {
+    return self.status == NSStreamStatusOpen;
+}
+
+- (BOOL)getBuffer:(uint8_t **)buffer length:(NSUInteger *)len {
+    return NO;
+}
+
+- (void)setDelegate:(id<NSStreamDelegate>)delegate {
+    if (delegate == nil) {
+        _delegate = self;
+    } else {
+        _delegate = delegate;
+    }
+}
+
+- (void)scheduleInRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
+    [self.stream scheduleInRunLoop:aRunLoop forMode:mode];
+}
+
+- (void)removeFromRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
+    [self.stream removeFromRunLoop:aRunLoop forMode:mode];
+}
+
+- (id)propertyForKey:(NSString *)key {
+    return [self.stream propertyForKey:key];
+}
+
+- (BOOL)setProperty:(id)property forKey:(NSString *)key {
+    return [self.stream setProperty:property forKey:key];
+}
+
+- (NSStreamStatus)streamStatus {
+    return self.status;
+}
+
+- (NSError *)streamError {
+    return self.error;
+}
+
+- (NSMethodSignature *)methodSignatureForSelector:(SEL)aSelector {
+    return [self.stream methodSignatureForSelector:aSelector];
+}
+
+- (void)forwardInvocation:(NSInvocation *)anInvocation {
+    [anInvocation invokeWithTarget:self.stream];
+}
+
+@end
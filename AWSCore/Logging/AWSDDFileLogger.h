@@ -319,6 +319,13 @@ extern unsigned long long const kAWSDDDefaultLogFilesDiskQuota;
 /// The log message serializer.
 @property (nonatomic, strong) id<AWSDDFileLogMessageSerializer> logMessageSerializer;
 
+/**
+ * When set, archived log files are gzip-compressed in the background and renamed to `"<name>.log.gz"`.
+ * Compressed files count against `logFilesDiskQuota` with their compressed size, so the quota keeps more history.
+ * Setting it also compresses the files that were archived before. Default value is NO.
+ **/
+@property (readwrite, assign, atomic) BOOL compressesArchivedLogFiles;
+
 /* Inherited from AWSDDLogFileManager protocol:
 
    @property (readwrite, assign, atomic) NSUInteger maximumNumberOfLogFiles;
@@ -440,6 +447,9 @@ extern unsigned long long const kAWSDDDefaultLogFilesDiskQuota;
  * `doNotReuseLogFiles`
  *   When set, will always create a new log file at application launch.
  *
+ * `usesMemoryMappedFile`
+ *   When set, log files are written through a memory mapping instead of a file handle.
+ *
  * Both the `maximumFileSize` and the `rollingFrequency` are used to manage rolling.
  * Whichever occurs first will cause the log file to be rolled.
  *
@@ -470,6 +480,16 @@ extern unsigned long long const kAWSDDDefaultLogFilesDiskQuota;
  */
 @property (readwrite, assign, atomic) BOOL doNotReuseLogFiles;
 
+/**
+ * Writes the current log file through a shared memory mapping, so that a log statement costs a copy into memory
+ * instead of a `write` system call. Statements logged before a crash still reach the file, and the unwritten end of
+ * the mapping is removed the next time the file is opened.
+ *
+ * The file is not locked while it is written, so don't set this if other processes append to the same log files.
+ * Takes effect when the next log file is opened. Default value is NO.
+ **/
+@property (readwrite, assign, atomic) BOOL usesMemoryMappedFile;
+
 /**
  * The AWSDDLogFileManager instance can be used to retrieve the list of log files,
  * and configure the maximum number of archived log files to keep.
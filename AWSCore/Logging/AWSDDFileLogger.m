@@ -23,6 +23,8 @@
 #import <unistd.h>
 
 #import "AWSDDFileLogger+Internal.h"
+#import "AWSDDMappedLogFileWriter.h"
+#import "AWSGZIPInputStream.h"
 
 // We probably shouldn't be using AWSDDLog() statements within the AWSDDLog implementation.
 // But we still want to leave our log statements for any future debugging,
@@ -80,6 +82,8 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     unsigned long long _logFilesDiskQuota;
     NSString *_logsDirectory;
     BOOL _wasAddedToLogger;
+    BOOL _compressesArchivedLogFiles;
+    dispatch_queue_t _compressionQueue;
 #if TARGET_OS_IPHONE
     NSFileProtectionType _defaultFileProtectionLevel;
 #endif
@@ -112,6 +116,9 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
 
         _logMessageSerializer = [[AWSDDFileLogPlainTextMessageSerializer alloc] init];
 
+        _compressionQueue = dispatch_queue_create("AWSDDLogFileManagerDefault.compression",
+                                                  dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+
         NSLogVerbose(@"AWSDDFileLogManagerDefault: logsDirectory:\n%@", [self logsDirectory]);
         NSLogVerbose(@"AWSDDFileLogManagerDefault: sortedLogFileNames:\n%@", [self sortedLogFileNames]);
     }
@@ -170,6 +177,30 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     }
 }
 
+- (BOOL)compressesArchivedLogFiles {
+    @synchronized (self) {
+        return _compressesArchivedLogFiles;
+    }
+}
+
+- (void)setCompressesArchivedLogFiles:(BOOL)compressesArchivedLogFiles {
+    @synchronized (self) {
+        if (_compressesArchivedLogFiles == compressesArchivedLogFiles) {
+            return;
+        }
+        _compressesArchivedLogFiles = compressesArchivedLogFiles;
+    }
+    if (compressesArchivedLogFiles) {
+        [self compressArchivedLogFiles];
+    }
+}
+
+- (void)didArchiveLogFile:(NSString *)logFilePath wasRolled:(BOOL)wasRolled {
+    if (self.compressesArchivedLogFiles) {
+        [self compressArchivedLogFiles];
+    }
+}
+
 #if TARGET_OS_IPHONE
 - (NSFileProtectionType)logFileProtection {
     if (_defaultFileProtectionLevel.length > 0) {
@@ -208,7 +239,12 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
 
         for (NSUInteger i = 0; i < sortedLogFileInfos.count; i++) {
             AWSDDLogFileInfo *info = sortedLogFileInfos[i];
-            used += info.fileSize;
+            // A mapped file is extended ahead of its data, so only the data counts against the quota.
+            if ([info.filePath.pathExtension isEqualToString:@"gz"]) {
+                used += info.fileSize;
+            } else {
+                used += [AWSDDMappedLogFileWriter dataLengthOfFileAtPath:info.filePath];
+            }
 
             if (used > diskQuota) {
                 firstIndexToDelete = i;
@@ -265,6 +301,109 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     return [self deleteOldLogFilesWithError:error];
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark File Compressing
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compresses every archived log file that isn't compressed yet, then deletes old log files by their compressed size.
+ * Runs on a serial utility queue, so a sweep never races another one.
+ **/
+- (void)compressArchivedLogFiles {
+    dispatch_async(_compressionQueue, ^{
+        @autoreleasepool {
+            __auto_type fileManager = [NSFileManager defaultManager];
+            __auto_type logsDirectory = [self logsDirectory];
+
+            // Leftovers of a sweep that was interrupted.
+            for (NSString *fileName in [fileManager contentsOfDirectoryAtPath:logsDirectory error:nil]) {
+                if ([fileName hasSuffix:@".gz.tmp"]) {
+                    [fileManager removeItemAtPath:[logsDirectory stringByAppendingPathComponent:fileName] error:nil];
+                }
+            }
+
+            for (AWSDDLogFileInfo *logFileInfo in [self sortedLogFileInfos]) {
+                if (!self.compressesArchivedLogFiles) {
+                    return;
+                }
+                if (!logFileInfo.isArchived || logFileInfo.isSymlink || [logFileInfo.filePath.pathExtension isEqualToString:@"gz"]) {
+                    continue;
+                }
+
+                __autoreleasing NSError *error = nil;
+                if (![self compressLogFileAtPath:logFileInfo.filePath error:&error]) {
+                    NSLogError(@"AWSDDLogFileManagerDefault: Failed to compress file %@: %@", logFileInfo.fileName, error);
+                }
+            }
+
+            [self deleteOldLogFilesWithError:nil];
+        }
+    });
+}
+
+- (BOOL)compressLogFileAtPath:(NSString *)filePath error:(NSError *__autoreleasing _Nullable *)error {
+    // The file was mapped if the app crashed while writing it.
+    if (![AWSDDMappedLogFileWriter recoverFileAtPath:filePath error:error]) {
+        return NO;
+    }
+
+    __auto_type fileManager = [NSFileManager defaultManager];
+    __auto_type compressedFilePath = [filePath stringByAppendingPathExtension:@"gz"];
+    __auto_type temporaryFilePath = [compressedFilePath stringByAppendingPathExtension:@"tmp"];
+
+    __auto_type inputStream = [AWSGZIPInputStream compressingStreamWithInputStream:[NSInputStream inputStreamWithFileAtPath:filePath]];
+    __auto_type outputStream = [NSOutputStream outputStreamToFileAtPath:temporaryFilePath append:NO];
+    [inputStream open];
+    [outputStream open];
+
+    NSError *streamError = nil;
+    __auto_type buffer = [NSMutableData dataWithLength:64 * 1024];
+    while (streamError == nil) {
+        __auto_type read = [inputStream read:buffer.mutableBytes maxLength:buffer.length];
+        if (read < 0) {
+            streamError = inputStream.streamError ?: [NSError errorWithDomain:AWSGZIPInputStreamErrorDomain code:AWSGZIPInputStreamErrorUnknown userInfo:nil];
+        } else if (read == 0) {
+            break;
+        }
+
+        NSInteger written = 0;
+        while (streamError == nil && written < read) {
+            __auto_type count = [outputStream write:(const uint8_t *)buffer.bytes + written maxLength:(NSUInteger)(read - written)];
+            if (count <= 0) {
+                streamError = outputStream.streamError ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:EIO userInfo:nil];
+            }
+            written += count;
+        }
+    }
+    [inputStream close];
+    [outputStream close];
+
+    if (streamError == nil) {
+        // Keep the dates the files are sorted by, and the protection class the file was created with.
+        __auto_type attributes = [fileManager attributesOfItemAtPath:filePath error:nil];
+        __auto_type keptAttributes = [NSMutableDictionary dictionary];
+        for (NSFileAttributeKey key in @[NSFileCreationDate, NSFileModificationDate, NSFileProtectionKey]) {
+            keptAttributes[key] = attributes[key];
+        }
+        [fileManager setAttributes:keptAttributes ofItemAtPath:temporaryFilePath error:nil];
+
+        if (rename(temporaryFilePath.fileSystemRepresentation, compressedFilePath.fileSystemRepresentation) != 0) {
+            streamError = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:@{NSFilePathErrorKey: compressedFilePath}];
+        }
+    }
+
+    if (streamError != nil) {
+        [fileManager removeItemAtPath:temporaryFilePath error:nil];
+        if (error) {
+            *error = streamError;
+        }
+        return NO;
+    }
+
+    NSLogInfo(@"AWSDDLogFileManagerDefault: Compressed file: %@", compressedFilePath.lastPathComponent);
+    return [fileManager removeItemAtPath:filePath error:error];
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark Log Files
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,7 +449,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     __auto_type appName = [self applicationName];
 
     // We need to add a space to the name as otherwise we could match applications that have the name prefix.
-    return [fileName hasPrefix:[appName stringByAppendingString:@" "]] && [fileName hasSuffix:@".log"];
+    return [fileName hasPrefix:[appName stringByAppendingString:@" "]] && ([fileName hasSuffix:@".log"] || [fileName hasSuffix:@".log.gz"]);
 }
 
 // if you change formatter, then change sortedLogFileInfos method also accordingly
@@ -407,6 +546,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
         __auto_type arrayComponent = [[obj1 fileName] componentsSeparatedByString:@" "];
         if (arrayComponent.count > 0) {
             NSString *stringDate = arrayComponent.lastObject;
+            stringDate = [stringDate stringByReplacingOccurrencesOfString:@".log.gz" withString:@""];
             stringDate = [stringDate stringByReplacingOccurrencesOfString:@".log" withString:@""];
 #if TARGET_IPHONE_SIMULATOR
             // This is only used on the iPhone simulator for backward compatibility reason.
@@ -418,6 +558,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
         arrayComponent = [[obj2 fileName] componentsSeparatedByString:@" "];
         if (arrayComponent.count > 0) {
             NSString *stringDate = arrayComponent.lastObject;
+            stringDate = [stringDate stringByReplacingOccurrencesOfString:@".log.gz" withString:@""];
             stringDate = [stringDate stringByReplacingOccurrencesOfString:@".log" withString:@""];
 #if TARGET_IPHONE_SIMULATOR
             // This is only used on the iPhone simulator for backward compatibility reason.
@@ -610,6 +751,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
 
     AWSDDLogFileInfo *_currentLogFileInfo;
     NSFileHandle *_currentLogFileHandle;
+    AWSDDMappedLogFileWriter *_currentLogFileWriter;
 
     dispatch_source_t _currentLogFileVnode;
 
@@ -683,6 +825,10 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
         _currentLogFileHandle = nil;
     }
 
+    if (_currentLogFileWriter != nil) {
+        [self lt_closeCurrentLogFileWriter];
+    }
+
     if (_currentLogFileVnode) {
         dispatch_source_cancel(_currentLogFileVnode);
         _currentLogFileVnode = NULL;
@@ -738,7 +884,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     __auto_type block = ^{
         @autoreleasepool {
             self->_maximumFileSize = newMaximumFileSize;
-            if (self->_currentLogFileHandle != nil) {
+            if (self->_currentLogFileHandle != nil || self->_currentLogFileWriter != nil) {
                 [self lt_maybeRollLogFileDueToSize];
             }
         }
@@ -791,7 +937,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     __auto_type block = ^{
         @autoreleasepool {
             self->_rollingFrequency = newRollingFrequency;
-            if (self->_currentLogFileHandle != nil) {
+            if (self->_currentLogFileHandle != nil || self->_currentLogFileWriter != nil) {
                 [self lt_maybeRollLogFileDueToAge];
             }
         }
@@ -898,11 +1044,13 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     AWSDDAbstractLoggerAssertOnInternalLoggerQueue();
     NSLogVerbose(@"AWSDDFileLogger: %@", NSStringFromSelector(_cmd));
 
-    if (_currentLogFileHandle == nil) {
+    if (_currentLogFileHandle == nil && _currentLogFileWriter == nil) {
         return;
     }
 
-    if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
+    if (_currentLogFileWriter != nil) {
+        [self lt_closeCurrentLogFileWriter];
+    } else if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
         __autoreleasing NSError *error = nil;
         __auto_type success = [_currentLogFileHandle synchronizeAndReturnError:&error];
         if (!success) {
@@ -979,9 +1127,11 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     // Note: Use direct access to maximumFileSize variable.
     // We specifically wrote our own getter/setter method to allow us to do this (for performance reasons).
 
-    if (_currentLogFileHandle != nil && _maximumFileSize > 0) {
+    if ((_currentLogFileHandle != nil || _currentLogFileWriter != nil) && _maximumFileSize > 0) {
         unsigned long long fileSize;
-        if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
+        if (_currentLogFileWriter != nil) {
+            fileSize = _currentLogFileWriter.length;
+        } else if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
             __autoreleasing NSError *error = nil;
             __auto_type success = [_currentLogFileHandle getOffset:&fileSize error:&error];
             if (!success) {
@@ -1125,6 +1275,15 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
         return NO;
     }
 
+    // A file that was mapped when the app crashed ends with zeros. Remove them before measuring or appending to it.
+    if (isResuming) {
+        __autoreleasing NSError *error = nil;
+        if (![AWSDDMappedLogFileWriter recoverFileAtPath:logFileInfo.filePath error:&error]) {
+            NSLogError(@"AWSDDFileLogger: Failed to recover file: %@", error);
+        }
+        [logFileInfo reset];
+    }
+
     // If we're resuming, we need to check if the log file is allowed for reuse or needs to be archived.
     if (isResuming && (_doNotReuseLogFiles || [self lt_shouldLogFileBeArchived:logFileInfo])) {
         logFileInfo.isArchived = YES;
@@ -1157,7 +1316,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
 
 - (void)lt_monitorCurrentLogFileForExternalChanges {
     AWSDDAbstractLoggerAssertOnInternalLoggerQueue();
-    NSAssert(_currentLogFileHandle, @"Can not monitor without handle.");
+    NSAssert(_currentLogFileHandle || _currentLogFileWriter, @"Can not monitor without handle.");
 
     // This seems to work around crashes when an active source is replaced / released.
     // See https://github.com/CocoaLumberjack/CocoaLumberjack/issues/1341
@@ -1167,7 +1326,7 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     }
 
     _currentLogFileVnode = dispatch_source_create(DISPATCH_SOURCE_TYPE_VNODE,
-                                                  (uintptr_t)[_currentLogFileHandle fileDescriptor],
+                                                  (uintptr_t)(_currentLogFileWriter ? _currentLogFileWriter.fileDescriptor : [_currentLogFileHandle fileDescriptor]),
                                                   DISPATCH_VNODE_DELETE | DISPATCH_VNODE_RENAME | DISPATCH_VNODE_REVOKE,
                                                   _loggerQueue);
 
@@ -1212,6 +1371,42 @@ NSTimeInterval     const kAWSDDRollingLeeway              = 1.0;              //
     return _currentLogFileHandle;
 }
 
+- (AWSDDMappedLogFileWriter *)lt_currentLogFileWriter {
+    AWSDDAbstractLoggerAssertOnInternalLoggerQueue();
+
+    // A file that failed to map is written through a file handle until it is rolled.
+    if (_currentLogFileWriter == nil && _currentLogFileHandle == nil && _usesMemoryMappedFile) {
+        __auto_type logFilePath = [[self lt_currentLogFileInfo] filePath];
+        if (logFilePath == nil) {
+            return nil;
+        }
+
+        __autoreleasing NSError *error = nil;
+        _currentLogFileWriter = [[AWSDDMappedLogFileWriter alloc] initWithFilePath:logFilePath error:&error];
+        if (_currentLogFileWriter != nil) {
+            [self lt_scheduleTimerToRollLogFileDueToAge];
+            [self lt_monitorCurrentLogFileForExternalChanges];
+        } else {
+            NSLogError(@"AWSDDFileLogger: Failed to map file, using a file handle: %@", error);
+        }
+    }
+
+    return _currentLogFileWriter;
+}
+
+- (void)lt_closeCurrentLogFileWriter {
+    AWSDDAbstractLoggerAssertOnInternalLoggerQueue();
+
+    __autoreleasing NSError *error = nil;
+    if (![_currentLogFileWriter synchronizeWithError:&error]) {
+        NSLogError(@"AWSDDFileLogger: Failed to synchronize file: %@", error);
+    }
+    if (![_currentLogFileWriter closeWithError:&error]) {
+        NSLogError(@"AWSDDFileLogger: Failed to close file: %@", error);
+    }
+    _currentLogFileWriter = nil;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark AWSDDLogger Protocol
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1268,6 +1463,13 @@ static int exception_count = 0;
 - (void)lt_flush {
     AWSDDAbstractLoggerAssertOnInternalLoggerQueue();
 
+    if (_currentLogFileWriter != nil) {
+        __autoreleasing NSError *error = nil;
+        if (![_currentLogFileWriter synchronizeWithError:&error]) {
+            NSLogError(@"AWSDDFileLogger: Failed to synchronize file: %@", error);
+        }
+    }
+
     if (_currentLogFileHandle != nil) {
         if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
             __autoreleasing NSError *error = nil;
@@ -1351,7 +1553,8 @@ static int exception_count = 0;
 
     @try {
         // Make sure that _currentLogFileInfo is initialised before being used.
-        __auto_type handle = [self lt_currentLogFileHandle];
+        __auto_type writer = [self lt_currentLogFileWriter];
+        __auto_type handle = writer == nil ? [self lt_currentLogFileHandle] : nil;
 
         if (implementsDeprecatedWillLog) {
 #pragma clang diagnostic push
@@ -1362,27 +1565,39 @@ static int exception_count = 0;
             [self willLogMessage:_currentLogFileInfo];
         }
 
-        // use an advisory lock to coordinate write with other processes
-        __auto_type fd = [handle fileDescriptor];
-        while(flock(fd, LOCK_EX) != 0) {
-            NSLogError(@"AWSDDFileLogger: Could not lock logfile, retrying in 1ms: %s (%d)", strerror(errno), errno);
-            usleep(1000);
-        }
-        if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
+        if (writer != nil) {
             __autoreleasing NSError *error = nil;
-            __auto_type success = [handle seekToEndReturningOffset:nil error:&error];
-            if (!success) {
-                NSLogError(@"AWSDDFileLogger: Failed to seek to end of file: %@", error);
+            if (![writer writeData:data error:&error]) {
+                // The file couldn't be extended or mapped again. It is closed at its data and written through a file
+                // handle until it is rolled, so that the statement isn't lost.
+                NSLogError(@"AWSDDFileLogger: Failed to write data through the mapping, using a file handle: %@", error);
+                [self lt_closeCurrentLogFileWriter];
+                handle = [self lt_currentLogFileHandle];
             }
-            success =  [handle writeData:data error:&error];
-            if (!success) {
-                NSLogError(@"AWSDDFileLogger: Failed to write data: %@", error);
+        }
+        if (handle != nil) {
+            // use an advisory lock to coordinate write with other processes
+            __auto_type fd = [handle fileDescriptor];
+            while(flock(fd, LOCK_EX) != 0) {
+                NSLogError(@"AWSDDFileLogger: Could not lock logfile, retrying in 1ms: %s (%d)", strerror(errno), errno);
+                usleep(1000);
             }
-        } else {
-            [handle seekToEndOfFile];
-            [handle writeData:data];
+            if (@available(macOS 10.15, iOS 13.0, tvOS 13.0, watchOS 6.0, *)) {
+                __autoreleasing NSError *error = nil;
+                __auto_type success = [handle seekToEndReturningOffset:nil error:&error];
+                if (!success) {
+                    NSLogError(@"AWSDDFileLogger: Failed to seek to end of file: %@", error);
+                }
+                success =  [handle writeData:data error:&error];
+                if (!success) {
+                    NSLogError(@"AWSDDFileLogger: Failed to write data: %@", error);
+                }
+            } else {
+                [handle seekToEndOfFile];
+                [handle writeData:data];
+            }
+            flock(fd, LOCK_UN);
         }
-        flock(fd, LOCK_UN);
 
         if (implementsDeprecatedDidLog) {
 #pragma clang diagnostic push
@@ -1568,7 +1783,8 @@ static NSString * const kDDXAttrArchivedName = @"lumberjack.log.archived";
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 - (BOOL)isArchived {
-    return [self hasExtendedAttributeWithName:kDDXAttrArchivedName];
+    // Only archived log files are compressed, and the attribute isn't carried over to the compressed file.
+    return [filePath.pathExtension isEqualToString:@"gz"] || [self hasExtendedAttributeWithName:kDDXAttrArchivedName];
 }
 
 - (void)setIsArchived:(BOOL)flag {
@@ -1588,6 +1804,7 @@ static NSString * const kDDXAttrArchivedName = @"lumberjack.log.archived";
     _fileAttributes = nil;
     _creationDate = nil;
     _modificationDate = nil;
+    _fileSize = 0;
 }
 
 - (void)renameFile:(NSString *)newFileName {
@@ -244,6 +244,30 @@ AWSDD_SENDABLE
  */
 @property (nonatomic, assign) AWSDDLogLevel logLevel;
 
+/**
+ * Asynchronous log statements with a format are written to a preallocated ring buffer,
+ * and turned into `AWSDDLogMessage`s on the logging queue. The calling thread formats the message,
+ * but neither waits for the logging queue nor creates the other strings of the message.
+ *
+ * When the buffer is full, info, debug and verbose statements are dropped and counted here,
+ * while warnings and errors go through the logging queue as usual.
+ * The loggers receive a warning with the number of statements dropped.
+ *
+ * The file and function of a buffered statement must be string literals, like `__FILE__` and `__PRETTY_FUNCTION__`.
+ **/
+@property (nonatomic, readonly) NSUInteger droppedMessageCount;
+
+/**
+ * Keeps one out of every `interval` debug and verbose statements logged with the given context,
+ * and skips the others before their message is formatted.
+ * Give each subsystem its own context to sample them independently.
+ * An interval of 0 or 1 keeps every statement.
+ *
+ *  @param interval The number of statements out of which one is kept.
+ *  @param context  The context of the statements.
+ **/
+- (void)setSampleInterval:(NSUInteger)interval forContext:(NSInteger)context;
+
 /**
  * Provides access to the underlying logging queue.
  * This may be helpful to Logger classes for things like thread synchronization.
@@ -302,6 +326,37 @@ AWSDD_SENDABLE
         tag:(nullable id)tag
      format:(NSString *)format, ... NS_FORMAT_FUNCTION(9,10);
 
+/**
+ * Logging Primitive used by the macros.
+ *
+ * Same as `log:level:flag:context:file:function:line:tag:format:...`, except that `file` and `function` must be
+ * string literals, such as `__FILE__` and `__PRETTY_FUNCTION__`. Asynchronous statements keep the pointers until the
+ * logging queue processes them, instead of copying the strings on the calling thread. Use the `file:function:`
+ * variants for any other strings.
+ */
++ (void)log:(BOOL)asynchronous
+       level:(AWSDDLogLevel)level
+        flag:(AWSDDLogFlag)flag
+     context:(NSInteger)context
+ literalFile:(const char *)file
+literalFunction:(nullable const char *)function
+        line:(NSUInteger)line
+         tag:(nullable id)tag
+      format:(NSString *)format, ... NS_FORMAT_FUNCTION(9,10);
+
+/**
+ * Logging Primitive used by the macros. See `+log:level:flag:context:literalFile:literalFunction:line:tag:format:...`.
+ */
+- (void)log:(BOOL)asynchronous
+       level:(AWSDDLogLevel)level
+        flag:(AWSDDLogFlag)flag
+     context:(NSInteger)context
+ literalFile:(const char *)file
+literalFunction:(nullable const char *)function
+        line:(NSUInteger)line
+         tag:(nullable id)tag
+      format:(NSString *)format, ... NS_FORMAT_FUNCTION(9,10);
+
 /**
  * Logging Primitive.
  *
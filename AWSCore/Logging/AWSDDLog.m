@@ -19,6 +19,7 @@
 
 #import <pthread.h>
 #import <objc/runtime.h>
+#import <stdatomic.h>
 #import <sys/qos.h>
 
 #if TARGET_OS_IOS
@@ -85,12 +86,78 @@ static void *const GlobalLoggingQueueIdentityKey = (void *)&GlobalLoggingQueueId
 #pragma mark -
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Asynchronous log statements are copied into a preallocated ring buffer by the calling threads and turned into
+// AWSDDLogMessages on the logging queue. Only the message itself is formatted on the calling thread, since its
+// arguments can't outlive the call. The file and function strings, the thread ID string and the date are created when
+// the statement is taken out of the buffer.
+//
+// The buffer is a bounded multi-producer queue: a calling thread claims a slot by advancing the enqueue position and
+// publishes it by advancing the slot's sequence, and the logging queue is the only consumer.
+
+#define AWSDD_LOG_BUFFER_CAPACITY 1024 // Must be a power of 2.
+
+typedef struct {
+    _Atomic(NSUInteger) sequence;
+    void *message;       // Retained NSString.
+    void *messageFormat; // Retained NSString.
+    void *tag;           // Retained object, or NULL.
+    const char *file;     // String literal, or NULL when fileString is set.
+    const char *function; // String literal, or NULL.
+    void *fileString;     // Retained NSString of a file that isn't a literal, or NULL.
+    void *functionString; // Retained NSString of a function that isn't a literal, or NULL.
+    NSUInteger line;
+    NSInteger context;
+    AWSDDLogLevel level;
+    AWSDDLogFlag flag;
+    CFAbsoluteTime timestamp;
+    uint64_t threadID;
+    qos_class_t qos;
+    char threadName[32];
+    char queueLabel[64];
+} AWSDDLogBufferSlot;
+
+typedef struct {
+    _Atomic(NSUInteger) enqueuePosition;
+    // Only used on the logging queue.
+    NSUInteger dequeuePosition;
+    AWSDDLogBufferSlot slots[AWSDD_LOG_BUFFER_CAPACITY];
+} AWSDDLogBuffer;
+
+@interface AWSDDLogSampler : NSObject
+{
+    @public
+    NSUInteger _interval;
+    _Atomic(NSUInteger) _count;
+}
+
+@end
+
+@implementation AWSDDLogSampler
+
+@end
+
 @interface AWSDDLog ()
+{
+    // Allocated by the first buffered statement.
+    _Atomic(AWSDDLogBuffer *) _buffer;
+    // Wakes the logging queue up to drain the buffer.
+    dispatch_source_t _bufferSource;
+    _Atomic(NSUInteger) _droppedMessageCount;
+    _Atomic(BOOL) _sampling;
+
+    // Only used on the logging queue.
+    NSUInteger _reportedDroppedMessageCount;
+    // File and function strings by the address of their C strings.
+    CFMutableDictionaryRef _fileNames;
+    CFMutableDictionaryRef _functionNames;
+}
 
 // An array used to manage all the individual loggers.
 // The array is only modified on the loggingQueue/loggingThread.
 @property (nonatomic, strong) NSMutableArray *_loggers;
 
+@property (atomic, copy) NSDictionary<NSNumber *, AWSDDLogSampler *> *samplers;
+
 @end
 
 @implementation AWSDDLog
@@ -164,6 +231,16 @@ static NSUInteger _numProcessors;
         self._loggers = [[NSMutableArray alloc] initWithCapacity:4];
         self.logLevel = AWSDDLogLevelWarning;//default to warning
 
+        _fileNames = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, &kCFTypeDictionaryValueCallBacks);
+        _functionNames = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, &kCFTypeDictionaryValueCallBacks);
+
+        _bufferSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_DATA_ADD, 0, 0, _loggingQueue);
+        __weak __auto_type weakSelf = self;
+        dispatch_source_set_event_handler(_bufferSource, ^{ @autoreleasepool {
+            [weakSelf lt_drainBuffer];
+        } });
+        dispatch_resume(_bufferSource);
+
 #if TARGET_OS_IOS
         __auto_type notificationName = UIApplicationWillTerminateNotification;
 #else
@@ -205,6 +282,33 @@ static NSUInteger _numProcessors;
     return _loggingQueue;
 }
 
+- (void)dealloc {
+    dispatch_source_cancel(_bufferSource);
+    CFRelease(_fileNames);
+    CFRelease(_functionNames);
+
+    AWSDDLogBuffer *buffer = atomic_load_explicit(&_buffer, memory_order_acquire);
+    if (buffer) {
+        for (NSUInteger i = 0; i < AWSDD_LOG_BUFFER_CAPACITY; i++) {
+            AWSDDLogBufferSlot *slot = &buffer->slots[i];
+            if (slot->message) {
+                CFRelease(slot->message);
+                CFRelease(slot->messageFormat);
+            }
+            if (slot->tag) {
+                CFRelease(slot->tag);
+            }
+            if (slot->fileString) {
+                CFRelease(slot->fileString);
+            }
+            if (slot->functionString) {
+                CFRelease(slot->functionString);
+            }
+        }
+        free(buffer);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark Notifications
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,8 +429,9 @@ static NSUInteger _numProcessors;
 
     __auto_type logBlock = ^{
         // We're now sure we won't overflow the queue.
-        // It is time to queue our log message.
+        // It is time to queue our log message, after the buffered ones issued before it.
         @autoreleasepool {
+            [self lt_drainBuffer];
             [self lt_log:logMessage];
         }
     };
@@ -370,6 +475,36 @@ static NSUInteger _numProcessors;
     }
 }
 
++ (void)log:(BOOL)asynchronous
+       level:(AWSDDLogLevel)level
+        flag:(AWSDDLogFlag)flag
+     context:(NSInteger)context
+ literalFile:(const char *)file
+literalFunction:(const char *)function
+        line:(NSUInteger)line
+         tag:(id)tag
+      format:(NSString *)format, ... {
+    va_list args;
+
+    if (format) {
+        va_start(args, format);
+
+        [self.sharedInstance log:asynchronous
+                           level:level
+                            flag:flag
+                         context:context
+                            file:file
+                        function:function
+                 literalLocation:YES
+                            line:line
+                             tag:tag
+                          format:format
+                            args:args];
+
+        va_end(args);
+    }
+}
+
 - (void)log:(BOOL)asynchronous
       level:(AWSDDLogLevel)level
        flag:(AWSDDLogFlag)flag
@@ -399,6 +534,36 @@ static NSUInteger _numProcessors;
     }
 }
 
+- (void)log:(BOOL)asynchronous
+       level:(AWSDDLogLevel)level
+        flag:(AWSDDLogFlag)flag
+     context:(NSInteger)context
+ literalFile:(const char *)file
+literalFunction:(const char *)function
+        line:(NSUInteger)line
+         tag:(id)tag
+      format:(NSString *)format, ... {
+    va_list args;
+
+    if (format) {
+        va_start(args, format);
+
+        [self log:asynchronous
+            level:level
+             flag:flag
+          context:context
+             file:file
+         function:function
+  literalLocation:YES
+             line:line
+              tag:tag
+           format:format
+             args:args];
+
+        va_end(args);
+    }
+}
+
 + (void)log:(BOOL)asynchronous
       level:(AWSDDLogLevel)level
        flag:(AWSDDLogFlag)flag
@@ -422,12 +587,57 @@ static NSUInteger _numProcessors;
         tag:(id)tag
      format:(NSString *)format
        args:(va_list)args {
+    [self log:asynchronous
+        level:level
+         flag:flag
+      context:context
+         file:file
+     function:function
+literalLocation:NO
+         line:line
+          tag:tag
+       format:format
+         args:args];
+}
+
+// A buffered statement keeps the file and function pointers until the logging queue takes it out of the buffer, which
+// is only safe for string literals. Other strings are copied before the call returns.
+- (void)log:(BOOL)asynchronous
+      level:(AWSDDLogLevel)level
+       flag:(AWSDDLogFlag)flag
+    context:(NSInteger)context
+       file:(const char *)file
+   function:(const char *)function
+literalLocation:(BOOL)literalLocation
+       line:(NSUInteger)line
+        tag:(id)tag
+     format:(NSString *)format
+       args:(va_list)args {
     if (format) {
+        if ((flag & (AWSDDLogFlagDebug | AWSDDLogFlagVerbose)) != 0 &&
+            atomic_load_explicit(&_sampling, memory_order_relaxed) &&
+            ![self sampleStatementWithContext:context]) {
+            return;
+        }
+
+        __auto_type message = [[NSString alloc] initWithFormat:format arguments:args];
+
+        if (asynchronous) {
+            if ([self bufferMessage:message format:format level:level flag:flag context:context file:file function:function literalLocation:literalLocation line:line tag:tag]) {
+                return;
+            }
+            if ((flag & (AWSDDLogFlagError | AWSDDLogFlagWarning)) == 0) {
+                atomic_fetch_add_explicit(&_droppedMessageCount, 1, memory_order_relaxed);
+                return;
+            }
+            // Warnings and errors are never dropped, they go through the logging queue when the buffer is full.
+        }
+
         // Null checks are handled by -initWithMessage:
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wnullable-to-nonnull-conversion"
-        __auto_type logMessage = [[AWSDDLogMessage alloc] initWithFormat:format
-                                                                    args:args
+        __auto_type logMessage = [[AWSDDLogMessage alloc] initWithFormat:[format copy]
+                                                               formatted:message
                                                                    level:level
                                                                     flag:flag
                                                                  context:context
@@ -435,7 +645,7 @@ static NSUInteger _numProcessors;
                                                                 function:@(function)
                                                                     line:line
                                                                      tag:tag
-                                                                 options:(AWSDDLogMessageOptions)0
+                                                                 options:AWSDDLogMessageDontCopyMessage
                                                                timestamp:nil];
 #pragma clang diagnostic pop
 
@@ -464,6 +674,210 @@ static NSUInteger _numProcessors;
     });
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma mark Log Buffer
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+- (NSUInteger)droppedMessageCount {
+    return atomic_load_explicit(&_droppedMessageCount, memory_order_relaxed);
+}
+
+- (void)setSampleInterval:(NSUInteger)interval forContext:(NSInteger)context {
+    @synchronized(self) {
+        NSMutableDictionary<NSNumber *, AWSDDLogSampler *> *samplers = [self.samplers mutableCopy] ?: [NSMutableDictionary new];
+        if (interval > 1) {
+            AWSDDLogSampler *sampler = [AWSDDLogSampler new];
+            sampler->_interval = interval;
+            samplers[@(context)] = sampler;
+        } else {
+            [samplers removeObjectForKey:@(context)];
+        }
+        self.samplers = samplers;
+        atomic_store_explicit(&_sampling, samplers.count > 0, memory_order_relaxed);
+    }
+}
+
+- (BOOL)sampleStatementWithContext:(NSInteger)context {
+    AWSDDLogSampler *sampler = self.samplers[@(context)];
+    if (!sampler) {
+        return YES;
+    }
+    return atomic_fetch_add_explicit(&sampler->_count, 1, memory_order_relaxed) % sampler->_interval == 0;
+}
+
+- (AWSDDLogBuffer *)buffer {
+    AWSDDLogBuffer *buffer = atomic_load_explicit(&_buffer, memory_order_acquire);
+    if (buffer) {
+        return buffer;
+    }
+
+    AWSDDLogBuffer *newBuffer = calloc(1, sizeof(AWSDDLogBuffer));
+    for (NSUInteger i = 0; i < AWSDD_LOG_BUFFER_CAPACITY; i++) {
+        atomic_init(&newBuffer->slots[i].sequence, i);
+    }
+    if (atomic_compare_exchange_strong_explicit(&_buffer, &buffer, newBuffer, memory_order_acq_rel, memory_order_acquire)) {
+        return newBuffer;
+    }
+    free(newBuffer);
+    return buffer;
+}
+
+// Returns NO when the buffer is full.
+- (BOOL)bufferMessage:(NSString *)message
+               format:(NSString *)format
+                level:(AWSDDLogLevel)level
+                 flag:(AWSDDLogFlag)flag
+              context:(NSInteger)context
+                 file:(const char *)file
+             function:(const char *)function
+      literalLocation:(BOOL)literalLocation
+                 line:(NSUInteger)line
+                  tag:(id)tag {
+    __auto_type buffer = [self buffer];
+
+    AWSDDLogBufferSlot *slot = NULL;
+    NSUInteger position = atomic_load_explicit(&buffer->enqueuePosition, memory_order_relaxed);
+    for (;;) {
+        slot = &buffer->slots[position & (AWSDD_LOG_BUFFER_CAPACITY - 1)];
+        NSInteger difference = (NSInteger)atomic_load_explicit(&slot->sequence, memory_order_acquire) - (NSInteger)position;
+        if (difference == 0) {
+            if (atomic_compare_exchange_weak_explicit(&buffer->enqueuePosition, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            return NO;
+        } else {
+            position = atomic_load_explicit(&buffer->enqueuePosition, memory_order_relaxed);
+        }
+    }
+
+    slot->message = (__bridge_retained void *)message;
+    slot->messageFormat = (__bridge_retained void *)[format copy];
+    slot->tag = (__bridge_retained void *)tag;
+    if (literalLocation) {
+        slot->file = file;
+        slot->function = function;
+    } else {
+        slot->file = NULL;
+        slot->function = NULL;
+        slot->fileString = (__bridge_retained void *)@(file);
+        slot->functionString = function ? (__bridge_retained void *)@(function) : NULL;
+    }
+    slot->line = line;
+    slot->context = context;
+    slot->level = level;
+    slot->flag = flag;
+    slot->timestamp = CFAbsoluteTimeGetCurrent();
+    pthread_threadid_np(NULL, &slot->threadID);
+    slot->qos = qos_class_self();
+    pthread_getname_np(pthread_self(), slot->threadName, sizeof(slot->threadName));
+    strlcpy(slot->queueLabel, dispatch_queue_get_label(DISPATCH_CURRENT_QUEUE_LABEL), sizeof(slot->queueLabel));
+
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+    dispatch_source_merge_data(_bufferSource, 1);
+    return YES;
+}
+
+- (void)lt_drainBuffer {
+    AWSDDLogAssertOnGlobalLoggingQueue();
+
+    AWSDDLogBuffer *buffer = atomic_load_explicit(&_buffer, memory_order_acquire);
+    if (!buffer) {
+        return;
+    }
+
+    for (;;) {
+        NSUInteger position = buffer->dequeuePosition;
+        AWSDDLogBufferSlot *slot = &buffer->slots[position & (AWSDD_LOG_BUFFER_CAPACITY - 1)];
+        // Stops at a slot that is claimed but not published yet, the thread publishing it wakes the queue up again.
+        if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != position + 1) {
+            break;
+        }
+
+        __auto_type logMessage = [self lt_logMessageFromSlot:slot];
+        atomic_store_explicit(&slot->sequence, position + AWSDD_LOG_BUFFER_CAPACITY, memory_order_release);
+        buffer->dequeuePosition = position + 1;
+
+        @autoreleasepool {
+            [self lt_log:logMessage];
+        }
+    }
+
+    __auto_type droppedMessageCount = atomic_load_explicit(&_droppedMessageCount, memory_order_relaxed);
+    if (droppedMessageCount != _reportedDroppedMessageCount) {
+        __auto_type message = [NSString stringWithFormat:@"AWSDDLog: Dropped %lu log messages because the log buffer was full.",
+                               (unsigned long)(droppedMessageCount - _reportedDroppedMessageCount)];
+        _reportedDroppedMessageCount = droppedMessageCount;
+        [self lt_log:[[AWSDDLogMessage alloc] initWithMessage:message
+                                                        level:AWSDDLogLevelWarning
+                                                         flag:AWSDDLogFlagWarning
+                                                      context:0
+                                                         file:@(__FILE__)
+                                                     function:@(__PRETTY_FUNCTION__)
+                                                         line:__LINE__
+                                                          tag:nil
+                                                      options:(AWSDDLogMessageOptions)0
+                                                    timestamp:nil]];
+    }
+}
+
+- (AWSDDLogMessage *)lt_logMessageFromSlot:(AWSDDLogBufferSlot *)slot {
+    __auto_type logMessage = [[AWSDDLogMessage alloc] init];
+    logMessage->_message = (__bridge_transfer NSString *)slot->message;
+    logMessage->_messageFormat = (__bridge_transfer NSString *)slot->messageFormat;
+    slot->message = NULL;
+    slot->messageFormat = NULL;
+    logMessage->_level = slot->level;
+    logMessage->_flag = slot->flag;
+    logMessage->_context = slot->context;
+
+    if (slot->fileString) {
+        NSString *file = (__bridge_transfer NSString *)slot->fileString;
+        slot->fileString = NULL;
+        logMessage->_file = file;
+        logMessage->_fileName = AWSDDExtractFileNameWithoutExtension(file.UTF8String, YES) ?: file;
+        logMessage->_function = (__bridge_transfer NSString *)slot->functionString;
+        slot->functionString = NULL;
+    } else {
+        // The file and function are string literals, so their strings are created once per address.
+        NSArray<NSString *> *fileNames = (__bridge NSArray *)CFDictionaryGetValue(_fileNames, slot->file);
+        if (!fileNames) {
+            NSString *file = @(slot->file);
+            fileNames = @[file, AWSDDExtractFileNameWithoutExtension(slot->file, YES) ?: file];
+            CFDictionarySetValue(_fileNames, slot->file, (__bridge CFArrayRef)fileNames);
+        }
+        logMessage->_file = fileNames[0];
+        logMessage->_fileName = fileNames[1];
+    }
+
+    if (slot->function) {
+        NSString *function = (__bridge NSString *)CFDictionaryGetValue(_functionNames, slot->function);
+        if (!function) {
+            function = @(slot->function);
+            CFDictionarySetValue(_functionNames, slot->function, (__bridge CFStringRef)function);
+        }
+        logMessage->_function = function;
+    }
+
+    logMessage->_line = slot->line;
+    logMessage->_representedObject = (__bridge_transfer id)slot->tag;
+    slot->tag = NULL;
+#if AWSDD_LEGACY_MESSAGE_TAG
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+    logMessage->_tag = logMessage->_representedObject;
+#pragma clang diagnostic pop
+#endif
+    logMessage->_options = (AWSDDLogMessageOptions)0;
+    logMessage->_timestamp = [NSDate dateWithTimeIntervalSinceReferenceDate:slot->timestamp];
+    logMessage->_threadID = [[NSString alloc] initWithFormat:@"%llu", slot->threadID];
+    logMessage->_threadName = @(slot->threadName);
+    logMessage->_queueLabel = @(slot->queueLabel);
+    logMessage->_qos = (NSUInteger)slot->qos;
+    return logMessage;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma mark Registered Dynamic Logging
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -803,6 +1217,8 @@ static NSUInteger _numProcessors;
 
     AWSDDLogAssertOnGlobalLoggingQueue();
 
+    [self lt_drainBuffer];
+
     for (AWSDDLoggerNode *loggerNode in self._loggers) {
         if ([loggerNode->_logger respondsToSelector:@selector(flush)]) {
             dispatch_group_async(_loggingGroup, loggerNode->_loggerQueue, ^{ @autoreleasepool {
@@ -37,14 +37,15 @@
 /**
  * These are the two macros that all other macros below compile into.
  * These big multiline macros makes all the other macros easier to read.
+ * `fnct` must be a string literal, such as `__PRETTY_FUNCTION__`.
  **/
 #define AWSDD_LOG_MACRO(isAsynchronous, lvl, flg, ctx, atag, fnct, frmt, ...) \
         [AWSDDLog log : isAsynchronous                                     \
              level : lvl                                                \
               flag : flg                                                \
            context : ctx                                                \
-              file : __FILE__                                           \
-          function : fnct                                               \
+       literalFile : __FILE__                                           \
+   literalFunction : fnct                                               \
               line : __LINE__                                           \
                tag : atag                                               \
             format : (frmt), ## __VA_ARGS__]
@@ -54,8 +55,8 @@
              level : lvl                                                \
               flag : flg                                                \
            context : ctx                                                \
-              file : __FILE__                                           \
-          function : fnct                                               \
+       literalFile : __FILE__                                           \
+   literalFunction : fnct                                               \
               line : __LINE__                                           \
                tag : atag                                               \
             format : (frmt), ## __VA_ARGS__]
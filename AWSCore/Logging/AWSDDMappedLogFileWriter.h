@@ -0,0 +1,72 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Appends to a log file through a shared memory mapping.
+
+ The file is extended and mapped ahead of the data in chunks, so a write is a copy into memory, without a system call
+ or a seek. Pages of a shared mapping belong to the kernel, so what was written reaches the file even if the process
+ crashes before closing it. The file then ends with the zeroed part of the last chunk, which
+ `recoverFileAtPath:error:` removes.
+
+ The writer assumes that no other process appends to the file at the same time.
+ */
+@interface AWSDDMappedLogFileWriter : NSObject
+
+/**
+ Removes the zeroed, unwritten end of a file left by a writer that wasn't closed, and ends the file with a newline so
+ that appended lines don't continue a partial one. Does nothing to a file that doesn't end with a zero byte.
+ */
++ (BOOL)recoverFileAtPath:(NSString *)filePath error:(NSError **)error;
+
+/**
+ The length of a file without the zeroed, unwritten end of its mapping, which is what a file being written through a
+ writer holds. Returns the size of the file when it doesn't end with a zero byte, and 0 when it can't be read.
+ */
++ (unsigned long long)dataLengthOfFileAtPath:(NSString *)filePath;
+
+/**
+ Opens the file for appending, after recovering it.
+ */
+- (nullable instancetype)initWithFilePath:(NSString *)filePath error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, readonly) int fileDescriptor;
+
+/**
+ The length of the data in the file.
+ */
+@property (nonatomic, readonly) unsigned long long length;
+
+- (BOOL)writeData:(NSData *)data error:(NSError **)error;
+
+/**
+ Writes the mapped data to the storage device.
+ */
+- (BOOL)synchronizeWithError:(NSError **)error;
+
+/**
+ Unmaps the file and truncates it to its data. Called when the writer is deallocated.
+ */
+- (BOOL)closeWithError:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,245 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSDDMappedLogFileWriter.h"
+
+#import <fcntl.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+
+// The file is extended and mapped by this much at a time.
+static off_t const AWSDDMappedLogFileChunkSize = 256 * 1024;
+
+static NSError *AWSDDMappedLogFileErrorFromErrno(NSString *filePath) {
+    return [NSError errorWithDomain:NSPOSIXErrorDomain
+                               code:errno
+                           userInfo:@{NSFilePathErrorKey: filePath ?: @""}];
+}
+
+// Returns the length of the file without its trailing zero bytes, or -1 on error.
+static off_t AWSDDMappedLogFileDataLength(int fd, off_t fileSize) {
+    uint8_t buffer[4096];
+    off_t end = fileSize;
+    while (end > 0) {
+        size_t count = (size_t)MIN((off_t)sizeof(buffer), end);
+        if (pread(fd, buffer, count, end - (off_t)count) != (ssize_t)count) {
+            return -1;
+        }
+        for (size_t i = count; i > 0; i--) {
+            if (buffer[i - 1] != 0) {
+                return end - (off_t)count + (off_t)i;
+            }
+        }
+        end -= (off_t)count;
+    }
+    return 0;
+}
+
+// Reserves blocks for the file up to `size`, so that a write to the mapping doesn't fault on a full disk.
+static BOOL AWSDDMappedLogFileReserve(int fd, off_t currentSize, off_t size) {
+#ifdef F_PREALLOCATE
+    fstore_t store = {
+        .fst_flags = F_ALLOCATECONTIG | F_ALLOCATEALL,
+        .fst_posmode = F_PEOFPOSMODE,
+        .fst_offset = 0,
+        .fst_length = size - currentSize,
+    };
+    if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+        store.fst_flags = F_ALLOCATEALL;
+        if (fcntl(fd, F_PREALLOCATE, &store) == -1) {
+            return NO;
+        }
+    }
+#endif
+    return ftruncate(fd, size) == 0;
+}
+
+@interface AWSDDMappedLogFileWriter () {
+    NSString *_filePath;
+    int _fd;
+    uint8_t *_bytes;
+    off_t _mappedLength;
+    off_t _length;
+}
+
+@end
+
+@implementation AWSDDMappedLogFileWriter
+
++ (BOOL)recoverFileAtPath:(NSString *)filePath error:(NSError **)error {
+    int fd = open(filePath.fileSystemRepresentation, O_RDWR | O_CLOEXEC);
+    if (fd == -1) {
+        if (error) {
+            *error = AWSDDMappedLogFileErrorFromErrno(filePath);
+        }
+        return NO;
+    }
+
+    BOOL success = NO;
+    struct stat info;
+    uint8_t lastByte = 0;
+    if (fstat(fd, &info) == 0 && (info.st_size == 0 || pread(fd, &lastByte, 1, info.st_size - 1) == 1)) {
+        if (info.st_size == 0 || lastByte != 0) {
+            success = YES;
+        } else {
+            off_t length = AWSDDMappedLogFileDataLength(fd, info.st_size);
+            if (length >= 0 && ftruncate(fd, length) == 0) {
+                success = YES;
+                if (length > 0 && pread(fd, &lastByte, 1, length - 1) == 1 && lastByte != '\n') {
+                    success = pwrite(fd, "\n", 1, length) == 1;
+                }
+            }
+        }
+    }
+
+    if (!success && error) {
+        *error = AWSDDMappedLogFileErrorFromErrno(filePath);
+    }
+    close(fd);
+    return success;
+}
+
++ (unsigned long long)dataLengthOfFileAtPath:(NSString *)filePath {
+    int fd = open(filePath.fileSystemRepresentation, O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        return 0;
+    }
+
+    off_t length = 0;
+    struct stat info;
+    if (fstat(fd, &info) == 0) {
+        length = AWSDDMappedLogFileDataLength(fd, info.st_size);
+    }
+    close(fd);
+    return (unsigned long long)MAX(length, 0);
+}
+
+- (nullable instancetype)initWithFilePath:(NSString *)filePath error:(NSError **)error {
+    if (self = [super init]) {
+        _filePath = [filePath copy];
+        _fd = -1;
+
+        if (![[self class] recoverFileAtPath:filePath error:error]) {
+            return nil;
+        }
+
+        _fd = open(filePath.fileSystemRepresentation, O_RDWR | O_CLOEXEC);
+        struct stat info;
+        if (_fd == -1 || fstat(_fd, &info) != 0) {
+            if (error) {
+                *error = AWSDDMappedLogFileErrorFromErrno(filePath);
+            }
+            return nil;
+        }
+        _length = info.st_size;
+
+        if (![self mapLength:_length + 1 error:error]) {
+            return nil;
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self closeWithError:nil];
+}
+
+- (int)fileDescriptor {
+    return _fd;
+}
+
+- (unsigned long long)length {
+    return (unsigned long long)_length;
+}
+
+// Extends the file and its mapping to at least `length`, rounded up to a whole chunk.
+- (BOOL)mapLength:(off_t)length error:(NSError **)error {
+    off_t mappedLength = (length + AWSDDMappedLogFileChunkSize - 1) / AWSDDMappedLogFileChunkSize * AWSDDMappedLogFileChunkSize;
+
+    if (_bytes) {
+        munmap(_bytes, (size_t)_mappedLength);
+        _bytes = NULL;
+        _mappedLength = 0;
+    }
+
+    struct stat info;
+    if (fstat(_fd, &info) != 0 ||
+        (info.st_size < mappedLength && !AWSDDMappedLogFileReserve(_fd, info.st_size, mappedLength))) {
+        if (error) {
+            *error = AWSDDMappedLogFileErrorFromErrno(_filePath);
+        }
+        return NO;
+    }
+
+    void *bytes = mmap(NULL, (size_t)mappedLength, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (bytes == MAP_FAILED) {
+        if (error) {
+            *error = AWSDDMappedLogFileErrorFromErrno(_filePath);
+        }
+        return NO;
+    }
+    _bytes = bytes;
+    _mappedLength = mappedLength;
+    return YES;
+}
+
+- (BOOL)writeData:(NSData *)data error:(NSError **)error {
+    if (_fd == -1) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:EBADF userInfo:@{NSFilePathErrorKey: _filePath}];
+        }
+        return NO;
+    }
+
+    off_t length = _length + (off_t)data.length;
+    if (length > _mappedLength && ![self mapLength:length error:error]) {
+        return NO;
+    }
+    [data getBytes:_bytes + _length length:data.length];
+    _length = length;
+    return YES;
+}
+
+- (BOOL)synchronizeWithError:(NSError **)error {
+    if (_bytes && _length > 0 && msync(_bytes, (size_t)_length, MS_SYNC) != 0) {
+        if (error) {
+            *error = AWSDDMappedLogFileErrorFromErrno(_filePath);
+        }
+        return NO;
+    }
+    return YES;
+}
+
+- (BOOL)closeWithError:(NSError **)error {
+    if (_fd == -1) {
+        return YES;
+    }
+
+    if (_bytes) {
+        munmap(_bytes, (size_t)_mappedLength);
+        _bytes = NULL;
+        _mappedLength = 0;
+    }
+    BOOL success = ftruncate(_fd, _length) == 0;
+    if (!success && error) {
+        *error = AWSDDMappedLogFileErrorFromErrno(_filePath);
+    }
+    close(_fd);
+    _fd = -1;
+    return success;
+}
+
+@end
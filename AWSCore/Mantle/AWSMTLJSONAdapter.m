@@ -9,6 +9,7 @@
 #import "AWSMTLJSONAdapter.h"
 #import "AWSMTLModel.h"
 #import "AWSMTLReflection.h"
+#import <objc/runtime.h>
 
 NSString * const AWSMTLJSONAdapterErrorDomain = @"AWSMTLJSONAdapterErrorDomain";
 const NSInteger AWSMTLJSONAdapterErrorNoClassFound = 2;
@@ -21,6 +22,10 @@ const NSInteger AWSMTLJSONAdapterErrorExceptionThrown = 1;
 // Associated with the NSException that was caught.
 static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONAdapterThrownException";
 
+// Used to cache the transformers of a model class' property keys, which are
+// otherwise looked up by selector for every key of every model.
+static void *AWSMTLJSONAdapterCachedTransformersKey = &AWSMTLJSONAdapterCachedTransformersKey;
+
 @interface AWSMTLJSONAdapter ()
 
 // The MTLModel subclass being parsed, or the class of `model` if parsing has
@@ -37,6 +42,10 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 // Returns a transformer to use, or nil to not transform the property.
 - (NSValueTransformer *)JSONTransformerForKey:(NSString *)key;
 
+// Looks up the transformer for the given key without the per-class cache used
+// by -JSONTransformerForKey:.
+- (NSValueTransformer *)uncachedJSONTransformerForKey:(NSString *)key;
+
 @end
 
 @implementation AWSMTLJSONAdapter
@@ -273,6 +282,31 @@ static NSString * const AWSMTLJSONAdapterThrownExceptionErrorKey = @"AWSMTLJSONA
 - (NSValueTransformer *)JSONTransformerForKey:(NSString *)key {
 	NSParameterAssert(key != nil);
 
+	NSDictionary *transformers = objc_getAssociatedObject(self.modelClass, AWSMTLJSONAdapterCachedTransformersKey);
+	if (transformers == nil) {
+		NSSet *propertyKeys = [self.modelClass propertyKeys];
+		NSMutableDictionary *transformersByPropertyKey = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+		for (NSString *propertyKey in propertyKeys) {
+			transformersByPropertyKey[propertyKey] = [self uncachedJSONTransformerForKey:propertyKey] ?: NSNull.null;
+		}
+
+		// It doesn't really matter if we replace another thread's work, since we
+		// do it atomically and the result should be the same.
+		transformers = [transformersByPropertyKey copy];
+		objc_setAssociatedObject(self.modelClass, AWSMTLJSONAdapterCachedTransformersKey, transformers, OBJC_ASSOCIATION_RETAIN);
+	}
+
+	id transformer = transformers[key];
+	if (transformer == nil) return [self uncachedJSONTransformerForKey:key];
+	if (transformer == NSNull.null) return nil;
+
+	return transformer;
+}
+
+- (NSValueTransformer *)uncachedJSONTransformerForKey:(NSString *)key {
+	NSParameterAssert(key != nil);
+
 	SEL selector = AWSMTLSelectorWithKeyPattern(key, "JSONTransformer");
 	if ([self.modelClass respondsToSelector:selector]) {
 		NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self.modelClass methodSignatureForSelector:selector]];
@@ -21,6 +21,39 @@ static NSString * const AWSMTLModelVersionKey = @"AWSMTLModelVersion";
 // Used to cache the reflection performed in +allowedSecureCodingClassesByPropertyKey.
 static void *AWSMTLModelCachedAllowedClassesKey = &AWSMTLModelCachedAllowedClassesKey;
 
+// Used to cache the reflection performed in +encodingBehaviorsByPropertyKey.
+static void *AWSMTLModelCachedEncodingBehaviorsKey = &AWSMTLModelCachedEncodingBehaviorsKey;
+
+// Used to cache the -decode<Key>WithCoder:modelVersion: selectors looked up in
+// -decodeValueForKey:withCoder:modelVersion:.
+static void *AWSMTLModelCachedDecodingSelectorsKey = &AWSMTLModelCachedDecodingSelectorsKey;
+
+// Returns the -decode<Key>WithCoder:modelVersion: selectors of the given class'
+// property keys, wrapped in NSValue, or NSNull for the keys that the class
+// doesn't implement one for.
+static NSDictionary *decodingSelectorsByPropertyKeyForClass(Class modelClass) {
+	NSDictionary *cachedSelectors = objc_getAssociatedObject(modelClass, AWSMTLModelCachedDecodingSelectorsKey);
+	if (cachedSelectors != nil) return cachedSelectors;
+
+	NSSet *propertyKeys = [modelClass propertyKeys];
+	NSMutableDictionary *selectors = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
+
+	for (NSString *key in propertyKeys) {
+		SEL selector = AWSMTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
+		if ([modelClass instancesRespondToSelector:selector]) {
+			selectors[key] = [NSValue valueWithPointer:selector];
+		} else {
+			selectors[key] = NSNull.null;
+		}
+	}
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(modelClass, AWSMTLModelCachedDecodingSelectorsKey, selectors, OBJC_ASSOCIATION_COPY);
+
+	return selectors;
+}
+
 // Returns whether the given NSCoder requires secure coding.
 static BOOL coderRequiresSecureCoding(NSCoder *coder) {
 	SEL requiresSecureCodingSelector = @selector(requiresSecureCoding);
@@ -67,6 +100,9 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 #pragma mark Encoding Behaviors
 
 + (NSDictionary *)encodingBehaviorsByPropertyKey {
+	NSDictionary *cachedBehaviors = objc_getAssociatedObject(self, AWSMTLModelCachedEncodingBehaviorsKey);
+	if (cachedBehaviors != nil) return cachedBehaviors;
+
 	NSSet *propertyKeys = self.propertyKeys;
 	NSMutableDictionary *behaviors = [[NSMutableDictionary alloc] initWithCapacity:propertyKeys.count];
 
@@ -83,6 +119,10 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 		behaviors[key] = @(behavior);
 	}
 
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, AWSMTLModelCachedEncodingBehaviorsKey, behaviors, OBJC_ASSOCIATION_COPY);
+
 	return behaviors;
 }
 
@@ -130,8 +170,15 @@ static void verifyAllowedClassesByPropertyKey(Class modelClass) {
 	NSParameterAssert(key != nil);
 	NSParameterAssert(coder != nil);
 
-	SEL selector = AWSMTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
-	if ([self respondsToSelector:selector]) {
+	SEL selector = NULL;
+	id cachedSelector = decodingSelectorsByPropertyKeyForClass(self.class)[key];
+	if (cachedSelector == nil) {
+		selector = AWSMTLSelectorWithCapitalizedKeyPattern("decode", key, "WithCoder:modelVersion:");
+	} else if (cachedSelector != NSNull.null) {
+		selector = [cachedSelector pointerValue];
+	}
+
+	if (selector != NULL && [self respondsToSelector:selector]) {
 		NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self methodSignatureForSelector:selector]];
 		invocation.target = self;
 		invocation.selector = selector;
@@ -12,6 +12,7 @@
 #import "AWSEXTScope.h"
 #import "AWSMTLReflection.h"
 #import <objc/runtime.h>
+#import <ctype.h>
 
 // This coupling is needed for backwards compatibility in MTLModel's deprecated
 // methods.
@@ -21,6 +22,309 @@
 // Used to cache the reflection performed in +propertyKeys.
 static void *MTLModelCachedPropertyKeysKey = &MTLModelCachedPropertyKeysKey;
 
+// Used to cache the accessors resolved in +propertyAccessorTable.
+static void *AWSMTLModelCachedPropertyAccessorTableKey = &AWSMTLModelCachedPropertyAccessorTableKey;
+
+// The integer and floating point types that key-value coding boxes into
+// NSNumber, with the NSNumber methods used to box and unbox them.
+#define AWSMTL_INTEGER_TYPES(X) \
+	X('c', char, numberWithChar, charValue) \
+	X('C', unsigned char, numberWithUnsignedChar, unsignedCharValue) \
+	X('s', short, numberWithShort, shortValue) \
+	X('S', unsigned short, numberWithUnsignedShort, unsignedShortValue) \
+	X('i', int, numberWithInt, intValue) \
+	X('I', unsigned int, numberWithUnsignedInt, unsignedIntValue) \
+	X('l', long, numberWithLong, longValue) \
+	X('L', unsigned long, numberWithUnsignedLong, unsignedLongValue) \
+	X('q', long long, numberWithLongLong, longLongValue) \
+	X('Q', unsigned long long, numberWithUnsignedLongLong, unsignedLongLongValue) \
+	X('B', bool, numberWithBool, boolValue)
+
+#define AWSMTL_NUMBER_TYPES(X) \
+	AWSMTL_INTEGER_TYPES(X) \
+	X('f', float, numberWithFloat, floatValue) \
+	X('d', double, numberWithDouble, doubleValue)
+
+// The accessor methods that key-value coding would use for one property of a
+// model class.
+//
+// key            - The property key. It is retained by the table the accessor
+//                  belongs to.
+// getter         - The implementation of the method -valueForKey: would call,
+//                  or NULL if the value must be read with -valueForKey:.
+// getterType     - The type returned by `getter`: '@' for objects and classes,
+//                  or one of the types in AWSMTL_NUMBER_TYPES.
+// setter         - The implementation of the method -setValue:forKey: would
+//                  call, or NULL if the value must be set with key-value
+//                  coding, for example because it has a validation method.
+// setterType     - The type of the argument of `setter`.
+// validates      - Whether -validateValue:forKey:error: may do anything else
+//                  than accept the value.
+typedef struct {
+	__unsafe_unretained NSString *key;
+
+	SEL getterSelector;
+	IMP getter;
+	char getterType;
+
+	SEL setterSelector;
+	IMP setter;
+	char setterType;
+
+	BOOL validates;
+} AWSMTLPropertyAccessor;
+
+// Returns the type an accessor reads or writes for the given Objective-C type
+// encoding, or '\0' if key-value coding has to box the value itself.
+static char AWSMTLAccessorTypeForEncoding(const char *encoding) {
+	// Skip the method type qualifiers (const, in, inout, out, bycopy, byref and
+	// oneway).
+	while (*encoding != '\0' && strchr("rnNoORV", *encoding) != NULL) encoding++;
+
+	switch (*encoding) {
+		case '@':
+		case '#':
+			return '@';
+
+#define AWSMTL_ACCESSOR_TYPE(code, type, boxSelector, unboxSelector) \
+		case code: \
+			return code;
+		AWSMTL_NUMBER_TYPES(AWSMTL_ACCESSOR_TYPE)
+#undef AWSMTL_ACCESSOR_TYPE
+
+		default:
+			return '\0';
+	}
+}
+
+// Returns whether a method with the given selector returns a retained object
+// under ARC, which a plain function pointer call would leak.
+static BOOL AWSMTLSelectorReturnsRetainedObject(SEL selector) {
+	static const char *families[] = { "alloc", "copy", "mutableCopy", "new", "init" };
+
+	const char *name = sel_getName(selector);
+	while (*name == '_') name++;
+
+	for (size_t i = 0; i < sizeof(families) / sizeof(*families); i++) {
+		size_t length = strlen(families[i]);
+		if (strncmp(name, families[i], length) == 0 && !islower(name[length])) return YES;
+	}
+
+	return NO;
+}
+
+// Returns the first of the given selectors that the class implements, in the
+// order key-value coding searches them.
+static Method AWSMTLFirstInstanceMethod(Class cls, const SEL *selectors, size_t count, SEL *selector) {
+	for (size_t i = 0; i < count; i++) {
+		if (selectors[i] == NULL) continue;
+
+		Method method = class_getInstanceMethod(cls, selectors[i]);
+		if (method != NULL) {
+			*selector = selectors[i];
+			return method;
+		}
+	}
+
+	return NULL;
+}
+
+// Returns whether the class overrides the given NSObject instance method.
+static BOOL AWSMTLClassOverridesMethod(Class cls, SEL selector) {
+	return [cls instanceMethodForSelector:selector] != [NSObject instanceMethodForSelector:selector];
+}
+
+// The property accessors of a model class, resolved once so that equality,
+// hashing, copying and coding can call them directly instead of going through
+// key-value coding for every property, every time.
+@interface AWSMTLPropertyAccessorTable : NSObject
+
+// The number of accessors.
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+// The accessors, one for each of the class' +propertyKeys. This storage is
+// owned by the receiver, which callers must keep alive while they use it.
+@property (nonatomic, assign, readonly) const AWSMTLPropertyAccessor *accessors;
+
+- (instancetype)initWithModelClass:(Class)modelClass;
+
+// Returns the accessor for the given key, or NULL if the key is not one of the
+// class' +propertyKeys.
+- (const AWSMTLPropertyAccessor *)accessorForKey:(NSString *)key;
+
+@end
+
+@implementation AWSMTLPropertyAccessorTable {
+	NSArray *_keys;
+	NSDictionary *_indexesByKey;
+	AWSMTLPropertyAccessor *_mutableAccessors;
+}
+
+- (instancetype)initWithModelClass:(Class)modelClass {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_keys = [[modelClass propertyKeys] allObjects];
+	_count = _keys.count;
+	_mutableAccessors = calloc(MAX(_count, 1), sizeof(AWSMTLPropertyAccessor));
+
+	// Key-value coding is used throughout when the class customizes it.
+	BOOL usesKeyValueCodingGetters = AWSMTLClassOverridesMethod(modelClass, @selector(valueForKey:));
+	BOOL usesKeyValueCodingSetters = AWSMTLClassOverridesMethod(modelClass, @selector(setValue:forKey:));
+	BOOL usesKeyValueCodingValidation = AWSMTLClassOverridesMethod(modelClass, @selector(validateValue:forKey:error:));
+
+	NSMutableDictionary *indexesByKey = [[NSMutableDictionary alloc] initWithCapacity:_count];
+	char type[16];
+
+	for (NSUInteger i = 0; i < _count; i++) {
+		NSString *key = _keys[i];
+		AWSMTLPropertyAccessor *accessor = &_mutableAccessors[i];
+		accessor->key = key;
+		indexesByKey[key] = @(i);
+
+		SEL validationSelector = AWSMTLSelectorWithCapitalizedKeyPattern("validate", key, ":error:");
+		accessor->validates = usesKeyValueCodingValidation || validationSelector == NULL || class_getInstanceMethod(modelClass, validationSelector) != NULL;
+
+		if (!usesKeyValueCodingGetters) {
+			const SEL selectors[] = {
+				AWSMTLSelectorWithCapitalizedKeyPattern("get", key, ""),
+				AWSMTLSelectorWithKeyPattern(key, ""),
+				AWSMTLSelectorWithCapitalizedKeyPattern("is", key, ""),
+				AWSMTLSelectorWithKeyPattern([@"_" stringByAppendingString:key], ""),
+			};
+			SEL selector = NULL;
+			Method getter = AWSMTLFirstInstanceMethod(modelClass, selectors, sizeof(selectors) / sizeof(*selectors), &selector);
+
+			if (getter != NULL && method_getNumberOfArguments(getter) == 2) {
+				method_getReturnType(getter, type, sizeof(type));
+				char getterType = AWSMTLAccessorTypeForEncoding(type);
+
+				if (getterType != '\0' && !(getterType == '@' && AWSMTLSelectorReturnsRetainedObject(selector))) {
+					accessor->getterSelector = selector;
+					accessor->getter = method_getImplementation(getter);
+					accessor->getterType = getterType;
+				}
+			}
+		}
+
+		if (!usesKeyValueCodingSetters && !accessor->validates) {
+			const SEL selectors[] = {
+				AWSMTLSelectorWithCapitalizedKeyPattern("set", key, ":"),
+				AWSMTLSelectorWithCapitalizedKeyPattern("_set", key, ":"),
+			};
+			SEL selector = NULL;
+			Method setter = AWSMTLFirstInstanceMethod(modelClass, selectors, sizeof(selectors) / sizeof(*selectors), &selector);
+
+			if (setter != NULL && method_getNumberOfArguments(setter) == 3) {
+				method_getArgumentType(setter, 2, type, sizeof(type));
+				char setterType = AWSMTLAccessorTypeForEncoding(type);
+
+				if (setterType != '\0') {
+					accessor->setterSelector = selector;
+					accessor->setter = method_getImplementation(setter);
+					accessor->setterType = setterType;
+				}
+			}
+		}
+	}
+
+	_indexesByKey = [indexesByKey copy];
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_mutableAccessors);
+}
+
+- (const AWSMTLPropertyAccessor *)accessors {
+	return _mutableAccessors;
+}
+
+- (const AWSMTLPropertyAccessor *)accessorForKey:(NSString *)key {
+	NSNumber *index = _indexesByKey[key];
+	if (index == nil) return NULL;
+
+	return &_mutableAccessors[index.unsignedIntegerValue];
+}
+
+@end
+
+// Reads a property, boxing the value the way -valueForKey: does.
+static id AWSMTLAccessorGetValue(const AWSMTLPropertyAccessor *accessor, id model) {
+	if (accessor->getter == NULL) return [model valueForKey:accessor->key];
+
+	switch (accessor->getterType) {
+		case '@':
+			return ((id (*)(id, SEL))accessor->getter)(model, accessor->getterSelector);
+
+#define AWSMTL_GET_VALUE(code, type, boxSelector, unboxSelector) \
+		case code: \
+			return [NSNumber boxSelector:((type (*)(id, SEL))accessor->getter)(model, accessor->getterSelector)];
+		AWSMTL_NUMBER_TYPES(AWSMTL_GET_VALUE)
+#undef AWSMTL_GET_VALUE
+
+		default:
+			return [model valueForKey:accessor->key];
+	}
+}
+
+// Sets a property the way -setValue:forKey: does.
+//
+// Returns NO if the value must be set with key-value coding instead, for
+// example to unbox a value that is not an NSNumber or to handle nil for
+// a scalar property.
+static BOOL AWSMTLAccessorSetValue(const AWSMTLPropertyAccessor *accessor, id model, id value) {
+	if (accessor->setter == NULL) return NO;
+
+	switch (accessor->setterType) {
+		case '@':
+			((void (*)(id, SEL, id))accessor->setter)(model, accessor->setterSelector, value);
+			return YES;
+
+#define AWSMTL_SET_VALUE(code, type, boxSelector, unboxSelector) \
+		case code: \
+			if (![value isKindOfClass:NSNumber.class]) return NO; \
+			((void (*)(id, SEL, type))accessor->setter)(model, accessor->setterSelector, [value unboxSelector]); \
+			return YES;
+		AWSMTL_NUMBER_TYPES(AWSMTL_SET_VALUE)
+#undef AWSMTL_SET_VALUE
+
+		default:
+			return NO;
+	}
+}
+
+// Returns whether a property has equal values on two instances of the same
+// model class.
+static BOOL AWSMTLAccessorValuesEqual(const AWSMTLPropertyAccessor *accessor, id model, id otherModel) {
+	char type = (accessor->getter != NULL ? accessor->getterType : '\0');
+
+	switch (type) {
+		case '@': {
+			id value = ((id (*)(id, SEL))accessor->getter)(model, accessor->getterSelector);
+			id otherValue = ((id (*)(id, SEL))accessor->getter)(otherModel, accessor->getterSelector);
+
+			return value == otherValue || [value isEqual:otherValue];
+		}
+
+#define AWSMTL_VALUES_EQUAL(code, type, boxSelector, unboxSelector) \
+		case code: \
+			return ((type (*)(id, SEL))accessor->getter)(model, accessor->getterSelector) == ((type (*)(id, SEL))accessor->getter)(otherModel, accessor->getterSelector);
+		AWSMTL_INTEGER_TYPES(AWSMTL_VALUES_EQUAL)
+#undef AWSMTL_VALUES_EQUAL
+
+		default: {
+			// Compare boxed floating point values, so that NaN behaves the same
+			// as with key-value coding.
+			id value = AWSMTLAccessorGetValue(accessor, model);
+			id otherValue = AWSMTLAccessorGetValue(accessor, otherModel);
+
+			return (value == nil && otherValue == nil) || [value isEqual:otherValue];
+		}
+	}
+}
+
 // Validates a value for an object and sets it if necessary.
 //
 // obj         - The object for which the value is being validated. This value
@@ -30,18 +334,26 @@ static void *MTLModelCachedPropertyKeysKey = &MTLModelCachedPropertyKeysKey;
 // value       - The new value for the property identified by `key`.
 // forceUpdate - If set to `YES`, the value is being updated even if validating
 //               it did not change it.
+// accessor    - The accessor for `key` from the class' property accessor
+//               table, or NULL to use key-value coding.
 // error       - If not NULL, this may be set to any error that occurs during
 //               validation
 //
 // Returns YES if `value` could be validated and set, or NO if an error
 // occurred.
-static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUpdate, NSError **error) {
+static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUpdate, const AWSMTLPropertyAccessor *accessor, NSError **error) {
 	// Mark this as being autoreleased, because validateValue may return
 	// a new object to be stored in this variable (and we don't want ARC to
 	// double-free or leak the old or new values).
 	__autoreleasing id validatedValue = value;
 
 	@try {
+		// Without a validation method, validating accepts the value unchanged.
+		if (accessor != NULL && !accessor->validates) {
+			if (!forceUpdate) return YES;
+			if (AWSMTLAccessorSetValue(accessor, obj, value)) return YES;
+		}
+
 		if (![obj validateValue:&validatedValue forKey:key error:error]) return NO;
 
 		if (forceUpdate || value != validatedValue) {
@@ -74,6 +386,14 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 // multiple classes in the hierarchy.
 + (void)enumeratePropertiesUsingBlock:(void (^)(objc_property_t property, BOOL *stop))block;
 
+// Returns the accessors of the receiver's +propertyKeys, which are resolved
+// once and cached.
++ (AWSMTLPropertyAccessorTable *)propertyAccessorTable;
+
+// Returns the receiver's property values like -dictionaryValue, but leaves
+// out the keys of nil values instead of mapping them to NSNull.
+- (NSMutableDictionary *)awsmtl_dictionaryValueWithoutNilValues;
+
 @end
 
 @implementation AWSMTLModel
@@ -93,6 +413,8 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	self = [self init];
 	if (self == nil) return nil;
 
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
+
 	for (NSString *key in dictionary) {
 		// Mark this as being autoreleased, because validateValue may return
 		// a new object to be stored in this variable (and we don't want ARC to
@@ -101,7 +423,7 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	
 		if ([value isEqual:NSNull.null]) value = nil;
 
-		BOOL success = MTLValidateAndSetValue(self, key, value, YES, error);
+		BOOL success = MTLValidateAndSetValue(self, key, value, YES, [accessorTable accessorForKey:key], error);
 		if (!success) return nil;
 	}
 
@@ -157,8 +479,42 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	return keys;
 }
 
++ (AWSMTLPropertyAccessorTable *)propertyAccessorTable {
+	AWSMTLPropertyAccessorTable *cachedTable = objc_getAssociatedObject(self, AWSMTLModelCachedPropertyAccessorTableKey);
+	if (cachedTable != nil) return cachedTable;
+
+	AWSMTLPropertyAccessorTable *table = [[AWSMTLPropertyAccessorTable alloc] initWithModelClass:self];
+
+	// It doesn't really matter if we replace another thread's work, since we do
+	// it atomically and the result should be the same.
+	objc_setAssociatedObject(self, AWSMTLModelCachedPropertyAccessorTableKey, table, OBJC_ASSOCIATION_RETAIN);
+
+	return table;
+}
+
 - (NSDictionary *)dictionaryValue {
-	return [self dictionaryWithValuesForKeys:self.class.propertyKeys.allObjects];
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:accessorTable.count];
+
+	for (NSUInteger i = 0; i < accessorTable.count; i++) {
+		const AWSMTLPropertyAccessor *accessor = &accessorTable.accessors[i];
+		dictionaryValue[accessor->key] = AWSMTLAccessorGetValue(accessor, self) ?: NSNull.null;
+	}
+
+	return dictionaryValue;
+}
+
+- (NSMutableDictionary *)awsmtl_dictionaryValueWithoutNilValues {
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
+	NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:accessorTable.count];
+
+	for (NSUInteger i = 0; i < accessorTable.count; i++) {
+		const AWSMTLPropertyAccessor *accessor = &accessorTable.accessors[i];
+		id value = AWSMTLAccessorGetValue(accessor, self);
+		if (value != nil) dictionaryValue[accessor->key] = value;
+	}
+
+	return dictionaryValue;
 }
 
 #pragma mark Merging
@@ -195,10 +551,15 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 #pragma mark Validation
 
 - (BOOL)validate:(NSError **)error {
-	for (NSString *key in self.class.propertyKeys) {
-		id value = [self valueForKey:key];
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
+
+	for (NSUInteger i = 0; i < accessorTable.count; i++) {
+		const AWSMTLPropertyAccessor *accessor = &accessorTable.accessors[i];
+		if (!accessor->validates) continue;
+
+		id value = AWSMTLAccessorGetValue(accessor, self);
 
-		BOOL success = MTLValidateAndSetValue(self, key, value, NO, error);
+		BOOL success = MTLValidateAndSetValue(self, accessor->key, value, NO, accessor, error);
 		if (!success) return NO;
 	}
 
@@ -218,10 +579,11 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 }
 
 - (NSUInteger)hash {
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
 	NSUInteger value = 0;
 
-	for (NSString *key in self.class.propertyKeys) {
-		value ^= [[self valueForKey:key] hash];
+	for (NSUInteger i = 0; i < accessorTable.count; i++) {
+		value ^= [AWSMTLAccessorGetValue(&accessorTable.accessors[i], self) hash];
 	}
 
 	return value;
@@ -231,12 +593,10 @@ static BOOL MTLValidateAndSetValue(id obj, NSString *key, id value, BOOL forceUp
 	if (self == model) return YES;
 	if (![model isMemberOfClass:self.class]) return NO;
 
-	for (NSString *key in self.class.propertyKeys) {
-		id selfValue = [self valueForKey:key];
-		id modelValue = [model valueForKey:key];
+	NS_VALID_UNTIL_END_OF_SCOPE AWSMTLPropertyAccessorTable *accessorTable = self.class.propertyAccessorTable;
 
-		BOOL valuesEqual = ((selfValue == nil && modelValue == nil) || [selfValue isEqual:modelValue]);
-		if (!valuesEqual) return NO;
+	for (NSUInteger i = 0; i < accessorTable.count; i++) {
+		if (!AWSMTLAccessorValuesEqual(&accessorTable.accessors[i], self, model)) return NO;
 	}
 
 	return YES;
@@ -80,6 +80,12 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
                      headers:(NSDictionary *)headers
                   parameters:(NSDictionary *)parameters;
 
+@optional
+/**
+ Request bodies of at least this many bytes are gzip compressed and sent with `Content-Encoding: gzip`. `0` turns this off.
+ */
+@property (nonatomic, assign) NSUInteger requestMinCompressionSizeBytes;
+
 @end
 
 @protocol AWSNetworkingRequestInterceptor <NSObject>
@@ -172,6 +178,13 @@ typedef NS_ENUM(NSInteger, AWSHTTPMethod) {
  */
 @property (nonatomic, assign) NSTimeInterval timeoutIntervalForResource;
 
+/**
+ Request bodies of at least this many bytes are gzip compressed before they are sent. The default is `0`, which never
+ compresses them. Only set this for services that accept compressed request bodies, such as CloudWatch `PutMetricData`;
+ it applies to JSON, XML and query bodies built by the SDK and is ignored for requests that already set `Content-Encoding`.
+ */
+@property (nonatomic, assign) NSUInteger requestMinCompressionSizeBytes;
+
 @end
 
 #pragma mark - AWSNetworkingRequest
@@ -166,6 +166,7 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     configuration.maxRetryCount = self.maxRetryCount;
     configuration.timeoutIntervalForRequest = self.timeoutIntervalForRequest;
     configuration.timeoutIntervalForResource = self.timeoutIntervalForResource;
+    configuration.requestMinCompressionSizeBytes = self.requestMinCompressionSizeBytes;
 
     return configuration;
 }
@@ -223,6 +224,10 @@ NSString *const AWSNetworkingErrorDomain = @"com.amazonaws.AWSNetworkingErrorDom
     if (!self.retryHandler) {
         self.retryHandler = configuration.retryHandler;
     }
+
+    if (!self.requestMinCompressionSizeBytes) {
+        self.requestMinCompressionSizeBytes = configuration.requestMinCompressionSizeBytes;
+    }
 }
 
 - (void)setTask:(NSURLSessionTask *)task {
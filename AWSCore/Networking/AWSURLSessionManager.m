@@ -171,6 +171,10 @@ typedef NS_ENUM(NSInteger, AWSURLSessionTaskType) {
     AWSTask *task = [AWSTask taskWithResult:nil];
 
     if (request.requestSerializer) {
+        if (request.requestMinCompressionSizeBytes > 0
+            && [request.requestSerializer respondsToSelector:@selector(setRequestMinCompressionSizeBytes:)]) {
+            request.requestSerializer.requestMinCompressionSizeBytes = request.requestMinCompressionSizeBytes;
+        }
         task = [request.requestSerializer serializeRequest:mutableRequest
                                                    headers:request.headers
                                                 parameters:request.parameters];
@@ -0,0 +1,96 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSModel;
+
+FOUNDATION_EXPORT NSString *const AWSJSONModelCodecErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSJSONModelCodecErrorType) {
+    AWSJSONModelCodecErrorUnknown,
+    AWSJSONModelCodecErrorUnsupportedValue,
+};
+
+/**
+ Encodes the input model of a JSON protocol operation straight to the request body, and decodes the response body straight
+ to the output model.
+
+ The `AWSMTLJSONAdapter`, `AWSJSONBuilder` and `AWSJSONParser` path builds a dictionary tree per step. A codec walks the
+ operation's shapes and the model classes together instead, and produces the same JSON and the same models. It applies the
+ models' value transformers to scalar members, and builds nested models itself.
+
+ A codec is only available when every shape the operation reaches maps to a model class named `modelClassPrefix` followed
+ by the shape name, with the same members. Otherwise callers keep using the dictionary path.
+ */
+@interface AWSJSONModelCodec : NSObject
+
+/**
+ The model class of the operation's input.
+ */
+@property (nonatomic, readonly, nullable) Class inputClass;
+
+/**
+ The model class of the operation's output.
+ */
+@property (nonatomic, readonly, nullable) Class outputClass;
+
+/**
+ Returns the codec for `actionName`, or `nil` when the operation cannot be handled by one. Codecs are cached per definition.
+
+ @param JSONDefinition   The service definition. Only `json` protocol definitions are supported.
+ @param actionName       The operation name.
+ @param modelClassPrefix The prefix of the service's model classes, for example `AWSDynamoDB`.
+ */
++ (nullable instancetype)codecWithJSONDefinition:(NSDictionary *)JSONDefinition
+                                      actionName:(NSString *)actionName
+                                modelClassPrefix:(NSString *)modelClassPrefix;
+
+/**
+ Returns the JSON request body for `model`, which must be an instance of `inputClass`.
+
+ Returns `nil` and sets `error` when a value cannot be encoded directly. The dictionary path reports the same value.
+ */
+- (nullable NSData *)JSONDataFromModel:(AWSModel *)model
+                                 error:(NSError *__autoreleasing *)error;
+
+/**
+ Returns an instance of `outputClass` for a successful JSON response body.
+
+ Returns `nil` and sets `error` when the body does not match the output shape. Callers should then fall back to the
+ dictionary path, which handles and reports malformed responses.
+ */
+- (nullable id)modelFromJSONData:(NSData *)data
+                           error:(NSError *__autoreleasing *)error;
+
+/**
+ Returns an instance of `outputClass` whose list member `memberName` is decoded lazily.
+
+ The other members are decoded as by `modelFromJSONData:error:`. The list keeps `data` and the byte range of each element,
+ and decodes an element the first time it is read. A map element decodes each value the first time its key is read. Fully
+ read, the list is equal to the one `modelFromJSONData:error:` returns. An element that cannot be decoded is read as
+ `NSNull` and logged.
+
+ Falls back to `modelFromJSONData:error:` when `memberName` is not a list of models or the body cannot be scanned.
+ */
+- (nullable id)modelFromJSONData:(NSData *)data
+        lazilyDecodingListMember:(NSString *)memberName
+                           error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
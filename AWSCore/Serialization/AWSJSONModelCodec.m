@@ -0,0 +1,1270 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSJSONModelCodec.h"
+#import <objc/runtime.h>
+#import <objc/message.h>
+#import <os/lock.h>
+#import "AWSModel.h"
+#import "AWSMTLReflection.h"
+#import "AWSSerialization.h"
+#import "AWSCategory.h"
+#import "AWSCocoaLumberjack.h"
+
+NSString *const AWSJSONModelCodecErrorDomain = @"com.amazonaws.AWSJSONModelCodecErrorDomain";
+
+static const void *AWSJSONModelCodecCacheKey = &AWSJSONModelCodecCacheKey;
+
+@interface AWSJSONBuilder()
+
++ (id)serializeMember:(NSDictionary *)shape value:(id)value isPayloadType:(BOOL)isPayloadType error:(NSError *__autoreleasing *)error;
+
+@end
+
+@interface AWSJSONParser()
+
++ (id)serializeMember:(NSDictionary *)shape value:(id)value target:(id)target error:(NSError *__autoreleasing *)error;
+
+@end
+
+#pragma mark - Plan
+
+typedef NS_ENUM(NSInteger, AWSJSONModelCodecNodeType) {
+    AWSJSONModelCodecNodeTypeStructure,
+    AWSJSONModelCodecNodeTypeList,
+    AWSJSONModelCodecNodeTypeMap,
+};
+
+@class AWSJSONModelCodecStructure;
+
+// A value that holds models: a structure, or a list or map whose elements hold models.
+@interface AWSJSONModelCodecNode : NSObject
+
+@property (nonatomic, assign) AWSJSONModelCodecNodeType type;
+@property (nonatomic, strong) AWSJSONModelCodecStructure *structure;
+@property (nonatomic, strong) AWSJSONModelCodecNode *element;
+
+@end
+
+@implementation AWSJSONModelCodecNode
+
+@end
+
+@interface AWSJSONModelCodecMember : NSObject
+
+@property (nonatomic, strong) NSString *propertyKey;
+@property (nonatomic, strong) NSString *wireName;
+@property (nonatomic, strong) NSDictionary *rules;
+@property (nonatomic, strong) NSValueTransformer *transformer;
+@property (nonatomic, assign) BOOL reversible;
+// nil for scalars, and for lists and maps of scalars, which go through `rules` and `transformer` as a whole.
+@property (nonatomic, strong) AWSJSONModelCodecNode *node;
+
+@end
+
+@implementation AWSJSONModelCodecMember
+
+@end
+
+@interface AWSJSONModelCodecStructure : NSObject
+
+@property (nonatomic, assign) Class modelClass;
+@property (nonatomic, strong) NSArray<AWSJSONModelCodecMember *> *members;
+@property (nonatomic, strong) NSDictionary<NSString *, AWSJSONModelCodecMember *> *membersByName;
+@property (nonatomic, strong) NSDictionary<NSString *, AWSJSONModelCodecMember *> *membersByLocationName;
+
+@end
+
+@implementation AWSJSONModelCodecStructure
+
+@end
+
+static BOOL AWSJSONModelCodecHoldsModels(NSDictionary *rules) {
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"]) {
+        return YES;
+    }
+    if ([type isEqualToString:@"list"]) {
+        return AWSJSONModelCodecHoldsModels(rules[@"member"]);
+    }
+    if ([type isEqualToString:@"map"]) {
+        return AWSJSONModelCodecHoldsModels(rules[@"value"]);
+    }
+    return NO;
+}
+
+// The class named by a property's type encoding, e.g. `T@"NSArray",&,N,V_items`.
+static Class AWSJSONModelCodecPropertyClass(Class modelClass, NSString *propertyKey) {
+    objc_property_t property = class_getProperty(modelClass, propertyKey.UTF8String);
+    if (property == NULL) {
+        return nil;
+    }
+    char *type = property_copyAttributeValue(property, "T");
+    if (type == NULL) {
+        return nil;
+    }
+    Class propertyClass = nil;
+    size_t length = strlen(type);
+    if (length > 3 && type[0] == '@' && type[1] == '"') {
+        size_t end = 2;
+        while (end < length && type[end] != '"' && type[end] != '<') {
+            end++;
+        }
+        NSString *className = [[NSString alloc] initWithBytes:type + 2 length:end - 2 encoding:NSUTF8StringEncoding];
+        propertyClass = NSClassFromString(className);
+    }
+    free(type);
+    return propertyClass;
+}
+
+static NSValueTransformer *AWSJSONModelCodecTransformer(Class modelClass, NSString *propertyKey) {
+    SEL selector = AWSMTLSelectorWithKeyPattern(propertyKey, "JSONTransformer");
+    if ([modelClass respondsToSelector:selector]) {
+        return ((NSValueTransformer *(*)(id, SEL))objc_msgSend)(modelClass, selector);
+    }
+    if ([modelClass respondsToSelector:@selector(JSONTransformerForKey:)]) {
+        return [modelClass JSONTransformerForKey:propertyKey];
+    }
+    return nil;
+}
+
+#pragma mark - Writer
+
+typedef struct {
+    __unsafe_unretained NSMutableData *data;
+    NSUInteger length;
+    uint8_t buffer[4096];
+} AWSJSONModelCodecWriter;
+
+static void AWSJSONModelCodecFlush(AWSJSONModelCodecWriter *writer) {
+    [writer->data appendBytes:writer->buffer length:writer->length];
+    writer->length = 0;
+}
+
+static void AWSJSONModelCodecWriteBytes(AWSJSONModelCodecWriter *writer, const void *bytes, NSUInteger length) {
+    if (writer->length + length > sizeof(writer->buffer)) {
+        AWSJSONModelCodecFlush(writer);
+        if (length > sizeof(writer->buffer)) {
+            [writer->data appendBytes:bytes length:length];
+            return;
+        }
+    }
+    memcpy(writer->buffer + writer->length, bytes, length);
+    writer->length += length;
+}
+
+static inline void AWSJSONModelCodecWriteByte(AWSJSONModelCodecWriter *writer, uint8_t byte) {
+    if (writer->length == sizeof(writer->buffer)) {
+        AWSJSONModelCodecFlush(writer);
+    }
+    writer->buffer[writer->length++] = byte;
+}
+
+static void AWSJSONModelCodecWriteUTF8(AWSJSONModelCodecWriter *writer, const uint8_t *bytes, NSUInteger length) {
+    static const char hex[] = "0123456789abcdef";
+    NSUInteger start = 0;
+    for (NSUInteger i = 0; i < length; i++) {
+        uint8_t byte = bytes[i];
+        if (byte >= 0x20 && byte != '"' && byte != '\\') {
+            continue;
+        }
+        AWSJSONModelCodecWriteBytes(writer, bytes + start, i - start);
+        start = i + 1;
+        switch (byte) {
+            case '"': AWSJSONModelCodecWriteBytes(writer, "\\\"", 2); break;
+            case '\\': AWSJSONModelCodecWriteBytes(writer, "\\\\", 2); break;
+            case '\n': AWSJSONModelCodecWriteBytes(writer, "\\n", 2); break;
+            case '\r': AWSJSONModelCodecWriteBytes(writer, "\\r", 2); break;
+            case '\t': AWSJSONModelCodecWriteBytes(writer, "\\t", 2); break;
+            case '\b': AWSJSONModelCodecWriteBytes(writer, "\\b", 2); break;
+            case '\f': AWSJSONModelCodecWriteBytes(writer, "\\f", 2); break;
+            default: {
+                char escaped[6] = {'\\', 'u', '0', '0', hex[byte >> 4], hex[byte & 0xf]};
+                AWSJSONModelCodecWriteBytes(writer, escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+    AWSJSONModelCodecWriteBytes(writer, bytes + start, length - start);
+}
+
+static void AWSJSONModelCodecWriteString(AWSJSONModelCodecWriter *writer, NSString *string) {
+    AWSJSONModelCodecWriteByte(writer, '"');
+    const char *cString = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+    if (cString) {
+        AWSJSONModelCodecWriteUTF8(writer, (const uint8_t *)cString, strlen(cString));
+    } else {
+        uint8_t bytes[512];
+        NSRange range = NSMakeRange(0, string.length);
+        while (range.length > 0) {
+            NSUInteger usedLength = 0;
+            NSRange remainingRange = {0, 0};
+            [string getBytes:bytes
+                   maxLength:sizeof(bytes)
+                  usedLength:&usedLength
+                    encoding:NSUTF8StringEncoding
+                     options:0
+                       range:range
+              remainingRange:&remainingRange];
+            if (usedLength == 0) {
+                // Not representable in UTF-8, e.g. an unpaired surrogate.
+                NSData *data = [[string substringWithRange:range] dataUsingEncoding:NSUTF8StringEncoding allowLossyConversion:YES];
+                AWSJSONModelCodecWriteUTF8(writer, data.bytes, data.length);
+                break;
+            }
+            AWSJSONModelCodecWriteUTF8(writer, bytes, usedLength);
+            range = remainingRange;
+        }
+    }
+    AWSJSONModelCodecWriteByte(writer, '"');
+}
+
+static BOOL AWSJSONModelCodecWriteNumber(AWSJSONModelCodecWriter *writer, NSNumber *number) {
+    if (number == (id)kCFBooleanTrue) {
+        AWSJSONModelCodecWriteBytes(writer, "true", 4);
+        return YES;
+    }
+    if (number == (id)kCFBooleanFalse) {
+        AWSJSONModelCodecWriteBytes(writer, "false", 5);
+        return YES;
+    }
+
+    char digits[32];
+    int length = 0;
+    const char *type = number.objCType;
+    if (type[0] == 'f' || type[0] == 'd') {
+        double value = number.doubleValue;
+        if (!isfinite(value)) {
+            return NO;
+        }
+        // The shortest of the two that reads back as the same double.
+        length = snprintf(digits, sizeof(digits), "%.15g", value);
+        if (strtod(digits, NULL) != value) {
+            length = snprintf(digits, sizeof(digits), "%.17g", value);
+        }
+    } else if (type[0] == 'Q' || type[0] == 'L' || type[0] == 'I') {
+        length = snprintf(digits, sizeof(digits), "%llu", number.unsignedLongLongValue);
+    } else {
+        length = snprintf(digits, sizeof(digits), "%lld", number.longLongValue);
+    }
+    AWSJSONModelCodecWriteBytes(writer, digits, length);
+    return YES;
+}
+
+// Writes a value already converted by `AWSJSONBuilder`.
+static BOOL AWSJSONModelCodecWriteJSONObject(AWSJSONModelCodecWriter *writer, id value) {
+    if ([value isKindOfClass:[NSString class]]) {
+        AWSJSONModelCodecWriteString(writer, value);
+        return YES;
+    }
+    if ([value isKindOfClass:[NSNumber class]]) {
+        return AWSJSONModelCodecWriteNumber(writer, value);
+    }
+    if (value == [NSNull null]) {
+        AWSJSONModelCodecWriteBytes(writer, "null", 4);
+        return YES;
+    }
+    if ([value isKindOfClass:[NSArray class]]) {
+        AWSJSONModelCodecWriteByte(writer, '[');
+        BOOL first = YES;
+        for (id element in value) {
+            if (!first) {
+                AWSJSONModelCodecWriteByte(writer, ',');
+            }
+            first = NO;
+            if (!AWSJSONModelCodecWriteJSONObject(writer, element)) {
+                return NO;
+            }
+        }
+        AWSJSONModelCodecWriteByte(writer, ']');
+        return YES;
+    }
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        AWSJSONModelCodecWriteByte(writer, '{');
+        BOOL first = YES;
+        for (id key in value) {
+            if (![key isKindOfClass:[NSString class]]) {
+                return NO;
+            }
+            if (!first) {
+                AWSJSONModelCodecWriteByte(writer, ',');
+            }
+            first = NO;
+            AWSJSONModelCodecWriteString(writer, key);
+            AWSJSONModelCodecWriteByte(writer, ':');
+            if (!AWSJSONModelCodecWriteJSONObject(writer, [value objectForKey:key])) {
+                return NO;
+            }
+        }
+        AWSJSONModelCodecWriteByte(writer, '}');
+        return YES;
+    }
+    return NO;
+}
+
+#pragma mark - AWSJSONModelCodec
+
+#pragma mark - Scanner
+
+// Finds where JSON values start and end without building them. Used for lists that are decoded lazily.
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+} AWSJSONModelCodecScanner;
+
+static const NSUInteger AWSJSONModelCodecScannerMaxDepth = 512;
+
+static inline void AWSJSONModelCodecScanWhitespace(AWSJSONModelCodecScanner *scanner) {
+    while (scanner->offset < scanner->length) {
+        uint8_t byte = scanner->bytes[scanner->offset];
+        if (byte != ' ' && byte != '\t' && byte != '\n' && byte != '\r') {
+            break;
+        }
+        scanner->offset++;
+    }
+}
+
+static inline BOOL AWSJSONModelCodecScanByte(AWSJSONModelCodecScanner *scanner, uint8_t byte) {
+    AWSJSONModelCodecScanWhitespace(scanner);
+    if (scanner->offset < scanner->length && scanner->bytes[scanner->offset] == byte) {
+        scanner->offset++;
+        return YES;
+    }
+    return NO;
+}
+
+static inline BOOL AWSJSONModelCodecIsHexDigit(uint8_t byte) {
+    return (byte >= '0' && byte <= '9') || (byte >= 'a' && byte <= 'f') || (byte >= 'A' && byte <= 'F');
+}
+
+// Scans the string at the current offset. `range` includes the quotes.
+static BOOL AWSJSONModelCodecScanString(AWSJSONModelCodecScanner *scanner, NSRange *range, BOOL *escaped) {
+    const uint8_t *bytes = scanner->bytes;
+    NSUInteger start = scanner->offset;
+    if (start >= scanner->length || bytes[start] != '"') {
+        return NO;
+    }
+
+    BOOL hasEscapes = NO;
+    NSUInteger offset = start + 1;
+    while (offset < scanner->length) {
+        uint8_t byte = bytes[offset];
+        if (byte == '"') {
+            scanner->offset = offset + 1;
+            if (range) {
+                *range = NSMakeRange(start, scanner->offset - start);
+            }
+            if (escaped) {
+                *escaped = hasEscapes;
+            }
+            return YES;
+        }
+        if (byte < 0x20) {
+            return NO;
+        }
+        if (byte == '\\') {
+            hasEscapes = YES;
+            if (offset + 1 >= scanner->length) {
+                return NO;
+            }
+            uint8_t escape = bytes[offset + 1];
+            if (escape == 'u') {
+                if (offset + 6 > scanner->length) {
+                    return NO;
+                }
+                for (NSUInteger i = offset + 2; i < offset + 6; i++) {
+                    if (!AWSJSONModelCodecIsHexDigit(bytes[i])) {
+                        return NO;
+                    }
+                }
+                offset += 6;
+                continue;
+            }
+            if (escape == 0 || strchr("\"\\/bfnrt", escape) == NULL) {
+                return NO;
+            }
+            offset += 2;
+            continue;
+        }
+        offset++;
+    }
+    return NO;
+}
+
+static BOOL AWSJSONModelCodecScanLiteral(AWSJSONModelCodecScanner *scanner, const char *literal) {
+    NSUInteger length = strlen(literal);
+    if (scanner->length - scanner->offset < length || memcmp(scanner->bytes + scanner->offset, literal, length) != 0) {
+        return NO;
+    }
+    scanner->offset += length;
+    return YES;
+}
+
+// Skips the value at the current offset.
+static BOOL AWSJSONModelCodecSkipValue(AWSJSONModelCodecScanner *scanner, NSUInteger depth) {
+    AWSJSONModelCodecScanWhitespace(scanner);
+    if (scanner->offset >= scanner->length || depth > AWSJSONModelCodecScannerMaxDepth) {
+        return NO;
+    }
+
+    uint8_t byte = scanner->bytes[scanner->offset];
+    switch (byte) {
+        case '{':
+            scanner->offset++;
+            if (AWSJSONModelCodecScanByte(scanner, '}')) {
+                return YES;
+            }
+            do {
+                AWSJSONModelCodecScanWhitespace(scanner);
+                if (!AWSJSONModelCodecScanString(scanner, NULL, NULL)
+                    || !AWSJSONModelCodecScanByte(scanner, ':')
+                    || !AWSJSONModelCodecSkipValue(scanner, depth + 1)) {
+                    return NO;
+                }
+            } while (AWSJSONModelCodecScanByte(scanner, ','));
+            return AWSJSONModelCodecScanByte(scanner, '}');
+
+        case '[':
+            scanner->offset++;
+            if (AWSJSONModelCodecScanByte(scanner, ']')) {
+                return YES;
+            }
+            do {
+                if (!AWSJSONModelCodecSkipValue(scanner, depth + 1)) {
+                    return NO;
+                }
+            } while (AWSJSONModelCodecScanByte(scanner, ','));
+            return AWSJSONModelCodecScanByte(scanner, ']');
+
+        case '"':
+            return AWSJSONModelCodecScanString(scanner, NULL, NULL);
+
+        case 't':
+            return AWSJSONModelCodecScanLiteral(scanner, "true");
+
+        case 'f':
+            return AWSJSONModelCodecScanLiteral(scanner, "false");
+
+        case 'n':
+            return AWSJSONModelCodecScanLiteral(scanner, "null");
+
+        default: {
+            if (byte != '-' && (byte < '0' || byte > '9')) {
+                return NO;
+            }
+            scanner->offset++;
+            while (scanner->offset < scanner->length) {
+                byte = scanner->bytes[scanner->offset];
+                if ((byte < '0' || byte > '9') && byte != '.' && byte != 'e' && byte != 'E' && byte != '+' && byte != '-') {
+                    break;
+                }
+                scanner->offset++;
+            }
+            return YES;
+        }
+    }
+}
+
+// Returns the key of the string scanned at `range`.
+static NSString *AWSJSONModelCodecKeyForRange(NSData *data, NSRange range, BOOL escaped) {
+    if (!escaped) {
+        return [[NSString alloc] initWithBytes:(const uint8_t *)data.bytes + range.location + 1
+                                        length:range.length - 2
+                                      encoding:NSUTF8StringEncoding];
+    }
+    id key = [NSJSONSerialization JSONObjectWithData:[data subdataWithRange:range]
+                                             options:NSJSONReadingAllowFragments
+                                               error:nil];
+    return [key isKindOfClass:[NSString class]] ? key : nil;
+}
+
+// A list whose elements are decoded from the response body the first time they are read.
+@interface AWSJSONModelCodecLazyList : NSArray
+
+- (instancetype)initWithCodec:(AWSJSONModelCodec *)codec
+                         node:(AWSJSONModelCodecNode *)node
+                         data:(NSData *)data
+                       ranges:(NSData *)ranges;
+
+@end
+
+// A map whose keys are read up front and whose values are decoded the first time they are read.
+@interface AWSJSONModelCodecLazyMap : NSDictionary
+
+- (instancetype)initWithCodec:(AWSJSONModelCodec *)codec
+                         node:(AWSJSONModelCodecNode *)node
+                         data:(NSData *)data
+                        range:(NSRange)range;
+
+@end
+
+@interface AWSJSONModelCodec()
+
+@property (nonatomic, strong) NSString *modelClassPrefix;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSJSONModelCodecStructure *> *structures;
+@property (nonatomic, strong) AWSJSONModelCodecStructure *input;
+@property (nonatomic, strong) AWSJSONModelCodecStructure *output;
+
+- (id)readNode:(AWSJSONModelCodecNode *)node
+        object:(id)object
+         error:(NSError *__autoreleasing *)error;
+- (id)lazyValueForNode:(AWSJSONModelCodecNode *)node data:(NSData *)data range:(NSRange)range;
+
+@end
+
+@implementation AWSJSONModelCodec
+
++ (instancetype)codecWithJSONDefinition:(NSDictionary *)JSONDefinition
+                             actionName:(NSString *)actionName
+                       modelClassPrefix:(NSString *)modelClassPrefix {
+    if (JSONDefinition == nil || actionName == nil || modelClassPrefix == nil) {
+        return nil;
+    }
+
+    @synchronized (JSONDefinition) {
+        NSMutableDictionary *codecs = objc_getAssociatedObject(JSONDefinition, AWSJSONModelCodecCacheKey);
+        if (codecs == nil) {
+            codecs = [NSMutableDictionary new];
+            objc_setAssociatedObject(JSONDefinition, AWSJSONModelCodecCacheKey, codecs, OBJC_ASSOCIATION_RETAIN);
+        }
+        NSString *cacheKey = [NSString stringWithFormat:@"%@.%@", modelClassPrefix, actionName];
+        id codec = codecs[cacheKey];
+        if (codec == nil) {
+            codec = [[AWSJSONModelCodec alloc] initWithJSONDefinition:JSONDefinition
+                                                           actionName:actionName
+                                                     modelClassPrefix:modelClassPrefix];
+            codecs[cacheKey] = codec ?: [NSNull null];
+        }
+        return codec == [NSNull null] ? nil : codec;
+    }
+}
+
+- (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
+                            actionName:(NSString *)actionName
+                      modelClassPrefix:(NSString *)modelClassPrefix {
+    if (self = [super init]) {
+        if (![JSONDefinition[@"metadata"][@"protocol"] isEqual:@"json"]) {
+            return nil;
+        }
+        NSDictionary *operation = JSONDefinition[@"operations"][actionName];
+        NSDictionary *shapes = JSONDefinition[@"shapes"];
+        if (![operation isKindOfClass:[NSDictionary class]] || ![shapes isKindOfClass:[NSDictionary class]]) {
+            return nil;
+        }
+
+        _modelClassPrefix = modelClassPrefix;
+        _structures = [NSMutableDictionary new];
+
+        for (NSString *direction in @[@"input", @"output"]) {
+            if (operation[direction] == nil) {
+                continue;
+            }
+            AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:operation[direction] JSONDefinitionRule:shapes];
+            if (rules[@"payload"]) {
+                return nil;
+            }
+            AWSJSONModelCodecStructure *structure = [self structureForRules:rules];
+            if (structure == nil) {
+                return nil;
+            }
+            if ([direction isEqualToString:@"input"]) {
+                _input = structure;
+            } else {
+                _output = structure;
+            }
+        }
+        if (_input == nil && _output == nil) {
+            return nil;
+        }
+
+        // Only the two roots are needed once the plan is linked.
+        _structures = nil;
+    }
+    return self;
+}
+
+- (Class)inputClass {
+    return self.input.modelClass;
+}
+
+- (Class)outputClass {
+    return self.output.modelClass;
+}
+
+#pragma mark - Plan
+
+- (AWSJSONModelCodecStructure *)structureForRules:(NSDictionary *)rules {
+    NSString *shapeName = rules[@"shape"];
+    if (![rules[@"type"] isEqual:@"structure"] || ![shapeName isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+    AWSJSONModelCodecStructure *structure = self.structures[shapeName];
+    if (structure) {
+        return structure;
+    }
+
+    Class modelClass = NSClassFromString([self.modelClassPrefix stringByAppendingString:shapeName]);
+    if (![modelClass isSubclassOfClass:[AWSModel class]]
+        || [modelClass respondsToSelector:@selector(classForParsingJSONDictionary:)]) {
+        return nil;
+    }
+
+    NSDictionary *membersRules = rules[@"members"] ?: @{};
+    NSDictionary *keyPaths = [modelClass JSONKeyPathsByPropertyKey];
+    NSMutableDictionary<NSString *, NSString *> *propertyKeysByMemberName = [NSMutableDictionary new];
+    for (NSString *propertyKey in keyPaths) {
+        id keyPath = keyPaths[propertyKey];
+        if (keyPath == [NSNull null]) {
+            continue;
+        }
+        if (![keyPath isKindOfClass:[NSString class]] || [keyPath containsString:@"."] || membersRules[keyPath] == nil) {
+            return nil;
+        }
+        propertyKeysByMemberName[keyPath] = propertyKey;
+    }
+    if (propertyKeysByMemberName.count != membersRules.count) {
+        return nil;
+    }
+
+    // Registered before its members so that recursive shapes link back to it.
+    structure = [AWSJSONModelCodecStructure new];
+    structure.modelClass = modelClass;
+    self.structures[shapeName] = structure;
+
+    NSMutableArray<AWSJSONModelCodecMember *> *members = [NSMutableArray new];
+    NSMutableDictionary<NSString *, AWSJSONModelCodecMember *> *membersByName = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, AWSJSONModelCodecMember *> *membersByLocationName = [NSMutableDictionary new];
+    for (NSString *memberName in membersRules) {
+        NSDictionary *memberRules = membersRules[memberName];
+        if (memberRules[@"location"]) {
+            return nil;
+        }
+
+        AWSJSONModelCodecMember *member = [AWSJSONModelCodecMember new];
+        member.propertyKey = propertyKeysByMemberName[memberName];
+        member.rules = memberRules;
+        member.wireName = memberRules[@"locationName"] ?: memberName;
+        member.transformer = AWSJSONModelCodecTransformer(modelClass, member.propertyKey);
+        member.reversible = [[member.transformer class] allowsReverseTransformation];
+
+        if (AWSJSONModelCodecHoldsModels(memberRules)) {
+            // The model's transformer builds these from dictionaries; the plan builds them directly.
+            member.node = [self nodeForRules:memberRules];
+            if (member.node == nil || member.transformer == nil) {
+                return nil;
+            }
+            Class propertyClass = AWSJSONModelCodecPropertyClass(modelClass, member.propertyKey);
+            Class expectedClass = member.node.type == AWSJSONModelCodecNodeTypeStructure ? member.node.structure.modelClass
+                                : member.node.type == AWSJSONModelCodecNodeTypeList ? [NSArray class] : [NSDictionary class];
+            if (propertyClass != expectedClass) {
+                return nil;
+            }
+        }
+
+        [members addObject:member];
+        membersByName[memberName] = member;
+        NSString *locationName = memberRules[@"locationName"];
+        if ([locationName isKindOfClass:[NSString class]] && membersByLocationName[locationName] == nil) {
+            membersByLocationName[locationName] = member;
+        }
+    }
+    structure.members = members;
+    structure.membersByName = membersByName;
+    structure.membersByLocationName = membersByLocationName;
+    return structure;
+}
+
+- (AWSJSONModelCodecNode *)nodeForRules:(NSDictionary *)rules {
+    AWSJSONModelCodecNode *node = [AWSJSONModelCodecNode new];
+    NSString *type = rules[@"type"];
+    if ([type isEqualToString:@"structure"]) {
+        node.type = AWSJSONModelCodecNodeTypeStructure;
+        node.structure = [self structureForRules:rules];
+        return node.structure ? node : nil;
+    }
+    if ([type isEqualToString:@"list"]) {
+        node.type = AWSJSONModelCodecNodeTypeList;
+        node.element = [self nodeForRules:rules[@"member"]];
+    } else {
+        node.type = AWSJSONModelCodecNodeTypeMap;
+        node.element = [self nodeForRules:rules[@"value"]];
+    }
+    return node.element ? node : nil;
+}
+
+#pragma mark - Encoding
+
+- (NSData *)JSONDataFromModel:(AWSModel *)model
+                        error:(NSError *__autoreleasing *)error {
+    if (self.input == nil || [model class] != self.input.modelClass) {
+        [self failWithDescription:[NSString stringWithFormat:@"Expected an instance of %@, got %@", self.input.modelClass, [model class]]
+                            error:error];
+        return nil;
+    }
+
+    NSMutableData *data = [NSMutableData new];
+    AWSJSONModelCodecWriter writer;
+    writer.data = data;
+    writer.length = 0;
+
+    BOOL succeeded = NO;
+    @try {
+        // Like `aws_removeNullValues`, which only reaches nested dictionaries, nulls are dropped outside of lists.
+        succeeded = [self writeStructure:self.input model:model removesNulls:YES writer:&writer error:error];
+    } @catch (NSException *exception) {
+        [self failWithDescription:exception.reason ?: exception.name error:error];
+    }
+    if (!succeeded) {
+        return nil;
+    }
+    AWSJSONModelCodecFlush(&writer);
+    return data;
+}
+
+- (BOOL)writeStructure:(AWSJSONModelCodecStructure *)structure
+                 model:(id)model
+          removesNulls:(BOOL)removesNulls
+                writer:(AWSJSONModelCodecWriter *)writer
+                 error:(NSError *__autoreleasing *)error {
+    if ([model class] != structure.modelClass) {
+        [self failWithDescription:[NSString stringWithFormat:@"Expected an instance of %@, got %@", structure.modelClass, [model class]]
+                            error:error];
+        return NO;
+    }
+
+    AWSJSONModelCodecWriteByte(writer, '{');
+    BOOL first = YES;
+    for (AWSJSONModelCodecMember *member in structure.members) {
+        id value = [model valueForKey:member.propertyKey];
+        if (value == nil) {
+            continue;
+        }
+
+        if (member.node == nil) {
+            if (member.reversible) {
+                value = [member.transformer reverseTransformedValue:value == [NSNull null] ? nil : value] ?: [NSNull null];
+            }
+            if (removesNulls) {
+                if (value == [NSNull null]) {
+                    continue;
+                }
+                if ([value isKindOfClass:[NSDictionary class]]) {
+                    value = [value aws_removeNullValues];
+                }
+            }
+            NSError *builderError = nil;
+            value = [AWSJSONBuilder serializeMember:member.rules value:value isPayloadType:NO error:&builderError];
+            if (builderError) {
+                if (error) {
+                    *error = builderError;
+                }
+                return NO;
+            }
+        }
+
+        if (!first) {
+            AWSJSONModelCodecWriteByte(writer, ',');
+        }
+        first = NO;
+        AWSJSONModelCodecWriteString(writer, member.wireName);
+        AWSJSONModelCodecWriteByte(writer, ':');
+
+        BOOL written = member.node ? [self writeNode:member.node value:value removesNulls:removesNulls writer:writer error:error]
+                                   : AWSJSONModelCodecWriteJSONObject(writer, value);
+        if (!written) {
+            if (error && *error == nil) {
+                [self failWithDescription:[NSString stringWithFormat:@"%@ is not a valid JSON value", member.propertyKey] error:error];
+            }
+            return NO;
+        }
+    }
+    AWSJSONModelCodecWriteByte(writer, '}');
+    return YES;
+}
+
+- (BOOL)writeNode:(AWSJSONModelCodecNode *)node
+            value:(id)value
+     removesNulls:(BOOL)removesNulls
+           writer:(AWSJSONModelCodecWriter *)writer
+            error:(NSError *__autoreleasing *)error {
+    switch (node.type) {
+        case AWSJSONModelCodecNodeTypeStructure:
+            return [self writeStructure:node.structure model:value removesNulls:removesNulls writer:writer error:error];
+
+        case AWSJSONModelCodecNodeTypeList: {
+            if (![value isKindOfClass:[NSArray class]]) {
+                return NO;
+            }
+            AWSJSONModelCodecWriteByte(writer, '[');
+            BOOL first = YES;
+            for (id element in value) {
+                if (!first) {
+                    AWSJSONModelCodecWriteByte(writer, ',');
+                }
+                first = NO;
+                if (![self writeNode:node.element value:element removesNulls:NO writer:writer error:error]) {
+                    return NO;
+                }
+            }
+            AWSJSONModelCodecWriteByte(writer, ']');
+            return YES;
+        }
+
+        case AWSJSONModelCodecNodeTypeMap: {
+            if (![value isKindOfClass:[NSDictionary class]]) {
+                return NO;
+            }
+            AWSJSONModelCodecWriteByte(writer, '{');
+            BOOL first = YES;
+            for (id key in value) {
+                id element = [value objectForKey:key];
+                if (element == [NSNull null] && removesNulls) {
+                    continue;
+                }
+                if (![key isKindOfClass:[NSString class]]) {
+                    return NO;
+                }
+                if (!first) {
+                    AWSJSONModelCodecWriteByte(writer, ',');
+                }
+                first = NO;
+                AWSJSONModelCodecWriteString(writer, key);
+                AWSJSONModelCodecWriteByte(writer, ':');
+                if (![self writeNode:node.element value:element removesNulls:removesNulls writer:writer error:error]) {
+                    return NO;
+                }
+            }
+            AWSJSONModelCodecWriteByte(writer, '}');
+            return YES;
+        }
+    }
+    return NO;
+}
+
+#pragma mark - Decoding
+
+- (id)modelFromJSONData:(NSData *)data
+                  error:(NSError *__autoreleasing *)error {
+    if (self.output == nil) {
+        [self failWithDescription:@"The operation has no output" error:error];
+        return nil;
+    }
+
+    id JSONObject = [NSJSONSerialization JSONObjectWithData:data
+                                                    options:NSJSONReadingAllowFragments
+                                                      error:error];
+    if (![JSONObject isKindOfClass:[NSDictionary class]] || JSONObject[@"__type"]) {
+        if (JSONObject) {
+            [self failWithDescription:@"The response is not a successful result" error:error];
+        }
+        return nil;
+    }
+
+    @try {
+        return [self readStructure:self.output object:JSONObject error:error];
+    } @catch (NSException *exception) {
+        [self failWithDescription:exception.reason ?: exception.name error:error];
+        return nil;
+    }
+}
+
+- (id)modelFromJSONData:(NSData *)data
+    lazilyDecodingListMember:(NSString *)memberName
+                       error:(NSError *__autoreleasing *)error {
+    AWSJSONModelCodecMember *member = self.output.membersByName[memberName];
+    if (member.node.type != AWSJSONModelCodecNodeTypeList || member.node.element == nil) {
+        return [self modelFromJSONData:data error:error];
+    }
+
+    // The list must outlive a mutable buffer the body was read into.
+    data = [data copy];
+    const char *wireName = [member.wireName UTF8String];
+    NSUInteger wireNameLength = strlen(wireName);
+    AWSJSONModelCodecScanner scanner = {data.bytes, data.length, 0};
+    NSRange listRange = NSMakeRange(NSNotFound, 0);
+    NSMutableData *elementRanges = nil;
+
+    if (!AWSJSONModelCodecScanByte(&scanner, '{')) {
+        return [self modelFromJSONData:data error:error];
+    }
+    if (!AWSJSONModelCodecScanByte(&scanner, '}')) {
+        do {
+            AWSJSONModelCodecScanWhitespace(&scanner);
+            NSRange keyRange;
+            BOOL escaped = NO;
+            if (!AWSJSONModelCodecScanString(&scanner, &keyRange, &escaped) || !AWSJSONModelCodecScanByte(&scanner, ':')) {
+                return [self modelFromJSONData:data error:error];
+            }
+            AWSJSONModelCodecScanWhitespace(&scanner);
+
+            BOOL isList = !escaped && listRange.location == NSNotFound
+            && keyRange.length - 2 == wireNameLength
+            && memcmp(scanner.bytes + keyRange.location + 1, wireName, wireNameLength) == 0
+            && scanner.offset < scanner.length && scanner.bytes[scanner.offset] == '[';
+            if (!isList) {
+                if (!AWSJSONModelCodecSkipValue(&scanner, 1)) {
+                    return [self modelFromJSONData:data error:error];
+                }
+                continue;
+            }
+
+            // Only the extent of each element is recorded here. Elements that do not open like the shape expects are
+            // left to the eager path, which reports them.
+            uint8_t opener = member.node.element.type == AWSJSONModelCodecNodeTypeList ? '[' : '{';
+            NSUInteger listStart = scanner.offset++;
+            elementRanges = [NSMutableData new];
+            if (!AWSJSONModelCodecScanByte(&scanner, ']')) {
+                do {
+                    AWSJSONModelCodecScanWhitespace(&scanner);
+                    NSUInteger elementStart = scanner.offset;
+                    if (elementStart >= scanner.length || scanner.bytes[elementStart] != opener
+                        || !AWSJSONModelCodecSkipValue(&scanner, 2)) {
+                        return [self modelFromJSONData:data error:error];
+                    }
+                    NSRange elementRange = NSMakeRange(elementStart, scanner.offset - elementStart);
+                    [elementRanges appendBytes:&elementRange length:sizeof(elementRange)];
+                } while (AWSJSONModelCodecScanByte(&scanner, ','));
+                if (!AWSJSONModelCodecScanByte(&scanner, ']')) {
+                    return [self modelFromJSONData:data error:error];
+                }
+            }
+            listRange = NSMakeRange(listStart, scanner.offset - listStart);
+        } while (AWSJSONModelCodecScanByte(&scanner, ','));
+        if (!AWSJSONModelCodecScanByte(&scanner, '}')) {
+            return [self modelFromJSONData:data error:error];
+        }
+    }
+    AWSJSONModelCodecScanWhitespace(&scanner);
+    if (scanner.offset != scanner.length || listRange.location == NSNotFound) {
+        return [self modelFromJSONData:data error:error];
+    }
+
+    // The other members are decoded now, with an empty list in place of the lazy one.
+    NSMutableData *remainder = [NSMutableData dataWithCapacity:data.length - listRange.length + 2];
+    [remainder appendBytes:data.bytes length:listRange.location];
+    [remainder appendBytes:"[]" length:2];
+    [remainder appendBytes:(const uint8_t *)data.bytes + NSMaxRange(listRange) length:data.length - NSMaxRange(listRange)];
+    id model = [self modelFromJSONData:remainder error:error];
+    if (model) {
+        [model setValue:[[AWSJSONModelCodecLazyList alloc] initWithCodec:self
+                                                                    node:member.node.element
+                                                                    data:data
+                                                                  ranges:elementRanges]
+                 forKey:member.propertyKey];
+    }
+    return model;
+}
+
+- (id)readStructure:(AWSJSONModelCodecStructure *)structure
+             object:(id)object
+              error:(NSError *__autoreleasing *)error {
+    if (![object isKindOfClass:[NSDictionary class]]) {
+        [self failWithDescription:[NSString stringWithFormat:@"Expected an object for %@", structure.modelClass] error:error];
+        return nil;
+    }
+
+    NSMutableDictionary *dictionaryValue = [[NSMutableDictionary alloc] initWithCapacity:[object count]];
+    for (NSString *name in object) {
+        AWSJSONModelCodecMember *member = structure.membersByLocationName[name] ?: structure.membersByName[name];
+        if (member == nil) {
+            continue;
+        }
+
+        id value = [object objectForKey:name];
+        if (member.node) {
+            value = [self readNode:member.node object:value error:error];
+            if (value == nil) {
+                return nil;
+            }
+        } else {
+            NSError *parserError = nil;
+            value = [AWSJSONParser serializeMember:member.rules value:value target:nil error:&parserError];
+            if (parserError) {
+                if (error) {
+                    *error = parserError;
+                }
+                return nil;
+            }
+            if (member.transformer) {
+                value = [member.transformer transformedValue:value == [NSNull null] ? nil : value] ?: [NSNull null];
+            }
+        }
+        dictionaryValue[member.propertyKey] = value;
+    }
+
+    return [structure.modelClass modelWithDictionary:dictionaryValue error:error];
+}
+
+- (id)readNode:(AWSJSONModelCodecNode *)node
+        object:(id)object
+         error:(NSError *__autoreleasing *)error {
+    switch (node.type) {
+        case AWSJSONModelCodecNodeTypeStructure:
+            return [self readStructure:node.structure object:object error:error];
+
+        case AWSJSONModelCodecNodeTypeList: {
+            if (![object isKindOfClass:[NSArray class]]) {
+                break;
+            }
+            NSMutableArray *array = [[NSMutableArray alloc] initWithCapacity:[object count]];
+            for (id element in object) {
+                id value = [self readNode:node.element object:element error:error];
+                if (value == nil) {
+                    return nil;
+                }
+                [array addObject:value];
+            }
+            return array;
+        }
+
+        case AWSJSONModelCodecNodeTypeMap: {
+            if (![object isKindOfClass:[NSDictionary class]]) {
+                break;
+            }
+            NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] initWithCapacity:[object count]];
+            for (NSString *key in object) {
+                id value = [self readNode:node.element object:[object objectForKey:key] error:error];
+                if (value == nil) {
+                    return nil;
+                }
+                dictionary[key] = value;
+            }
+            return dictionary;
+        }
+    }
+
+    [self failWithDescription:[NSString stringWithFormat:@"Unexpected value: %@", [object class]] error:error];
+    return nil;
+}
+
+- (id)lazyValueForNode:(AWSJSONModelCodecNode *)node data:(NSData *)data range:(NSRange)range {
+    if (node.type == AWSJSONModelCodecNodeTypeMap) {
+        AWSJSONModelCodecLazyMap *map = [[AWSJSONModelCodecLazyMap alloc] initWithCodec:self node:node data:data range:range];
+        if (map) {
+            return map;
+        }
+    }
+
+    NSError *error = nil;
+    id object = [NSJSONSerialization JSONObjectWithData:[data subdataWithRange:range]
+                                                options:NSJSONReadingAllowFragments
+                                                  error:&error];
+    id value = nil;
+    @try {
+        value = object ? [self readNode:node object:object error:&error] : nil;
+    } @catch (NSException *exception) {
+        [self failWithDescription:exception.reason ?: exception.name error:&error];
+    }
+    if (value == nil) {
+        AWSDDLogError(@"Failed to decode a lazily decoded value: %@", error);
+    }
+    return value;
+}
+
+#pragma mark -
+
+- (void)failWithDescription:(NSString *)description
+                      error:(NSError *__autoreleasing *)error {
+    if (error) {
+        *error = [NSError errorWithDomain:AWSJSONModelCodecErrorDomain
+                                     code:AWSJSONModelCodecErrorUnsupportedValue
+                                 userInfo:@{NSLocalizedDescriptionKey : description}];
+    }
+}
+
+@end
+
+#pragma mark - Lazy values
+
+@implementation AWSJSONModelCodecLazyList {
+    AWSJSONModelCodec *_codec;
+    AWSJSONModelCodecNode *_node;
+    NSData *_data;
+    NSData *_ranges;
+    NSUInteger _count;
+    __strong id *_objects;
+    os_unfair_lock _lock;
+}
+
+- (instancetype)initWithCodec:(AWSJSONModelCodec *)codec
+                         node:(AWSJSONModelCodecNode *)node
+                         data:(NSData *)data
+                       ranges:(NSData *)ranges {
+    if (self = [super init]) {
+        _codec = codec;
+        _node = node;
+        _data = data;
+        _ranges = ranges;
+        _count = ranges.length / sizeof(NSRange);
+        _objects = (__strong id *)calloc(MAX(_count, 1), sizeof(id));
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    for (NSUInteger i = 0; i < _count; i++) {
+        _objects[i] = nil;
+    }
+    free(_objects);
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index {
+    if (index >= _count) {
+        [NSException raise:NSRangeException format:@"index %lu beyond bounds [0 .. %ld]", (unsigned long)index, (long)_count - 1];
+    }
+
+    os_unfair_lock_lock(&_lock);
+    id object = _objects[index];
+    os_unfair_lock_unlock(&_lock);
+    if (object) {
+        return object;
+    }
+
+    // Decoded outside the lock; when two threads race, both keep the first value stored.
+    NSRange range = ((const NSRange *)_ranges.bytes)[index];
+    object = [_codec lazyValueForNode:_node data:_data range:range] ?: [NSNull null];
+    os_unfair_lock_lock(&_lock);
+    if (_objects[index] == nil) {
+        _objects[index] = object;
+    } else {
+        object = _objects[index];
+    }
+    os_unfair_lock_unlock(&_lock);
+    return object;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
+@implementation AWSJSONModelCodecLazyMap {
+    AWSJSONModelCodec *_codec;
+    AWSJSONModelCodecNode *_node;
+    NSData *_data;
+    NSDictionary<NSString *, NSNumber *> *_indexes;
+    NSData *_ranges;
+    __strong id *_objects;
+    os_unfair_lock _lock;
+}
+
+- (instancetype)initWithCodec:(AWSJSONModelCodec *)codec
+                         node:(AWSJSONModelCodecNode *)node
+                         data:(NSData *)data
+                        range:(NSRange)range {
+    AWSJSONModelCodecScanner scanner = {data.bytes, NSMaxRange(range), range.location};
+    if (!AWSJSONModelCodecScanByte(&scanner, '{')) {
+        return nil;
+    }
+
+    NSMutableDictionary<NSString *, NSNumber *> *indexes = [NSMutableDictionary new];
+    NSMutableData *ranges = [NSMutableData new];
+    if (!AWSJSONModelCodecScanByte(&scanner, '}')) {
+        do {
+            AWSJSONModelCodecScanWhitespace(&scanner);
+            NSRange keyRange;
+            BOOL escaped = NO;
+            if (!AWSJSONModelCodecScanString(&scanner, &keyRange, &escaped) || !AWSJSONModelCodecScanByte(&scanner, ':')) {
+                return nil;
+            }
+            NSString *key = AWSJSONModelCodecKeyForRange(data, keyRange, escaped);
+            AWSJSONModelCodecScanWhitespace(&scanner);
+            NSUInteger valueStart = scanner.offset;
+            if (key == nil || !AWSJSONModelCodecSkipValue(&scanner, 1)) {
+                return nil;
+            }
+
+            // A repeated key keeps its last value.
+            NSRange valueRange = NSMakeRange(valueStart, scanner.offset - valueStart);
+            NSNumber *index = indexes[key];
+            if (index) {
+                [ranges replaceBytesInRange:NSMakeRange([index unsignedIntegerValue] * sizeof(NSRange), sizeof(NSRange))
+                                  withBytes:&valueRange];
+            } else {
+                indexes[key] = @(indexes.count);
+                [ranges appendBytes:&valueRange length:sizeof(valueRange)];
+            }
+        } while (AWSJSONModelCodecScanByte(&scanner, ','));
+        if (!AWSJSONModelCodecScanByte(&scanner, '}')) {
+            return nil;
+        }
+    }
+
+    if (self = [super init]) {
+        _codec = codec;
+        _node = node;
+        _data = data;
+        _indexes = indexes;
+        _ranges = ranges;
+        _objects = (__strong id *)calloc(MAX(indexes.count, 1), sizeof(id));
+        _lock = OS_UNFAIR_LOCK_INIT;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    NSUInteger count = _indexes.count;
+    for (NSUInteger i = 0; i < count; i++) {
+        _objects[i] = nil;
+    }
+    free(_objects);
+}
+
+- (NSUInteger)count {
+    return _indexes.count;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    return [_indexes keyEnumerator];
+}
+
+- (id)objectForKey:(id)key {
+    NSNumber *indexNumber = _indexes[key];
+    if (indexNumber == nil) {
+        return nil;
+    }
+    NSUInteger index = [indexNumber unsignedIntegerValue];
+
+    os_unfair_lock_lock(&_lock);
+    id object = _objects[index];
+    os_unfair_lock_unlock(&_lock);
+    if (object) {
+        return object;
+    }
+
+    NSRange range = ((const NSRange *)_ranges.bytes)[index];
+    object = [_codec lazyValueForNode:_node.element data:_data range:range] ?: [NSNull null];
+    os_unfair_lock_lock(&_lock);
+    if (_objects[index] == nil) {
+        _objects[index] = object;
+    } else {
+        object = _objects[index];
+    }
+    os_unfair_lock_unlock(&_lock);
+    return object;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
@@ -97,6 +97,13 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
 
 @interface AWSJSONDictionary : NSDictionary
 
+/**
+ Returns the rules for an operation's `input` or `output`. Callers passing the same `rule` and `definitionRules`
+ objects share one instance, which resolves each shape reference once and keeps the result for later requests.
+ */
++ (instancetype)rulesWithDictionary:(NSDictionary *)rule
+                 JSONDefinitionRule:(NSDictionary *)definitionRules;
+
 - (instancetype)initWithDictionary:(NSDictionary *)otherDictionary
                 JSONDefinitionRule:(NSDictionary *)rule;
 - (NSUInteger)count;
@@ -136,6 +143,17 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
                  serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
                                  error:(NSError *__autoreleasing *)error;
 
+/**
+ Returns the form-encoded request body for `params`, written in a single pass without the intermediate dictionary of
+ `buildFormattedParams:actionName:serviceDefinitionRule:error:`. The body has the same `key=value` pairs.
+
+ Returns `nil` when a value cannot be written directly, for example an invalid parameter. Callers then use
+ `buildFormattedParams:actionName:serviceDefinitionRule:error:`, which reports the error.
+ */
++ (NSData *)formDataForParams:(NSDictionary *)params
+                   actionName:(NSString *)actionName
+        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
 @end
 
 @interface AWSEC2ParamBuilder : NSObject
@@ -145,6 +163,17 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
                  serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
                                  error:(NSError *__autoreleasing *)error;
 
+/**
+ Returns the form-encoded request body for `params`, written in a single pass without the intermediate dictionary of
+ `buildFormattedParams:actionName:serviceDefinitionRule:error:`. The body has the same `key=value` pairs.
+
+ Returns `nil` when a value cannot be written directly, for example an invalid parameter. Callers then use
+ `buildFormattedParams:actionName:serviceDefinitionRule:error:`, which reports the error.
+ */
++ (NSData *)formDataForParams:(NSDictionary *)params
+                   actionName:(NSString *)actionName
+        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
 @end
 
 @interface AWSJSONBuilder : NSObject
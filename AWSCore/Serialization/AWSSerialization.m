@@ -18,6 +18,9 @@
 #import "AWSCategory.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSXMLDictionary.h"
+#import "AWSXMLStreamDecoder.h"
+#import <objc/runtime.h>
+#import <os/lock.h>
 
 NSString *const AWSXMLBuilderErrorDomain = @"com.amazonaws.AWSXMLBuilderErrorDomain";
 NSString *const AWSXMLParserErrorDomain = @"com.amazonaws.AWSXMLParserErrorDomain";
@@ -30,15 +33,78 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 @property (nonatomic, strong) NSDictionary *embeddedDictionary;
 @property (nonatomic, strong) NSDictionary *JSONDefinitionRule;
 
+- (NSString *)memberNameForXMLName:(NSString *)xmlName;
+- (NSString *)memberNameForLocationName:(NSString *)locationName;
+
 @end
 
-@implementation AWSJSONDictionary
+static const void *AWSJSONDictionaryOperationRulesKey = &AWSJSONDictionaryOperationRulesKey;
+
+// Marks a key that resolved to nothing.
+static id AWSJSONDictionaryMissingValue(void) {
+    static id _missingValue = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _missingValue = [NSObject new];
+    });
+    return _missingValue;
+}
+
+// The XML element names a structure member can be read from, in the order `findKeyNameByXMLName:rules:` tries them.
+static NSArray<NSString *> *AWSXMLNamesForMember(NSString *key, id obj) {
+    NSMutableArray<NSString *> *xmlNames = [NSMutableArray arrayWithObject:key];
+    if ([obj isKindOfClass:[NSDictionary class]]) {
+        if ([obj[@"type"] isEqualToString:@"list"] || [obj[@"type"] isEqualToString:@"map"]) {
+            if ([obj[@"flattened"] boolValue]) {
+                NSString *objXMLName = obj[@"member"][@"locationName"]?obj[@"member"][@"locationName"]:obj[@"locationName"];
+                [xmlNames addObject:objXMLName?objXMLName:@"member"];
+            } else if (obj[@"locationName"]) {
+                [xmlNames addObject:obj[@"locationName"]];
+            }
+        }
+        if (obj[@"locationName"]) {
+            [xmlNames addObject:obj[@"locationName"]];
+        }
+    }
+    return xmlNames;
+}
+
+@implementation AWSJSONDictionary {
+    NSMutableDictionary *_resolvedValues;
+    NSDictionary<NSString *, NSString *> *_memberNamesByXMLName;
+    NSDictionary<NSString *, NSString *> *_memberNamesByLocationName;
+    os_unfair_lock _lock;
+}
+
++ (instancetype)rulesWithDictionary:(NSDictionary *)rule JSONDefinitionRule:(NSDictionary *)definitionRules {
+    if (![rule isKindOfClass:[NSDictionary class]] || ![definitionRules isKindOfClass:[NSDictionary class]] || [definitionRules count] == 0) {
+        return [[AWSJSONDictionary alloc] initWithDictionary:rule JSONDefinitionRule:definitionRules];
+    }
+
+    // The operation rules are kept for as long as the shapes they resolve against.
+    @synchronized (definitionRules) {
+        NSMapTable *operationRules = objc_getAssociatedObject(definitionRules, AWSJSONDictionaryOperationRulesKey);
+        if (operationRules == nil) {
+            operationRules = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                   valueOptions:NSPointerFunctionsStrongMemory];
+            objc_setAssociatedObject(definitionRules, AWSJSONDictionaryOperationRulesKey, operationRules, OBJC_ASSOCIATION_RETAIN);
+        }
+        AWSJSONDictionary *rules = [operationRules objectForKey:rule];
+        if (rules == nil) {
+            rules = [[AWSJSONDictionary alloc] initWithDictionary:rule JSONDefinitionRule:definitionRules];
+            [operationRules setObject:rules forKey:rule];
+        }
+        return rules;
+    }
+}
 
 - (instancetype)initWithDictionary:(NSDictionary *)otherDictionary JSONDefinitionRule:(NSDictionary *)rule {
     self = [super init];
     if (self) {
         _embeddedDictionary = [[NSDictionary alloc] initWithDictionary:otherDictionary];
         _JSONDefinitionRule = [rule copy];
+        _resolvedValues = [NSMutableDictionary new];
+        _lock = OS_UNFAIR_LOCK_INIT;
     }
     return self;
 }
@@ -56,6 +122,33 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 }
 
 - (id)objectForKey:(id)aKey {
+    if (aKey == nil) {
+        return nil;
+    }
+
+    // Each key is resolved once; later lookups, including those for other requests of the same operation, share
+    // the result and the rules wrapped around it.
+    os_unfair_lock_lock(&_lock);
+    id value = _resolvedValues[aKey];
+    os_unfair_lock_unlock(&_lock);
+    if (value) {
+        return value == AWSJSONDictionaryMissingValue() ? nil : value;
+    }
+
+    value = [self resolveObjectForKey:aKey];
+
+    os_unfair_lock_lock(&_lock);
+    id resolvedValue = _resolvedValues[aKey];
+    if (resolvedValue) {
+        value = resolvedValue == AWSJSONDictionaryMissingValue() ? nil : resolvedValue;
+    } else {
+        _resolvedValues[aKey] = value ?: AWSJSONDictionaryMissingValue();
+    }
+    os_unfair_lock_unlock(&_lock);
+    return value;
+}
+
+- (id)resolveObjectForKey:(id)aKey {
     //If value found, just return value
     id value = [self.embeddedDictionary objectForKey:aKey];
     if (value) {
@@ -91,6 +184,53 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return [self.embeddedDictionary keyEnumerator];
 }
 
+// For the `members` rules of a structure. The first member that can be read from an element wins.
+- (NSString *)memberNameForXMLName:(NSString *)xmlName {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary<NSString *, NSString *> *memberNamesByXMLName = _memberNamesByXMLName;
+    os_unfair_lock_unlock(&_lock);
+
+    if (memberNamesByXMLName == nil) {
+        NSMutableDictionary<NSString *, NSString *> *index = [NSMutableDictionary new];
+        for (NSString *key in self.embeddedDictionary) {
+            for (NSString *name in AWSXMLNamesForMember(key, self[key])) {
+                if (index[name] == nil) {
+                    index[name] = key;
+                }
+            }
+        }
+        memberNamesByXMLName = index;
+
+        os_unfair_lock_lock(&_lock);
+        _memberNamesByXMLName = memberNamesByXMLName;
+        os_unfair_lock_unlock(&_lock);
+    }
+    return memberNamesByXMLName[xmlName];
+}
+
+// For the `members` rules of a structure. The first member with the location name wins.
+- (NSString *)memberNameForLocationName:(NSString *)locationName {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary<NSString *, NSString *> *memberNamesByLocationName = _memberNamesByLocationName;
+    os_unfair_lock_unlock(&_lock);
+
+    if (memberNamesByLocationName == nil) {
+        NSMutableDictionary<NSString *, NSString *> *index = [NSMutableDictionary new];
+        for (NSString *key in self.embeddedDictionary) {
+            NSString *name = self[key][@"locationName"];
+            if ([name isKindOfClass:[NSString class]] && index[name] == nil) {
+                index[name] = key;
+            }
+        }
+        memberNamesByLocationName = index;
+
+        os_unfair_lock_lock(&_lock);
+        _memberNamesByLocationName = memberNamesByLocationName;
+        os_unfair_lock_unlock(&_lock);
+    }
+    return memberNamesByLocationName[locationName];
+}
+
 @end
 
 @implementation AWSXMLBuilder
@@ -137,7 +277,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 
     AWSXMLWriter* xmlWriter = [[AWSXMLWriter alloc]init];
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
     NSString *xmlElementName = rules[@"locationName"];
     if (xmlElementName) {
@@ -334,6 +474,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 @interface AWSXMLParser ()
 
 @property (nonatomic, strong) AWSXMLDictionaryParser *xmlDictionaryParser;
+@property (nonatomic, assign) BOOL usesStreamDecoder;
 
 @end
 
@@ -356,6 +497,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         _xmlDictionaryParser.stripEmptyNodes = NO;
         _xmlDictionaryParser.wrapRootNode = YES; //wrapRootNode for easy process
         _xmlDictionaryParser.nodeNameMode = AWSXMLDictionaryNodeNameModeNever; //do not need rootName anymore since rootNode is wrapped.
+        _usesStreamDecoder = YES;
     }
 
     return self;
@@ -431,6 +573,17 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
+    // Successful responses are decoded in a single pass. Error responses, and documents the decoder does not decode
+    // exactly the way the dictionary tree below does, fall through to it.
+    if (self.usesStreamDecoder && [data isKindOfClass:[NSData class]]) {
+        AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:actionName
+                                                            serviceDefinitionRule:serviceDefinitionRule];
+        NSMutableDictionary *decodedDictionary = [decoder dictionaryForXMLData:data error:nil];
+        if (decodedDictionary) {
+            return decodedDictionary;
+        }
+    }
+
     NSMutableDictionary *rootXmlDictionary = nil;
     if ([data isKindOfClass:[NSData class]]) {
         @synchronized (self) {
@@ -459,7 +612,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         //This is mostly used error response, return xmlDictionary
         return [xmlDictionary mutableCopy];
     }else {
-        AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+        AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
         xmlDictionary = [AWSXMLParser preprocessDictionary:xmlDictionary operationName:actionName actionRule:rules serviceDefinitionRule:serviceDefinitionRule];
 
@@ -495,46 +648,16 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 }
 
 + (NSString *)findKeyNameByXMLName:(NSString *)xmlName rules:(NSDictionary *)rules {
+    if ([rules isKindOfClass:[AWSJSONDictionary class]]) {
+        return [(AWSJSONDictionary *)rules memberNameForXMLName:xmlName];
+    }
+
     __block NSString *result;
     [rules enumerateKeysAndObjectsUsingBlock:^(NSString *key, id obj, BOOL *stop) {
-
-        if ([key isEqualToString:xmlName]) {
+        if ([AWSXMLNamesForMember(key, obj) containsObject:xmlName]) {
             result = key;
             *stop = YES;
-            return;
         }
-
-        if ([obj isKindOfClass:[NSDictionary class]] && ([obj[@"type"] isEqualToString:@"list"] || [obj[@"type"] isEqualToString:@"map"])) {
-            if ([obj[@"flattened"] boolValue]) {
-                NSString *objXMLName = obj[@"member"][@"locationName"]?obj[@"member"][@"locationName"]:obj[@"locationName"];
-                objXMLName = objXMLName?objXMLName:@"member";
-                if ([xmlName isEqualToString:objXMLName]) {
-                    result = key;
-                    *stop = YES;
-                    return;
-                }
-            } else {
-                if ([xmlName isEqualToString:obj[@"locationName"]]) {
-                    result = key;
-                    *stop = YES;
-                    return;
-                }
-            }
-
-        }
-
-        if ([obj isKindOfClass:[NSDictionary class]] && [obj objectForKey:@"locationName"]) {
-            if ([xmlName isEqualToString:[obj objectForKey:@"locationName"]]) {
-                result = key;
-                *stop = YES;
-                return;
-            }
-
-        }
-
-
-
-
     }];
     return result;
 }
@@ -784,6 +907,229 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 @end
 
 
+#pragma mark - AWSQueryFormWriter
+
+// Whether `byte` is left as is by `aws_stringWithURLEncoding`.
+static inline BOOL AWSQueryFormIsUnreservedByte(uint8_t byte) {
+    return (byte >= 'a' && byte <= 'z') || (byte >= 'A' && byte <= 'Z') || (byte >= '0' && byte <= '9')
+    || byte == '-' || byte == '.' || byte == '_' || byte == '~';
+}
+
+// Appends `string` percent-encoded the way `aws_stringWithURLEncoding` encodes it.
+static BOOL AWSQueryFormAppendEncodedString(NSMutableData *data, NSString *string) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    NSUInteger start = data.length;
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(cfString);
+    CFIndex location = 0;
+    uint8_t bytes[256];
+    uint8_t encoded[sizeof(bytes) * 3];
+
+    while (location < length) {
+        CFIndex usedLength = 0;
+        CFIndex converted = CFStringGetBytes(cfString, CFRangeMake(location, length - location), kCFStringEncodingUTF8, 0, false, bytes, sizeof(bytes), &usedLength);
+        if (converted == 0) {
+            // Not representable in UTF-8.
+            [data setLength:start];
+            return NO;
+        }
+
+        NSUInteger encodedLength = 0;
+        for (CFIndex i = 0; i < usedLength; i++) {
+            uint8_t byte = bytes[i];
+            if (byte == '%') {
+                // `aws_stringWithURLEncoding` decodes existing escapes first.
+                [data setLength:start];
+                NSString *encodedString = [string aws_stringWithURLEncoding];
+                if (!encodedString) {
+                    return NO;
+                }
+                [data appendData:[encodedString dataUsingEncoding:NSUTF8StringEncoding]];
+                return YES;
+            }
+            if (AWSQueryFormIsUnreservedByte(byte)) {
+                encoded[encodedLength++] = byte;
+            } else {
+                encoded[encodedLength++] = '%';
+                encoded[encodedLength++] = hexDigits[byte >> 4];
+                encoded[encodedLength++] = hexDigits[byte & 0x0F];
+            }
+        }
+        [data appendBytes:encoded length:encodedLength];
+        location += converted;
+    }
+    return YES;
+}
+
+// Writes the `key=value` pairs of a form-encoded body into one buffer. Keys are built on a stack of percent-encoded
+// segments; each `write...` method may extend the key, and callers shorten it back to the length they started from.
+@interface AWSQueryFormWriter : NSObject
+
+@property (nonatomic, strong, readonly) NSMutableData *body;
+@property (nonatomic, strong, readonly) NSMutableData *key;
+
+- (NSUInteger)keyLength;
+- (void)truncateKeyToLength:(NSUInteger)length;
+- (void)truncateKeyToLastComponent;
+- (BOOL)appendKeyString:(NSString *)string;
+- (void)appendKeyBytes:(const char *)bytes;
+- (void)appendKeyIndex:(NSUInteger)index;
+- (BOOL)writeValue:(id)value;
+- (BOOL)writeValue:(NSString *)value forKey:(NSString *)key;
+- (BOOL)writeActionName:(NSString *)actionName serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+- (BOOL)writeScalar:(id)value type:(NSString *)rulesType;
+
+@end
+
+@implementation AWSQueryFormWriter {
+    // Hashes of the keys written so far. The dictionary path keeps one value per key.
+    CFMutableSetRef _keyHashes;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _body = [NSMutableData dataWithCapacity:1024];
+        _key = [NSMutableData dataWithCapacity:128];
+        _keyHashes = CFSetCreateMutable(kCFAllocatorDefault, 0, NULL);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    CFRelease(_keyHashes);
+}
+
+- (NSUInteger)keyLength {
+    return self.key.length;
+}
+
+- (void)truncateKeyToLength:(NSUInteger)length {
+    [self.key setLength:length];
+}
+
+// Drops the last `.` separated component, keeping the separator.
+- (void)truncateKeyToLastComponent {
+    const uint8_t *bytes = self.key.bytes;
+    NSUInteger length = self.key.length;
+    while (length > 0 && bytes[length - 1] != '.') {
+        length--;
+    }
+    [self.key setLength:length];
+}
+
+- (BOOL)appendKeyString:(NSString *)string {
+    if (![string isKindOfClass:[NSString class]]) {
+        return NO;
+    }
+    return AWSQueryFormAppendEncodedString(self.key, string);
+}
+
+- (void)appendKeyBytes:(const char *)bytes {
+    [self.key appendBytes:bytes length:strlen(bytes)];
+}
+
+- (void)appendKeyIndex:(NSUInteger)index {
+    char bytes[24];
+    int length = snprintf(bytes, sizeof(bytes), ".%lu", (unsigned long)index);
+    [self.key appendBytes:bytes length:length];
+}
+
+- (BOOL)writeValue:(id)value {
+    // 64-bit FNV-1a. A collision only sends the request through the dictionary path.
+    const uint8_t *keyBytes = self.key.bytes;
+    uint64_t hash = 14695981039346656037ULL;
+    for (NSUInteger i = 0; i < self.key.length; i++) {
+        hash = (hash ^ keyBytes[i]) * 1099511628211ULL;
+    }
+    const void *keyHash = (const void *)(uintptr_t)(hash | 1);
+    if (CFSetContainsValue(_keyHashes, keyHash)) {
+        return NO;
+    }
+
+    NSUInteger start = self.body.length;
+    if (start > 0) {
+        [self.body appendBytes:"&" length:1];
+    }
+    [self.body appendData:self.key];
+    [self.body appendBytes:"=" length:1];
+
+    BOOL written = NO;
+    if ([value isKindOfClass:[NSString class]]) {
+        written = AWSQueryFormAppendEncodedString(self.body, value);
+    } else if ([value isKindOfClass:[NSNumber class]]) {
+        const char *type = [value objCType];
+        char bytes[24];
+        int length = -1;
+        if (strcmp(type, @encode(unsigned long long)) == 0 || strcmp(type, @encode(unsigned long)) == 0) {
+            length = snprintf(bytes, sizeof(bytes), "%llu", [value unsignedLongLongValue]);
+        } else if (strcmp(type, @encode(float)) != 0 && strcmp(type, @encode(double)) != 0) {
+            length = snprintf(bytes, sizeof(bytes), "%lld", [value longLongValue]);
+        }
+        if (length > 0) {
+            [self.body appendBytes:bytes length:length];
+            written = YES;
+        } else {
+            written = AWSQueryFormAppendEncodedString(self.body, [value stringValue]);
+        }
+    }
+
+    if (!written) {
+        [self.body setLength:start];
+        return NO;
+    }
+    CFSetAddValue(_keyHashes, keyHash);
+    return YES;
+}
+
+- (BOOL)writeValue:(NSString *)value forKey:(NSString *)key {
+    NSUInteger length = self.keyLength;
+    BOOL written = [self appendKeyString:key] && [self writeValue:value];
+    [self truncateKeyToLength:length];
+    return written;
+}
+
+// Writes `Action` and `Version`. Both are encoded once more when written, like `processParameters:queryString:` does.
+- (BOOL)writeActionName:(NSString *)actionName serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    NSString *urlEncodedActionName = [actionName aws_stringWithURLEncoding];
+    if (!urlEncodedActionName || ![self writeValue:urlEncodedActionName forKey:@"Action"]) {
+        return NO;
+    }
+
+    id apiVersion = serviceDefinitionRule[@"metadata"][@"apiVersion"];
+    if ([apiVersion isKindOfClass:[NSString class]]) {
+        NSString *urlEncodedAPIVersion = [apiVersion aws_stringWithURLEncoding];
+        if (!urlEncodedAPIVersion || ![self writeValue:urlEncodedAPIVersion forKey:@"Version"]) {
+            return NO;
+        }
+    } else {
+        AWSDDLogError(@"can not find apiVersion keyword in definition file!");
+    }
+    return YES;
+}
+
+// Writes the scalar members the two builders share. Returns `NO` for a value the dictionary path would reject.
+- (BOOL)writeScalar:(id)value type:(NSString *)rulesType {
+    if ([rulesType isEqualToString:@"blob"]) {
+        if ([value isKindOfClass:[NSString class]]) {
+            value = [value dataUsingEncoding:NSUTF8StringEncoding];
+        }
+        if (![value isKindOfClass:[NSData class]]) {
+            return NO;
+        }
+        NSString *base64encodedStr = [value base64EncodedStringWithOptions:0];
+        return [self writeValue:base64encodedStr ?: @""];
+    }
+    if ([rulesType isEqualToString:@"boolean"]) {
+        if (![value respondsToSelector:@selector(boolValue)]) {
+            return NO;
+        }
+        return [self writeValue:[value boolValue] ? @"true" : @"false"];
+    }
+    return [self writeValue:value];
+}
+
+@end
+
 @implementation AWSQueryParamBuilder
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -847,7 +1193,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
 
     [AWSQueryParamBuilder serializeStructure:params rules:rules prefix:@"" formattedParams:formattedParams  error:error];
@@ -970,6 +1316,128 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return YES;
 }
 
++ (NSData *)formDataForParams:(NSDictionary *)params
+                   actionName:(NSString *)actionName
+        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    AWSQueryFormWriter *writer = [AWSQueryFormWriter new];
+    if (![writer writeActionName:actionName serviceDefinitionRule:serviceDefinitionRule]) {
+        return nil;
+    }
+
+    if ([params count] > 0) {
+        NSDictionary *actionRule = serviceDefinitionRule[@"operations"][actionName][@"input"];
+        NSDictionary *definitionRules = serviceDefinitionRule[@"shapes"];
+        if (![definitionRules isKindOfClass:[NSDictionary class]] || [definitionRules count] == 0 || [actionRule count] == 0) {
+            return nil;
+        }
+
+        AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+        if (![self writeStructure:params rules:rules writer:writer]) {
+            return nil;
+        }
+    }
+
+    return writer.body;
+}
+
++ (BOOL)writeStructure:(NSDictionary *)values rules:(AWSJSONDictionary *)structureRules writer:(AWSQueryFormWriter *)writer {
+    if (![values isKindOfClass:[NSDictionary class]]) {
+        return NO;
+    }
+
+    NSUInteger keyLength = writer.keyLength;
+    for (NSString *name in values) {
+        AWSJSONDictionary *memberShape = structureRules[@"members"][name];
+        if (memberShape) {
+            BOOL written = [writer appendKeyString:[self queryName:memberShape withDefaultName:name]]
+            && [self writeMember:values[name] rules:memberShape writer:writer];
+            [writer truncateKeyToLength:keyLength];
+            if (!written) {
+                return NO;
+            }
+        }
+    }
+    return YES;
+}
+
++ (BOOL)writeList:(NSArray *)values rules:(AWSJSONDictionary *)listRules writer:(AWSQueryFormWriter *)writer {
+    if (![values isKindOfClass:[NSArray class]]) {
+        return NO;
+    }
+
+    if ([listRules[@"flattened"] boolValue]) {
+        NSString *memberName = [self queryName:listRules[@"member"] withDefaultName:nil];
+        if (memberName) {
+            [writer truncateKeyToLastComponent];
+            if (![writer appendKeyString:memberName]) {
+                return NO;
+            }
+        }
+    } else {
+        [writer appendKeyBytes:".member"];
+    }
+
+    NSUInteger keyLength = writer.keyLength;
+    for (NSUInteger i = 0; i < [values count]; i++) {
+        [writer appendKeyIndex:i + 1];
+        BOOL written = [self writeMember:values[i] rules:listRules[@"member"] writer:writer];
+        [writer truncateKeyToLength:keyLength];
+        if (!written) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
++ (BOOL)writeMap:(NSDictionary *)values rules:(AWSJSONDictionary *)mapRules writer:(AWSQueryFormWriter *)writer {
+    if (![values isKindOfClass:[NSDictionary class]]) {
+        return NO;
+    }
+
+    if ([mapRules[@"flattened"] boolValue] == NO) {
+        [writer appendKeyBytes:".entry"];
+    }
+
+    NSString *keyName = [self queryName:mapRules[@"key"] withDefaultName:@"key"];
+    NSString *valueName = [self queryName:mapRules[@"value"] withDefaultName:@"value"];
+    NSArray *allKeysArray = [[values allKeys] sortedArrayUsingSelector:@selector(localizedCaseInsensitiveCompare:)];
+    NSUInteger keyLength = writer.keyLength;
+    NSUInteger index = 0;
+    for (NSString *key in allKeysArray) {
+        [writer appendKeyIndex:++index];
+        [writer appendKeyBytes:"."];
+        NSUInteger entryLength = writer.keyLength;
+        BOOL written = [writer appendKeyString:keyName]
+        && [self writeMember:key rules:mapRules[@"key"] writer:writer];
+        [writer truncateKeyToLength:entryLength];
+        written = written
+        && [writer appendKeyString:valueName]
+        && [self writeMember:values[key] rules:mapRules[@"value"] writer:writer];
+        [writer truncateKeyToLength:keyLength];
+        if (!written) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
++ (BOOL)writeMember:(id)value rules:(AWSJSONDictionary *)shape writer:(AWSQueryFormWriter *)writer {
+    NSString *rulesType = shape[@"type"];
+    if ([rulesType isEqualToString:@"structure"]) {
+        [writer appendKeyBytes:"."];
+        return [self writeStructure:value rules:shape writer:writer];
+    } else if ([rulesType isEqualToString:@"list"]) {
+        return [self writeList:value rules:shape writer:writer];
+    } else if ([rulesType isEqualToString:@"map"]) {
+        return [self writeMap:value rules:shape writer:writer];
+    } else if ([rulesType isEqualToString:@"timestamp"]) {
+        NSError *error = nil;
+        NSString *timestampStr = [AWSQueryTimestampSerialization serializeTimestamp:shape value:value error:&error];
+        return timestampStr && !error && [writer writeValue:timestampStr];
+    }
+    return [writer writeScalar:value type:rulesType];
+}
+
 + (NSString *)queryName:(NSDictionary *)shape withDefaultName:(NSString *)defaultName {
 
     return shape[@"locationName"]?shape[@"locationName"]:defaultName;
@@ -1038,7 +1506,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
 
     [AWSEC2ParamBuilder serializeStructure:params rules:rules prefix:@"" formattedParams:formattedParams  error:error];
@@ -1126,6 +1594,85 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
     return YES;
 }
 
++ (NSData *)formDataForParams:(NSDictionary *)params
+                   actionName:(NSString *)actionName
+        serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    AWSQueryFormWriter *writer = [AWSQueryFormWriter new];
+    if (![writer writeActionName:actionName serviceDefinitionRule:serviceDefinitionRule]) {
+        return nil;
+    }
+
+    if ([params count] > 0) {
+        NSDictionary *actionRule = serviceDefinitionRule[@"operations"][actionName][@"input"];
+        NSDictionary *definitionRules = serviceDefinitionRule[@"shapes"];
+        if (![definitionRules isKindOfClass:[NSDictionary class]] || [definitionRules count] == 0 || [actionRule count] == 0) {
+            return nil;
+        }
+
+        AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+        if (![self writeStructure:params rules:rules writer:writer]) {
+            return nil;
+        }
+    }
+
+    return writer.body;
+}
+
++ (BOOL)writeStructure:(NSDictionary *)values rules:(AWSJSONDictionary *)structureRules writer:(AWSQueryFormWriter *)writer {
+    if (![values isKindOfClass:[NSDictionary class]]) {
+        return NO;
+    }
+
+    NSUInteger keyLength = writer.keyLength;
+    for (NSString *name in values) {
+        AWSJSONDictionary *memberShape = structureRules[@"members"][name];
+        if (memberShape) {
+            BOOL written = [writer appendKeyString:[self queryName:memberShape withDefaultName:name]]
+            && [self writeMember:values[name] rules:memberShape writer:writer];
+            [writer truncateKeyToLength:keyLength];
+            if (!written) {
+                return NO;
+            }
+        }
+    }
+    return YES;
+}
+
++ (BOOL)writeList:(NSArray *)values rules:(AWSJSONDictionary *)listRules writer:(AWSQueryFormWriter *)writer {
+    if (![values isKindOfClass:[NSArray class]]) {
+        return NO;
+    }
+
+    NSUInteger keyLength = writer.keyLength;
+    for (NSUInteger i = 0; i < [values count]; i++) {
+        [writer appendKeyIndex:i + 1];
+        BOOL written = [self writeMember:values[i] rules:listRules[@"member"] writer:writer];
+        [writer truncateKeyToLength:keyLength];
+        if (!written) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
++ (BOOL)writeMember:(id)value rules:(AWSJSONDictionary *)shape writer:(AWSQueryFormWriter *)writer {
+    NSString *rulesType = shape[@"type"];
+    if ([rulesType isEqualToString:@"structure"]) {
+        [writer appendKeyBytes:"."];
+        return [self writeStructure:value rules:shape writer:writer];
+    } else if ([rulesType isEqualToString:@"list"]) {
+        return [self writeList:value rules:shape writer:writer];
+    } else if ([rulesType isEqualToString:@"map"]) {
+        // EC2 does not have any map type yet
+        return NO;
+    } else if ([rulesType isEqualToString:@"timestamp"]) {
+        NSError *error = nil;
+        NSString *timestampStr = [AWSEC2TimestampSerialization serializeTimestamp:shape value:value error:&error];
+        return timestampStr && !error && [writer writeValue:timestampStr];
+    }
+    return [writer writeScalar:value type:rulesType];
+}
+
 + (NSString *)queryName:(NSDictionary *)shape withDefaultName:(NSString *)defaultName {
 
     NSString *resultStr = shape[@"queryName"]?shape[@"queryName"]:[self upperCaseFirstChar:shape[@"locationName"]];
@@ -1206,7 +1753,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return nil;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
     id resultParams = [self serializeMember:rules value:params isPayloadType:NO error:error];
 
@@ -1403,7 +1950,7 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
         return result;
     }
 
-    AWSJSONDictionary *rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
 
     //check if has payload tag.
     NSString *isPayloadData = rules[@"payload"];
@@ -1441,6 +1988,12 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 + (NSString *)findMemberName:(NSString*)locationName structureRules:(NSDictionary *)structureRules {
 
+    NSDictionary *membersRules = structureRules[@"members"];
+    if ([membersRules isKindOfClass:[AWSJSONDictionary class]]) {
+        NSString *memberName = [(AWSJSONDictionary *)membersRules memberNameForLocationName:locationName];
+        return memberName ?: locationName;
+    }
+
     for (NSString *aMember in structureRules[@"members"]) {
         NSDictionary *memberShape = structureRules[@"members"][aMember];
 
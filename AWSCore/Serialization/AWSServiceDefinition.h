@@ -0,0 +1,45 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A read-only dictionary over the JSON text of a service definition.
+
+ Creating one scans the text once to find where each member starts and ends. A member is decoded the first time it is
+ read and then cached. Large objects such as `operations` and `shapes` are returned as `AWSServiceDefinition`s as well,
+ so a client only ever decodes the operations it calls and the shapes those operations reference.
+
+ When the string is stored as ASCII, as service definition literals are, the bytes are read in place and are not copied.
+ */
+@interface AWSServiceDefinition : NSDictionary
+
+/**
+ Returns the definition for `JSONString`, which must hold a JSON object.
+
+ @param JSONString The JSON text of the service definition. It is retained by the returned dictionary.
+ @param error      Set when `JSONString` is not a JSON object.
+
+ @return An `AWSServiceDefinition`, or a dictionary decoded by `NSJSONSerialization` when the text could not be indexed,
+         or `nil` when it is not valid JSON.
+ */
++ (nullable NSDictionary *)definitionWithJSONString:(NSString *)JSONString
+                                              error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
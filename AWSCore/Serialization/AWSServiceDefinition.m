@@ -0,0 +1,291 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSServiceDefinition.h"
+#import <os/lock.h>
+#import "AWSCocoaLumberjack.h"
+
+// Objects at least this long are indexed instead of decoded.
+static const NSUInteger AWSServiceDefinitionIndexedObjectLength = 16 * 1024;
+
+#pragma mark - Scanning
+
+static NSUInteger AWSServiceDefinitionSkipWhitespace(const uint8_t *bytes, NSUInteger index, NSUInteger end) {
+    while (index < end && (bytes[index] == ' ' || bytes[index] == '\n' || bytes[index] == '\r' || bytes[index] == '\t')) {
+        index++;
+    }
+    return index;
+}
+
+// `index` is at the opening quote. Returns the index after the closing quote.
+static NSUInteger AWSServiceDefinitionSkipString(const uint8_t *bytes, NSUInteger index, NSUInteger end) {
+    for (index++; index < end; index++) {
+        if (bytes[index] == '\\') {
+            index++;
+        } else if (bytes[index] == '"') {
+            return index + 1;
+        }
+    }
+    return NSNotFound;
+}
+
+// Returns the index after the value starting at `index`. Nested values are only matched, not validated.
+static NSUInteger AWSServiceDefinitionSkipValue(const uint8_t *bytes, NSUInteger index, NSUInteger end) {
+    if (index >= end) {
+        return NSNotFound;
+    }
+    if (bytes[index] == '"') {
+        return AWSServiceDefinitionSkipString(bytes, index, end);
+    }
+    if (bytes[index] == '{' || bytes[index] == '[') {
+        NSUInteger depth = 0;
+        while (index < end) {
+            uint8_t byte = bytes[index];
+            if (byte == '"') {
+                index = AWSServiceDefinitionSkipString(bytes, index, end);
+                if (index == NSNotFound) {
+                    return NSNotFound;
+                }
+                continue;
+            }
+            if (byte == '{' || byte == '[') {
+                depth++;
+            } else if (byte == '}' || byte == ']') {
+                if (--depth == 0) {
+                    return index + 1;
+                }
+            }
+            index++;
+        }
+        return NSNotFound;
+    }
+
+    NSUInteger start = index;
+    while (index < end && bytes[index] != ',' && bytes[index] != '}' && bytes[index] != ']'
+           && bytes[index] != ' ' && bytes[index] != '\n' && bytes[index] != '\r' && bytes[index] != '\t') {
+        index++;
+    }
+    return index > start ? index : NSNotFound;
+}
+
+#pragma mark - AWSServiceDefinition
+
+@interface AWSServiceDefinition()
+
+- (nullable instancetype)initWithData:(NSData *)data
+                                range:(NSRange)range
+                                owner:(nullable id)owner;
+
+@end
+
+@implementation AWSServiceDefinition {
+    NSData *_data;
+    id _owner;
+    NSDictionary<NSString *, NSNumber *> *_memberIndexes;
+    NSRange *_memberRanges;
+    NSMutableDictionary<NSString *, id> *_decodedMembers;
+    os_unfair_lock _lock;
+}
+
++ (NSDictionary *)definitionWithJSONString:(NSString *)JSONString
+                                     error:(NSError *__autoreleasing *)error {
+    NSData *data = nil;
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)JSONString, kCFStringEncodingUTF8);
+    if (bytes) {
+        data = [NSData dataWithBytesNoCopy:(void *)bytes length:strlen(bytes) freeWhenDone:NO];
+    } else {
+        data = [JSONString dataUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    AWSServiceDefinition *definition = [[AWSServiceDefinition alloc] initWithData:data
+                                                                            range:NSMakeRange(0, data.length)
+                                                                            owner:JSONString];
+    if (definition) {
+        return definition;
+    }
+
+    // Let NSJSONSerialization decode it, or describe what is wrong with it.
+    id JSONObject = [NSJSONSerialization JSONObjectWithData:data
+                                                    options:kNilOptions
+                                                      error:error];
+    if (JSONObject && ![JSONObject isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+    return JSONObject;
+}
+
+- (instancetype)initWithData:(NSData *)data
+                       range:(NSRange)range
+                       owner:(id)owner {
+    if (self = [super init]) {
+        _data = data;
+        _owner = owner;
+        _decodedMembers = [NSMutableDictionary new];
+        _lock = OS_UNFAIR_LOCK_INIT;
+        if (![self indexObjectInRange:range]) {
+            return nil;
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_memberRanges);
+}
+
+- (BOOL)indexObjectInRange:(NSRange)range {
+    const uint8_t *bytes = _data.bytes;
+    NSUInteger end = NSMaxRange(range);
+    NSUInteger index = AWSServiceDefinitionSkipWhitespace(bytes, range.location, end);
+    if (index >= end || bytes[index] != '{') {
+        return NO;
+    }
+    index = AWSServiceDefinitionSkipWhitespace(bytes, index + 1, end);
+
+    NSMutableDictionary<NSString *, NSNumber *> *memberIndexes = [NSMutableDictionary new];
+    NSUInteger capacity = 16;
+    NSUInteger count = 0;
+    NSRange *memberRanges = malloc(capacity * sizeof(NSRange));
+
+    BOOL closed = index < end && bytes[index] == '}';
+    if (closed) {
+        index++;
+    }
+    while (!closed) {
+        if (index >= end || bytes[index] != '"') {
+            break;
+        }
+        NSUInteger keyEnd = AWSServiceDefinitionSkipString(bytes, index, end);
+        if (keyEnd == NSNotFound) {
+            break;
+        }
+        NSString *key = [self keyInRange:NSMakeRange(index, keyEnd - index)];
+        index = AWSServiceDefinitionSkipWhitespace(bytes, keyEnd, end);
+        if (key == nil || index >= end || bytes[index] != ':') {
+            break;
+        }
+        index = AWSServiceDefinitionSkipWhitespace(bytes, index + 1, end);
+        NSUInteger valueEnd = AWSServiceDefinitionSkipValue(bytes, index, end);
+        if (valueEnd == NSNotFound) {
+            break;
+        }
+
+        if (count == capacity) {
+            capacity *= 2;
+            memberRanges = realloc(memberRanges, capacity * sizeof(NSRange));
+        }
+        memberRanges[count] = NSMakeRange(index, valueEnd - index);
+        memberIndexes[key] = @(count);
+        count++;
+
+        index = AWSServiceDefinitionSkipWhitespace(bytes, valueEnd, end);
+        if (index < end && bytes[index] == ',') {
+            index = AWSServiceDefinitionSkipWhitespace(bytes, index + 1, end);
+        } else if (index < end && bytes[index] == '}') {
+            index++;
+            closed = YES;
+        } else {
+            break;
+        }
+    }
+
+    if (!closed || AWSServiceDefinitionSkipWhitespace(bytes, index, end) != end) {
+        free(memberRanges);
+        return NO;
+    }
+
+    _memberIndexes = memberIndexes;
+    _memberRanges = memberRanges;
+    return YES;
+}
+
+- (NSString *)keyInRange:(NSRange)range {
+    const uint8_t *bytes = _data.bytes;
+    if (memchr(bytes + range.location, '\\', range.length) == NULL) {
+        return [[NSString alloc] initWithBytes:bytes + range.location + 1
+                                        length:range.length - 2
+                                      encoding:NSUTF8StringEncoding];
+    }
+    return [NSJSONSerialization JSONObjectWithData:[_data subdataWithRange:range]
+                                           options:NSJSONReadingAllowFragments
+                                             error:nil];
+}
+
+- (id)decodeMemberInRange:(NSRange)range {
+    const uint8_t *bytes = _data.bytes;
+    if (bytes[range.location] == '{' && range.length >= AWSServiceDefinitionIndexedObjectLength) {
+        AWSServiceDefinition *member = [[AWSServiceDefinition alloc] initWithData:_data
+                                                                            range:range
+                                                                            owner:_owner];
+        if (member) {
+            return member;
+        }
+    }
+
+    NSError *error = nil;
+    id member = [NSJSONSerialization JSONObjectWithData:[_data subdataWithRange:range]
+                                                options:NSJSONReadingAllowFragments
+                                                  error:&error];
+    if (member == nil) {
+        AWSDDLogError(@"Failed to parse JSON service definition: %@", error);
+    }
+    return member;
+}
+
+#pragma mark - NSDictionary
+
+- (NSUInteger)count {
+    return _memberIndexes.count;
+}
+
+- (id)objectForKey:(id)aKey {
+    NSNumber *memberIndex = [_memberIndexes objectForKey:aKey];
+    if (memberIndex == nil) {
+        return nil;
+    }
+
+    os_unfair_lock_lock(&_lock);
+    id member = _decodedMembers[aKey];
+    os_unfair_lock_unlock(&_lock);
+    if (member) {
+        return member;
+    }
+
+    member = [self decodeMemberInRange:_memberRanges[memberIndex.unsignedIntegerValue]];
+    if (member == nil) {
+        return nil;
+    }
+
+    // Another thread may have decoded it first; keep the first one so callers share it.
+    os_unfair_lock_lock(&_lock);
+    id decoded = _decodedMembers[aKey];
+    if (decoded) {
+        member = decoded;
+    } else {
+        _decodedMembers[aKey] = member;
+    }
+    os_unfair_lock_unlock(&_lock);
+    return member;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    return [_memberIndexes keyEnumerator];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
@@ -19,6 +19,16 @@
 
 NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimestampSerializationErrorDomain";
 
+// Same output as `[NSString stringWithFormat:@"%.lf", ...]`, without parsing the format string.
+static NSString *AWSTimestampEpochString(NSDate *date) {
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%.0f", [date timeIntervalSince1970]);
+    if (length <= 0 || length >= (int)sizeof(buffer)) {
+        return [NSString stringWithFormat:@"%.lf", [date timeIntervalSince1970]];
+    }
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
 @implementation AWSTimestampSerialization
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -69,7 +79,7 @@ NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimest
             if ([rules[@"timestampFormat"] isEqualToString:@"iso8601"]) {
                 timestampStr = [timeStampDate aws_stringValue:AWSDateISO8601DateFormat1];
             } else if ([rules[@"timestampFormat"] isEqualToString:@"unixTimestamp"]) {
-                timestampStr = [NSString stringWithFormat:@"%.lf",[timeStampDate timeIntervalSince1970]];
+                timestampStr = AWSTimestampEpochString(timeStampDate);
             } else if ([rules[@"timestampFormat"] isEqualToString:@"rfc822"]) {
                 timestampStr = [timeStampDate aws_stringValue: AWSDateRFC822DateFormat1];
             }
@@ -88,7 +98,7 @@ NSString *const AWSTimestampSerializationErrorDomain = @"com.amazonaws.AWSTimest
     if (!timestampStr.length){
         // valid `timestampFormat` trait is not present, use protocol specific default.
         NSDate *timeStampDate = [self parseTimestamp:value];
-        timestampStr = [NSString stringWithFormat:@"%.lf",[timeStampDate timeIntervalSince1970]];
+        timestampStr = AWSTimestampEpochString(timeStampDate);
     }
     return timestampStr;
 }
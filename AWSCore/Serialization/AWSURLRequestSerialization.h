@@ -20,6 +20,14 @@
 
 @interface AWSJSONRequestSerializer : NSObject <AWSURLRequestSerializer>
 
+/**
+ A request body that has already been encoded, for example by an `AWSJSONModelCodec`. When set, it is sent as is instead
+ of a body built from the request parameters.
+ */
+@property (nonatomic, strong) NSData *encodedBody;
+
+@property (nonatomic, assign) NSUInteger requestMinCompressionSizeBytes;
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName;
 
@@ -27,6 +35,8 @@
 
 @interface AWSXMLRequestSerializer : NSObject <AWSURLRequestSerializer>
 
+@property (nonatomic, assign) NSUInteger requestMinCompressionSizeBytes;
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                       actionName:(NSString *)actionName;
 
@@ -45,4 +55,6 @@
 
 @property (nonatomic, strong) NSDictionary *additionalParameters;
 
+@property (nonatomic, assign) NSUInteger requestMinCompressionSizeBytes;
+
 @end
@@ -46,6 +46,22 @@
 
 @end
 
+// Compresses a body built by the serializer once it reaches `minimumSize` bytes, unless it is already encoded.
+static void AWSGZIPRequestBodyIfNeeded(NSMutableURLRequest *request, NSDictionary *headers, NSUInteger minimumSize) {
+    if (minimumSize == 0
+        || request.HTTPBody.length < minimumSize
+        || headers[@"Content-Encoding"]
+        || [request valueForHTTPHeaderField:@"Content-Encoding"]) {
+        return;
+    }
+
+    NSData *compressedData = [request.HTTPBody awsgzip_gzippedData];
+    if (compressedData) {
+        request.HTTPBody = compressedData;
+        [request setValue:@"gzip" forHTTPHeaderField:@"Content-Encoding"];
+    }
+}
+
 @interface AWSJSONRequestSerializer()
 
 @property (nonatomic, strong) NSDictionary *serviceDefinitionJSON;
@@ -88,7 +104,7 @@
 
     NSDictionary *actionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[actionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *inputRules = [AWSJSONDictionary rulesWithDictionary:[actionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
 
     NSDictionary *actionHTTPRule = [actionRules objectForKey:@"http"];
     NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
@@ -110,7 +126,7 @@
 
     //construct HTTPBody only if HTTPBodyStream is nil
     if (!request.HTTPBodyStream) {
-        NSData *bodyData = [AWSJSONBuilder jsonDataForDictionary:parameters actionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        NSData *bodyData = self.encodedBody ?: [AWSJSONBuilder jsonDataForDictionary:parameters actionName:self.actionName serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
         if (!error) {
             if (headers[@"Content-Encoding"] && [headers[@"Content-Encoding"] rangeOfString:@"gzip"].location != NSNotFound) {
                 //gzip the body
@@ -123,6 +139,10 @@
 
     [request aws_validateHTTPMethodAndBody];
 
+    if (!error) {
+        AWSGZIPRequestBodyIfNeeded(request, headers, self.requestMinCompressionSizeBytes);
+    }
+
     NSDictionary<NSString *, NSString *> *allHeaders = [request allHTTPHeaderFields];
 
     if (!error) {
@@ -188,7 +208,7 @@
     //Construct URI and Headers and HTTPBodyStream
     NSString *ruleURIStr = [actionHTTPRule objectForKey:@"requestUri"];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *inputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *inputRules = [AWSJSONDictionary rulesWithDictionary:[anActionRules objectForKey:@"input"] JSONDefinitionRule:shapeRules];
 
     NSDictionary *actionEndpoint = [anActionRules objectForKey:@"endpoint"];
     NSString *endpointHostPrefix = [actionEndpoint objectForKey:@"hostPrefix"];
@@ -225,9 +245,10 @@
 
     if (error) {
         return [AWSTask taskWithError:error];
-    } else {
-        return [AWSTask taskWithResult:nil];
     }
+
+    AWSGZIPRequestBodyIfNeeded(request, headers, self.requestMinCompressionSizeBytes);
+    return [AWSTask taskWithResult:nil];
 }
 
 - (AWSTask *)validateRequest:(NSURLRequest *)request {
@@ -534,19 +555,26 @@
     }];
 
     //Need to add version and actionName
-    NSError *error = nil;
-    NSDictionary *formattedParams = [AWSQueryParamBuilder buildFormattedParams:parameters
-                                                                    actionName:self.actionName
-                                                         serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
-    if (error) {
-        return [AWSTask taskWithError:error];
-    }
+    NSData *formData = [AWSQueryParamBuilder formDataForParams:parameters
+                                                    actionName:self.actionName
+                                         serviceDefinitionRule:self.serviceDefinitionJSON];
+    if (formData) {
+        request.HTTPBody = formData;
+    } else {
+        NSError *error = nil;
+        NSDictionary *formattedParams = [AWSQueryParamBuilder buildFormattedParams:parameters
+                                                                        actionName:self.actionName
+                                                             serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
 
-    NSMutableString *queryString = [NSMutableString new];
-    [self processParameters:formattedParams queryString:queryString];
+        NSMutableString *queryString = [NSMutableString new];
+        [self processParameters:formattedParams queryString:queryString];
 
-    if ([queryString length] > 0) {
-        request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        if ([queryString length] > 0) {
+            request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        }
     }
 
     //contruct additional headers
@@ -563,6 +591,7 @@
     }
 
     [request aws_validateHTTPMethodAndBody];
+    AWSGZIPRequestBodyIfNeeded(request, headers, self.requestMinCompressionSizeBytes);
 
     return [AWSTask taskWithResult:nil];
 }
@@ -18,12 +18,26 @@
 #import "AWSNetworking.h"
 #import "AWSSerialization.h"
 
+@class AWSJSONModelCodec;
+
 @interface AWSJSONResponseSerializer : NSObject <AWSHTTPURLResponseSerializer>
 
 @property (nonatomic, strong, readonly) NSDictionary *serviceDefinitionJSON;
 @property (nonatomic, strong, readonly) NSString *actionName;
 @property (nonatomic, assign, readonly) Class outputClass;
 
+/**
+ When set, and its `outputClass` is the serializer's, successful responses are decoded straight to an `outputClass`
+ model, which is returned instead of a dictionary. Responses it cannot decode are parsed as before.
+ */
+@property (nonatomic, strong) AWSJSONModelCodec *codec;
+
+/**
+ When set with `codec`, the output's list member with this name is decoded lazily, element by element, as it is read.
+ See `-[AWSJSONModelCodec modelFromJSONData:lazilyDecodingListMember:error:]`.
+ */
+@property (nonatomic, strong) NSString *lazilyDecodedMemberName;
+
 - (instancetype)initWithJSONDefinition:(NSDictionary *)JSONDefinition
                             actionName:(NSString *)actionName
                            outputClass:(Class)outputClass;
@@ -19,6 +19,7 @@
 #import "AWSService.h"
 #import "AWSValidation.h"
 #import "AWSSerialization.h"
+#import "AWSJSONModelCodec.h"
 
 #pragma mark - Service errors
 
@@ -91,6 +92,16 @@
         return nil;
     }
 
+    if (self.codec && self.outputClass && self.codec.outputClass == self.outputClass
+        && response.statusCode/100 == 2 && [data isKindOfClass:[NSData class]]) {
+        id model = self.lazilyDecodedMemberName
+        ? [self.codec modelFromJSONData:data lazilyDecodingListMember:self.lazilyDecodedMemberName error:nil]
+        : [self.codec modelFromJSONData:data error:nil];
+        if (model) {
+            return model;
+        }
+    }
+
     id result = nil;
 
     //parse JSON data
@@ -100,7 +111,7 @@
     if ([result isKindOfClass:[NSDictionary class]]) {
         NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:_actionName];
         NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-        AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
+        AWSJSONDictionary *outputRules = [AWSJSONDictionary rulesWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
         result = [AWSXMLResponseSerializer parseResponse:response rules:outputRules bodyDictionary:[result mutableCopy] error:error];
 
         NSNumber *errorCode = [[AWSService errorCodeDictionary] objectForKey:[[[result objectForKey:@"__type"] componentsSeparatedByString:@"#"] lastObject]];
@@ -252,7 +263,7 @@
 
     NSDictionary *anActionRules = [[self.serviceDefinitionJSON objectForKey:@"operations"] objectForKey:self.actionName];
     NSDictionary *shapeRules = [self.serviceDefinitionJSON objectForKey:@"shapes"];
-    AWSJSONDictionary *outputRules = [[AWSJSONDictionary alloc] initWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
+    AWSJSONDictionary *outputRules = [AWSJSONDictionary rulesWithDictionary:[anActionRules objectForKey:@"output"] JSONDefinitionRule:shapeRules];
 
     NSMutableDictionary *resultDic = [NSMutableDictionary new];
 
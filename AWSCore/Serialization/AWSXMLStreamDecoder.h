@@ -0,0 +1,59 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Decodes the body of a successful XML response in a single pass, driven by the operation's output shape.
+
+ `AWSXMLParser` first builds a dictionary tree of the whole document and then walks it a second time against the shape
+ rules. A decoder walks the shape rules as the parser reports each element instead: it only keeps the elements that are
+ still open, and converts each element to its final value as soon as it closes. The result is the same dictionary
+ `AWSXMLParser` returns.
+
+ A decoder returns `nil` for error responses and for documents it cannot decode exactly the way `AWSXMLParser` does, for
+ example a streaming payload. Callers then use `AWSXMLParser`, which also reports malformed responses.
+
+ A decoder is not thread safe. Use one per response.
+ */
+@interface AWSXMLStreamDecoder : NSObject
+
+/**
+ Returns a decoder for the output of `actionName`, or `nil` when the operation's responses cannot be decoded by one.
+
+ @param actionName            The operation name.
+ @param serviceDefinitionRule The service definition.
+ */
++ (nullable instancetype)decoderWithActionName:(NSString *)actionName
+                         serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+/**
+ Decodes a response body held in memory.
+ */
+- (nullable NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
+                                                 error:(NSError *__autoreleasing *)error;
+
+/**
+ Decodes a response body as it is read from `stream`, for example a body downloaded to a file or fed from a bound stream
+ pair while it arrives. The stream is opened and read to the end on the calling thread.
+ */
+- (nullable NSMutableDictionary *)dictionaryForXMLStream:(NSInputStream *)stream
+                                                   error:(NSError *__autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,603 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSXMLStreamDecoder.h"
+#import "AWSSerialization.h"
+#import "AWSTimestampSerialization.h"
+#import "AWSCocoaLumberjack.h"
+
+@interface AWSJSONDictionary()
+
+- (NSString *)memberNameForXMLName:(NSString *)xmlName;
+
+@end
+
+typedef NS_ENUM(NSInteger, AWSXMLStreamDecoderFrameType) {
+    AWSXMLStreamDecoderFrameTypeStructure,
+    AWSXMLStreamDecoderFrameTypeList,
+    AWSXMLStreamDecoderFrameTypeMap,
+    AWSXMLStreamDecoderFrameTypeMapEntry,
+    AWSXMLStreamDecoderFrameTypeScalar,
+};
+
+// Where the value of an element goes once it closes.
+typedef NS_ENUM(NSInteger, AWSXMLStreamDecoderFrameTarget) {
+    AWSXMLStreamDecoderFrameTargetRoot,
+    AWSXMLStreamDecoderFrameTargetResultWrapper,
+    AWSXMLStreamDecoderFrameTargetMember,
+    AWSXMLStreamDecoderFrameTargetFlattenedListItem,
+    AWSXMLStreamDecoderFrameTargetFlattenedMapEntry,
+    AWSXMLStreamDecoderFrameTargetListItem,
+    AWSXMLStreamDecoderFrameTargetMapEntry,
+    AWSXMLStreamDecoderFrameTargetMapKey,
+    AWSXMLStreamDecoderFrameTargetMapValue,
+};
+
+// An element that is still open.
+@interface AWSXMLStreamDecoderFrame : NSObject
+
+@property (nonatomic, assign) AWSXMLStreamDecoderFrameType type;
+@property (nonatomic, assign) AWSXMLStreamDecoderFrameTarget target;
+// The element name of a result wrapper, otherwise the key of the value in its parent.
+@property (nonatomic, strong) NSString *name;
+@property (nonatomic, strong) NSDictionary *rules;
+// An NSMutableDictionary for structures and maps, an NSMutableArray for lists.
+@property (nonatomic, strong) id value;
+@property (nonatomic, strong) NSMutableString *text;
+@property (nonatomic, assign) BOOL hasText;
+@property (nonatomic, assign) BOOL hasChildElements;
+@property (nonatomic, assign) BOOL hasIgnoredChildElements;
+
+// Structures.
+@property (nonatomic, strong) NSDictionary *members;
+@property (nonatomic, strong) NSMutableSet<NSString *> *scalarListNames;
+
+// Lists.
+@property (nonatomic, strong) NSDictionary *memberRules;
+@property (nonatomic, strong) NSString *memberName;
+
+// Maps and map entries.
+@property (nonatomic, strong) NSString *keyName;
+@property (nonatomic, strong) NSString *valueName;
+@property (nonatomic, strong) NSDictionary *valueRules;
+@property (nonatomic, strong) NSString *entryKey;
+@property (nonatomic, strong) id entryValue;
+
+@end
+
+@implementation AWSXMLStreamDecoderFrame
+
+@end
+
+// The types `AWSXMLParser` returns unparsed when a list has a single item.
+static BOOL AWSXMLStreamDecoderIsConvertedScalarType(NSString *type) {
+    return type != nil
+    && ![type isEqualToString:@"structure"]
+    && ![type isEqualToString:@"list"]
+    && ![type isEqualToString:@"map"]
+    && ![type isEqualToString:@"string"]
+    && ![type isEqualToString:@"character"];
+}
+
+@interface AWSXMLStreamDecoder() <NSXMLParserDelegate>
+
+@property (nonatomic, strong) NSDictionary *members;
+@property (nonatomic, strong) NSString *payloadName;
+@property (nonatomic, assign, getter=isResultWrapped) BOOL resultWrapped;
+@property (nonatomic, strong) NSString *resultWrapperName;
+@property (nonatomic, strong) NSString *operationResultName;
+
+@property (nonatomic, strong) NSMutableArray<AWSXMLStreamDecoderFrame *> *stack;
+@property (nonatomic, assign) NSUInteger skippedDepth;
+@property (nonatomic, strong) NSMutableDictionary *resultWrappers;
+@property (nonatomic, strong) NSMutableDictionary *result;
+@property (nonatomic, strong) NSString *failureDescription;
+
+@end
+
+@implementation AWSXMLStreamDecoder
+
++ (instancetype)decoderWithActionName:(NSString *)actionName
+                serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    NSDictionary *actionRule = [[[serviceDefinitionRule objectForKey:@"operations"] objectForKey:actionName] objectForKey:@"output"];
+    if (actionRule == (id)[NSNull null]) {
+        actionRule = @{};
+    }
+    NSDictionary *definitionRules = [serviceDefinitionRule objectForKey:@"shapes"];
+    if (![definitionRules isKindOfClass:[NSDictionary class]] || [definitionRules count] == 0) {
+        return nil;
+    }
+
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+    NSDictionary *members = rules[@"members"] ?: @{};
+    NSString *payloadName = rules[@"payload"];
+    if (payloadName) {
+        // Streaming payloads are not XML, and other payloads are decoded as a structure.
+        NSDictionary *payloadRules = members[payloadName];
+        if (payloadRules[@"streaming"] || ![payloadRules[@"type"] isEqualToString:@"structure"]) {
+            return nil;
+        }
+        members = payloadRules[@"members"] ?: @{};
+    }
+
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder new];
+    decoder.members = members;
+    decoder.payloadName = payloadName;
+
+    NSString *serviceTypeStr = serviceDefinitionRule[@"metadata"][@"type"]?serviceDefinitionRule[@"metadata"][@"type"]:serviceDefinitionRule[@"metadata"][@"protocol"];
+    NSNumber *isResultWrapped = serviceDefinitionRule[@"metadata"][@"resultWrapped"];
+    if ([serviceTypeStr isEqualToString:@"query"] && !(isResultWrapped && ![isResultWrapped boolValue])) {
+        decoder.resultWrapped = YES;
+        decoder.resultWrapperName = rules[@"resultWrapper"];
+        decoder.operationResultName = [actionName stringByAppendingString:@"Result"];
+    }
+
+    return decoder;
+}
+
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
+                                        error:(NSError *__autoreleasing *)error {
+    return [self dictionaryWithParser:[[NSXMLParser alloc] initWithData:data] error:error];
+}
+
+- (NSMutableDictionary *)dictionaryForXMLStream:(NSInputStream *)stream
+                                          error:(NSError *__autoreleasing *)error {
+    return [self dictionaryWithParser:[[NSXMLParser alloc] initWithStream:stream] error:error];
+}
+
+- (NSMutableDictionary *)dictionaryWithParser:(NSXMLParser *)parser
+                                        error:(NSError *__autoreleasing *)error {
+    self.stack = [NSMutableArray new];
+    self.skippedDepth = 0;
+    self.resultWrappers = [NSMutableDictionary new];
+    self.result = nil;
+    self.failureDescription = nil;
+
+    parser.delegate = self;
+    BOOL parsed = [parser parse];
+    parser.delegate = nil;
+
+    NSMutableDictionary *result = self.result;
+    NSString *failureDescription = self.failureDescription;
+    self.stack = nil;
+    self.resultWrappers = nil;
+    self.result = nil;
+    self.failureDescription = nil;
+
+    if (failureDescription) {
+        if (error) {
+            *error = [NSError errorWithDomain:AWSXMLParserErrorDomain
+                                         code:AWSXMLParserUnExpectedType
+                                     userInfo:@{NSLocalizedDescriptionKey : failureDescription}];
+        }
+        return nil;
+    }
+    if (!parsed || !result) {
+        if (error) {
+            *error = parser.parserError ?: [NSError errorWithDomain:AWSXMLParserErrorDomain
+                                                               code:AWSXMLParserUnknownError
+                                                           userInfo:@{NSLocalizedDescriptionKey : @"The response body is not an XML document."}];
+        }
+        return nil;
+    }
+    return result;
+}
+
+- (void)parser:(NSXMLParser *)parser failWithDescription:(NSString *)description {
+    if (!self.failureDescription) {
+        self.failureDescription = description;
+        [parser abortParsing];
+    }
+}
+
+#pragma mark - Frames
+
+- (AWSXMLStreamDecoderFrame *)structureFrameWithMembers:(NSDictionary *)members
+                                                 target:(AWSXMLStreamDecoderFrameTarget)target
+                                                   name:(NSString *)name {
+    AWSXMLStreamDecoderFrame *frame = [AWSXMLStreamDecoderFrame new];
+    frame.type = AWSXMLStreamDecoderFrameTypeStructure;
+    frame.target = target;
+    frame.name = name;
+    frame.members = members;
+    frame.value = [NSMutableDictionary new];
+    return frame;
+}
+
+- (AWSXMLStreamDecoderFrame *)entryFrameWithMapRules:(NSDictionary *)rules
+                                              target:(AWSXMLStreamDecoderFrameTarget)target
+                                                name:(NSString *)name {
+    NSDictionary *keyRules = rules[@"key"]?rules[@"key"]:@{};
+    NSDictionary *valueRules = rules[@"value"]?rules[@"value"]:@{};
+
+    AWSXMLStreamDecoderFrame *frame = [AWSXMLStreamDecoderFrame new];
+    frame.type = AWSXMLStreamDecoderFrameTypeMapEntry;
+    frame.target = target;
+    frame.name = name;
+    frame.rules = rules;
+    frame.keyName = keyRules[@"locationName"]?keyRules[@"locationName"]:@"key";
+    frame.valueName = valueRules[@"locationName"]?valueRules[@"locationName"]:@"value";
+    frame.valueRules = valueRules;
+    return frame;
+}
+
+// Returns nil for rules the decoder does not handle.
+- (AWSXMLStreamDecoderFrame *)frameWithRules:(NSDictionary *)rules
+                                      target:(AWSXMLStreamDecoderFrameTarget)target
+                                        name:(NSString *)name {
+    NSString *rulesType = rules[@"type"];
+    if (!rulesType) {
+        return nil;
+    }
+    if ([rulesType isEqualToString:@"structure"]) {
+        return [self structureFrameWithMembers:rules[@"members"]?rules[@"members"]:@{} target:target name:name];
+    }
+    if (([rulesType isEqualToString:@"list"] || [rulesType isEqualToString:@"map"]) && [rules[@"flattened"] boolValue]) {
+        // Flattened lists and maps are only decoded as structure members.
+        return nil;
+    }
+
+    AWSXMLStreamDecoderFrame *frame = [AWSXMLStreamDecoderFrame new];
+    frame.target = target;
+    frame.name = name;
+    frame.rules = rules;
+    if ([rulesType isEqualToString:@"list"]) {
+        frame.type = AWSXMLStreamDecoderFrameTypeList;
+        frame.memberRules = rules[@"member"]?rules[@"member"]:@{};
+        frame.memberName = frame.memberRules[@"locationName"]?frame.memberRules[@"locationName"]:@"member";
+        frame.value = [NSMutableArray new];
+    } else if ([rulesType isEqualToString:@"map"]) {
+        NSDictionary *keyRules = rules[@"key"]?rules[@"key"]:@{};
+        NSDictionary *valueRules = rules[@"value"]?rules[@"value"]:@{};
+        frame.type = AWSXMLStreamDecoderFrameTypeMap;
+        frame.keyName = keyRules[@"locationName"]?keyRules[@"locationName"]:@"key";
+        frame.valueName = valueRules[@"locationName"]?valueRules[@"locationName"]:@"value";
+        frame.valueRules = valueRules;
+        frame.value = [NSMutableDictionary new];
+    } else {
+        frame.type = AWSXMLStreamDecoderFrameTypeScalar;
+    }
+    return frame;
+}
+
+// Returns nil, and sets `ignored`, for elements without a member.
+- (AWSXMLStreamDecoderFrame *)frameForElement:(NSString *)elementName
+                                  inStructure:(AWSXMLStreamDecoderFrame *)parent
+                                       parser:(NSXMLParser *)parser
+                                      ignored:(BOOL *)ignored {
+    NSDictionary *members = parent.members;
+    NSString *keyName = [members isKindOfClass:[AWSJSONDictionary class]] ? [(AWSJSONDictionary *)members memberNameForXMLName:elementName] : nil;
+    if (!keyName) {
+        // The siblings of a result wrapper are not decoded.
+        BOOL isResultWrapperSibling = parent.target == AWSXMLStreamDecoderFrameTargetRoot && self.isResultWrapped;
+        if (!isResultWrapperSibling
+            && ![elementName isEqualToString:@"requestId"]
+            && ![elementName isEqualToString:@"ResponseMetadata"]) {
+            AWSDDLogWarn(@"Response element ignored: no rule for %@", elementName);
+        }
+        *ignored = YES;
+        return nil;
+    }
+
+    NSDictionary *rule = members[keyName];
+    NSString *dicName = rule[@"name"]?rule[@"name"]:keyName;
+    NSString *rulesType = rule[@"type"];
+    BOOL isFlattened = [rule[@"flattened"] boolValue];
+    if ([rulesType isEqualToString:@"list"] && isFlattened) {
+        NSDictionary *memberRules = rule[@"member"]?rule[@"member"]:@{};
+        if (AWSXMLStreamDecoderIsConvertedScalarType(memberRules[@"type"])) {
+            if (!parent.scalarListNames) {
+                parent.scalarListNames = [NSMutableSet new];
+            }
+            [parent.scalarListNames addObject:dicName];
+        }
+        return [self frameWithRules:memberRules target:AWSXMLStreamDecoderFrameTargetFlattenedListItem name:dicName];
+    }
+    if ([rulesType isEqualToString:@"map"] && isFlattened) {
+        return [self entryFrameWithMapRules:rule target:AWSXMLStreamDecoderFrameTargetFlattenedMapEntry name:dicName];
+    }
+    if (parent.value[dicName]) {
+        [self parser:parser failWithDescription:[NSString stringWithFormat:@"The element %@ is repeated.", elementName]];
+        return nil;
+    }
+    return [self frameWithRules:rule target:AWSXMLStreamDecoderFrameTargetMember name:dicName];
+}
+
+// Returns nil when the element cannot be decoded the way `AWSXMLParser` decodes it.
+- (id)valueForFrame:(AWSXMLStreamDecoderFrame *)frame {
+    switch (frame.type) {
+        case AWSXMLStreamDecoderFrameTypeStructure: {
+            if (!frame.hasChildElements && frame.hasText) {
+                return nil;
+            }
+            for (NSString *name in frame.scalarListNames) {
+                if ([frame.value[name] count] == 1) {
+                    return nil;
+                }
+            }
+            return frame.value;
+        }
+        case AWSXMLStreamDecoderFrameTypeList: {
+            NSUInteger count = [frame.value count];
+            if (count == 0 && (frame.hasIgnoredChildElements || frame.hasText)) {
+                return nil;
+            }
+            if (count == 1 && AWSXMLStreamDecoderIsConvertedScalarType(frame.memberRules[@"type"])) {
+                return nil;
+            }
+            return frame.value;
+        }
+        case AWSXMLStreamDecoderFrameTypeMap: {
+            if (frame.hasIgnoredChildElements || (!frame.hasChildElements && frame.hasText)) {
+                return nil;
+            }
+            return frame.value;
+        }
+        case AWSXMLStreamDecoderFrameTypeMapEntry: {
+            if (!frame.hasChildElements && frame.hasText) {
+                return nil;
+            }
+            return frame;
+        }
+        case AWSXMLStreamDecoderFrameTypeScalar: {
+            if (frame.hasChildElements) {
+                return nil;
+            }
+            if (frame.target == AWSXMLStreamDecoderFrameTargetMapKey) {
+                return [frame.text copy];
+            }
+            return [self scalarValueForText:frame.text rules:frame.rules];
+        }
+    }
+    return nil;
+}
+
+- (id)scalarValueForText:(NSString *)text rules:(NSDictionary *)rules {
+    NSString *rulesType = rules[@"type"];
+    if ([rulesType isEqualToString:@"string"] || [rulesType isEqualToString:@"character"]) {
+        return text ? [text copy] : @"";
+    }
+    if (!text) {
+        // `AWSXMLParser` reports empty elements of other types as errors.
+        return nil;
+    }
+    if ([rulesType isEqualToString:@"integer"] || [rulesType isEqualToString:@"long"]) {
+        return [NSNumber numberWithInteger:[text integerValue]];
+    } else if ([rulesType isEqualToString:@"float"] || [rulesType isEqualToString:@"double"]) {
+        return [NSNumber numberWithDouble:[text doubleValue]];
+    } else if ([rulesType isEqualToString:@"boolean"]) {
+        return [NSNumber numberWithBool:[text boolValue]];
+    } else if ([rulesType isEqualToString:@"timestamp"]) {
+        NSError *error = nil;
+        NSString *timestampStr = [AWSQueryTimestampSerialization serializeTimestamp:rules value:text error:&error];
+        return error ? nil : timestampStr;
+    } else if ([rulesType isEqualToString:@"blob"]) {
+        NSData *decodedData = [[NSData alloc] initWithBase64EncodedString:text options:0];
+        return decodedData?decodedData:[text copy];
+    }
+    return nil;
+}
+
+// `AWSXMLParser` decodes a missing map value to an empty container or an error marker.
+- (id)missingValueForRules:(NSDictionary *)rules {
+    NSString *rulesType = rules[@"type"];
+    if ([rulesType isEqualToString:@"structure"]) return @{};
+    if ([rulesType isEqualToString:@"list"]) return @[];
+    if ([rulesType isEqualToString:@"map"]) return @{};
+    return @"XMLPARSER:ERROR";
+}
+
+- (void)closeFrame:(AWSXMLStreamDecoderFrame *)frame
+             value:(id)value
+          inParent:(AWSXMLStreamDecoderFrame *)parent
+            parser:(NSXMLParser *)parser {
+    switch (frame.target) {
+        case AWSXMLStreamDecoderFrameTargetRoot: {
+            if (!frame.hasChildElements) {
+                [self parser:parser failWithDescription:@"The root element is empty."];
+                return;
+            }
+            NSMutableDictionary *body = value;
+            if (self.isResultWrapped) {
+                NSMutableDictionary *resultWrapper = self.resultWrapperName ? self.resultWrappers[self.resultWrapperName] : nil;
+                if (!resultWrapper) {
+                    resultWrapper = self.resultWrappers[self.operationResultName];
+                }
+                body = resultWrapper ?: body;
+            }
+            if (self.payloadName) {
+                self.result = [NSMutableDictionary dictionaryWithObject:body forKey:self.payloadName];
+            } else {
+                self.result = body;
+            }
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTargetResultWrapper:
+            self.resultWrappers[frame.name] = value;
+            break;
+        case AWSXMLStreamDecoderFrameTargetMember:
+            parent.value[frame.name] = value;
+            break;
+        case AWSXMLStreamDecoderFrameTargetFlattenedListItem: {
+            NSMutableArray *items = parent.value[frame.name];
+            if (!items) {
+                items = [NSMutableArray new];
+                parent.value[frame.name] = items;
+            }
+            [items addObject:value];
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTargetListItem:
+            [parent.value addObject:value];
+            break;
+        case AWSXMLStreamDecoderFrameTargetFlattenedMapEntry:
+        case AWSXMLStreamDecoderFrameTargetMapEntry: {
+            NSMutableDictionary *map = parent.value;
+            if (frame.target == AWSXMLStreamDecoderFrameTargetFlattenedMapEntry) {
+                map = parent.value[frame.name];
+                if (!map) {
+                    map = [NSMutableDictionary new];
+                    parent.value[frame.name] = map;
+                }
+            }
+            if (frame.entryKey) {
+                map[frame.entryKey] = frame.entryValue ?: [self missingValueForRules:frame.valueRules];
+            }
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTargetMapKey:
+            parent.entryKey = value;
+            break;
+        case AWSXMLStreamDecoderFrameTargetMapValue:
+            parent.entryValue = value;
+            break;
+    }
+}
+
+#pragma mark - NSXMLParserDelegate
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName attributes:(NSDictionary<NSString *, NSString *> *)attributeDict {
+    if (self.skippedDepth > 0) {
+        self.skippedDepth++;
+        return;
+    }
+
+    AWSXMLStreamDecoderFrame *parent = self.stack.lastObject;
+    if (!parent) {
+        if ([elementName isEqualToString:@"Error"]) {
+            // S3 error responses are decoded by `AWSXMLParser`.
+            [self parser:parser failWithDescription:@"The response is an error response."];
+            return;
+        }
+        [self.stack addObject:[self structureFrameWithMembers:self.members target:AWSXMLStreamDecoderFrameTargetRoot name:elementName]];
+        return;
+    }
+    parent.hasChildElements = YES;
+
+    AWSXMLStreamDecoderFrame *frame = nil;
+    BOOL ignored = NO;
+    switch (parent.type) {
+        case AWSXMLStreamDecoderFrameTypeStructure: {
+            if (parent.target == AWSXMLStreamDecoderFrameTargetRoot) {
+                if ([elementName isEqualToString:@"Errors"] || [elementName isEqualToString:@"Error"]) {
+                    [self parser:parser failWithDescription:@"The response is an error response."];
+                    return;
+                }
+                if (self.isResultWrapped
+                    && ([elementName isEqualToString:self.resultWrapperName] || [elementName isEqualToString:self.operationResultName])) {
+                    if (self.resultWrappers[elementName]) {
+                        [self parser:parser failWithDescription:[NSString stringWithFormat:@"The element %@ is repeated.", elementName]];
+                        return;
+                    }
+                    frame = [self structureFrameWithMembers:self.members target:AWSXMLStreamDecoderFrameTargetResultWrapper name:elementName];
+                    break;
+                }
+            }
+            frame = [self frameForElement:elementName inStructure:parent parser:parser ignored:&ignored];
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTypeList: {
+            if ([elementName isEqualToString:parent.memberName]) {
+                frame = [self frameWithRules:parent.memberRules target:AWSXMLStreamDecoderFrameTargetListItem name:nil];
+            } else {
+                ignored = YES;
+            }
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTypeMap: {
+            if ([elementName isEqualToString:@"entry"]) {
+                frame = [self entryFrameWithMapRules:parent.rules target:AWSXMLStreamDecoderFrameTargetMapEntry name:nil];
+            } else {
+                ignored = YES;
+            }
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTypeMapEntry: {
+            if ([elementName isEqualToString:parent.keyName] && !parent.entryKey) {
+                frame = [AWSXMLStreamDecoderFrame new];
+                frame.type = AWSXMLStreamDecoderFrameTypeScalar;
+                frame.target = AWSXMLStreamDecoderFrameTargetMapKey;
+            } else if ([elementName isEqualToString:parent.valueName] && !parent.entryValue) {
+                frame = [self frameWithRules:parent.valueRules target:AWSXMLStreamDecoderFrameTargetMapValue name:nil];
+            } else if (![elementName isEqualToString:parent.keyName] && ![elementName isEqualToString:parent.valueName]) {
+                ignored = YES;
+            }
+            break;
+        }
+        case AWSXMLStreamDecoderFrameTypeScalar:
+            break;
+    }
+
+    if (self.failureDescription) {
+        return;
+    }
+    if (ignored) {
+        parent.hasIgnoredChildElements = YES;
+        self.skippedDepth = 1;
+        return;
+    }
+    if (!frame) {
+        [self parser:parser failWithDescription:[NSString stringWithFormat:@"The element %@ cannot be decoded in a single pass.", elementName]];
+        return;
+    }
+    [self.stack addObject:frame];
+}
+
+- (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName {
+    if (self.skippedDepth > 0) {
+        self.skippedDepth--;
+        return;
+    }
+
+    AWSXMLStreamDecoderFrame *frame = self.stack.lastObject;
+    [self.stack removeLastObject];
+
+    id value = [self valueForFrame:frame];
+    if (!value) {
+        [self parser:parser failWithDescription:[NSString stringWithFormat:@"The element %@ cannot be decoded in a single pass.", elementName]];
+        return;
+    }
+    [self closeFrame:frame value:value inParent:self.stack.lastObject parser:parser];
+}
+
+- (void)parser:(NSXMLParser *)parser appendText:(NSString *)string {
+    if (self.skippedDepth > 0 || string.length == 0) {
+        return;
+    }
+    AWSXMLStreamDecoderFrame *frame = self.stack.lastObject;
+    frame.hasText = YES;
+    if (frame.type == AWSXMLStreamDecoderFrameTypeScalar) {
+        if (frame.text) {
+            [frame.text appendString:string];
+        } else {
+            frame.text = [NSMutableString stringWithString:string];
+        }
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string {
+    [self parser:parser appendText:string];
+}
+
+- (void)parser:(NSXMLParser *)parser foundCDATA:(NSData *)CDATABlock {
+    NSString *string = [[NSString alloc] initWithData:CDATABlock encoding:NSUTF8StringEncoding];
+    if (!string) {
+        [self parser:parser failWithDescription:@"A CDATA section is not UTF-8."];
+        return;
+    }
+    [self parser:parser appendText:string];
+}
+
+@end
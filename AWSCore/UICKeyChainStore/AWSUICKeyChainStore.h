@@ -100,6 +100,32 @@ typedef NS_ENUM(NSInteger, AWSUICKeyChainStoreAuthenticationPolicy) {
     AWSUICKeyChainStoreAuthenticationPolicyUserPresence = kSecAccessControlUserPresence,
 };
 
+/// Storage backend for `AWSUICKeyChainStore`. When a keychain store has no storage set, it talks to the
+/// system keychain through the `SecItem` APIs.
+@protocol AWSUICKeyChainStoreStorage <NSObject>
+
+- (nullable NSData *)dataForKey:(NSString *)key error:(NSError * __nullable __autoreleasing * __nullable)error;
+
+/// Returns every key and value held by the storage.
+- (nullable NSDictionary<NSString *, NSData *> *)allDataWithError:(NSError * __nullable __autoreleasing * __nullable)error;
+
+/// Applies all changes in one write. A value of `NSNull` removes the key.
+- (BOOL)updateData:(NSDictionary<NSString *, id> *)changes error:(NSError * __nullable __autoreleasing * __nullable)error;
+
+- (BOOL)removeAllDataWithError:(NSError * __nullable __autoreleasing * __nullable)error;
+
+@end
+
+/// A storage backend that keeps all values in a property list file. It is intended for tests and benchmarks
+/// on platforms without a keychain, and must not be used for secrets in production.
+@interface AWSUICKeyChainStoreFileStorage : NSObject <AWSUICKeyChainStoreStorage>
+
+@property (nonatomic, readonly) NSURL *fileURL;
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL;
+
+@end
+
 @interface AWSUICKeyChainStore : NSObject
 
 @property (nonatomic, readonly) AWSUICKeyChainStoreItemClass itemClass;
@@ -123,6 +149,14 @@ __OSX_AVAILABLE_STARTING(__MAC_NA, __IPHONE_8_0);
 @property (nonatomic, readonly, nullable) NSArray UIC_KEY_TYPE *allKeys;
 @property (nonatomic, readonly, nullable) NSArray *allItems;
 
+/// When enabled, values are cached in memory after the first read and the cache is updated on every write.
+/// The cache is shared by all keychain stores with the same service and access group in the process. Only enable
+/// it when no other process or keychain wrapper writes to the same service. Defaults to `NO`.
+@property (nonatomic) BOOL cachesValues;
+
+/// Storage backend used instead of the system keychain. Defaults to `nil`.
+@property (nonatomic, strong, nullable) id<AWSUICKeyChainStoreStorage> storage;
+
 + (NSString *)defaultService;
 + (void)setDefaultService:(NSString *)defaultService;
 
@@ -250,6 +284,27 @@ __OSX_AVAILABLE_STARTING(__MAC_10_10, __IPHONE_8_0);
 
 @end
 
+@interface AWSUICKeyChainStore (Batching)
+
+/// Returns the string values of the given keys. Keys without a value are absent from the result. When some keys are
+/// not cached, all items of the service are fetched with a single keychain query.
+- (nullable NSDictionary<NSString *, NSString *> *)stringsForKeys:(NSArray<NSString *> *)keys;
+- (nullable NSDictionary<NSString *, NSString *> *)stringsForKeys:(NSArray<NSString *> *)keys error:(NSError * __nullable __autoreleasing * __nullable)error;
+
+/// Sets several string values at once. A value of `NSNull` removes the key. Values that are known to be unchanged
+/// are not written again.
+- (BOOL)setStrings:(NSDictionary<NSString *, id> *)strings;
+- (BOOL)setStrings:(NSDictionary<NSString *, id> *)strings error:(NSError * __nullable __autoreleasing * __nullable)error;
+
+/// Runs `block` while holding the keychain store and coalesces all writes made through the store inside the block
+/// into one batch that is applied when the block returns. Reads inside the block see the pending writes.
+- (BOOL)performTransaction:(void (^)(AWSUICKeyChainStore *keychain))block error:(NSError * __nullable __autoreleasing * __nullable)error;
+
+/// Drops the in-memory values cached for this service and access group.
+- (void)invalidateCache;
+
+@end
+
 @interface AWSUICKeyChainStore (ForwardCompatibility)
 
 + (BOOL)setString:(nullable NSString *)value forKey:(NSString *)key genericAttribute:(nullable id)genericAttribute;
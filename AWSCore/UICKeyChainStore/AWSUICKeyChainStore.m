@@ -11,11 +11,199 @@
 NSString * const AWSUICKeyChainStoreErrorDomain = @"com.kishikawakatsumi.uickeychainstore";
 static NSString *_defaultService;
 
+/// In-memory values of one keychain service. A value is either `NSData`, or `NSNull` when the key is known to
+/// be absent. `generation` changes on every write so that a read racing with a write does not cache a stale value.
+@interface AWSUICKeyChainStoreValueCache : NSObject
+
+@property (nonatomic, readonly) NSUInteger generation;
+
++ (AWSUICKeyChainStoreValueCache *)sharedCacheForService:(NSString *)service accessGroup:(NSString *)accessGroup;
+
+- (id)cachedDataForKey:(NSString *)key;
+- (void)cacheData:(id)data forKey:(NSString *)key;
+- (void)cacheFetchedData:(id)data forKey:(NSString *)key generation:(NSUInteger)generation;
+- (void)cacheFetchedData:(NSDictionary<NSString *, NSData *> *)dataForKeys complete:(BOOL)complete generation:(NSUInteger)generation;
+- (void)removeCachedDataForKey:(NSString *)key;
+- (void)removeAllCachedData;
+
+@end
+
+@implementation AWSUICKeyChainStoreValueCache {
+    NSMutableDictionary<NSString *, id> *_values;
+    NSUInteger _generation;
+    BOOL _complete;
+}
+
++ (AWSUICKeyChainStoreValueCache *)sharedCacheForService:(NSString *)service accessGroup:(NSString *)accessGroup
+{
+    static NSMutableDictionary<NSString *, AWSUICKeyChainStoreValueCache *> *sharedCaches = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCaches = [NSMutableDictionary new];
+    });
+    
+    NSString *cacheKey = [NSString stringWithFormat:@"%@|%@", service ?: @"", accessGroup ?: @""];
+    @synchronized (sharedCaches) {
+        AWSUICKeyChainStoreValueCache *cache = sharedCaches[cacheKey];
+        if (!cache) {
+            cache = [AWSUICKeyChainStoreValueCache new];
+            sharedCaches[cacheKey] = cache;
+        }
+        return cache;
+    }
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _values = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (NSUInteger)generation
+{
+    @synchronized (self) {
+        return _generation;
+    }
+}
+
+- (id)cachedDataForKey:(NSString *)key
+{
+    @synchronized (self) {
+        id data = _values[key];
+        if (!data && _complete) {
+            return [NSNull null];
+        }
+        return data;
+    }
+}
+
+- (void)cacheData:(id)data forKey:(NSString *)key
+{
+    @synchronized (self) {
+        _generation++;
+        _values[key] = data ?: [NSNull null];
+    }
+}
+
+- (void)cacheFetchedData:(id)data forKey:(NSString *)key generation:(NSUInteger)generation
+{
+    @synchronized (self) {
+        if (_generation == generation) {
+            _values[key] = data ?: [NSNull null];
+        }
+    }
+}
+
+- (void)cacheFetchedData:(NSDictionary<NSString *, NSData *> *)dataForKeys complete:(BOOL)complete generation:(NSUInteger)generation
+{
+    @synchronized (self) {
+        if (_generation == generation) {
+            if (complete) {
+                [_values removeAllObjects];
+                _complete = YES;
+            }
+            [_values addEntriesFromDictionary:dataForKeys];
+        }
+    }
+}
+
+- (void)removeCachedDataForKey:(NSString *)key
+{
+    @synchronized (self) {
+        _generation++;
+        _complete = NO;
+        [_values removeObjectForKey:key];
+    }
+}
+
+- (void)removeAllCachedData
+{
+    @synchronized (self) {
+        _generation++;
+        _complete = NO;
+        [_values removeAllObjects];
+    }
+}
+
+@end
+
+@implementation AWSUICKeyChainStoreFileStorage {
+    NSMutableDictionary<NSString *, NSData *> *_values;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL
+{
+    self = [super init];
+    if (self) {
+        _fileURL = fileURL.copy;
+        NSDictionary *values = [NSDictionary dictionaryWithContentsOfURL:fileURL];
+        _values = values ? values.mutableCopy : [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (NSData *)dataForKey:(NSString *)key error:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        return _values[key];
+    }
+}
+
+- (NSDictionary<NSString *, NSData *> *)allDataWithError:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        return _values.copy;
+    }
+}
+
+- (BOOL)updateData:(NSDictionary<NSString *, id> *)changes error:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        for (NSString *key in changes) {
+            id data = changes[key];
+            if (data == [NSNull null]) {
+                [_values removeObjectForKey:key];
+            } else {
+                _values[key] = data;
+            }
+        }
+        return [self writeWithError:error];
+    }
+}
+
+- (BOOL)removeAllDataWithError:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        [_values removeAllObjects];
+        return [self writeWithError:error];
+    }
+}
+
+- (BOOL)writeWithError:(NSError *__autoreleasing *)error
+{
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:_values
+                                                              format:NSPropertyListBinaryFormat_v1_0
+                                                             options:0
+                                                               error:error];
+    if (!data) {
+        return NO;
+    }
+    return [data writeToURL:_fileURL options:NSDataWritingAtomic error:error];
+}
+
+@end
+
 @interface AWSUICKeyChainStore ()
 
 @end
 
-@implementation AWSUICKeyChainStore
+@implementation AWSUICKeyChainStore {
+    NSMutableDictionary<NSString *, id> *_pendingWrites;
+    AWSUICKeyChainStoreValueCache *_storageCache;
+}
 
 + (NSString *)defaultService
 {
@@ -358,6 +546,14 @@ static NSString *_defaultService;
 
 - (BOOL)contains:(NSString *)key
 {
+    id cachedData = [[self valueCache] cachedDataForKey:key];
+    if (cachedData) {
+        return cachedData != [NSNull null];
+    }
+    if (_storage) {
+        return [_storage dataForKey:key error:nil] != nil;
+    }
+    
     NSMutableDictionary *query = [self query];
     query[(__bridge __strong id)kSecAttrAccount] = key;
     
@@ -446,6 +642,33 @@ static NSString *_defaultService;
 }
 
 - (NSData *)dataForKey:(NSString *)key error:(NSError *__autoreleasing *)error
+{
+    id cachedData = nil;
+    @synchronized (self) {
+        cachedData = _pendingWrites[key];
+    }
+    AWSUICKeyChainStoreValueCache *cache = [self valueCache];
+    if (!cachedData) {
+        cachedData = [cache cachedDataForKey:key];
+    }
+    if (cachedData) {
+        return cachedData == [NSNull null] ? nil : cachedData;
+    }
+    
+    NSUInteger generation = cache.generation;
+    NSError *e = nil;
+    NSData *data = _storage ? [_storage dataForKey:key error:&e] : [self secItemDataForKey:key error:&e];
+    if (e) {
+        if (error) {
+            *error = e;
+        }
+        return nil;
+    }
+    [cache cacheFetchedData:data forKey:key generation:generation];
+    return data;
+}
+
+- (NSData *)secItemDataForKey:(NSString *)key error:(NSError *__autoreleasing *)error
 {
     NSMutableDictionary *query = [self query];
     query[(__bridge __strong id)kSecMatchLimit] = (__bridge id)kSecMatchLimitOne;
@@ -529,7 +752,26 @@ static NSString *_defaultService;
     if (!data) {
         return [self removeItemForKey:key error:error];
     }
+    // `_pendingWrites` is shared with transactions on other threads, so it is only touched under the lock, even if
+    // the caller already holds it.
+    @synchronized (self) {
+        if (_pendingWrites) {
+            _pendingWrites[key] = data;
+            return YES;
+        }
+    }
     
+    NSDictionary *changes = @{key: data};
+    if (_storage) {
+        return [self applyChanges:changes error:error];
+    }
+    BOOL succeeded = [self secItemSetData:data forKey:key genericAttribute:genericAttribute label:label comment:comment error:error];
+    [self updateCacheWithChanges:changes succeeded:succeeded];
+    return succeeded;
+}
+
+- (BOOL)secItemSetData:(NSData *)data forKey:(NSString *)key genericAttribute:(id)genericAttribute label:(NSString *)label comment:(NSString *)comment error:(NSError *__autoreleasing *)error
+{
     NSMutableDictionary *query = [self query];
     query[(__bridge __strong id)kSecAttrAccount] = key;
 #if TARGET_OS_IOS
@@ -708,6 +950,32 @@ static NSString *_defaultService;
 }
 
 - (BOOL)removeItemForKey:(NSString *)key error:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        if (_pendingWrites && key) {
+            _pendingWrites[key] = [NSNull null];
+            return YES;
+        }
+    }
+    if (!key) {
+        if (_storage) {
+            return [self removeAllItemsWithError:error];
+        }
+        [self invalidateCache];
+    } else if (_storage) {
+        @synchronized (self) {
+            return [self applyChanges:@{key: [NSNull null]} error:error];
+        }
+    }
+    
+    BOOL succeeded = [self secItemRemoveDataForKey:key error:error];
+    if (key) {
+        [self updateCacheWithChanges:@{key: [NSNull null]} succeeded:succeeded];
+    }
+    return succeeded;
+}
+
+- (BOOL)secItemRemoveDataForKey:(NSString *)key error:(NSError *__autoreleasing *)error
 {
     NSMutableDictionary *query = [self query];
     query[(__bridge __strong id)kSecAttrAccount] = key;
@@ -733,6 +1001,11 @@ static NSString *_defaultService;
 
 - (BOOL)removeAllItemsWithError:(NSError *__autoreleasing *)error
 {
+    [self invalidateCache];
+    if (_storage) {
+        return [_storage removeAllDataWithError:error];
+    }
+    
     NSMutableDictionary *query = [self query];
 #if !TARGET_OS_IPHONE
     query[(__bridge id)kSecMatchLimit] = (__bridge id)kSecMatchLimitAll;
@@ -752,6 +1025,242 @@ static NSString *_defaultService;
 
 #pragma mark -
 
+- (NSDictionary<NSString *, NSString *> *)stringsForKeys:(NSArray<NSString *> *)keys
+{
+    return [self stringsForKeys:keys error:nil];
+}
+
+- (NSDictionary<NSString *, NSString *> *)stringsForKeys:(NSArray<NSString *> *)keys error:(NSError *__autoreleasing *)error
+{
+    NSMutableDictionary<NSString *, NSData *> *dataForKeys = [NSMutableDictionary new];
+    NSMutableArray<NSString *> *missingKeys = [NSMutableArray new];
+    AWSUICKeyChainStoreValueCache *cache = [self valueCache];
+    
+    @synchronized (self) {
+        for (NSString *key in keys) {
+            id data = _pendingWrites[key] ?: [cache cachedDataForKey:key];
+            if (!data) {
+                [missingKeys addObject:key];
+            } else if (data != [NSNull null]) {
+                dataForKeys[key] = data;
+            }
+        }
+    }
+    
+    if (missingKeys.count > 0) {
+        NSUInteger generation = cache.generation;
+        BOOL complete = NO;
+        NSError *e = nil;
+        NSDictionary<NSString *, NSData *> *fetchedData = [self fetchDataForKeys:missingKeys complete:&complete error:&e];
+        if (e) {
+            if (error) {
+                *error = e;
+            }
+            return nil;
+        }
+        [cache cacheFetchedData:fetchedData complete:complete generation:generation];
+        for (NSString *key in missingKeys) {
+            if (fetchedData[key]) {
+                dataForKeys[key] = fetchedData[key];
+            } else if (!complete) {
+                [cache cacheFetchedData:nil forKey:key generation:generation];
+            }
+        }
+    }
+    
+    NSMutableDictionary<NSString *, NSString *> *strings = [NSMutableDictionary new];
+    for (NSString *key in dataForKeys) {
+        NSString *string = [[NSString alloc] initWithData:dataForKeys[key] encoding:NSUTF8StringEncoding];
+        if (string) {
+            strings[key] = string;
+        }
+    }
+    return strings.copy;
+}
+
+- (NSDictionary<NSString *, NSData *> *)fetchDataForKeys:(NSArray<NSString *> *)keys complete:(BOOL *)complete error:(NSError *__autoreleasing *)error
+{
+    if (_storage) {
+        *complete = YES;
+        return [_storage allDataWithError:error];
+    }
+    
+#if TARGET_OS_IPHONE
+    // A single query returns every item of the service along with its data.
+    NSMutableDictionary *query = [self query];
+    query[(__bridge __strong id)kSecMatchLimit] = (__bridge id)kSecMatchLimitAll;
+    query[(__bridge __strong id)kSecReturnAttributes] = (__bridge id)kCFBooleanTrue;
+    query[(__bridge __strong id)kSecReturnData] = (__bridge id)kCFBooleanTrue;
+    
+    CFArrayRef result = nil;
+    OSStatus status = SecItemCopyMatching((__bridge CFDictionaryRef)query, (CFTypeRef *)&result);
+    if (status == errSecSuccess || status == errSecItemNotFound) {
+        NSArray *items = CFBridgingRelease(result);
+        NSMutableDictionary<NSString *, NSData *> *dataForKeys = [NSMutableDictionary new];
+        for (NSDictionary *attributes in items) {
+            NSString *key = attributes[(__bridge id)kSecAttrAccount];
+            NSData *data = attributes[(__bridge id)kSecValueData];
+            if (key && data) {
+                dataForKeys[key] = data;
+            }
+        }
+        *complete = YES;
+        return dataForKeys.copy;
+    }
+    
+    NSError *e = [self.class securityError:status];
+    if (error) {
+        *error = e;
+    }
+    return nil;
+#else
+    // Item data cannot be returned for more than one item at a time on macOS.
+    NSMutableDictionary<NSString *, NSData *> *dataForKeys = [NSMutableDictionary new];
+    for (NSString *key in keys) {
+        NSData *data = [self secItemDataForKey:key error:error];
+        if (data) {
+            dataForKeys[key] = data;
+        }
+    }
+    *complete = NO;
+    return dataForKeys.copy;
+#endif
+}
+
+- (BOOL)setStrings:(NSDictionary<NSString *, id> *)strings
+{
+    return [self setStrings:strings error:nil];
+}
+
+- (BOOL)setStrings:(NSDictionary<NSString *, id> *)strings error:(NSError *__autoreleasing *)error
+{
+    NSMutableDictionary<NSString *, id> *changes = [NSMutableDictionary new];
+    for (NSString *key in strings) {
+        id string = strings[key];
+        if (string == [NSNull null]) {
+            changes[key] = string;
+        } else if ([string isKindOfClass:[NSString class]]) {
+            changes[key] = [string dataUsingEncoding:NSUTF8StringEncoding];
+        } else {
+            NSError *e = [self.class argumentError:NSLocalizedString(@"the value must be a string or NSNull", nil)];
+            if (error) {
+                *error = e;
+            }
+            return NO;
+        }
+    }
+    
+    @synchronized (self) {
+        if (_pendingWrites) {
+            [_pendingWrites addEntriesFromDictionary:changes];
+            return YES;
+        }
+        return [self applyChanges:changes error:error];
+    }
+}
+
+- (BOOL)performTransaction:(void (^)(AWSUICKeyChainStore *keychain))block error:(NSError *__autoreleasing *)error
+{
+    @synchronized (self) {
+        // A nested transaction joins the outer one.
+        if (_pendingWrites) {
+            block(self);
+            return YES;
+        }
+        
+        _pendingWrites = [NSMutableDictionary new];
+        block(self);
+        NSDictionary<NSString *, id> *changes = _pendingWrites.copy;
+        _pendingWrites = nil;
+        
+        return [self applyChanges:changes error:error];
+    }
+}
+
+- (void)invalidateCache
+{
+    [[self valueCache] removeAllCachedData];
+}
+
+/// Must be called while holding the lock on `self`.
+- (BOOL)applyChanges:(NSDictionary<NSString *, id> *)changes error:(NSError *__autoreleasing *)error
+{
+    AWSUICKeyChainStoreValueCache *cache = [self valueCache];
+    NSMutableDictionary<NSString *, id> *effectiveChanges = [NSMutableDictionary new];
+    for (NSString *key in changes) {
+        id data = changes[key];
+        if (![[cache cachedDataForKey:key] isEqual:data]) {
+            effectiveChanges[key] = data;
+        }
+    }
+    if (effectiveChanges.count == 0) {
+        return YES;
+    }
+    
+    if (_storage) {
+        BOOL succeeded = [_storage updateData:effectiveChanges error:error];
+        [self updateCacheWithChanges:effectiveChanges succeeded:succeeded];
+        return succeeded;
+    }
+    
+    // The keychain has no multi-item write, so each remaining change is its own SecItem call.
+    BOOL succeeded = YES;
+    for (NSString *key in effectiveChanges) {
+        id data = effectiveChanges[key];
+        NSError *e = nil;
+        BOOL updated = data == [NSNull null]
+        ? [self secItemRemoveDataForKey:key error:&e]
+        : [self secItemSetData:data forKey:key genericAttribute:nil label:nil comment:nil error:&e];
+        [self updateCacheWithChanges:@{key: data} succeeded:updated];
+        if (!updated && succeeded) {
+            succeeded = NO;
+            if (error) {
+                *error = e;
+            }
+        }
+    }
+    return succeeded;
+}
+
+- (void)updateCacheWithChanges:(NSDictionary<NSString *, id> *)changes succeeded:(BOOL)succeeded
+{
+    AWSUICKeyChainStoreValueCache *cache = [self valueCache];
+    for (NSString *key in changes) {
+        if (succeeded) {
+            [cache cacheData:changes[key] forKey:key];
+        } else {
+            // The stored value is unknown after a failed write.
+            [cache removeCachedDataForKey:key];
+        }
+    }
+}
+
+- (AWSUICKeyChainStoreValueCache *)valueCache
+{
+    if (!_cachesValues || _itemClass != AWSUICKeyChainStoreItemClassGenericPassword) {
+        return nil;
+    }
+    if (_storage) {
+        @synchronized (self) {
+            if (!_storageCache) {
+                _storageCache = [AWSUICKeyChainStoreValueCache new];
+            }
+            return _storageCache;
+        }
+    }
+    return [AWSUICKeyChainStoreValueCache sharedCacheForService:_service accessGroup:_accessGroup];
+}
+
+- (void)setStorage:(id<AWSUICKeyChainStoreStorage>)storage
+{
+    @synchronized (self) {
+        _storage = storage;
+        _storageCache = nil;
+    }
+}
+
+#pragma mark -
+
 - (NSString *)objectForKeyedSubscript:(NSString <NSCopying> *)key
 {
     return [self stringForKey:key];
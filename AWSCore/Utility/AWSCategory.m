@@ -16,6 +16,7 @@
 #import <objc/runtime.h>
 #import <CommonCrypto/CommonCryptor.h>
 #import <CommonCrypto/CommonDigest.h>
+#import <os/lock.h>
 #import "AWSCocoaLumberjack.h"
 #import "AWSGZIP.h"
 #import "AWSMantle.h"
@@ -46,6 +47,284 @@ NSString *const AWSDateShortDateFormat2 = @"yyyy-MM-dd";
 
 @end
 
+#pragma mark - Fixed date formats
+
+// The fixed formats are parsed and formatted without NSDateFormatter. Each is described by a pattern of the same length
+// as its strings: 'y', 'o', 'd', 'h', 'i', 's' and 'f' are the digits of the year, month, day, hour, minute, second and
+// millisecond, 'w' and 'n' are the letters of the weekday and month names, and any other character is a literal.
+static const char *const AWSDateRFC822Pattern1 = "www, dd nnn yyyy hh:ii:ss GMT";
+static const char *const AWSDateISO8601Pattern1 = "yyyy-oo-ddThh:ii:ssZ";
+static const char *const AWSDateISO8601Pattern2 = "yyyyooddThhiissZ";
+static const char *const AWSDateISO8601Pattern3 = "yyyy-oo-ddThh:ii:ss.fffZ";
+static const char *const AWSDateShortPattern1 = "yyyyoodd";
+static const char *const AWSDateShortPattern2 = "yyyy-oo-dd";
+
+static const char AWSDateWeekdayNames[7][4] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+static const char AWSDateMonthNames[12][4] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+// NSDateFormatter switches to the Julian calendar before October 1582, so only later years take the fixed path.
+static const int64_t AWSDateFixedFormatMinYear = 1583;
+static const int64_t AWSDateFixedFormatMaxYear = 9999;
+static const int64_t AWSDateMillisecondsPerDay = 86400000;
+
+static const char *AWSDateFixedFormatPattern(NSString *dateFormat) {
+    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat2]) {
+        return AWSDateISO8601Pattern2;
+    }
+    if ([dateFormat isEqualToString:AWSDateShortDateFormat1]) {
+        return AWSDateShortPattern1;
+    }
+    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat1]) {
+        return AWSDateISO8601Pattern1;
+    }
+    if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
+        return AWSDateRFC822Pattern1;
+    }
+    if ([dateFormat isEqualToString:AWSDateISO8601DateFormat3]) {
+        return AWSDateISO8601Pattern3;
+    }
+    if ([dateFormat isEqualToString:AWSDateShortDateFormat2]) {
+        return AWSDateShortPattern2;
+    }
+    return NULL;
+}
+
+// Days between 1970-01-01 and a date of the proleptic Gregorian calendar.
+static int64_t AWSDateDaysFromCivil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = (unsigned)(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int64_t)dayOfEra - 719468;
+}
+
+static void AWSDateCivilFromDays(int64_t days, int64_t *year, unsigned *month, unsigned *day) {
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned dayOfEra = (unsigned)(days - era * 146097);
+    unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    unsigned monthIndex = (5 * dayOfYear + 2) / 153;
+    *day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    *month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    *year = (int64_t)yearOfEra + era * 400 + (*month <= 2);
+}
+
+static unsigned AWSDateDaysInMonth(int64_t year, unsigned month) {
+    static const unsigned days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+static unsigned AWSDateWeekday(int64_t days) {
+    // 1970-01-01 was a Thursday.
+    int64_t weekday = (days + 4) % 7;
+    return (unsigned)(weekday < 0 ? weekday + 7 : weekday);
+}
+
+// Parses `bytes` in the fixed format of `pattern` to milliseconds since 1970. Returns `NO` for anything that does not
+// match exactly, which is then left to NSDateFormatter.
+static BOOL AWSDateParseFixedFormat(const char *pattern, const uint8_t *bytes, NSUInteger length, int64_t *milliseconds) {
+    if (strlen(pattern) != length) {
+        return NO;
+    }
+
+    int64_t year = 0;
+    unsigned month = 0, day = 0, hour = 0, minute = 0, second = 0, millisecond = 0;
+    int weekday = -1;
+    for (NSUInteger i = 0; i < length; i++) {
+        char code = pattern[i];
+        uint8_t byte = bytes[i];
+        if (code == 'w' || code == 'n') {
+            // Names are three letters long.
+            BOOL isWeekday = code == 'w';
+            int count = isWeekday ? 7 : 12;
+            int index = -1;
+            for (int j = 0; j < count; j++) {
+                const char *name = isWeekday ? AWSDateWeekdayNames[j] : AWSDateMonthNames[j];
+                if (memcmp(bytes + i, name, 3) == 0) {
+                    index = j;
+                    break;
+                }
+            }
+            if (index < 0) {
+                return NO;
+            }
+            if (isWeekday) {
+                weekday = index;
+            } else {
+                month = index + 1;
+            }
+            i += 2;
+            continue;
+        }
+        if (code < 'a' || code > 'z') {
+            if (byte != (uint8_t)code) {
+                return NO;
+            }
+            continue;
+        }
+        if (byte < '0' || byte > '9') {
+            return NO;
+        }
+        unsigned digit = byte - '0';
+        switch (code) {
+            case 'y': year = year * 10 + digit; break;
+            case 'o': month = month * 10 + digit; break;
+            case 'd': day = day * 10 + digit; break;
+            case 'h': hour = hour * 10 + digit; break;
+            case 'i': minute = minute * 10 + digit; break;
+            case 's': second = second * 10 + digit; break;
+            case 'f': millisecond = millisecond * 10 + digit; break;
+            default: return NO;
+        }
+    }
+
+    if (year < AWSDateFixedFormatMinYear || month < 1 || month > 12 || day < 1 || day > AWSDateDaysInMonth(year, month)
+        || hour > 23 || minute > 59 || second > 59) {
+        return NO;
+    }
+    int64_t days = AWSDateDaysFromCivil(year, month, day);
+    if (weekday >= 0 && (unsigned)weekday != AWSDateWeekday(days)) {
+        return NO;
+    }
+    *milliseconds = days * AWSDateMillisecondsPerDay + ((hour * 60 + minute) * 60 + second) * 1000 + millisecond;
+    return YES;
+}
+
+// Returns the date NSDateFormatter returns for a string that parses to `milliseconds`.
+static NSDate *AWSDateFromMilliseconds(int64_t milliseconds) {
+    return [NSDate dateWithTimeIntervalSinceReferenceDate:(double)milliseconds / 1000.0 - NSTimeIntervalSince1970];
+}
+
+// Returns the milliseconds NSDateFormatter formats `date` with, or `NO` when it may round differently from truncation.
+static BOOL AWSDateMillisecondsForFormatting(NSDate *date, const char *pattern, int64_t *milliseconds) {
+    double value = ([date timeIntervalSinceReferenceDate] + NSTimeIntervalSince1970) * 1000.0;
+    if (!isfinite(value) || value < -1.0e16 || value > 1.0e16) {
+        return NO;
+    }
+    double truncated = floor(value);
+    int64_t result = (int64_t)truncated;
+    if (value - truncated >= 0.5) {
+        // Halfway and above, the millisecond digits, and at the end of a second the second itself, depend on rounding.
+        int64_t remainder = result % 1000;
+        if (remainder < 0) {
+            remainder += 1000;
+        }
+        if (strchr(pattern, 'f') != NULL || remainder == 999) {
+            return NO;
+        }
+    }
+    *milliseconds = result;
+    return YES;
+}
+
+static NSString *AWSDateFormatFixedFormat(const char *pattern, int64_t milliseconds) {
+    int64_t days = milliseconds / AWSDateMillisecondsPerDay;
+    int64_t millisecondOfDay = milliseconds % AWSDateMillisecondsPerDay;
+    if (millisecondOfDay < 0) {
+        millisecondOfDay += AWSDateMillisecondsPerDay;
+        days--;
+    }
+
+    int64_t year = 0;
+    unsigned month = 0, day = 0;
+    AWSDateCivilFromDays(days, &year, &month, &day);
+    if (year < AWSDateFixedFormatMinYear || year > AWSDateFixedFormatMaxYear) {
+        return nil;
+    }
+    unsigned fields[128] = {0};
+    fields['y'] = (unsigned)year;
+    fields['o'] = month;
+    fields['d'] = day;
+    fields['h'] = (unsigned)(millisecondOfDay / 3600000);
+    fields['i'] = (unsigned)(millisecondOfDay / 60000 % 60);
+    fields['s'] = (unsigned)(millisecondOfDay / 1000 % 60);
+    fields['f'] = (unsigned)(millisecondOfDay % 1000);
+
+    char buffer[32];
+    NSUInteger length = strlen(pattern);
+    for (NSUInteger i = 0; i < length;) {
+        char code = pattern[i];
+        if (code == 'w' || code == 'n') {
+            memcpy(buffer + i, code == 'w' ? AWSDateWeekdayNames[AWSDateWeekday(days)] : AWSDateMonthNames[month - 1], 3);
+            i += 3;
+        } else if (code < 'a' || code > 'z') {
+            buffer[i++] = code;
+        } else {
+            NSUInteger run = 1;
+            while (pattern[i + run] == code) {
+                run++;
+            }
+            unsigned value = fields[(unsigned char)code];
+            for (NSUInteger j = run; j > 0; j--) {
+                buffer[i + j - 1] = '0' + value % 10;
+                value /= 10;
+            }
+            i += run;
+        }
+    }
+    return [[NSString alloc] initWithBytes:buffer length:length encoding:NSASCIIStringEncoding];
+}
+
+// Copies `string` to `buffer` when it is ASCII and fits.
+static BOOL AWSDateGetASCIIBytes(NSString *string, uint8_t *buffer, NSUInteger capacity, NSUInteger *length) {
+    CFStringRef cfString = (__bridge CFStringRef)string;
+    CFIndex stringLength = CFStringGetLength(cfString);
+    if (stringLength <= 0 || (NSUInteger)stringLength > capacity) {
+        return NO;
+    }
+    CFIndex usedLength = 0;
+    CFIndex converted = CFStringGetBytes(cfString, CFRangeMake(0, stringLength), kCFStringEncodingASCII, 0, false, buffer, capacity, &usedLength);
+    if (converted != stringLength) {
+        return NO;
+    }
+    *length = (NSUInteger)usedLength;
+    return YES;
+}
+
+// Signing formats the same second several times per request, and every request in the same second.
+static os_unfair_lock _signingCacheLock = OS_UNFAIR_LOCK_INIT;
+static int64_t _signingCacheSecond = INT64_MIN;
+static NSString *_signingCacheISO8601String2 = nil;
+static NSString *_signingCacheShortString1 = nil;
+
+static NSString *AWSDateSigningString(const char *pattern, int64_t milliseconds) {
+    int64_t second = milliseconds / 1000 - (milliseconds % 1000 < 0);
+    BOOL isISO8601 = pattern == AWSDateISO8601Pattern2;
+
+    os_unfair_lock_lock(&_signingCacheLock);
+    NSString *string = nil;
+    if (_signingCacheSecond == second) {
+        string = isISO8601 ? _signingCacheISO8601String2 : _signingCacheShortString1;
+    }
+    os_unfair_lock_unlock(&_signingCacheLock);
+    if (string) {
+        return string;
+    }
+
+    string = AWSDateFormatFixedFormat(pattern, milliseconds);
+    if (string == nil) {
+        return nil;
+    }
+    os_unfair_lock_lock(&_signingCacheLock);
+    if (_signingCacheSecond != second) {
+        _signingCacheSecond = second;
+        _signingCacheISO8601String2 = nil;
+        _signingCacheShortString1 = nil;
+    }
+    if (isISO8601) {
+        _signingCacheISO8601String2 = string;
+    } else {
+        _signingCacheShortString1 = string;
+    }
+    os_unfair_lock_unlock(&_signingCacheLock);
+    return string;
+}
+
 @implementation NSDate (AWS)
 
 static NSTimeInterval _clockskew = 0.0;
@@ -55,6 +334,27 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 + (NSDate *)aws_dateFromString:(NSString *)string {
+    // A string that matches one fixed pattern exactly cannot be parsed by the formatters of the others.
+    uint8_t bytes[32];
+    NSUInteger length = 0;
+    if (AWSDateGetASCIIBytes(string, bytes, sizeof(bytes), &length)) {
+        int64_t milliseconds = 0;
+        BOOL hasLetter = NO;
+        for (NSUInteger i = 0; i < length; i++) {
+            hasLetter = hasLetter || (bytes[i] >= 'A' && bytes[i] <= 'Z') || (bytes[i] >= 'a' && bytes[i] <= 'z');
+        }
+        if (!hasLetter) {
+            // Every format below has letters, so epoch seconds and other numbers never match.
+            return nil;
+        }
+        const char *patterns[] = {AWSDateRFC822Pattern1, AWSDateISO8601Pattern1, AWSDateISO8601Pattern2, AWSDateISO8601Pattern3};
+        for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+            if (AWSDateParseFixedFormat(patterns[i], bytes, length, &milliseconds)) {
+                return AWSDateFromMilliseconds(milliseconds);
+            }
+        }
+    }
+
     NSDate *parsedDate = nil;
     NSArray *arrayOfDateFormat = @[AWSDateRFC822DateFormat1,
                                    AWSDateISO8601DateFormat1,
@@ -73,6 +373,17 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 + (NSDate *)aws_dateFromString:(NSString *)string format:(NSString *)dateFormat {
+    const char *pattern = AWSDateFixedFormatPattern(dateFormat);
+    if (pattern) {
+        uint8_t bytes[32];
+        NSUInteger length = 0;
+        int64_t milliseconds = 0;
+        if (AWSDateGetASCIIBytes(string, bytes, sizeof(bytes), &length)
+            && AWSDateParseFixedFormat(pattern, bytes, length, &milliseconds)) {
+            return AWSDateFromMilliseconds(milliseconds);
+        }
+    }
+
     if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
         return [[NSDate aws_RFC822Date1Formatter] dateFromString:string];
     }
@@ -92,15 +403,24 @@ static NSTimeInterval _clockskew = 0.0;
         return [[NSDate aws_ShortDateFormat2Formatter] dateFromString:string];
     }
 
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
-    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
-    dateFormatter.dateFormat = dateFormat;
-
-    return [dateFormatter dateFromString:string];
+    return [[NSDate aws_dateFormatterWithFormat:dateFormat] dateFromString:string];
 }
 
 - (NSString *)aws_stringValue:(NSString *)dateFormat {
+    const char *pattern = AWSDateFixedFormatPattern(dateFormat);
+    int64_t milliseconds = 0;
+    if (pattern && AWSDateMillisecondsForFormatting(self, pattern, &milliseconds)) {
+        NSString *string = nil;
+        if (pattern == AWSDateISO8601Pattern2 || pattern == AWSDateShortPattern1) {
+            string = AWSDateSigningString(pattern, milliseconds);
+        } else {
+            string = AWSDateFormatFixedFormat(pattern, milliseconds);
+        }
+        if (string) {
+            return string;
+        }
+    }
+
     if ([dateFormat isEqualToString:AWSDateRFC822DateFormat1]) {
         return [[NSDate aws_RFC822Date1Formatter] stringFromDate:self];
     }
@@ -120,12 +440,30 @@ static NSTimeInterval _clockskew = 0.0;
         return [[NSDate aws_ShortDateFormat2Formatter] stringFromDate:self];
     }
 
-    NSDateFormatter *dateFormatter = [NSDateFormatter new];
-    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
-    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
-    dateFormatter.dateFormat = dateFormat;
+    return [[NSDate aws_dateFormatterWithFormat:dateFormat] stringFromDate:self];
+}
+
+// Formatters for other formats are kept for the formats used most recently.
++ (NSDateFormatter *)aws_dateFormatterWithFormat:(NSString *)dateFormat {
+    static NSCache<NSString *, NSDateFormatter *> *_dateFormatters = nil;
 
-    return [dateFormatter stringFromDate:self];
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _dateFormatters = [NSCache new];
+        _dateFormatters.countLimit = 16;
+    });
+
+    NSDateFormatter *dateFormatter = dateFormat ? [_dateFormatters objectForKey:dateFormat] : nil;
+    if (dateFormatter == nil) {
+        dateFormatter = [NSDateFormatter new];
+        dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+        dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+        dateFormatter.dateFormat = dateFormat;
+        if (dateFormat) {
+            [_dateFormatters setObject:dateFormatter forKey:[dateFormat copy]];
+        }
+    }
+    return dateFormatter;
 }
 
 + (NSDateFormatter *)aws_RFC822Date1Formatter {
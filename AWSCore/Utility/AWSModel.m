@@ -15,6 +15,12 @@
 
 #import "AWSModel.h"
 
+@interface AWSMTLModel()
+
+- (NSMutableDictionary *)awsmtl_dictionaryValueWithoutNilValues;
+
+@end
+
 @implementation AWSModel
 
 /// This must be overridden by subclasses on a model-by-model basis
@@ -27,16 +33,7 @@
 }
 
 - (NSDictionary *)dictionaryValue {
-    NSDictionary *dictionaryValue = [super dictionaryValue];
-    NSMutableDictionary *mutableDictionaryValue = [dictionaryValue mutableCopy];
-
-    [dictionaryValue enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
-        if ([self valueForKey:key] == nil) {
-            [mutableDictionaryValue removeObjectForKey:key];
-        }
-    }];
-
-    return mutableDictionaryValue;
+    return [self awsmtl_dictionaryValueWithoutNilValues];
 }
 
 @end
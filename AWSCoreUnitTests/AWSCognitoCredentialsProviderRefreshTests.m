@@ -0,0 +1,269 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+static NSString *const AWSTestIdentityPoolId = @"us-east-1:00000000-0000-0000-0000-000000000000";
+static NSString *const AWSTestIdentityId = @"us-east-1:11111111-1111-1111-1111-111111111111";
+
+@interface AWSCognitoIdentity()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+@interface AWSCognitoCredentialsProvider()
+
+- (AWSTask<AWSCredentials *> *)credentialsWithCancellationToken:(AWSCancellationTokenSource *)cancellationTokenSource;
+
+@end
+
+/**
+ Local stand-in for Amazon Cognito Identity that answers `GetCredentialsForIdentity` after a fixed delay, or fails with
+ `error` when it is set.
+ */
+@interface AWSTestCognitoIdentity : AWSCognitoIdentity
+
+@property (atomic, assign) NSInteger requestCount;
+@property (nonatomic, assign) int delayInMilliseconds;
+@property (nonatomic, assign) NSTimeInterval credentialsLifetime;
+@property (atomic, strong) NSError *error;
+
+@end
+
+@implementation AWSTestCognitoIdentity
+
+- (AWSTask<AWSCognitoIdentityGetCredentialsForIdentityResponse *> *)getCredentialsForIdentity:(AWSCognitoIdentityGetCredentialsForIdentityInput *)request {
+    NSInteger requestNumber;
+    @synchronized (self) {
+        requestNumber = ++self.requestCount;
+    }
+
+    return [[AWSTask taskWithDelay:self.delayInMilliseconds] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        if (self.error) {
+            return [AWSTask taskWithError:self.error];
+        }
+        AWSCognitoIdentityCredentials *credentials = [AWSCognitoIdentityCredentials new];
+        credentials.accessKeyId = [NSString stringWithFormat:@"accessKey%ld", (long)requestNumber];
+        credentials.secretKey = @"secretKey";
+        credentials.sessionToken = @"sessionToken";
+        credentials.expiration = [NSDate dateWithTimeIntervalSinceNow:self.credentialsLifetime];
+
+        AWSCognitoIdentityGetCredentialsForIdentityResponse *response = [AWSCognitoIdentityGetCredentialsForIdentityResponse new];
+        response.credentials = credentials;
+        response.identityId = request.identityId;
+        return [AWSTask taskWithResult:response];
+    }];
+}
+
+@end
+
+@interface AWSTestCognitoCredentialsProviderHelper : AWSAbstractCognitoCredentialsProviderHelper
+
+@end
+
+@implementation AWSTestCognitoCredentialsProviderHelper
+
+- (NSString *)identityPoolId {
+    return AWSTestIdentityPoolId;
+}
+
+- (AWSTask<NSString *> *)getIdentityId {
+    self.identityId = AWSTestIdentityId;
+    return [AWSTask taskWithResult:self.identityId];
+}
+
+- (AWSTask<NSDictionary<NSString *, NSString *> *> *)logins {
+    return [AWSTask taskWithResult:@{}];
+}
+
+- (BOOL)isAuthenticated {
+    return NO;
+}
+
+@end
+
+@interface AWSCognitoCredentialsProviderRefreshTests : XCTestCase
+
+@property (nonatomic, strong) AWSCognitoCredentialsProvider *credentialsProvider;
+@property (nonatomic, strong) AWSTestCognitoIdentity *cognitoIdentity;
+
+@end
+
+@implementation AWSCognitoCredentialsProviderRefreshTests
+
+- (void)setUp {
+    [super setUp];
+
+    AWSTestCognitoCredentialsProviderHelper *identityProvider = [AWSTestCognitoCredentialsProviderHelper new];
+    identityProvider.identityId = AWSTestIdentityId;
+    self.credentialsProvider = [[AWSCognitoCredentialsProvider alloc] initWithRegionType:AWSRegionUSEast1
+                                                                         identityProvider:identityProvider];
+    [self.credentialsProvider clearCredentials];
+
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1
+                                                                         credentialsProvider:[AWSAnonymousCredentialsProvider new]];
+    self.cognitoIdentity = [[AWSTestCognitoIdentity alloc] initWithConfiguration:configuration];
+    self.cognitoIdentity.delayInMilliseconds = 200;
+    self.cognitoIdentity.credentialsLifetime = 60 * 60;
+    [self.credentialsProvider setValue:self.cognitoIdentity forKey:@"cognitoIdentity"];
+}
+
+- (void)tearDown {
+    [self.credentialsProvider clearCredentials];
+    [super tearDown];
+}
+
+- (void)testConcurrentCallersShareOneRefresh {
+    NSMutableArray<AWSTask<AWSCredentials *> *> *tasks = [NSMutableArray new];
+    NSObject *lock = [NSObject new];
+    dispatch_apply(100, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+        @synchronized (lock) {
+            [tasks addObject:task];
+        }
+    });
+
+    [[AWSTask taskForCompletionOfAllTasks:tasks] waitUntilFinished];
+
+    for (AWSTask<AWSCredentials *> *task in tasks) {
+        XCTAssertNil(task.error);
+        XCTAssertEqualObjects(task.result.accessKey, @"accessKey1");
+    }
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 1);
+}
+
+- (void)testCachedCredentialsAreServedWhileRefreshingAhead {
+    self.credentialsProvider.refreshAheadRatio = 0;
+    AWSTask<AWSCredentials *> *firstTask = [self.credentialsProvider credentials];
+    [firstTask waitUntilFinished];
+    XCTAssertEqualObjects(firstTask.result.accessKey, @"accessKey1");
+
+    // The cached credentials are past their refresh-ahead date, so they are returned
+    // immediately while the refresh runs in the background.
+    AWSTask<AWSCredentials *> *staleTask = [self.credentialsProvider credentials];
+    XCTAssertTrue(staleTask.isCompleted);
+    XCTAssertEqualObjects(staleTask.result.accessKey, @"accessKey1");
+
+    self.credentialsProvider.refreshAheadRatio = 0.75;
+    [NSThread sleepForTimeInterval:1];
+
+    AWSTask<AWSCredentials *> *refreshedTask = [self.credentialsProvider credentials];
+    XCTAssertTrue(refreshedTask.isCompleted);
+    XCTAssertEqualObjects(refreshedTask.result.accessKey, @"accessKey2");
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 2);
+}
+
+- (void)testFailedRefreshIsSharedUntilRetry {
+    self.cognitoIdentity.error = [NSError errorWithDomain:NSURLErrorDomain
+                                                     code:NSURLErrorNotConnectedToInternet
+                                                 userInfo:nil];
+
+    NSMutableArray<AWSTask<AWSCredentials *> *> *tasks = [NSMutableArray new];
+    for (int i = 0; i < 50; i++) {
+        [tasks addObject:[self.credentialsProvider credentials]];
+    }
+    [[AWSTask taskForCompletionOfAllTasks:tasks] waitUntilFinished];
+
+    // Callers after the failure get its error without a new request.
+    for (int i = 0; i < 50; i++) {
+        AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+        [task waitUntilFinished];
+        [tasks addObject:task];
+    }
+    for (AWSTask<AWSCredentials *> *task in tasks) {
+        XCTAssertEqual(task.error.code, NSURLErrorNotConnectedToInternet);
+    }
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 1);
+
+    self.cognitoIdentity.error = nil;
+    [NSThread sleepForTimeInterval:1.1];
+    AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqualObjects(task.result.accessKey, @"accessKey2");
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 2);
+}
+
+- (void)testCancelledCallerDoesNotCancelSharedRefresh {
+    AWSCancellationTokenSource *cancellationTokenSource = [AWSCancellationTokenSource cancellationTokenSource];
+    AWSTask<AWSCredentials *> *cancelledTask = [self.credentialsProvider credentialsWithCancellationToken:cancellationTokenSource];
+    AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+    [cancellationTokenSource cancel];
+
+    [cancelledTask waitUntilFinished];
+    [task waitUntilFinished];
+    XCTAssertTrue(cancelledTask.isCancelled);
+    XCTAssertEqualObjects(task.result.accessKey, @"accessKey1");
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 1);
+}
+
+- (void)testClearCredentialsEmptiesTheKeychain {
+    AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    AWSUICKeyChainStore *keychain = [self.credentialsProvider valueForKey:@"keychain"];
+    dispatch_queue_t persistenceQueue = [self.credentialsProvider valueForKey:@"persistenceQueue"];
+    NSArray<NSString *> *keys = @[@"accessKey", @"secretKey", @"sessionKey", @"expiration"];
+    dispatch_sync(persistenceQueue, ^{});
+    XCTAssertEqualObjects([keychain stringForKey:@"accessKey"], @"accessKey1");
+
+    [self.credentialsProvider clearCredentials];
+    dispatch_sync(persistenceQueue, ^{});
+    for (NSString *key in keys) {
+        XCTAssertNil([keychain stringForKey:key], @"%@ is still in the keychain.", key);
+    }
+}
+
+- (void)testCredentialsTailLatencyAcrossRefreshBoundary {
+    self.credentialsProvider.refreshAheadRatio = 0;
+    [[self.credentialsProvider credentials] waitUntilFinished];
+    self.cognitoIdentity.delayInMilliseconds = 1000;
+
+    // Every call crosses the refresh-ahead date; none of them should wait for the stand-in.
+    int const callCount = 10000;
+    uint64_t *latencies = malloc(sizeof(uint64_t) * callCount);
+    for (int i = 0; i < callCount; i++) {
+        uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+        AWSTask<AWSCredentials *> *task = [self.credentialsProvider credentials];
+        latencies[i] = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+        XCTAssertTrue(task.isCompleted);
+    }
+    qsort_b(latencies, callCount, sizeof(uint64_t), ^int(const void *a, const void *b) {
+        uint64_t left = *(const uint64_t *)a;
+        uint64_t right = *(const uint64_t *)b;
+        return left < right ? -1 : left > right;
+    });
+    uint64_t p50 = latencies[callCount / 2];
+    uint64_t p99 = latencies[callCount * 99 / 100];
+    free(latencies);
+
+    XCTAssertLessThan(p50, NSEC_PER_MSEC);
+    XCTAssertLessThan(p99, 10 * NSEC_PER_MSEC);
+}
+
+- (void)testPerformanceOfCachedCredentials {
+    [[self.credentialsProvider credentials] waitUntilFinished];
+    [self measureBlock:^{
+        for (int i = 0; i < 10000; i++) {
+            XCTAssertTrue([self.credentialsProvider credentials].isCompleted);
+        }
+    }];
+    XCTAssertEqual(self.cognitoIdentity.requestCount, 1);
+}
+
+@end
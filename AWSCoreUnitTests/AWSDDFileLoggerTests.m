@@ -0,0 +1,195 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSDDMappedLogFileWriter.h"
+
+@interface AWSDDFileLogger (AWSDDFileLoggerTests)
+
+- (void)logData:(NSData *)data;
+
+@end
+
+@interface AWSDDFileLoggerTests : XCTestCase
+
+@property (nonatomic, strong) NSString *logsDirectory;
+
+@end
+
+@implementation AWSDDFileLoggerTests
+
+- (void)setUp {
+    [super setUp];
+    self.logsDirectory = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:self.logsDirectory error:nil];
+    [super tearDown];
+}
+
+- (AWSDDFileLogger *)fileLoggerInDirectory:(NSString *)directory {
+    AWSDDLogFileManagerDefault *logFileManager = [[AWSDDLogFileManagerDefault alloc] initWithLogsDirectory:directory];
+    AWSDDFileLogger *fileLogger = [[AWSDDFileLogger alloc] initWithLogFileManager:logFileManager];
+    fileLogger.usesMemoryMappedFile = YES;
+    fileLogger.maximumFileSize = 0;
+    fileLogger.rollingFrequency = 0;
+    fileLogger.logFormatter = nil;
+    return fileLogger;
+}
+
+- (void)logLines:(NSUInteger)count withPrefix:(NSString *)prefix toFileLogger:(AWSDDFileLogger *)fileLogger {
+    for (NSUInteger i = 0; i < count; i++) {
+        NSString *line = [NSString stringWithFormat:@"%@ %lu: GET /items/%lu returned 200 in 12 ms\n", prefix, (unsigned long)i, (unsigned long)i];
+        [fileLogger logData:[line dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+}
+
+- (void)testResumingAfterCrashRemovesUnwrittenEndOfMappedFile {
+    AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:self.logsDirectory];
+    [self logLines:100 withPrefix:@"Before" toFileLogger:fileLogger];
+    [fileLogger flush];
+
+    // Copying the file while the logger still has it mapped leaves it as a crash would.
+    NSString *crashedDirectory = [self.logsDirectory stringByAppendingPathComponent:@"Crashed"];
+    NSString *livePath = fileLogger.currentLogFileInfo.filePath;
+    NSString *crashedPath = [crashedDirectory stringByAppendingPathComponent:livePath.lastPathComponent];
+    [[NSFileManager defaultManager] createDirectoryAtPath:crashedDirectory withIntermediateDirectories:YES attributes:nil error:nil];
+    XCTAssertTrue([[NSFileManager defaultManager] copyItemAtPath:livePath toPath:crashedPath error:nil]);
+
+    NSData *crashedData = [NSData dataWithContentsOfFile:crashedPath];
+    const char zero = 0;
+    XCTAssertNotEqual([crashedData rangeOfData:[NSData dataWithBytes:&zero length:1] options:0 range:NSMakeRange(0, crashedData.length)].location, NSNotFound);
+
+    AWSDDFileLogger *resumedLogger = [self fileLoggerInDirectory:crashedDirectory];
+    [self logLines:1 withPrefix:@"After" toFileLogger:resumedLogger];
+    [resumedLogger flush];
+    XCTAssertEqualObjects(resumedLogger.currentLogFileInfo.filePath, crashedPath);
+
+    NSString *contents = [NSString stringWithContentsOfFile:crashedPath encoding:NSUTF8StringEncoding error:nil];
+    XCTAssertFalse([contents containsString:@"\0"]);
+    NSArray<NSString *> *lines = [[contents stringByTrimmingCharactersInSet:[NSCharacterSet newlineCharacterSet]] componentsSeparatedByString:@"\n"];
+    XCTAssertEqual(lines.count, 101);
+    XCTAssertTrue([lines.firstObject hasPrefix:@"Before 0:"]);
+    XCTAssertTrue([lines.lastObject hasPrefix:@"After 0:"]);
+}
+
+- (void)testRollingTruncatesMappedFileToItsData {
+    AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:self.logsDirectory];
+    [self logLines:10 withPrefix:@"Line" toFileLogger:fileLogger];
+    NSString *filePath = fileLogger.currentLogFileInfo.filePath;
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"The file was rolled."];
+    [fileLogger rollLogFileWithCompletionBlock:^{
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+
+    NSString *contents = [NSString stringWithContentsOfFile:filePath encoding:NSUTF8StringEncoding error:nil];
+    XCTAssertTrue([contents hasPrefix:@"Line 0:"]);
+    XCTAssertTrue([contents hasSuffix:@"ms\n"]);
+    XCTAssertFalse([contents containsString:@"\0"]);
+}
+
+- (void)testDiskQuotaCountsOnlyDataOfMappedFile {
+    AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:self.logsDirectory];
+    AWSDDLogFileManagerDefault *logFileManager = (AWSDDLogFileManagerDefault *)fileLogger.logFileManager;
+    logFileManager.maximumNumberOfLogFiles = 0;
+    logFileManager.logFilesDiskQuota = 64 * 1024;
+
+    [self logLines:10 withPrefix:@"Archived" toFileLogger:fileLogger];
+    NSString *archivedPath = fileLogger.currentLogFileInfo.filePath;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"The file was rolled."];
+    [fileLogger rollLogFileWithCompletionBlock:^{
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+
+    // The current file is extended by a whole chunk, well past the quota, but holds only a few lines.
+    [self logLines:10 withPrefix:@"Current" toFileLogger:fileLogger];
+    NSString *currentPath = fileLogger.currentLogFileInfo.filePath;
+    NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:currentPath error:nil];
+    XCTAssertGreaterThan(attributes.fileSize, logFileManager.logFilesDiskQuota);
+    XCTAssertLessThan([AWSDDMappedLogFileWriter dataLengthOfFileAtPath:currentPath], 4 * 1024);
+
+    XCTAssertTrue([logFileManager cleanupLogFilesWithError:nil]);
+    XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:archivedPath]);
+}
+
+- (void)testArchivedFilesAreCompressed {
+    AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:self.logsDirectory];
+    AWSDDLogFileManagerDefault *logFileManager = (AWSDDLogFileManagerDefault *)fileLogger.logFileManager;
+    logFileManager.compressesArchivedLogFiles = YES;
+
+    [self logLines:1000 withPrefix:@"Line" toFileLogger:fileLogger];
+    NSString *filePath = fileLogger.currentLogFileInfo.filePath;
+    [fileLogger flush];
+    NSData *expected = [NSData dataWithContentsOfFile:filePath];
+    [fileLogger rollLogFileWithCompletionBlock:nil];
+
+    NSString *compressedPath = [filePath stringByAppendingPathExtension:@"gz"];
+    NSPredicate *compressed = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+        return [[NSFileManager defaultManager] fileExistsAtPath:compressedPath] && ![[NSFileManager defaultManager] fileExistsAtPath:filePath];
+    }];
+    [self waitForExpectations:@[[[XCTNSPredicateExpectation alloc] initWithPredicate:compressed object:nil]] timeout:10];
+
+    XCTAssertEqualObjects([[NSData dataWithContentsOfFile:compressedPath] awsgzip_gunzippedData], expected);
+    XCTAssertLessThan([[NSData dataWithContentsOfFile:compressedPath] length], expected.length / 4);
+
+    AWSDDLogFileInfo *info = [logFileManager.sortedLogFileInfos filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"filePath == %@", compressedPath]].firstObject;
+    XCTAssertNotNil(info);
+    XCTAssertTrue(info.isArchived);
+}
+
+- (void)testMappedFileAndFileHandleArchiveTheSameLog {
+    NSUInteger const lineCount = 100000;
+    NSMutableArray<NSData *> *archives = [NSMutableArray new];
+    for (NSNumber *usesMemoryMappedFile in @[@NO, @YES]) {
+        NSString *directory = [self.logsDirectory stringByAppendingPathComponent:usesMemoryMappedFile.stringValue];
+        AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:directory];
+        fileLogger.usesMemoryMappedFile = usesMemoryMappedFile.boolValue;
+        AWSDDLogFileManagerDefault *logFileManager = (AWSDDLogFileManagerDefault *)fileLogger.logFileManager;
+        logFileManager.compressesArchivedLogFiles = YES;
+
+        [self logLines:lineCount withPrefix:@"Line" toFileLogger:fileLogger];
+        [fileLogger flush];
+
+        NSString *compressedPath = [fileLogger.currentLogFileInfo.filePath stringByAppendingPathExtension:@"gz"];
+        [fileLogger rollLogFileWithCompletionBlock:nil];
+        NSPredicate *compressed = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+            return [[NSFileManager defaultManager] fileExistsAtPath:compressedPath];
+        }];
+        [self waitForExpectations:@[[[XCTNSPredicateExpectation alloc] initWithPredicate:compressed object:nil]] timeout:30];
+        NSData *compressedData = [NSData dataWithContentsOfFile:compressedPath];
+        NSData *data = [compressedData awsgzip_gunzippedData];
+        XCTAssertLessThan(compressedData.length, data.length / 4);
+        [archives addObject:data];
+    }
+
+    NSString *contents = [[NSString alloc] initWithData:archives.lastObject encoding:NSUTF8StringEncoding];
+    XCTAssertEqual([contents componentsSeparatedByString:@"\n"].count, lineCount + 1);
+    XCTAssertEqualObjects(archives.firstObject, archives.lastObject);
+}
+
+- (void)testPerformanceOfMappedFile {
+    [self measureBlock:^{
+        AWSDDFileLogger *fileLogger = [self fileLoggerInDirectory:[self.logsDirectory stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+        [self logLines:100000 withPrefix:@"Line" toFileLogger:fileLogger];
+        [fileLogger flush];
+    }];
+}
+
+@end
@@ -0,0 +1,199 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+#define AWSDDLogTestsLog(log, async, logFlag, logContext, frmt, ...) \
+    [log log:async level:AWSDDLogLevelVerbose flag:logFlag context:logContext literalFile:__FILE__ literalFunction:__PRETTY_FUNCTION__ line:__LINE__ tag:nil format:(frmt), ##__VA_ARGS__]
+
+@interface AWSDDLogTestsLogger : AWSDDAbstractLogger
+
+@property (nonatomic, strong) NSMutableArray<AWSDDLogMessage *> *messages;
+@property (nonatomic, strong, nullable) dispatch_semaphore_t gate;
+
+@end
+
+@implementation AWSDDLogTestsLogger
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _messages = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)logMessage:(AWSDDLogMessage *)logMessage {
+    if (self.gate) {
+        dispatch_semaphore_wait(self.gate, DISPATCH_TIME_FOREVER);
+        self.gate = nil;
+    }
+    [self.messages addObject:logMessage];
+}
+
+@end
+
+@interface AWSDDLogTestsNullLogger : AWSDDAbstractLogger
+
+@property (atomic, assign) NSUInteger verboseMessageCount;
+
+@end
+
+@implementation AWSDDLogTestsNullLogger
+
+- (void)logMessage:(AWSDDLogMessage *)logMessage {
+    if (logMessage.flag == AWSDDLogFlagVerbose) {
+        self.verboseMessageCount++;
+    }
+}
+
+@end
+
+@interface AWSDDLogTests : XCTestCase
+
+@end
+
+@implementation AWSDDLogTests
+
+- (void)testBufferedStatementsCopyNonLiteralFileAndFunction {
+    AWSDDLog *log = [AWSDDLog new];
+    AWSDDLogTestsLogger *logger = [AWSDDLogTestsLogger new];
+    logger.gate = dispatch_semaphore_create(0);
+    [log addLogger:logger];
+
+    // Holds the logging queue, so the statements below stay in the buffer until their strings have been overwritten.
+    AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 0, @"Gate");
+    for (NSUInteger i = 0; i < 3; i++) {
+        char file[64];
+        char function[64];
+        snprintf(file, sizeof(file), "/tmp/Generated%lu.m", (unsigned long)i);
+        snprintf(function, sizeof(function), "generated%lu", (unsigned long)i);
+        [log log:YES level:AWSDDLogLevelVerbose flag:AWSDDLogFlagVerbose context:0 file:file function:function line:i tag:nil format:@"Statement"];
+        memset(file, 0, sizeof(file));
+        memset(function, 0, sizeof(function));
+    }
+    dispatch_semaphore_signal(logger.gate);
+    [log flushLog];
+
+    XCTAssertEqual(logger.messages.count, 4);
+    for (NSUInteger i = 0; i < 3; i++) {
+        AWSDDLogMessage *message = logger.messages[i + 1];
+        XCTAssertEqualObjects(message.file, ([NSString stringWithFormat:@"/tmp/Generated%lu.m", (unsigned long)i]));
+        XCTAssertEqualObjects(message.fileName, ([NSString stringWithFormat:@"Generated%lu", (unsigned long)i]));
+        XCTAssertEqualObjects(message.function, ([NSString stringWithFormat:@"generated%lu", (unsigned long)i]));
+    }
+}
+
+- (void)testBufferedStatementsKeepTheirOrderAndFields {
+    AWSDDLog *log = [AWSDDLog new];
+    AWSDDLogTestsLogger *logger = [AWSDDLogTestsLogger new];
+    [log addLogger:logger];
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 0, @"Statement %lu", (unsigned long)i);
+    }
+    AWSDDLogTestsLog(log, NO, AWSDDLogFlagError, 0, @"Error");
+    [log flushLog];
+
+    XCTAssertEqual(logger.messages.count, 101);
+    for (NSUInteger i = 0; i < 100; i++) {
+        XCTAssertEqualObjects(logger.messages[i].message, ([NSString stringWithFormat:@"Statement %lu", (unsigned long)i]));
+    }
+    XCTAssertEqualObjects(logger.messages.lastObject.message, @"Error");
+
+    AWSDDLogMessage *message = logger.messages.firstObject;
+    XCTAssertEqualObjects(message.messageFormat, @"Statement %lu");
+    XCTAssertEqual(message.flag, AWSDDLogFlagVerbose);
+    XCTAssertEqualObjects(message.fileName, @"AWSDDLogTests");
+    XCTAssertEqualObjects(message.file, @(__FILE__));
+    XCTAssertTrue([message.function containsString:@"testBufferedStatementsKeepTheirOrderAndFields"]);
+    XCTAssertEqualObjects(message.threadID, logger.messages.lastObject.threadID);
+    XCTAssertEqualObjects(message.queueLabel, logger.messages.lastObject.queueLabel);
+    XCTAssertEqualWithAccuracy(message.timestamp.timeIntervalSinceNow, 0, 60);
+    XCTAssertEqual(log.droppedMessageCount, 0);
+}
+
+- (void)testSamplingByContext {
+    AWSDDLog *log = [AWSDDLog new];
+    AWSDDLogTestsLogger *logger = [AWSDDLogTestsLogger new];
+    [log addLogger:logger];
+    [log setSampleInterval:10 forContext:7];
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 7, @"Sampled %lu", (unsigned long)i);
+        AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 0, @"Kept %lu", (unsigned long)i);
+    }
+    // Warnings are never sampled.
+    AWSDDLogTestsLog(log, YES, AWSDDLogFlagWarning, 7, @"Warning");
+    [log flushLog];
+
+    NSPredicate *sampled = [NSPredicate predicateWithFormat:@"context == 7 AND flag == %lu", (unsigned long)AWSDDLogFlagVerbose];
+    NSPredicate *kept = [NSPredicate predicateWithFormat:@"context == 0"];
+    XCTAssertEqual([logger.messages filteredArrayUsingPredicate:sampled].count, 10);
+    XCTAssertEqual([logger.messages filteredArrayUsingPredicate:kept].count, 100);
+    XCTAssertEqualObjects(logger.messages.lastObject.message, @"Warning");
+
+    [logger.messages removeAllObjects];
+    [log setSampleInterval:1 forContext:7];
+    AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 7, @"Kept");
+    [log flushLog];
+    XCTAssertEqual(logger.messages.count, 1);
+}
+
+- (void)testFullBufferDropsAndReports {
+    AWSDDLog *log = [AWSDDLog new];
+    AWSDDLogTestsLogger *logger = [AWSDDLogTestsLogger new];
+    logger.gate = dispatch_semaphore_create(0);
+    [log addLogger:logger];
+
+    NSUInteger const statementCount = 5000;
+    for (NSUInteger i = 0; i < statementCount; i++) {
+        AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 0, @"Statement %lu", (unsigned long)i);
+    }
+    AWSDDLogTestsLog(log, YES, AWSDDLogFlagWarning, 0, @"Warning");
+    XCTAssertGreaterThan(log.droppedMessageCount, 0);
+
+    dispatch_semaphore_signal(logger.gate);
+    [log flushLog];
+
+    NSPredicate *verbose = [NSPredicate predicateWithFormat:@"flag == %lu", (unsigned long)AWSDDLogFlagVerbose];
+    XCTAssertEqual([logger.messages filteredArrayUsingPredicate:verbose].count + log.droppedMessageCount, statementCount);
+    XCTAssertTrue([[logger.messages valueForKey:@"message"] containsObject:@"Warning"]);
+    NSPredicate *report = [NSPredicate predicateWithFormat:@"message BEGINSWITH 'AWSDDLog: Dropped'"];
+    XCTAssertEqual([logger.messages filteredArrayUsingPredicate:report].count, 1);
+}
+
+- (void)testPerformanceOfVerboseStatements {
+    AWSDDLog *log = [AWSDDLog new];
+    AWSDDLogTestsNullLogger *logger = [AWSDDLogTestsNullLogger new];
+    [log addLogger:logger];
+    NSUInteger const statementCount = 100000;
+
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSUInteger verboseMessageCount = logger.verboseMessageCount;
+            NSUInteger droppedMessageCount = log.droppedMessageCount;
+            for (NSUInteger i = 0; i < statementCount; i++) {
+                AWSDDLogTestsLog(log, YES, AWSDDLogFlagVerbose, 0, @"Request %lu succeeded with status %d", (unsigned long)i, 200);
+            }
+            [log flushLog];
+
+            // Every statement is either logged or counted as dropped.
+            XCTAssertEqual(logger.verboseMessageCount - verboseMessageCount + log.droppedMessageCount - droppedMessageCount, statementCount);
+        }];
+    }
+}
+
+@end
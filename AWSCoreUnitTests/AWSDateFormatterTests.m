@@ -18,10 +18,167 @@
 
 @interface AWSDateFormatterTests : XCTestCase
 
+@property (nonatomic, strong) NSTimeZone *defaultTimeZone;
+
 @end
 
 @implementation AWSDateFormatterTests
 
+- (void)setUp {
+    [super setUp];
+    self.defaultTimeZone = [NSTimeZone defaultTimeZone];
+}
+
+- (void)tearDown {
+    [NSTimeZone setDefaultTimeZone:self.defaultTimeZone];
+    [super tearDown];
+}
+
+- (NSDateFormatter *)dateFormatterWithFormat:(NSString *)dateFormat {
+    NSDateFormatter *dateFormatter = [NSDateFormatter new];
+    dateFormatter.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+    dateFormatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    dateFormatter.dateFormat = dateFormat;
+    return dateFormatter;
+}
+
+- (NSArray<NSString *> *)fixedDateFormats {
+    return @[AWSDateRFC822DateFormat1,
+             AWSDateISO8601DateFormat1,
+             AWSDateISO8601DateFormat2,
+             AWSDateISO8601DateFormat3,
+             AWSDateShortDateFormat1,
+             AWSDateShortDateFormat2];
+}
+
+- (NSArray<NSDate *> *)sampleDates {
+    NSMutableArray<NSDate *> *dates = [NSMutableArray new];
+    NSCalendar *calendar = [NSCalendar calendarWithIdentifier:NSCalendarIdentifierGregorian];
+    calendar.timeZone = [NSTimeZone timeZoneWithName:@"GMT"];
+
+    // Leap days, the days around them and year ends, at the first and last millisecond of the day.
+    NSArray<NSArray<NSNumber *> *> *days = @[@[@1600, @2, @29], @[@1700, @2, @28], @[@1700, @3, @1], @[@1900, @2, @28],
+                                             @[@1900, @3, @1], @[@1969, @12, @31], @[@1970, @1, @1], @[@2000, @2, @29],
+                                             @[@2024, @2, @29], @[@2024, @12, @31], @[@2100, @2, @28], @[@2100, @3, @1],
+                                             @[@2400, @2, @29], @[@9999, @12, @31]];
+    for (NSArray<NSNumber *> *day in days) {
+        NSDateComponents *components = [NSDateComponents new];
+        components.year = day[0].integerValue;
+        components.month = day[1].integerValue;
+        components.day = day[2].integerValue;
+        NSDate *date = [calendar dateFromComponents:components];
+        [dates addObject:date];
+        [dates addObject:[date dateByAddingTimeInterval:86399.999]];
+    }
+
+    srand48(42);
+    NSTimeInterval start = -12000000000.0; // 1589
+    NSTimeInterval end = 250000000000.0; // 9892
+    for (NSUInteger i = 0; i < 5000; i++) {
+        NSTimeInterval interval = start + drand48() * (end - start);
+        [dates addObject:[NSDate dateWithTimeIntervalSince1970:i % 2 ? floor(interval) : interval]];
+    }
+    return dates;
+}
+
+#pragma mark - Fixed formats
+
+- (void)testFixedFormatsMatchDateFormatter {
+    NSArray<NSDate *> *dates = [self sampleDates];
+    for (NSString *timeZoneName in @[@"GMT", @"America/Los_Angeles", @"Asia/Kolkata", @"Pacific/Chatham"]) {
+        [NSTimeZone setDefaultTimeZone:[NSTimeZone timeZoneWithName:timeZoneName]];
+
+        for (NSString *dateFormat in [self fixedDateFormats]) {
+            NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:dateFormat];
+            for (NSDate *date in dates) {
+                NSString *expected = [dateFormatter stringFromDate:date];
+                NSString *string = [date aws_stringValue:dateFormat];
+                XCTAssertEqualObjects(string, expected, @"%@ %@ %f", timeZoneName, dateFormat, [date timeIntervalSince1970]);
+
+                NSDate *expectedDate = [dateFormatter dateFromString:expected];
+                NSDate *parsedDate = [NSDate aws_dateFromString:expected format:dateFormat];
+                XCTAssertEqualObjects(parsedDate, expectedDate, @"%@ %@ %@", timeZoneName, dateFormat, expected);
+                if (![dateFormat isEqualToString:AWSDateShortDateFormat1] && ![dateFormat isEqualToString:AWSDateShortDateFormat2]) {
+                    XCTAssertEqualObjects([NSDate aws_dateFromString:expected], expectedDate, @"%@", expected);
+                }
+            }
+        }
+    }
+}
+
+- (void)testFixedFormatsLeaveOtherStringsToDateFormatter {
+    NSDictionary<NSString *, NSArray<NSString *> *> *stringsByFormat =
+    @{AWSDateRFC822DateFormat1: @[@"Wed, 02 Jan 2019 03:45:06 PST", @"Thu, 02 Jan 2019 03:45:06 GMT", @"Wed, 2 Jan 2019 03:45:06 GMT",
+                                  @"Fri, 29 Feb 2019 03:45:06 GMT", @"wed, 02 jan 2019 03:45:06 GMT"],
+      AWSDateISO8601DateFormat1: @[@"2019-02-29T00:00:00Z", @"2019-13-01T00:00:00Z", @"2019-01-02T24:00:00Z",
+                                   @"2019-01-02T03:45:60Z", @"1582-10-10T00:00:00Z", @"12019-01-02T03:45:06Z", @"2019-01-02 03:45:06Z"],
+      AWSDateISO8601DateFormat3: @[@"2019-01-02T03:45:06.7Z", @"2019-01-02T03:45:06Z"],
+      AWSDateShortDateFormat2: @[@"2019-1-2", @"２０１９-01-02", @""]};
+    for (NSString *dateFormat in stringsByFormat) {
+        NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:dateFormat];
+        for (NSString *string in stringsByFormat[dateFormat]) {
+            XCTAssertEqualObjects([NSDate aws_dateFromString:string format:dateFormat], [dateFormatter dateFromString:string], @"%@", string);
+        }
+    }
+
+    XCTAssertNil([NSDate aws_dateFromString:@"1398796238"]);
+    XCTAssertNil([NSDate aws_dateFromString:@"1398796238.5"]);
+}
+
+- (void)testSigningStringsAreSharedWithinASecond {
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1792411200.25];
+    NSString *dateTime = [date aws_stringValue:AWSDateISO8601DateFormat2];
+    NSString *dateStamp = [date aws_stringValue:AWSDateShortDateFormat1];
+    XCTAssertEqualObjects(dateTime, @"20261019T120000Z");
+    XCTAssertEqualObjects(dateStamp, @"20261019");
+
+    NSDate *sameSecond = [NSDate dateWithTimeIntervalSince1970:1792411200.75];
+    XCTAssertTrue([sameSecond aws_stringValue:AWSDateISO8601DateFormat2] == dateTime);
+    XCTAssertTrue([sameSecond aws_stringValue:AWSDateShortDateFormat1] == dateStamp);
+
+    NSDate *nextSecond = [NSDate dateWithTimeIntervalSince1970:1792411201.0];
+    XCTAssertEqualObjects([nextSecond aws_stringValue:AWSDateISO8601DateFormat2], @"20261019T120001Z");
+    XCTAssertEqualObjects([date aws_stringValue:AWSDateISO8601DateFormat2], @"20261019T120000Z");
+}
+
+#pragma mark - Benchmarks
+
+- (NSArray<NSString *> *)ISO8601Strings {
+    NSMutableArray<NSString *> *strings = [NSMutableArray new];
+    NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:AWSDateISO8601DateFormat1];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [strings addObject:[dateFormatter stringFromDate:[NSDate dateWithTimeIntervalSince1970:1700000000 + i * 7919]]];
+    }
+    return strings;
+}
+
+- (void)testFixedFormatParsePerformance {
+    NSArray<NSString *> *strings = [self ISO8601Strings];
+    [self measureBlock:^{
+        NSUInteger parsed = 0;
+        for (NSUInteger i = 0; i < 2000; i++) {
+            for (NSString *string in strings) {
+                parsed += [NSDate aws_dateFromString:string format:AWSDateISO8601DateFormat1] != nil;
+            }
+        }
+        XCTAssertEqual(parsed, 2000000);
+    }];
+}
+
+- (void)testDateFormatterParsePerformance {
+    NSArray<NSString *> *strings = [self ISO8601Strings];
+    NSDateFormatter *dateFormatter = [self dateFormatterWithFormat:AWSDateISO8601DateFormat1];
+    [self measureBlock:^{
+        NSUInteger parsed = 0;
+        for (NSUInteger i = 0; i < 100; i++) {
+            for (NSString *string in strings) {
+                parsed += [dateFormatter dateFromString:string] != nil;
+            }
+        }
+        XCTAssertEqual(parsed, 100000);
+    }];
+}
+
 #pragma mark - aws_dateFromString
 
 - (void)test_aws_dateFromString_handlesAWSDateRFC822DateFormat1 {
@@ -0,0 +1,192 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import <pthread.h>
+#import <stdatomic.h>
+
+@interface AWSExecutorTests : XCTestCase
+
+@property (nonatomic, assign) NSUInteger originalMaximumConcurrentBlockCount;
+
+@end
+
+@implementation AWSExecutorTests
+
+- (void)setUp {
+    [super setUp];
+    self.originalMaximumConcurrentBlockCount = [AWSExecutor maximumConcurrentBlockCount];
+}
+
+- (void)tearDown {
+    [AWSExecutor setMaximumConcurrentBlockCount:self.originalMaximumConcurrentBlockCount];
+    [super tearDown];
+}
+
+- (NSUInteger)inlineDepthOfDefaultExecutorFromDepth:(NSUInteger)depth {
+    __block NSUInteger deepest = depth;
+    if (depth < 100) {
+        [[AWSExecutor defaultExecutor] execute:^{
+            deepest = [self inlineDepthOfDefaultExecutorFromDepth:depth + 1];
+        }];
+    }
+    return deepest;
+}
+
+- (void)testDefaultExecutorDispatchesDeeplyNestedBlocks {
+    XCTAssertEqual([self inlineDepthOfDefaultExecutorFromDepth:0], 20);
+    // The depth is back to zero once the nested blocks have returned.
+    XCTAssertEqual([self inlineDepthOfDefaultExecutorFromDepth:0], 20);
+}
+
+- (void)testDefaultExecutorRestoresDepthAfterException {
+    for (int i = 0; i < 30; i++) {
+        @try {
+            [[AWSExecutor defaultExecutor] execute:^{
+                @throw [NSException exceptionWithName:NSInternalInconsistencyException reason:@"test" userInfo:nil];
+            }];
+        } @catch (NSException *exception) {
+        }
+    }
+    XCTAssertEqual([self inlineDepthOfDefaultExecutorFromDepth:0], 20);
+}
+
+- (void)testDefaultExecutorDoesNotWaitForSaturatedPool {
+    [AWSExecutor setMaximumConcurrentBlockCount:1];
+
+    // The only slot of the pool is held by a block waiting on a semaphore, which the pool can't lend out.
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    XCTestExpectation *gateStarted = [self expectationWithDescription:@"The gate block started."];
+    [[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility] execute:^{
+        [gateStarted fulfill];
+        dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER);
+    }];
+    [self waitForExpectations:@[gateStarted] timeout:5];
+
+    // Deeply nested continuations of the default executor still run, and can unblock the pool themselves.
+    XCTestExpectation *nestedBlockRan = [self expectationWithDescription:@"The dispatched nested block ran."];
+    __block void (^nest)(NSUInteger) = ^(NSUInteger depth) {
+        [[AWSExecutor defaultExecutor] execute:^{
+            if (depth < 30) {
+                nest(depth + 1);
+            } else {
+                dispatch_semaphore_signal(gate);
+                [nestedBlockRan fulfill];
+            }
+        }];
+    };
+    nest(0);
+
+    [self waitForExpectations:@[nestedBlockRan] timeout:5];
+    nest = nil;
+}
+
+- (void)testHigherQualityOfServiceRunsFirst {
+    [AWSExecutor setMaximumConcurrentBlockCount:1];
+
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    XCTestExpectation *gateStarted = [self expectationWithDescription:@"The gate block started."];
+    [[AWSExecutor executorWithQualityOfService:NSQualityOfServiceBackground] execute:^{
+        [gateStarted fulfill];
+        dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER);
+    }];
+    [self waitForExpectations:@[gateStarted] timeout:5];
+
+    NSMutableArray<NSString *> *order = [NSMutableArray new];
+    XCTestExpectation *finished = [self expectationWithDescription:@"Both blocks ran."];
+    finished.expectedFulfillmentCount = 2;
+    [[AWSExecutor executorWithQualityOfService:NSQualityOfServiceBackground] execute:^{
+        @synchronized(order) {
+            [order addObject:@"background"];
+        }
+        [finished fulfill];
+    }];
+    [[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUserInitiated] execute:^{
+        @synchronized(order) {
+            [order addObject:@"userInitiated"];
+        }
+        [finished fulfill];
+    }];
+    dispatch_semaphore_signal(gate);
+
+    [self waitForExpectations:@[finished] timeout:5];
+    XCTAssertEqualObjects(order, (@[@"userInitiated", @"background"]));
+}
+
+- (void)testWaitingBlockGivesUpItsSlot {
+    [AWSExecutor setMaximumConcurrentBlockCount:1];
+    AWSExecutor *executor = [AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility];
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"The waiting block finished."];
+    [executor execute:^{
+        AWSTask *task = [AWSTask taskFromExecutor:executor withBlock:^id{
+            return @"result";
+        }];
+        [task waitUntilFinished];
+        XCTAssertEqualObjects(task.result, @"result");
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+}
+
+- (void)testStressBoundsThreadsAndConcurrency {
+    NSUInteger const taskCount = 10000;
+    NSUInteger const limit = 8;
+    [AWSExecutor setMaximumConcurrentBlockCount:limit];
+
+    __block _Atomic(NSUInteger) running = 0;
+    __block _Atomic(NSUInteger) maximumRunning = 0;
+    NSMutableSet<NSNumber *> *threads = [NSMutableSet new];
+
+    NSArray<AWSExecutor *> *executors = @[[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUserInitiated],
+                                          [AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility],
+                                          [AWSExecutor executorWithQualityOfService:NSQualityOfServiceBackground]];
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray arrayWithCapacity:taskCount];
+    for (NSUInteger i = 0; i < taskCount; i++) {
+        [tasks addObject:[AWSTask taskFromExecutor:executors[i % executors.count] withBlock:^id{
+            NSUInteger current = atomic_fetch_add(&running, 1) + 1;
+            NSUInteger maximum = atomic_load(&maximumRunning);
+            while (current > maximum && !atomic_compare_exchange_weak(&maximumRunning, &maximum, current)) {
+            }
+            uint64_t threadID = 0;
+            pthread_threadid_np(NULL, &threadID);
+            @synchronized(threads) {
+                [threads addObject:@(threadID)];
+            }
+
+            usleep(100);
+            atomic_fetch_sub(&running, 1);
+            return nil;
+        }]];
+    }
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"All tasks finished."];
+    [[AWSTask taskForCompletionOfAllTasks:tasks] continueWithBlock:^id(AWSTask *task) {
+        [expectation fulfill];
+        return nil;
+    }];
+    [self waitForExpectationsWithTimeout:60 handler:nil];
+
+    NSUInteger maximum = atomic_load(&maximumRunning);
+    XCTAssertGreaterThan(maximum, 1);
+    XCTAssertLessThanOrEqual(maximum, limit);
+    // Workers run the blocks queued behind them, so the pool reuses a handful of threads instead of taking one per task.
+    XCTAssertGreaterThan(threads.count, 1);
+    XCTAssertLessThanOrEqual(threads.count, taskCount / 100);
+}
+
+@end
@@ -0,0 +1,213 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+@interface AWSFMDatabaseStoreTests : XCTestCase
+
+@property (nonatomic, strong) NSString *directory;
+
+@end
+
+@implementation AWSFMDatabaseStoreTests
+
+- (void)setUp {
+    [super setUp];
+    self.directory = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    [[NSFileManager defaultManager] createDirectoryAtPath:self.directory withIntermediateDirectories:YES attributes:nil error:nil];
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtPath:self.directory error:nil];
+    [super tearDown];
+}
+
+- (AWSFMDatabaseStore *)storeNamed:(NSString *)name {
+    AWSFMDatabaseStore *store = [AWSFMDatabaseStore storeWithPath:[self.directory stringByAppendingPathComponent:name]];
+    [store inDatabase:^(AWSFMDatabase *db) {
+        XCTAssertTrue([db executeUpdate:@"CREATE TABLE IF NOT EXISTS record (data BLOB NOT NULL, timestamp REAL NOT NULL)"]);
+    }];
+    return store;
+}
+
+- (void)insertRecords:(NSUInteger)count intoStore:(AWSFMDatabaseStore *)store {
+    NSData *data = [NSMutableData dataWithLength:512];
+    [store inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        for (NSUInteger i = 0; i < count; i++) {
+            XCTAssertTrue([db executeUpdate:@"INSERT INTO record (data, timestamp) VALUES (?, ?)", data, @(i)]);
+        }
+    }];
+}
+
+- (void)testDatabaseIsInWALMode {
+    AWSFMDatabaseStore *store = [self storeNamed:@"store"];
+    [store inReadDatabase:^(AWSFMDatabase *db) {
+        XCTAssertEqualObjects([db stringForQuery:@"PRAGMA journal_mode"], @"wal");
+    }];
+    XCTAssertTrue([[NSFileManager defaultManager] fileExistsAtPath:[store.path stringByAppendingString:@"-wal"]]);
+}
+
+- (void)testReadersDontWaitForTheWriter {
+    AWSFMDatabaseStore *store = [self storeNamed:@"store"];
+    [self insertRecords:10 intoStore:store];
+
+    dispatch_semaphore_t writing = dispatch_semaphore_create(0);
+    dispatch_semaphore_t read = dispatch_semaphore_create(0);
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        [store inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+            XCTAssertTrue([db executeUpdate:@"DELETE FROM record"]);
+            dispatch_semaphore_signal(writing);
+            // Holds the uncommitted write until the reader is done.
+            dispatch_semaphore_wait(read, DISPATCH_TIME_FOREVER);
+        }];
+    });
+    dispatch_semaphore_wait(writing, DISPATCH_TIME_FOREVER);
+
+    [store inReadDatabase:^(AWSFMDatabase *db) {
+        XCTAssertEqual([db longForQuery:@"SELECT COUNT(*) FROM record"], 10);
+        XCTAssertFalse([db executeUpdate:@"DELETE FROM record"]);
+    }];
+    dispatch_semaphore_signal(read);
+
+    [store inDatabase:^(AWSFMDatabase *db) {
+        XCTAssertEqual([db longForQuery:@"SELECT COUNT(*) FROM record"], 0);
+    }];
+    [store inReadDatabase:^(AWSFMDatabase *db) {
+        XCTAssertEqual([db longForQuery:@"SELECT COUNT(*) FROM record"], 0);
+    }];
+}
+
+- (void)testReadersAreBounded {
+    AWSFMDatabaseStore *store = [[AWSFMDatabaseStore alloc] initWithPath:[self.directory stringByAppendingPathComponent:@"store"]
+                                                  maximumNumberOfReaders:2
+                                                             busyTimeout:1];
+    __block NSUInteger active = 0;
+    __block NSUInteger maximumActive = 0;
+    dispatch_apply(20, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t iteration) {
+        [store inReadDatabase:^(AWSFMDatabase *db) {
+            XCTAssertNotNil(db);
+            @synchronized (self) {
+                active++;
+                maximumActive = MAX(maximumActive, active);
+            }
+            usleep(1000);
+            @synchronized (self) {
+                active--;
+            }
+        }];
+    });
+    XCTAssertLessThanOrEqual(maximumActive, 2);
+}
+
+- (void)testTruncatingCheckpointEmptiesTheLog {
+    AWSFMDatabaseStore *store = [self storeNamed:@"store"];
+    store.autoCheckpointPageCount = 0;
+    XCTAssertEqual(store.autoCheckpointPageCount, 0);
+    [self insertRecords:1000 intoStore:store];
+
+    NSString *logPath = [store.path stringByAppendingString:@"-wal"];
+    XCTAssertGreaterThan([[[NSFileManager defaultManager] attributesOfItemAtPath:logPath error:nil] fileSize], 512 * 1000);
+    XCTAssertGreaterThan(store.fileSize, 512 * 1000);
+
+    NSError *error = nil;
+    XCTAssertTrue([store checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:&error]);
+    XCTAssertNil(error);
+    XCTAssertEqual([[[NSFileManager defaultManager] attributesOfItemAtPath:logPath error:nil] fileSize], 0);
+    [store inReadDatabase:^(AWSFMDatabase *db) {
+        XCTAssertEqual([db longForQuery:@"SELECT COUNT(*) FROM record"], 1000);
+    }];
+}
+
+// Writes `writeCount` records while `readerCount` readers read batches the way the recorders do between saves, and
+// returns the number of batches read per second.
+- (double)batchReadsPerSecondWhileWriting:(NSUInteger)writeCount
+                                  readers:(NSUInteger)readerCount
+                                    write:(void (^)(void (^)(AWSFMDatabase *)))write
+                                     read:(void (^)(void (^)(AWSFMDatabase *)))read {
+    NSData *data = [NSMutableData dataWithLength:512];
+    __block BOOL writing = YES;
+    __block NSUInteger readCount = 0;
+
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    dispatch_group_t group = dispatch_group_create();
+    for (NSUInteger i = 0; i < readerCount; i++) {
+        dispatch_group_async(group, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+            while (YES) {
+                BOOL stillWriting = NO;
+                @synchronized (self) {
+                    stillWriting = writing;
+                }
+                if (!stillWriting) {
+                    break;
+                }
+                read(^(AWSFMDatabase *db) {
+                    [db longForQuery:@"SELECT COUNT(*) FROM record"];
+                    AWSFMResultSet *rs = [db executeQuery:@"SELECT rowid, data FROM record ORDER BY timestamp ASC LIMIT 100"];
+                    while ([rs next]) {
+                    }
+                    [rs close];
+                });
+                @synchronized (self) {
+                    readCount++;
+                }
+            }
+        });
+    }
+    for (NSUInteger i = 0; i < writeCount; i++) {
+        write(^(AWSFMDatabase *db) {
+            XCTAssertTrue([db executeUpdate:@"INSERT INTO record (data, timestamp) VALUES (?, ?)", data, @(i)]);
+        });
+    }
+    uint64_t elapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+    @synchronized (self) {
+        writing = NO;
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+
+    return readCount / ((double)elapsed / NSEC_PER_SEC);
+}
+
+- (void)testStoreReadsWhileWritingAtLeastAsOftenAsASerialQueue {
+    AWSFMDatabaseQueue *queue = [AWSFMDatabaseQueue serialDatabaseQueueWithPath:[self.directory stringByAppendingPathComponent:@"queue"]];
+    [queue inDatabase:^(AWSFMDatabase *db) {
+        XCTAssertTrue([db executeUpdate:@"CREATE TABLE record (data BLOB NOT NULL, timestamp REAL NOT NULL)"]);
+    }];
+    AWSFMDatabaseStore *store = [self storeNamed:@"store"];
+
+    double queueReadsPerSecond = [self batchReadsPerSecondWhileWriting:2000
+                                                               readers:4
+                                                                 write:^(void (^block)(AWSFMDatabase *db)) { [queue inDatabase:block]; }
+                                                                  read:^(void (^block)(AWSFMDatabase *db)) { [queue inDatabase:block]; }];
+    double storeReadsPerSecond = [self batchReadsPerSecondWhileWriting:2000
+                                                               readers:4
+                                                                 write:^(void (^block)(AWSFMDatabase *db)) { [store inDatabase:block]; }
+                                                                  read:^(void (^block)(AWSFMDatabase *db)) { [store inReadDatabase:block]; }];
+    XCTAssertGreaterThan(storeReadsPerSecond, 0);
+    // The readers of the store don't wait for the writer, where those of the queue take turns with it.
+    XCTAssertGreaterThanOrEqual(storeReadsPerSecond, queueReadsPerSecond);
+}
+
+- (void)testPerformanceOfMixedReadsAndWrites {
+    AWSFMDatabaseStore *store = [self storeNamed:@"store"];
+    [self measureBlock:^{
+        [self batchReadsPerSecondWhileWriting:500
+                                      readers:4
+                                        write:^(void (^block)(AWSFMDatabase *db)) { [store inDatabase:block]; }
+                                         read:^(void (^block)(AWSFMDatabase *db)) { [store inReadDatabase:block]; }];
+    }];
+}
+
+@end
@@ -0,0 +1,287 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+// 40 properties, like the wider service models.
+@interface AWSMTLModelTestsWideModel : AWSModel
+
+@property (nonatomic, strong) NSString *string0;
+@property (nonatomic, strong) NSString *string1;
+@property (nonatomic, strong) NSString *string2;
+@property (nonatomic, strong) NSString *string3;
+@property (nonatomic, strong) NSString *string4;
+@property (nonatomic, strong) NSString *string5;
+@property (nonatomic, strong) NSString *string6;
+@property (nonatomic, strong) NSString *string7;
+@property (nonatomic, strong) NSString *string8;
+@property (nonatomic, strong) NSString *string9;
+@property (nonatomic, strong) NSString *string10;
+@property (nonatomic, strong) NSString *string11;
+@property (nonatomic, strong) NSString *string12;
+@property (nonatomic, strong) NSString *string13;
+@property (nonatomic, strong) NSString *string14;
+@property (nonatomic, strong) NSString *string15;
+@property (nonatomic, strong) NSString *string16;
+@property (nonatomic, strong) NSString *string17;
+@property (nonatomic, strong) NSString *string18;
+@property (nonatomic, strong) NSString *string19;
+@property (nonatomic, strong) NSNumber *number0;
+@property (nonatomic, strong) NSNumber *number1;
+@property (nonatomic, strong) NSNumber *number2;
+@property (nonatomic, strong) NSNumber *number3;
+@property (nonatomic, strong) NSNumber *number4;
+@property (nonatomic, strong) NSNumber *number5;
+@property (nonatomic, strong) NSNumber *number6;
+@property (nonatomic, strong) NSNumber *number7;
+@property (nonatomic, strong) NSNumber *number8;
+@property (nonatomic, strong) NSNumber *number9;
+@property (nonatomic, strong) NSArray<NSString *> *list0;
+@property (nonatomic, strong) NSArray<NSString *> *list1;
+@property (nonatomic, strong) NSArray<NSString *> *list2;
+@property (nonatomic, strong) NSArray<NSString *> *list3;
+@property (nonatomic, strong) NSDate *date0;
+@property (nonatomic, strong) NSDate *date1;
+@property (nonatomic, assign) BOOL flag;
+@property (nonatomic, assign) NSInteger count;
+@property (nonatomic, assign) double ratio;
+@property (nonatomic, assign) uint32_t identifier;
+
+@end
+
+@implementation AWSMTLModelTestsWideModel
+
++ (NSDictionary *)JSONKeyPathsByPropertyKey {
+    NSMutableDictionary *keyPaths = [NSMutableDictionary new];
+    for (NSString *key in self.propertyKeys) {
+        keyPaths[key] = [key capitalizedString];
+    }
+    return keyPaths;
+}
+
++ (NSValueTransformer *)date0JSONTransformer {
+    return [AWSMTLValueTransformer reversibleTransformerWithForwardBlock:^id(NSNumber *number) {
+        return [NSDate dateWithTimeIntervalSince1970:[number doubleValue]];
+    } reverseBlock:^id(NSDate *date) {
+        return @([date timeIntervalSince1970]);
+    }];
+}
+
+@end
+
+// Customizes key-value coding the ways the accessor table has to respect.
+@interface AWSMTLModelTestsCustomModel : AWSMTLModel
+
+@property (nonatomic, strong) NSString *name;
+@property (nonatomic, strong) NSString *value;
+@property (nonatomic, strong, readonly) NSString *identifier;
+@property (nonatomic, assign) NSInteger count;
+
+@end
+
+@implementation AWSMTLModelTestsCustomModel
+
+- (BOOL)validateName:(id *)name error:(NSError **)error {
+    *name = [*name uppercaseString];
+    return YES;
+}
+
+// Key-value coding prefers -getValue over -value.
+- (NSString *)getValue {
+    return [_value stringByAppendingString:@"!"];
+}
+
+@end
+
+@interface AWSMTLModelTests : XCTestCase
+
+@end
+
+@implementation AWSMTLModelTests
+
+- (AWSMTLModelTestsWideModel *)wideModelWithSeed:(NSUInteger)seed {
+    AWSMTLModelTestsWideModel *model = [AWSMTLModelTestsWideModel new];
+    for (NSUInteger i = 0; i < 20; i++) {
+        // Leave some properties nil, like a sparse response.
+        if ((i + seed) % 5 == 0) continue;
+        [model setValue:[NSString stringWithFormat:@"value-%lu-%lu", (unsigned long)seed, (unsigned long)i] forKey:[NSString stringWithFormat:@"string%lu", (unsigned long)i]];
+    }
+    for (NSUInteger i = 0; i < 10; i++) {
+        [model setValue:@(seed * 100 + i) forKey:[NSString stringWithFormat:@"number%lu", (unsigned long)i]];
+    }
+    for (NSUInteger i = 0; i < 4; i++) {
+        [model setValue:@[@"a", @"b", [NSString stringWithFormat:@"%lu", (unsigned long)(seed + i)]] forKey:[NSString stringWithFormat:@"list%lu", (unsigned long)i]];
+    }
+    model.date0 = [NSDate dateWithTimeIntervalSince1970:1792411200 + seed];
+    model.flag = seed % 2 == 0;
+    model.count = -(NSInteger)seed;
+    model.ratio = seed / 3.0;
+    model.identifier = (uint32_t)(UINT32_MAX - seed);
+    return model;
+}
+
+- (NSDictionary *)keyValueCodingDictionaryValueForModel:(AWSMTLModel *)model {
+    NSMutableDictionary *dictionaryValue = [NSMutableDictionary new];
+    for (NSString *key in model.class.propertyKeys) {
+        id value = [model valueForKey:key];
+        if (value != nil) dictionaryValue[key] = value;
+    }
+    return dictionaryValue;
+}
+
+- (void)testDictionaryValueMatchesKeyValueCoding {
+    AWSMTLModelTestsWideModel *model = [self wideModelWithSeed:3];
+    XCTAssertEqual(AWSMTLModelTestsWideModel.propertyKeys.count, 40);
+    XCTAssertEqualObjects(model.dictionaryValue, [self keyValueCodingDictionaryValueForModel:model]);
+    XCTAssertNil(model.dictionaryValue[@"string2"]);
+    XCTAssertEqualObjects(model.dictionaryValue[@"flag"], @NO);
+    XCTAssertEqualObjects(model.dictionaryValue[@"identifier"], @(UINT32_MAX - 3));
+}
+
+- (void)testCopyEqualityAndHash {
+    AWSMTLModelTestsWideModel *model = [self wideModelWithSeed:4];
+    AWSMTLModelTestsWideModel *copy = [model copy];
+    XCTAssertNotEqual(copy, model);
+    XCTAssertEqualObjects(copy, model);
+    XCTAssertEqual(copy.hash, model.hash);
+    XCTAssertEqualObjects(copy.dictionaryValue, model.dictionaryValue);
+    XCTAssertEqual(copy.identifier, UINT32_MAX - 4);
+    XCTAssertEqual(copy.count, -4);
+
+    for (NSString *key in AWSMTLModelTestsWideModel.propertyKeys) {
+        AWSMTLModelTestsWideModel *changed = [model copy];
+        id value = [model valueForKey:key];
+        if ([value isKindOfClass:[NSNumber class]]) {
+            [changed setValue:@([value unsignedIntValue] ^ 1) forKey:key];
+        } else if (value == nil) {
+            [changed setValue:@"set" forKey:key];
+        } else {
+            [changed setValue:nil forKey:key];
+        }
+        XCTAssertNotEqualObjects(changed, model, @"%@", key);
+    }
+
+    XCTAssertNotEqualObjects(model, [self wideModelWithSeed:5]);
+    XCTAssertNotEqualObjects(model, @"model");
+}
+
+- (void)testScalarEqualityMatchesKeyValueCoding {
+    AWSMTLModelTestsWideModel *model = [self wideModelWithSeed:1];
+    AWSMTLModelTestsWideModel *copy = [model copy];
+
+    for (NSNumber *ratio in @[@0.0, @(-0.0), @(NAN), @(INFINITY)]) {
+        model.ratio = 0.0;
+        copy.ratio = ratio.doubleValue;
+        BOOL valuesEqual = [[model valueForKey:@"ratio"] isEqual:[copy valueForKey:@"ratio"]];
+        XCTAssertEqual([model isEqual:copy], valuesEqual, @"%@", ratio);
+
+        model.ratio = ratio.doubleValue;
+        valuesEqual = [[model valueForKey:@"ratio"] isEqual:[copy valueForKey:@"ratio"]];
+        XCTAssertEqual([model isEqual:copy], valuesEqual, @"%@", ratio);
+    }
+}
+
+- (void)testKeyValueCodingCustomizationsAreRespected {
+    NSError *error = nil;
+    AWSMTLModelTestsCustomModel *model = [AWSMTLModelTestsCustomModel modelWithDictionary:@{@"name": @"name",
+                                                                                           @"value": @"value",
+                                                                                           @"identifier": @"identifier",
+                                                                                           @"count": @"42"}
+                                                                                    error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(model.name, @"NAME");
+    XCTAssertEqualObjects(model.value, @"value");
+    XCTAssertEqualObjects(model.identifier, @"identifier");
+    XCTAssertEqual(model.count, 42);
+
+    XCTAssertEqualObjects(model.dictionaryValue, [model dictionaryWithValuesForKeys:model.class.propertyKeys.allObjects]);
+    XCTAssertEqualObjects(model.dictionaryValue[@"value"], @"value!");
+
+    AWSMTLModelTestsCustomModel *copy = [model copy];
+    XCTAssertEqualObjects(copy.value, @"value!");
+    XCTAssertNotEqualObjects(copy, model);
+    XCTAssertEqualObjects(copy.identifier, @"identifier");
+    XCTAssertTrue([model validate:&error]);
+}
+
+- (void)testCodingAndJSONRoundTrips {
+    AWSMTLModelTestsWideModel *model = [self wideModelWithSeed:6];
+
+    NSDictionary *JSONDictionary = [AWSMTLJSONAdapter JSONDictionaryFromModel:model];
+    XCTAssertEqualObjects(JSONDictionary[@"Date0"], @(1792411206));
+    XCTAssertEqualObjects(JSONDictionary[@"Number3"], @603);
+    NSError *error = nil;
+    XCTAssertEqualObjects([AWSMTLJSONAdapter modelOfClass:[AWSMTLModelTestsWideModel class] fromJSONDictionary:JSONDictionary error:&error], model);
+    XCTAssertNil(error);
+
+    if (@available(iOS 11.0, *)) {
+        NSData *data = [NSKeyedArchiver archivedDataWithRootObject:model requiringSecureCoding:NO error:&error];
+        XCTAssertNil(error);
+        NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingFromData:data error:&error];
+        unarchiver.requiresSecureCoding = NO;
+        XCTAssertEqualObjects([unarchiver decodeObjectForKey:NSKeyedArchiveRootObjectKey], model);
+    }
+}
+
+#pragma mark - Benchmarks
+
+- (NSArray<AWSMTLModelTestsWideModel *> *)wideModels {
+    NSMutableArray<AWSMTLModelTestsWideModel *> *models = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [models addObject:[self wideModelWithSeed:i]];
+    }
+    return models;
+}
+
+- (void)testWideModelCopyPerformance {
+    NSArray<AWSMTLModelTestsWideModel *> *models = [self wideModels];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            for (AWSMTLModelTestsWideModel *model in models) {
+                XCTAssertNotNil([model copy]);
+            }
+        }];
+    }
+}
+
+- (void)testWideModelEqualityPerformance {
+    NSArray<AWSMTLModelTestsWideModel *> *models = [self wideModels];
+    NSArray<AWSMTLModelTestsWideModel *> *copies = [[NSArray alloc] initWithArray:models copyItems:YES];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new]] block:^{
+            for (NSUInteger i = 0; i < 10; i++) {
+                XCTAssertEqualObjects(copies, models);
+            }
+        }];
+    }
+}
+
+- (void)testWideModelHashPerformance {
+    NSArray<AWSMTLModelTestsWideModel *> *models = [self wideModels];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new]] block:^{
+            NSUInteger hash = 0;
+            for (NSUInteger i = 0; i < 10; i++) {
+                for (AWSMTLModelTestsWideModel *model in models) {
+                    hash ^= model.hash;
+                }
+            }
+            XCTAssertEqual(hash, 0);
+        }];
+    }
+}
+
+@end
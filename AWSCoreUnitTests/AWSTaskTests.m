@@ -0,0 +1,230 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <stdatomic.h>
+#import <AWSCore/AWSCore.h>
+
+static NSUInteger const AWSTaskTestsBenchmarkCount = 1000000;
+
+@interface AWSTaskTests : XCTestCase
+
+@end
+
+@implementation AWSTaskTests
+
+- (void)testContinuationsRunInRegistrationOrder {
+    AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+    NSMutableArray<NSNumber *> *order = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 10; i++) {
+        [source.task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *task) {
+            [order addObject:@(i)];
+            return nil;
+        }];
+    }
+    XCTAssertEqual(order.count, 0);
+
+    source.result = @"result";
+
+    XCTAssertEqualObjects(order, (@[@0, @1, @2, @3, @4, @5, @6, @7, @8, @9]));
+}
+
+- (void)testContinuationOfCompletedTaskRunsImmediately {
+    AWSTask *task = [AWSTask taskWithResult:@"result"];
+    __block id result = nil;
+    [task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *t) {
+        result = t.result;
+        return nil;
+    }];
+    XCTAssertEqualObjects(result, @"result");
+}
+
+- (void)testContinuationRegisteredWhileCompletingRuns {
+    AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+    __block BOOL ranInner = NO;
+    [source.task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *task) {
+        [task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *t) {
+            ranInner = YES;
+            return nil;
+        }];
+        return nil;
+    }];
+    source.result = nil;
+    XCTAssertTrue(ranInner);
+}
+
+- (void)testOutcomeIsSetOnce {
+    AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+    XCTAssertFalse(source.task.completed);
+    XCTAssertNil(source.task.result);
+
+    XCTAssertTrue([source trySetResult:@"first"]);
+    XCTAssertFalse([source trySetResult:@"second"]);
+    XCTAssertFalse([source trySetError:[NSError errorWithDomain:@"AWSTaskTests" code:1 userInfo:nil]]);
+    XCTAssertFalse([source trySetCancelled]);
+
+    XCTAssertTrue(source.task.completed);
+    XCTAssertEqualObjects(source.task.result, @"first");
+    XCTAssertNil(source.task.error);
+    XCTAssertFalse(source.task.faulted);
+    XCTAssertFalse(source.task.cancelled);
+}
+
+- (void)testErrorAndCancellation {
+    NSError *error = [NSError errorWithDomain:@"AWSTaskTests" code:1 userInfo:nil];
+    AWSTask *faulted = [AWSTask taskWithError:error];
+    XCTAssertTrue(faulted.completed);
+    XCTAssertTrue(faulted.faulted);
+    XCTAssertFalse(faulted.cancelled);
+    XCTAssertEqualObjects(faulted.error, error);
+
+    AWSTask *cancelled = [AWSTask cancelledTask];
+    XCTAssertTrue(cancelled.completed);
+    XCTAssertTrue(cancelled.cancelled);
+    XCTAssertFalse(cancelled.faulted);
+    XCTAssertNil(cancelled.error);
+
+    XCTAssertTrue([[cancelled description] containsString:@"cancelled = YES"]);
+    XCTAssertTrue([[[AWSTask taskWithResult:@"result"] description] containsString:@"result = result"]);
+}
+
+- (void)testConcurrentCompletionRunsEachContinuationOnce {
+    for (NSUInteger round = 0; round < 100; round++) {
+        AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+        __block _Atomic(int32_t) runs = 0;
+        __block _Atomic(int32_t) wins = 0;
+        dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+            if (i % 2 == 0) {
+                [source.task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *task) {
+                    XCTAssertTrue(task.completed);
+                    atomic_fetch_add(&runs, 1);
+                    return nil;
+                }];
+            } else if ([source trySetResult:@(i)]) {
+                atomic_fetch_add(&wins, 1);
+            }
+        });
+        XCTAssertEqual(wins, 1);
+        XCTAssertEqual(runs, 32);
+    }
+}
+
+- (void)testWaitUntilFinished {
+    AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, 50 * NSEC_PER_MSEC), dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^{
+        source.result = @"result";
+    });
+
+    [source.task waitUntilFinished];
+
+    XCTAssertEqualObjects(source.task.result, @"result");
+    // Returns at once for a completed task.
+    [source.task waitUntilFinished];
+}
+
+- (void)testPendingContinuationsAreReleasedWithTheTask {
+    __weak id weakObject = nil;
+    @autoreleasepool {
+        NSObject *object = [NSObject new];
+        weakObject = object;
+        AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+        for (NSUInteger i = 0; i < 3; i++) {
+            [source.task continueWithBlock:^id(AWSTask *task) {
+                return object;
+            }];
+        }
+        object = nil;
+        source = nil;
+    }
+    XCTAssertNil(weakObject);
+}
+
+- (void)testCompletionOfAllTasksCompletesOnce {
+    NSMutableArray<AWSTaskCompletionSource *> *sources = [NSMutableArray new];
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+        [sources addObject:source];
+        [tasks addObject:source.task];
+    }
+    AWSTask *all = [AWSTask taskForCompletionOfAllTasksWithResults:tasks];
+
+    dispatch_apply(sources.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+        sources[i].result = @(i);
+    });
+    [all waitUntilFinished];
+
+    XCTAssertNil(all.error);
+    XCTAssertEqual([all.result count], 1000);
+    XCTAssertEqualObjects([all.result lastObject], @999);
+}
+
+#pragma mark - Benchmarks
+
+- (void)testPerformanceOfContinuationChain {
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+            AWSTask *task = source.task;
+            for (NSUInteger i = 0; i < AWSTaskTestsBenchmarkCount; i++) {
+                task = [task continueWithBlock:^id(AWSTask *t) {
+                    return t.result;
+                }];
+            }
+            source.result = @"result";
+            [task waitUntilFinished];
+            XCTAssertEqualObjects(task.result, @"result");
+        }];
+    }
+}
+
+- (void)testPerformanceOfContinuationsOnOneTask {
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+            __block NSUInteger runs = 0;
+            for (NSUInteger i = 0; i < AWSTaskTestsBenchmarkCount; i++) {
+                [source.task continueWithExecutor:[AWSExecutor immediateExecutor] withBlock:^id(AWSTask *t) {
+                    runs++;
+                    return nil;
+                }];
+            }
+            source.result = nil;
+            XCTAssertEqual(runs, AWSTaskTestsBenchmarkCount);
+        }];
+    }
+}
+
+- (void)testPerformanceOfCompletionOfAllTasks {
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new]] block:^{
+            NSMutableArray<AWSTaskCompletionSource *> *sources = [NSMutableArray new];
+            NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+            for (NSUInteger i = 0; i < 100000; i++) {
+                AWSTaskCompletionSource *source = [AWSTaskCompletionSource taskCompletionSource];
+                [sources addObject:source];
+                [tasks addObject:source.task];
+            }
+            AWSTask *all = [AWSTask taskForCompletionOfAllTasks:tasks];
+            dispatch_apply(sources.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+                sources[i].result = nil;
+            });
+            [all waitUntilFinished];
+            XCTAssertTrue(all.completed);
+        }];
+    }
+}
+
+@end
@@ -0,0 +1,110 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+@interface AWSXMLParser()
+
++ (NSString *)findKeyNameByXMLName:(NSString *)xmlName rules:(NSDictionary *)rules;
+
+@end
+
+@interface AWSJSONParser()
+
++ (NSString *)findMemberName:(NSString*)locationName structureRules:(NSDictionary *)structureRules;
+
+@end
+
+@interface AWSJSONDictionaryTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *shapes;
+@property (nonatomic, strong) NSDictionary *outputRule;
+
+@end
+
+@implementation AWSJSONDictionaryTests
+
+- (void)setUp {
+    [super setUp];
+    self.shapes = @{@"ListOutput": @{@"type": @"structure",
+                                     @"members": @{@"Name": @{@"shape": @"String"},
+                                                   @"Items": @{@"shape": @"ItemList", @"locationName": @"Item"},
+                                                   @"Tags": @{@"shape": @"TagList", @"locationName": @"TagSet"},
+                                                   @"Token": @{@"shape": @"String", @"locationName": @"NextToken"}}},
+                    @"ItemList": @{@"type": @"list", @"member": @{@"shape": @"Item"}, @"flattened": @YES},
+                    @"TagList": @{@"type": @"list", @"member": @{@"shape": @"Tag", @"locationName": @"Tag"}},
+                    @"Item": @{@"type": @"structure", @"members": @{@"Key": @{@"shape": @"String"}}},
+                    @"Tag": @{@"type": @"structure", @"members": @{@"Key": @{@"shape": @"String"}}},
+                    @"String": @{@"type": @"string"}};
+    self.outputRule = @{@"shape": @"ListOutput"};
+}
+
+- (void)testRulesAreSharedPerOperation {
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:self.shapes];
+
+    XCTAssertTrue(rules == [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:self.shapes]);
+    XCTAssertFalse(rules == [AWSJSONDictionary rulesWithDictionary:[self.outputRule mutableCopy] JSONDefinitionRule:self.shapes]);
+    XCTAssertFalse(rules == [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:[self.shapes mutableCopy]]);
+    XCTAssertNotNil([AWSJSONDictionary rulesWithDictionary:nil JSONDefinitionRule:self.shapes]);
+}
+
+- (void)testLookupsAreResolvedOnce {
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:self.shapes];
+
+    XCTAssertEqualObjects(rules[@"type"], @"structure");
+    XCTAssertTrue(rules[@"members"] == rules[@"members"]);
+    XCTAssertTrue(rules[@"members"][@"Items"] == rules[@"members"][@"Items"]);
+    XCTAssertEqualObjects(rules[@"members"][@"Items"][@"member"][@"type"], @"structure");
+    XCTAssertNil(rules[@"missing"]);
+    XCTAssertNil(rules[@"missing"]);
+    XCTAssertNil([rules objectForKey:nil]);
+    XCTAssertEqual(rules.count, 1);
+
+    NSDictionary *members = rules[@"members"];
+    NSMutableArray *results = [NSMutableArray new];
+    dispatch_apply(64, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        id memberRules = members[@"Tags"];
+        @synchronized (results) {
+            [results addObject:memberRules];
+        }
+    });
+    for (id memberRules in results) {
+        XCTAssertTrue(memberRules == results.firstObject);
+    }
+}
+
+- (void)testXMLNameIndexMatchesLinearSearch {
+    AWSJSONDictionary *members = [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:self.shapes][@"members"];
+    NSDictionary *plainMembers = [NSDictionary dictionaryWithDictionary:members];
+
+    for (NSString *xmlName in @[@"Name", @"Items", @"Item", @"member", @"Tags", @"TagSet", @"Tag", @"Token", @"NextToken", @"Unknown"]) {
+        XCTAssertEqualObjects([AWSXMLParser findKeyNameByXMLName:xmlName rules:members],
+                              [AWSXMLParser findKeyNameByXMLName:xmlName rules:plainMembers], @"%@", xmlName);
+    }
+    XCTAssertEqualObjects([AWSXMLParser findKeyNameByXMLName:@"Item" rules:members], @"Items");
+    XCTAssertEqualObjects([AWSXMLParser findKeyNameByXMLName:@"TagSet" rules:members], @"Tags");
+    XCTAssertNil([AWSXMLParser findKeyNameByXMLName:@"Tag" rules:members]);
+}
+
+- (void)testLocationNameIndex {
+    AWSJSONDictionary *rules = [AWSJSONDictionary rulesWithDictionary:self.outputRule JSONDefinitionRule:self.shapes];
+
+    XCTAssertEqualObjects([AWSJSONParser findMemberName:@"NextToken" structureRules:rules], @"Token");
+    XCTAssertEqualObjects([AWSJSONParser findMemberName:@"Name" structureRules:rules], @"Name");
+    XCTAssertEqualObjects([AWSJSONParser findMemberName:@"Unknown" structureRules:rules], @"Unknown");
+}
+
+@end
@@ -0,0 +1,143 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+@interface AWSQueryStringRequestSerializer()
+
+- (void)processParameters:(NSDictionary *)parameters queryString:(NSMutableString *)queryString;
+
+@end
+
+@interface AWSQueryFormEncodingTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+
+@end
+
+@implementation AWSQueryFormEncodingTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = @{@"metadata": @{@"protocol": @"query", @"apiVersion": @"2014-01-01"},
+                        @"operations": @{@"OperationName": @{@"name": @"OperationName",
+                                                             @"input": @{@"shape": @"InputShape"}}},
+                        @"shapes": @{@"InputShape": @{@"type": @"structure",
+                                                      @"members": @{@"Foo": @{@"shape": @"String"},
+                                                                    @"Blob": @{@"shape": @"Blob"},
+                                                                    @"Items": @{@"shape": @"StringList"},
+                                                                    @"Renamed": @{@"shape": @"String", @"locationName": @"Action"}}},
+                                     @"StringList": @{@"type": @"list", @"member": @{@"shape": @"String"}},
+                                     @"Blob": @{@"type": @"blob"},
+                                     @"String": @{@"type": @"string"}}};
+}
+
+- (NSCountedSet *)pairsForData:(NSData *)data {
+    NSString *body = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    return [NSCountedSet setWithArray:[body componentsSeparatedByString:@"&"]];
+}
+
+- (NSCountedSet *)legacyPairsForParams:(NSDictionary *)params
+                            definition:(NSDictionary *)definition
+                              builder:(Class)builder {
+    NSError *error = nil;
+    NSDictionary *formattedParams = [builder buildFormattedParams:params
+                                                       actionName:@"OperationName"
+                                            serviceDefinitionRule:definition
+                                                            error:&error];
+    XCTAssertNil(error);
+    NSMutableString *queryString = [NSMutableString new];
+    [[AWSQueryStringRequestSerializer new] processParameters:formattedParams queryString:queryString];
+    return [NSCountedSet setWithArray:[queryString componentsSeparatedByString:@"&"]];
+}
+
+- (void)assertFormDataMatchesDictionaryForResource:(NSString *)resource builder:(Class)builder {
+    NSString *filePath = [[NSBundle bundleForClass:[self class]] pathForResource:resource ofType:@"json"];
+    NSArray *testPackages = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfFile:filePath]
+                                                            options:NSJSONReadingMutableContainers
+                                                              error:nil];
+    XCTAssertGreaterThan(testPackages.count, 0);
+
+    for (NSMutableDictionary *testPackage in testPackages) {
+        for (NSDictionary *testCase in testPackage[@"cases"]) {
+            NSMutableDictionary *definition = [testPackage mutableCopy];
+            definition[@"operations"] = @{@"OperationName": testCase[@"given"]};
+
+            NSData *data = [builder formDataForParams:testCase[@"params"]
+                                           actionName:@"OperationName"
+                                serviceDefinitionRule:definition];
+            XCTAssertNotNil(data, @"%@: %@", resource, testPackage[@"description"]);
+            XCTAssertEqualObjects([self pairsForData:data],
+                                  [self legacyPairsForParams:testCase[@"params"] definition:definition builder:builder],
+                                  @"%@: %@", resource, testPackage[@"description"]);
+        }
+    }
+}
+
+- (void)testQueryFormDataMatchesDictionary {
+    [self assertFormDataMatchesDictionaryForResource:@"query-input" builder:[AWSQueryParamBuilder class]];
+}
+
+- (void)testEC2FormDataMatchesDictionary {
+    [self assertFormDataMatchesDictionaryForResource:@"ec2-input" builder:[AWSEC2ParamBuilder class]];
+}
+
+- (void)testPercentEncoding {
+    NSArray<NSString *> *values = @[@"a b&c=d/e?f#g[h]",
+                                    @"-._~!*'();:@+$,",
+                                    @"café \U0001F600",
+                                    @"100%25",
+                                    @"50%",
+                                    @"<\"\\^`{|}>"];
+    for (NSString *value in values) {
+        NSDictionary *params = @{@"Foo": value};
+        NSData *data = [AWSQueryParamBuilder formDataForParams:params
+                                                    actionName:@"OperationName"
+                                         serviceDefinitionRule:self.definition];
+        NSString *expected = [NSString stringWithFormat:@"Action=OperationName&Version=2014-01-01&Foo=%@", [value aws_stringWithURLEncoding]];
+        XCTAssertEqualObjects([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding], expected, @"%@", value);
+        XCTAssertEqualObjects([self pairsForData:data],
+                              [self legacyPairsForParams:params definition:self.definition builder:[AWSQueryParamBuilder class]]);
+    }
+}
+
+- (void)testValuesLeftToDictionary {
+    NSArray<NSDictionary *> *paramsList = @[@{@"Foo": [NSNull null]},
+                                            @{@"Foo": @{@"Nested": @"value"}},
+                                            @{@"Items": @"not a list"},
+                                            @{@"Renamed": @"collides with Action"}];
+    for (NSDictionary *params in paramsList) {
+        XCTAssertNil([AWSQueryParamBuilder formDataForParams:params
+                                                  actionName:@"OperationName"
+                                       serviceDefinitionRule:self.definition], @"%@", params);
+    }
+
+    NSDictionary *params = @{@"Blob": @42};
+    XCTAssertNil([AWSQueryParamBuilder formDataForParams:params
+                                              actionName:@"OperationName"
+                                   serviceDefinitionRule:self.definition]);
+
+    // The serializer still reports the error from the dictionary path.
+    AWSQueryStringRequestSerializer *serializer = [[AWSQueryStringRequestSerializer alloc] initWithJSONDefinition:self.definition
+                                                                                                       actionName:@"OperationName"];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://example.com/"]];
+    request.HTTPMethod = @"POST";
+    AWSTask *task = [serializer serializeRequest:request headers:@{} parameters:params];
+    XCTAssertEqualObjects(task.error.domain, AWSQueryParamBuilderErrorDomain);
+    XCTAssertEqual(task.error.code, AWSQueryParamBuilderInvalidParameter);
+}
+
+@end
@@ -0,0 +1,97 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+@interface AWSServiceDefinitionTests : XCTestCase
+
+@end
+
+@implementation AWSServiceDefinitionTests
+
+- (NSString *)definitionStringWithShapeCount:(NSUInteger)shapeCount {
+    NSMutableString *shapes = [NSMutableString new];
+    for (NSUInteger i = 0; i < shapeCount; i++) {
+        [shapes appendFormat:@"%@\n    \"Shape%lu\":{\"type\":\"structure\",\"members\":{\"Name\":{\"shape\":\"String\",\"locationName\":\"name\"}},\"required\":[\"Name\"]}",
+         i == 0 ? @"" : @",", (unsigned long)i];
+    }
+    return [NSString stringWithFormat:@"{\n"
+            "  \"version\":\"2.0\",\n"
+            "  \"metadata\" : {\"apiVersion\":\"2016-11-15\", \"jsonVersion\":1.1, \"resultWrapped\":true, \"checksum\":null},\n"
+            "  \"operations\":{\"Describe\":{\"name\":\"Describe\",\"input\":{\"shape\":\"Shape0\"},\"errors\":[]}},\n"
+            "  \"shapes\":{%@\n  },\n"
+            "  \"documentation\":\"Braces } and ] and \\\"quotes\\\" inside strings\",\n"
+            "  \"esc\\u0061ped\":[1, -2.5e3, [true, false], {}]\n"
+            "}\n", shapes];
+}
+
+- (void)testDefinitionMatchesJSONSerialization {
+    // 200 shapes are enough for `shapes` to be indexed rather than decoded.
+    NSString *definitionString = [self definitionStringWithShapeCount:200];
+    NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:[definitionString dataUsingEncoding:NSUTF8StringEncoding]
+                                                             options:kNilOptions
+                                                               error:nil];
+    NSError *error = nil;
+    NSDictionary *definition = [AWSServiceDefinition definitionWithJSONString:definitionString error:&error];
+
+    XCTAssertNil(error);
+    XCTAssertTrue([definition isKindOfClass:[AWSServiceDefinition class]]);
+    XCTAssertTrue([definition[@"shapes"] isKindOfClass:[AWSServiceDefinition class]]);
+    XCTAssertFalse([definition[@"operations"] isKindOfClass:[AWSServiceDefinition class]]);
+    XCTAssertEqual(definition.count, expected.count);
+    XCTAssertEqual([definition[@"shapes"] count], 200);
+    XCTAssertEqualObjects(definition[@"escaped"], (@[@1, @(-2500), @[@YES, @NO], @{}]));
+    XCTAssertEqualObjects(definition[@"metadata"][@"checksum"], [NSNull null]);
+    XCTAssertNil(definition[@"missing"]);
+    XCTAssertEqualObjects(definition, expected);
+}
+
+- (void)testMembersAreDecodedOnce {
+    NSDictionary *definition = [AWSServiceDefinition definitionWithJSONString:[self definitionStringWithShapeCount:200] error:nil];
+
+    XCTAssertTrue(definition[@"shapes"] == definition[@"shapes"]);
+    XCTAssertTrue(definition[@"shapes"][@"Shape7"] == definition[@"shapes"][@"Shape7"]);
+    XCTAssertTrue([definition copy] == definition);
+
+    NSDictionary *shapes = definition[@"shapes"];
+    NSMutableArray *results = [NSMutableArray new];
+    dispatch_apply(64, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        id shape = shapes[@"Shape150"];
+        @synchronized (results) {
+            [results addObject:shape];
+        }
+    });
+    for (id shape in results) {
+        XCTAssertTrue(shape == results.firstObject);
+    }
+}
+
+- (void)testNonASCIIDefinition {
+    NSString *definitionString = @"{\"documentation\":\"Zürich – 東京\",\"shapes\":{}}";
+    NSDictionary *definition = [AWSServiceDefinition definitionWithJSONString:definitionString error:nil];
+
+    XCTAssertEqualObjects(definition[@"documentation"], @"Zürich – 東京");
+    XCTAssertEqualObjects(definition[@"shapes"], @{});
+}
+
+- (void)testMalformedDefinition {
+    for (NSString *definitionString in @[@"", @"[]", @"{\"version\":\"2.0\"", @"{\"version\" \"2.0\"}", @"{\"a\":1} trailing"]) {
+        NSError *error = nil;
+        XCTAssertNil([AWSServiceDefinition definitionWithJSONString:definitionString error:&error], @"%@", definitionString);
+    }
+}
+
+@end
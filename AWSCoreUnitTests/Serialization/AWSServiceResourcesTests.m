@@ -0,0 +1,92 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+
+// What the `AWS*Resources` class of every service implements.
+@protocol AWSServiceResourcesTestsResources <NSObject>
+
+- (NSDictionary *)JSONObject;
+- (NSString *)definitionString;
+
+@end
+
+@interface AWSServiceResourcesTests : XCTestCase
+
+@end
+
+@implementation AWSServiceResourcesTests
+
+// The services with the largest definitions, each with an operation whose input shape is looked up.
++ (NSDictionary<NSString *, NSString *> *)operationNamesByResourcesClassName {
+    return @{
+        @"AWSDynamoDBResources" : @"GetItem",
+        @"AWSEC2Resources" : @"DescribeInstances",
+        @"AWSIoTResources" : @"ListThings",
+        @"AWSS3Resources" : @"GetObject",
+    };
+}
+
+- (id<AWSServiceResourcesTestsResources>)resourcesOfClassNamed:(NSString *)className {
+    Class resourcesClass = NSClassFromString(className);
+    XCTAssertNotNil(resourcesClass, @"%@ isn't linked.", className);
+    return [resourcesClass new];
+}
+
+- (void)testDefinitionsMatchJSONSerialization {
+    for (NSString *className in [[self class] operationNamesByResourcesClassName]) {
+        id<AWSServiceResourcesTestsResources> resources = [self resourcesOfClassNamed:className];
+        NSDictionary *expected = [NSJSONSerialization JSONObjectWithData:[[resources definitionString] dataUsingEncoding:NSUTF8StringEncoding]
+                                                                 options:kNilOptions
+                                                                   error:nil];
+        XCTAssertNotNil(expected, @"%@", className);
+        XCTAssertEqualObjects([resources JSONObject], expected, @"%@", className);
+    }
+}
+
+- (void)testFirstOperationLookupPerformance {
+    NSDictionary<NSString *, NSString *> *operationNames = [[self class] operationNamesByResourcesClassName];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            for (NSString *className in operationNames) {
+                NSDictionary *definition = [[self resourcesOfClassNamed:className] JSONObject];
+                NSDictionary *operation = definition[@"operations"][operationNames[className]];
+                XCTAssertNotNil(definition[@"shapes"][operation[@"input"][@"shape"]], @"%@", className);
+            }
+        }];
+    }
+}
+
+- (void)testFullJSONParsePerformance {
+    NSDictionary<NSString *, NSString *> *operationNames = [[self class] operationNamesByResourcesClassName];
+    NSMutableDictionary<NSString *, NSString *> *definitionStrings = [NSMutableDictionary new];
+    for (NSString *className in operationNames) {
+        definitionStrings[className] = [[self resourcesOfClassNamed:className] definitionString];
+    }
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            for (NSString *className in operationNames) {
+                NSDictionary *definition = [NSJSONSerialization JSONObjectWithData:[definitionStrings[className] dataUsingEncoding:NSUTF8StringEncoding]
+                                                                           options:kNilOptions
+                                                                             error:nil];
+                NSDictionary *operation = definition[@"operations"][operationNames[className]];
+                XCTAssertNotNil(definition[@"shapes"][operation[@"input"][@"shape"]], @"%@", className);
+            }
+        }];
+    }
+}
+
+@end
@@ -0,0 +1,192 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+@interface AWSXMLParser()
+
+@property (nonatomic, assign) BOOL usesStreamDecoder;
+
+@end
+
+@interface AWSXMLStreamDecoderTests : XCTestCase
+
+@property (nonatomic, strong) AWSXMLParser *treeParser;
+@property (nonatomic, strong) NSDictionary *countsDefinition;
+
+@end
+
+@implementation AWSXMLStreamDecoderTests
+
+- (void)setUp {
+    [super setUp];
+    self.treeParser = [AWSXMLParser new];
+    self.treeParser.usesStreamDecoder = NO;
+    self.countsDefinition = @{@"metadata": @{@"protocol": @"query"},
+                              @"operations": @{@"OperationName": @{@"name": @"OperationName",
+                                                                   @"output": @{@"shape": @"OutputShape"}}},
+                              @"shapes": @{@"OutputShape": @{@"type": @"structure",
+                                                             @"members": @{@"Name": @{@"shape": @"String"},
+                                                                           @"Counts": @{@"shape": @"IntegerList"}}},
+                                           @"IntegerList": @{@"type": @"list", @"member": @{@"shape": @"Integer"}},
+                                           @"Integer": @{@"type": @"integer"},
+                                           @"String": @{@"type": @"string"}}};
+}
+
+- (NSData *)dataWithString:(NSString *)string {
+    return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)assertDecoderMatchesDictionaryTreeForResource:(NSString *)resource {
+    NSString *filePath = [[NSBundle bundleForClass:[self class]] pathForResource:resource ofType:@"json"];
+    NSArray *testPackages = [NSJSONSerialization JSONObjectWithData:[NSData dataWithContentsOfFile:filePath]
+                                                            options:NSJSONReadingMutableContainers
+                                                              error:nil];
+    XCTAssertGreaterThan(testPackages.count, 0);
+
+    for (NSMutableDictionary *testPackage in testPackages) {
+        for (NSDictionary *testCase in testPackage[@"cases"]) {
+            NSMutableDictionary *definition = [testPackage mutableCopy];
+            definition[@"operations"] = @{@"OperationName": testCase[@"given"]};
+            NSData *data = [self dataWithString:testCase[@"response"][@"body"]];
+
+            AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"OperationName"
+                                                                serviceDefinitionRule:definition];
+            NSDictionary *outputRules = [AWSJSONDictionary rulesWithDictionary:testCase[@"given"][@"output"]
+                                                            JSONDefinitionRule:definition[@"shapes"]];
+            NSString *payloadName = outputRules[@"payload"];
+            if (payloadName && outputRules[@"members"][payloadName][@"streaming"]) {
+                XCTAssertNil(decoder, @"%@: %@", resource, testPackage[@"description"]);
+                continue;
+            }
+
+            NSError *treeError = nil;
+            NSDictionary *expected = [self.treeParser dictionaryForXMLData:data
+                                                                actionName:@"OperationName"
+                                                     serviceDefinitionRule:definition
+                                                                     error:&treeError];
+            XCTAssertNil(treeError);
+
+            NSError *error = nil;
+            NSDictionary *result = [decoder dictionaryForXMLData:data error:&error];
+            XCTAssertNil(error, @"%@: %@", resource, testPackage[@"description"]);
+            XCTAssertEqualObjects(result, expected, @"%@: %@", resource, testPackage[@"description"]);
+
+            NSDictionary *streamResult = [decoder dictionaryForXMLStream:[NSInputStream inputStreamWithData:data] error:nil];
+            XCTAssertEqualObjects(streamResult, expected, @"%@: %@", resource, testPackage[@"description"]);
+        }
+    }
+}
+
+- (void)testQueryResponsesMatchDictionaryTree {
+    [self assertDecoderMatchesDictionaryTreeForResource:@"query-output"];
+}
+
+- (void)testRestXMLResponsesMatchDictionaryTree {
+    [self assertDecoderMatchesDictionaryTreeForResource:@"rest-xml-output"];
+}
+
+- (void)testEC2ResponsesMatchDictionaryTree {
+    [self assertDecoderMatchesDictionaryTreeForResource:@"ec2-output"];
+}
+
+- (void)testErrorResponsesAreLeftToDictionaryTree {
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"OperationName"
+                                                        serviceDefinitionRule:self.countsDefinition];
+    NSArray<NSString *> *bodies = @[@"<Error><Code>NoSuchBucket</Code><Message>The specified bucket does not exist</Message></Error>",
+                                    @"<Response><Errors><Error><Code>InvalidInstanceID.NotFound</Code></Error></Errors><RequestID>id</RequestID></Response>",
+                                    @"<ErrorResponse><Error><Type>Sender</Type><Code>Throttling</Code></Error><RequestId>id</RequestId></ErrorResponse>"];
+    for (NSString *body in bodies) {
+        NSData *data = [self dataWithString:body];
+        NSError *error = nil;
+        XCTAssertNil([decoder dictionaryForXMLData:data error:&error], @"%@", body);
+        XCTAssertNotNil(error);
+
+        NSDictionary *expected = [self.treeParser dictionaryForXMLData:data
+                                                            actionName:@"OperationName"
+                                                 serviceDefinitionRule:self.countsDefinition
+                                                                 error:&error];
+        NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                        actionName:@"OperationName"
+                                                             serviceDefinitionRule:self.countsDefinition
+                                                                             error:&error];
+        XCTAssertNotNil(result);
+        XCTAssertEqualObjects(result, expected, @"%@", body);
+    }
+}
+
+- (void)testSingleConvertedListItemIsLeftToDictionaryTree {
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"OperationName"
+                                                        serviceDefinitionRule:self.countsDefinition];
+
+    NSData *data = [self dataWithString:@"<OperationNameResponse><OperationNameResult><Counts><member>5</member><member>6</member></Counts></OperationNameResult></OperationNameResponse>"];
+    XCTAssertEqualObjects([decoder dictionaryForXMLData:data error:nil], (@{@"Counts": @[@5, @6]}));
+
+    // The dictionary tree returns the text of a single item unconverted.
+    data = [self dataWithString:@"<OperationNameResponse><OperationNameResult><Counts><member>5</member></Counts></OperationNameResult></OperationNameResponse>"];
+    XCTAssertNil([decoder dictionaryForXMLData:data error:nil]);
+    NSError *error = nil;
+    NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                    actionName:@"OperationName"
+                                                         serviceDefinitionRule:self.countsDefinition
+                                                                         error:&error];
+    XCTAssertEqualObjects(result, (@{@"Counts": @[@"5"]}));
+}
+
+- (void)testWhitespaceAndIgnoredElements {
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"OperationName"
+                                                        serviceDefinitionRule:self.countsDefinition];
+    NSData *data = [self dataWithString:@"<OperationNameResponse>\n"
+                    "  <OperationNameResult>\n"
+                    "    <Name><![CDATA[a < b]]> &amp; c</Name>\n"
+                    "    <Unknown><Nested>1</Nested></Unknown>\n"
+                    "    <Counts>\n      <member>1</member>\n      <member>2</member>\n    </Counts>\n"
+                    "  </OperationNameResult>\n"
+                    "  <ResponseMetadata><RequestId>id</RequestId></ResponseMetadata>\n"
+                    "</OperationNameResponse>"];
+    NSDictionary *expected = [self.treeParser dictionaryForXMLData:data
+                                                        actionName:@"OperationName"
+                                             serviceDefinitionRule:self.countsDefinition
+                                                             error:nil];
+    NSDictionary *result = [decoder dictionaryForXMLData:data error:nil];
+
+    XCTAssertEqualObjects(result, (@{@"Name": @"a < b & c", @"Counts": @[@1, @2]}));
+    XCTAssertEqualObjects(result, expected);
+}
+
+- (void)testMalformedDocument {
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"OperationName"
+                                                        serviceDefinitionRule:self.countsDefinition];
+    for (NSString *body in @[@"", @"not xml", @"<OperationNameResponse><OperationNameResult><Name>a"]) {
+        NSError *error = nil;
+        XCTAssertNil([decoder dictionaryForXMLData:[self dataWithString:body] error:&error], @"%@", body);
+        XCTAssertNotNil(error, @"%@", body);
+    }
+}
+
+- (void)testStreamingPayloadHasNoDecoder {
+    NSDictionary *definition = @{@"metadata": @{@"protocol": @"rest-xml"},
+                                 @"operations": @{@"GetObject": @{@"name": @"GetObject",
+                                                                  @"output": @{@"shape": @"GetObjectOutput"}}},
+                                 @"shapes": @{@"GetObjectOutput": @{@"type": @"structure",
+                                                                    @"members": @{@"Body": @{@"shape": @"Body"}},
+                                                                    @"payload": @"Body"},
+                                              @"Body": @{@"type": @"blob", @"streaming": @YES}}};
+    XCTAssertNil([AWSXMLStreamDecoder decoderWithActionName:@"GetObject" serviceDefinitionRule:definition]);
+    XCTAssertNil([AWSXMLStreamDecoder decoderWithActionName:@"GetObject" serviceDefinitionRule:@{}]);
+}
+
+@end
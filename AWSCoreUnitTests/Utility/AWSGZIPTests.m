@@ -0,0 +1,270 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSCore.h"
+
+static const NSUInteger AWSGZIPTestsLargeDataLength = 50 * 1024 * 1024;
+
+@interface AWSGZIPTests : XCTestCase
+
+@end
+
+@implementation AWSGZIPTests
+
+// Log-like text that compresses about as well as a JSON or XML body.
++ (NSData *)dataWithLength:(NSUInteger)length {
+    NSMutableData *data = [NSMutableData dataWithCapacity:length];
+    NSUInteger line = 0;
+    while (data.length < length) {
+        NSString *string = [NSString stringWithFormat:@"{\"id\":%lu,\"value\":\"%08x\",\"message\":\"request %lu finished\"}\n",
+                            (unsigned long)line, arc4random(), (unsigned long)line % 97];
+        [data appendData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+        line++;
+    }
+    data.length = length;
+    return data;
+}
+
++ (NSData *)largeData {
+    static NSData *data = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        data = [self dataWithLength:AWSGZIPTestsLargeDataLength];
+    });
+    return data;
+}
+
++ (NSData *)readStream:(NSInputStream *)stream bufferSize:(NSUInteger)bufferSize error:(NSError **)error {
+    NSMutableData *data = [NSMutableData new];
+    uint8_t *buffer = malloc(bufferSize);
+    [stream open];
+    NSInteger read = 0;
+    while ((read = [stream read:buffer maxLength:bufferSize]) > 0) {
+        [data appendBytes:buffer length:read];
+    }
+    free(buffer);
+    if (read < 0) {
+        if (error) {
+            *error = stream.streamError;
+        }
+        [stream close];
+        return nil;
+    }
+    [stream close];
+    return data;
+}
+
+- (void)testDataRoundTrip {
+    for (NSNumber *length in @[@1, @100, @16384, @16385, @1000000]) {
+        NSData *data = [AWSGZIPTests dataWithLength:length.unsignedIntegerValue];
+        NSData *compressedData = [data awsgzip_gzippedData];
+        XCTAssertTrue([compressedData awsgzip_isGzippedData]);
+        XCTAssertEqualObjects([compressedData awsgzip_gunzippedData], data, @"%@", length);
+    }
+    XCTAssertNil([[NSData data] awsgzip_gzippedData]);
+}
+
+- (void)testGunzipRejectsTruncatedAndCorruptData {
+    NSData *compressedData = [[AWSGZIPTests dataWithLength:100000] awsgzip_gzippedData];
+    XCTAssertNil([[compressedData subdataWithRange:NSMakeRange(0, compressedData.length - 8)] awsgzip_gunzippedData]);
+
+    NSMutableData *corruptData = [compressedData mutableCopy];
+    ((uint8_t *)corruptData.mutableBytes)[corruptData.length / 2] ^= 0xff;
+    XCTAssertNil([corruptData awsgzip_gunzippedData]);
+}
+
+- (void)testStreamRoundTrip {
+    NSData *largeData = [AWSGZIPTests dataWithLength:3 * 1024 * 1024 + 17];
+    for (NSNumber *bufferSize in @[@1, @7, @4096, @(1024 * 1024)]) {
+        // Keep single byte reads quick.
+        NSData *data = (bufferSize.unsignedIntegerValue == 1) ? [largeData subdataWithRange:NSMakeRange(0, 100000)] : largeData;
+        NSError *error = nil;
+        AWSGZIPInputStream *compressingStream = [AWSGZIPInputStream compressingStreamWithInputStream:[NSInputStream inputStreamWithData:data]];
+        NSData *compressedData = [AWSGZIPTests readStream:compressingStream
+                                               bufferSize:bufferSize.unsignedIntegerValue
+                                                    error:&error];
+        XCTAssertNil(error);
+        XCTAssertEqual(compressingStream.totalBytesIn, data.length);
+        XCTAssertEqual(compressingStream.totalBytesOut, compressedData.length);
+        XCTAssertEqualObjects([compressedData awsgzip_gunzippedData], data, @"%@", bufferSize);
+
+        AWSGZIPInputStream *decompressingStream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:[data awsgzip_gzippedData]]];
+        NSData *decompressedData = [AWSGZIPTests readStream:decompressingStream
+                                                 bufferSize:bufferSize.unsignedIntegerValue
+                                                      error:&error];
+        XCTAssertNil(error);
+        XCTAssertEqualObjects(decompressedData, data, @"%@", bufferSize);
+        XCTAssertEqual(decompressingStream.streamStatus, NSStreamStatusClosed);
+    }
+}
+
+- (void)testStreamReadsConcatenatedMembers {
+    NSData *first = [AWSGZIPTests dataWithLength:50000];
+    NSData *second = [AWSGZIPTests dataWithLength:70000];
+    NSMutableData *compressedData = [[first awsgzip_gzippedData] mutableCopy];
+    [compressedData appendData:[second awsgzip_gzippedData]];
+
+    NSMutableData *expected = [first mutableCopy];
+    [expected appendData:second];
+
+    NSError *error = nil;
+    AWSGZIPInputStream *stream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:compressedData]];
+    XCTAssertEqualObjects([AWSGZIPTests readStream:stream bufferSize:4096 error:&error], expected);
+    XCTAssertNil(error);
+
+    // Padding after the last member is ignored, as gzip does.
+    [compressedData increaseLengthBy:16];
+    stream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:compressedData]];
+    XCTAssertEqualObjects([AWSGZIPTests readStream:stream bufferSize:4096 error:&error], expected);
+    XCTAssertNil(error);
+}
+
+- (void)testStreamReportsTruncatedAndCorruptData {
+    NSData *compressedData = [[AWSGZIPTests dataWithLength:100000] awsgzip_gzippedData];
+
+    NSError *error = nil;
+    NSData *truncatedData = [compressedData subdataWithRange:NSMakeRange(0, compressedData.length - 8)];
+    AWSGZIPInputStream *stream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:truncatedData]];
+    XCTAssertNil([AWSGZIPTests readStream:stream bufferSize:4096 error:&error]);
+    XCTAssertEqualObjects(error.domain, AWSGZIPInputStreamErrorDomain);
+    XCTAssertEqual(error.code, AWSGZIPInputStreamErrorTruncatedData);
+
+    NSMutableData *corruptData = [compressedData mutableCopy];
+    ((uint8_t *)corruptData.mutableBytes)[corruptData.length / 2] ^= 0xff;
+    ((uint8_t *)corruptData.mutableBytes)[corruptData.length / 2 + 1] ^= 0x55;
+    error = nil;
+    stream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:corruptData]];
+    XCTAssertNil([AWSGZIPTests readStream:stream bufferSize:4096 error:&error]);
+    XCTAssertEqualObjects(error.domain, AWSGZIPInputStreamErrorDomain);
+    XCTAssertEqual(error.code, AWSGZIPInputStreamErrorCorruptData);
+    XCTAssertEqual(stream.streamStatus, NSStreamStatusClosed);
+}
+
+- (void)testStreamCompressesFile {
+    NSData *data = [AWSGZIPTests dataWithLength:2 * 1024 * 1024];
+    NSURL *fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]]];
+    XCTAssertTrue([data writeToURL:fileURL atomically:YES]);
+
+    AWSGZIPInputStream *stream = [AWSGZIPInputStream compressingStreamWithInputStream:[NSInputStream inputStreamWithURL:fileURL]];
+    NSData *compressedData = [AWSGZIPTests readStream:stream bufferSize:32 * 1024 error:nil];
+    XCTAssertLessThan(compressedData.length, data.length / 2);
+    XCTAssertEqualObjects([compressedData awsgzip_gunzippedData], data);
+
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+#pragma mark - Request compression
+
+- (NSMutableURLRequest *)serializeParameters:(NSDictionary *)parameters
+                                     headers:(NSDictionary *)headers
+                          minCompressionSize:(NSUInteger)minCompressionSize {
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[NSURL URLWithString:@"https://aws.amazon.com"]];
+    request.HTTPMethod = @"POST";
+    AWSJSONRequestSerializer *serializer = [AWSJSONRequestSerializer new];
+    serializer.requestMinCompressionSizeBytes = minCompressionSize;
+    [[serializer serializeRequest:request headers:headers parameters:parameters] waitUntilFinished];
+    return request;
+}
+
+- (void)testRequestBodyIsCompressedAboveMinimumSize {
+    NSDictionary *parameters = @{@"Message": [[NSString alloc] initWithData:[AWSGZIPTests dataWithLength:20000]
+                                                                   encoding:NSUTF8StringEncoding]};
+    NSData *expected = [NSJSONSerialization dataWithJSONObject:parameters options:0 error:nil];
+
+    NSMutableURLRequest *request = [self serializeParameters:parameters headers:nil minCompressionSize:10240];
+    XCTAssertEqualObjects([request valueForHTTPHeaderField:@"Content-Encoding"], @"gzip");
+    XCTAssertLessThan(request.HTTPBody.length, expected.length);
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:[request.HTTPBody awsgzip_gunzippedData] options:0 error:nil], parameters);
+
+    request = [self serializeParameters:parameters headers:nil minCompressionSize:0];
+    XCTAssertNil([request valueForHTTPHeaderField:@"Content-Encoding"]);
+    XCTAssertFalse([request.HTTPBody awsgzip_isGzippedData]);
+
+    request = [self serializeParameters:@{@"Message": @"small"} headers:nil minCompressionSize:10240];
+    XCTAssertNil([request valueForHTTPHeaderField:@"Content-Encoding"]);
+    XCTAssertFalse([request.HTTPBody awsgzip_isGzippedData]);
+}
+
+- (void)testRequestBodyWithContentEncodingIsNotCompressedAgain {
+    NSDictionary *parameters = @{@"Message": [[NSString alloc] initWithData:[AWSGZIPTests dataWithLength:20000]
+                                                                   encoding:NSUTF8StringEncoding]};
+    NSMutableURLRequest *request = [self serializeParameters:parameters
+                                                     headers:@{@"Content-Encoding": @"gzip"}
+                                          minCompressionSize:1];
+    NSData *body = [request.HTTPBody awsgzip_gunzippedData];
+    XCTAssertFalse([body awsgzip_isGzippedData]);
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:body options:0 error:nil], parameters);
+}
+
+- (void)testRequestMinCompressionSizeIsInheritedFromConfiguration {
+    AWSNetworkingConfiguration *configuration = [AWSNetworkingConfiguration new];
+    configuration.requestMinCompressionSizeBytes = 10240;
+    XCTAssertEqual([configuration copy].requestMinCompressionSizeBytes, 10240);
+
+    AWSNetworkingRequest *request = [AWSNetworkingRequest new];
+    [request assignProperties:configuration];
+    XCTAssertEqual(request.requestMinCompressionSizeBytes, 10240);
+}
+
+#pragma mark - Performance
+
+- (void)testGzipDataPerformance {
+    NSData *data = [AWSGZIPTests largeData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            XCTAssertNotNil([data awsgzip_gzippedData]);
+        }];
+    }
+}
+
+- (void)testCompressingStreamPerformance {
+    NSData *data = [AWSGZIPTests largeData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSGZIPInputStream *stream = [AWSGZIPInputStream compressingStreamWithInputStream:[NSInputStream inputStreamWithData:data]];
+            uint8_t buffer[64 * 1024];
+            [stream open];
+            while ([stream read:buffer maxLength:sizeof(buffer)] > 0);
+            [stream close];
+            XCTAssertEqual(stream.totalBytesIn, data.length);
+        }];
+    }
+}
+
+- (void)testGunzipDataPerformance {
+    NSData *compressedData = [[AWSGZIPTests largeData] awsgzip_gzippedData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            XCTAssertEqual([compressedData awsgzip_gunzippedData].length, AWSGZIPTestsLargeDataLength);
+        }];
+    }
+}
+
+- (void)testDecompressingStreamPerformance {
+    NSData *compressedData = [[AWSGZIPTests largeData] awsgzip_gzippedData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSGZIPInputStream *stream = [AWSGZIPInputStream decompressingStreamWithInputStream:[NSInputStream inputStreamWithData:compressedData]];
+            uint8_t buffer[64 * 1024];
+            [stream open];
+            while ([stream read:buffer maxLength:sizeof(buffer)] > 0);
+            [stream close];
+            XCTAssertEqual(stream.totalBytesOut, AWSGZIPTestsLargeDataLength);
+        }];
+    }
+}
+
+@end
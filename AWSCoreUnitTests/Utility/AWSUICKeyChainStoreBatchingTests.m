@@ -0,0 +1,149 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "AWSUICKeyChainStore.h"
+
+@interface AWSCountingFileStorage : AWSUICKeyChainStoreFileStorage
+
+@property (atomic, assign) NSInteger readCount;
+@property (atomic, assign) NSInteger writeCount;
+
+@end
+
+@implementation AWSCountingFileStorage
+
+- (NSData *)dataForKey:(NSString *)key error:(NSError *__autoreleasing *)error {
+    self.readCount++;
+    return [super dataForKey:key error:error];
+}
+
+- (NSDictionary<NSString *, NSData *> *)allDataWithError:(NSError *__autoreleasing *)error {
+    self.readCount++;
+    return [super allDataWithError:error];
+}
+
+- (BOOL)updateData:(NSDictionary<NSString *, id> *)changes error:(NSError *__autoreleasing *)error {
+    self.writeCount++;
+    return [super updateData:changes error:error];
+}
+
+@end
+
+@interface AWSUICKeyChainStoreBatchingTests : XCTestCase
+
+@property (nonatomic, strong) NSURL *fileURL;
+@property (nonatomic, strong) AWSCountingFileStorage *storage;
+@property (nonatomic, strong) AWSUICKeyChainStore *keychain;
+
+@end
+
+@implementation AWSUICKeyChainStoreBatchingTests
+
+- (void)setUp {
+    [super setUp];
+    self.fileURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    self.storage = [[AWSCountingFileStorage alloc] initWithFileURL:self.fileURL];
+    self.keychain = [AWSUICKeyChainStore keyChainStoreWithService:@"AWSUICKeyChainStoreBatchingTests"];
+    self.keychain.storage = self.storage;
+    self.keychain.cachesValues = YES;
+}
+
+- (void)tearDown {
+    [[NSFileManager defaultManager] removeItemAtURL:self.fileURL error:nil];
+    [super tearDown];
+}
+
+- (void)testReadsAreServedFromCacheUntilWrite {
+    self.keychain[@"accessToken"] = @"token1";
+    XCTAssertEqual(self.storage.writeCount, 1);
+
+    for (int i = 0; i < 10; i++) {
+        XCTAssertEqualObjects(self.keychain[@"accessToken"], @"token1");
+    }
+    XCTAssertEqual(self.storage.readCount, 0);
+
+    self.keychain[@"accessToken"] = @"token2";
+    XCTAssertEqualObjects(self.keychain[@"accessToken"], @"token2");
+    XCTAssertNil(self.keychain[@"missing"]);
+    XCTAssertNil(self.keychain[@"missing"]);
+    XCTAssertEqual(self.storage.readCount, 1);
+}
+
+- (void)testTransactionCoalescesWritesIntoOneUpdate {
+    NSError *error = nil;
+    BOOL succeeded = [self.keychain performTransaction:^(AWSUICKeyChainStore *keychain) {
+        keychain[@"idToken"] = @"id";
+        keychain[@"accessToken"] = @"stale";
+        keychain[@"accessToken"] = @"access";
+        keychain[@"refreshToken"] = @"refresh";
+        keychain[@"expiration"] = @"2026-01-01T00:00:00Z";
+        XCTAssertEqualObjects(keychain[@"accessToken"], @"access");
+    } error:&error];
+
+    XCTAssertTrue(succeeded);
+    XCTAssertNil(error);
+    XCTAssertEqual(self.storage.writeCount, 1);
+
+    AWSUICKeyChainStore *reloaded = [AWSUICKeyChainStore keyChainStoreWithService:@"AWSUICKeyChainStoreBatchingTests"];
+    reloaded.storage = [[AWSUICKeyChainStoreFileStorage alloc] initWithFileURL:self.fileURL];
+    NSDictionary *values = [reloaded stringsForKeys:@[@"idToken", @"accessToken", @"refreshToken", @"expiration", @"missing"]];
+    XCTAssertEqualObjects(values, (@{@"idToken": @"id",
+                                     @"accessToken": @"access",
+                                     @"refreshToken": @"refresh",
+                                     @"expiration": @"2026-01-01T00:00:00Z"}));
+}
+
+- (void)testSetStringsSkipsUnchangedValues {
+    [self.keychain setStrings:@{@"a": @"1", @"b": @"2"}];
+    [self.keychain setStrings:@{@"a": @"1", @"b": @"2"}];
+    XCTAssertEqual(self.storage.writeCount, 1);
+
+    [self.keychain setStrings:@{@"a": @"1", @"b": [NSNull null]}];
+    XCTAssertEqual(self.storage.writeCount, 2);
+    XCTAssertNil(self.keychain[@"b"]);
+    XCTAssertEqualObjects(self.keychain[@"a"], @"1");
+}
+
+- (void)testBatchedReadFetchesStorageOnce {
+    AWSUICKeyChainStoreFileStorage *storage = [[AWSUICKeyChainStoreFileStorage alloc] initWithFileURL:self.fileURL];
+    [storage updateData:@{@"a": [@"1" dataUsingEncoding:NSUTF8StringEncoding],
+                          @"b": [@"2" dataUsingEncoding:NSUTF8StringEncoding]} error:nil];
+    self.storage = [[AWSCountingFileStorage alloc] initWithFileURL:self.fileURL];
+    self.keychain.storage = self.storage;
+
+    NSDictionary *values = [self.keychain stringsForKeys:@[@"a", @"b", @"c"]];
+    XCTAssertEqualObjects(values, (@{@"a": @"1", @"b": @"2"}));
+    XCTAssertNil(self.keychain[@"c"]);
+    XCTAssertEqualObjects(self.keychain[@"a"], @"1");
+    XCTAssertEqual(self.storage.readCount, 1);
+}
+
+- (void)testCachedReadPerformance {
+    [self.keychain setStrings:@{@"accessKey": @"accessKey",
+                                @"secretKey": @"secretKey",
+                                @"sessionKey": @"sessionKey",
+                                @"expiration": @"1700000000.000000"}];
+    NSArray<NSString *> *keys = @[@"accessKey", @"secretKey", @"sessionKey", @"expiration"];
+
+    [self measureBlock:^{
+        for (int i = 0; i < 100000; i++) {
+            [self.keychain stringsForKeys:keys];
+        }
+    }];
+}
+
+@end
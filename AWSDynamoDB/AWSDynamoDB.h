@@ -41,3 +41,4 @@ FOUNDATION_EXPORT const unsigned char AWSDynamoDBVersionString[] DEPRECATED_MSG_
 #import <AWSCore/AWSCore.h>
 #import "AWSDynamoDBService.h"
 #import "AWSDynamoDBObjectMapper.h"
+#import "AWSDynamoDBObjectMapperCache.h"
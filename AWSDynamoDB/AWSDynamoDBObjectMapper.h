@@ -63,10 +63,39 @@ typedef NS_ENUM(NSInteger, AWSDynamoDBObjectMapperSaveBehavior) {
     AWSDynamoDBObjectMapperSaveBehaviorClobber
 };
 
+FOUNDATION_EXPORT NSString *const AWSDynamoDBObjectMapperErrorDomain;
+
+typedef NS_ENUM(NSInteger, AWSDynamoDBObjectMapperErrorType) {
+    AWSDynamoDBObjectMapperErrorUnknown,
+    /**
+     DynamoDB still returned some keys or items as unprocessed after `maximumBatchRetryCount` retries. The models that
+     were not loaded, saved or removed are in the `userInfo` under `AWSDynamoDBObjectMapperUnprocessedModelsKey`.
+     */
+    AWSDynamoDBObjectMapperErrorUnprocessedItems,
+};
+
+/**
+ The `userInfo` key of the models a batch operation did not process. When a batch operation fails, for any reason, its
+ error lists the models of the requests that failed and of the requests that were never sent under this key.
+ */
+FOUNDATION_EXPORT NSString *const AWSDynamoDBObjectMapperUnprocessedModelsKey;
+
+/**
+ The maximum number of keys in one `BatchGetItem` request. `batchLoad:` splits larger inputs into several requests.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSDynamoDBObjectMapperBatchGetItemLimit;
+
+/**
+ The maximum number of put and delete requests in one `BatchWriteItem` request. `batchSave:` and `batchRemove:` split
+ larger inputs into several requests.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSDynamoDBObjectMapperBatchWriteItemLimit;
+
 @class AWSDynamoDBObjectMapperConfiguration;
 @class AWSDynamoDBQueryExpression;
 @class AWSDynamoDBScanExpression;
 @class AWSDynamoDBPaginatedOutput;
+@class AWSDynamoDBObjectMapperCache;
 
 /**
  A DynamoDB Modeling protocol. All objects mapped to an Amazon DynamoDB table row need to conform to this protocol.
@@ -278,6 +307,25 @@ typedef NS_ENUM(NSInteger, AWSDynamoDBObjectMapperSaveBehavior) {
  */
 + (void)removeDynamoDBObjectMapperForKey:(NSString *)key;
 
+/**
+ Sets the local cache of the items of a table. `load:` reads the cache before the table, and the other operations on
+ the table keep it up to date. See `AWSDynamoDBObjectMapperCache`.
+
+ @param cache     The cache, or `nil` to stop caching the table.
+ @param tableName The name of the table.
+ */
+- (void)setCache:(nullable AWSDynamoDBObjectMapperCache *)cache
+    forTableName:(NSString *)tableName;
+
+/**
+ Returns the local cache of the items of a table.
+
+ @param tableName The name of the table.
+
+ @return The cache, or `nil` if the table isn't cached.
+ */
+- (nullable AWSDynamoDBObjectMapperCache *)cacheForTableName:(NSString *)tableName;
+
 /**
  Saves the model object to an Amazon DynamoDB table using the default configuration.
 
@@ -422,6 +470,140 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBObjectModel<AWSDynamoDBModeling
 configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
 completionHandler:(void (^ _Nullable)(AWSDynamoDBObjectModel<AWSDynamoDBModeling> * _Nullable response, NSError * _Nullable error))completionHandler;
 
+/**
+ Loads the objects with the keys of the given models using the default configuration. The models only need their hash key and range key (if it exists) set, and may belong to different tables.
+
+ The keys are sent in `BatchGetItem` requests of up to `AWSDynamoDBObjectMapperBatchGetItemLimit` keys, at most `maximumConcurrentBatchRequests` at a time. Keys DynamoDB returns as unprocessed are sent again after a backoff.
+
+ @param models Models with the keys of the objects to load.
+
+ @return AWSTask. `task.result` is an array with the loaded object for each model in `models`, in the same order, and `NSNull` where no such object exists.
+ */
+- (AWSTask<NSArray *> *)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models;
+
+/**
+ Loads the objects with the keys of the given models using the default configuration.
+
+ @param models            Models with the keys of the objects to load.
+ @param completionHandler The completion handler to call when the load request is complete.
+                          `response`: The loaded object for each model in `models`, in the same order, and `NSNull` where no such object exists.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+completionHandler:(void (^ _Nullable)(NSArray * _Nullable response, NSError * _Nullable error))completionHandler;
+
+/**
+ Loads the objects with the keys of the given models using the specified configuration.
+
+ @param models        Models with the keys of the objects to load.
+ @param configuration A configuration.
+
+ @return AWSTask. `task.result` is an array with the loaded object for each model in `models`, in the same order, and `NSNull` where no such object exists.
+ */
+- (AWSTask<NSArray *> *)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+                    configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration;
+
+/**
+ Loads the objects with the keys of the given models using the specified configuration.
+
+ @param models            Models with the keys of the objects to load.
+ @param configuration     A configuration.
+ @param completionHandler The completion handler to call when the load request is complete.
+                          `response`: The loaded object for each model in `models`, in the same order, and `NSNull` where no such object exists.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+    configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
+completionHandler:(void (^ _Nullable)(NSArray * _Nullable response, NSError * _Nullable error))completionHandler;
+
+/**
+ Saves the model objects to their Amazon DynamoDB tables using the default configuration.
+
+ The models are sent in `BatchWriteItem` requests of up to `AWSDynamoDBObjectMapperBatchWriteItemLimit` items, at most `maximumConcurrentBatchRequests` at a time. Items DynamoDB returns as unprocessed are sent again after a backoff. `BatchWriteItem` replaces whole items, so every model is saved as with `AWSDynamoDBObjectMapperSaveBehaviorClobber` regardless of `saveBehavior`. When several models have the same key, the last one is saved.
+
+ @param models Models to save.
+
+ @return AWSTask.
+ */
+- (AWSTask *)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models;
+
+/**
+ Saves the model objects to their Amazon DynamoDB tables using the default configuration.
+
+ @param models            Models to save.
+ @param completionHandler The completion handler to call when the save request is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
+/**
+ Saves the model objects to their Amazon DynamoDB tables using the specified configuration.
+
+ @param models        Models to save.
+ @param configuration A configuration.
+
+ @return AWSTask.
+ */
+- (AWSTask *)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+         configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration;
+
+/**
+ Saves the model objects to their Amazon DynamoDB tables using the specified configuration.
+
+ @param models            Models to save.
+ @param configuration     A configuration.
+ @param completionHandler The completion handler to call when the save request is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+    configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
+completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
+/**
+ Removes the given model objects from their Amazon DynamoDB tables using the default configuration. The models only need their hash key and range key (if it exists) set.
+
+ The keys are sent in `BatchWriteItem` requests of up to `AWSDynamoDBObjectMapperBatchWriteItemLimit` keys, at most `maximumConcurrentBatchRequests` at a time. Keys DynamoDB returns as unprocessed are sent again after a backoff.
+
+ @param models Models to delete.
+
+ @return AWSTask.
+ */
+- (AWSTask *)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models;
+
+/**
+ Removes the given model objects from their Amazon DynamoDB tables using the default configuration.
+
+ @param models            Models to delete.
+ @param completionHandler The completion handler to call when the remove request is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+  completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
+/**
+ Removes the given model objects from their Amazon DynamoDB tables using the specified configuration.
+
+ @param models        Models to delete.
+ @param configuration A configuration.
+
+ @return AWSTask.
+ */
+- (AWSTask *)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+           configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration;
+
+/**
+ Removes the given model objects from their Amazon DynamoDB tables using the specified configuration.
+
+ @param models            Models to delete.
+ @param configuration     A configuration.
+ @param completionHandler The completion handler to call when the remove request is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+      configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
+  completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
 /**
  Queries an Amazon DynamoDB table and returns the matching results as an unmodifiable list of instantiated objects, using the default configuration.
 
@@ -526,6 +708,74 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
 completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable response, NSError * _Nullable error))completionHandler;
 
+/**
+ Scans through an Amazon DynamoDB table in `totalSegments` segments at a time, using the default configuration.
+
+ Each segment is read by its own sequence of `Scan` requests, and `pageHandler` is called with each page as it arrives, one page at a time. The pages of a segment are passed in order, and the pages of different segments interleave. Each segment reads at most `readAheadPageCount` pages ahead of `pageHandler`.
+
+ @param resultClass   The class of the result object.
+ @param expression    An expression object. `exclusiveStartKey` is ignored.
+ @param totalSegments The number of segments, between 1 and 1000000.
+ @param pageHandler   Called with the items of each page, the segment they belong to, and a pointer to a Boolean that can be set to `YES` to stop the scan.
+
+ @return AWSTask. `task.result` is always `nil`. The task completes once every segment has been read, or after the scan was stopped.
+ */
+- (AWSTask *)parallelScan:(Class)resultClass
+               expression:(AWSDynamoDBScanExpression *)expression
+            totalSegments:(NSUInteger)totalSegments
+              pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler;
+
+/**
+ Scans through an Amazon DynamoDB table in `totalSegments` segments at a time, using the default configuration.
+
+ @param resultClass       The class of the result object.
+ @param expression        An expression object. `exclusiveStartKey` is ignored.
+ @param totalSegments     The number of segments, between 1 and 1000000.
+ @param pageHandler       Called with the items of each page, the segment they belong to, and a pointer to a Boolean that can be set to `YES` to stop the scan.
+ @param completionHandler The completion handler to call when the scan is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)parallelScan:(Class)resultClass
+          expression:(AWSDynamoDBScanExpression *)expression
+       totalSegments:(NSUInteger)totalSegments
+         pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler
+   completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
+/**
+ Scans through an Amazon DynamoDB table in `totalSegments` segments at a time, using the specified configuration.
+
+ @param resultClass   The class of the result object.
+ @param expression    An expression object. `exclusiveStartKey` is ignored.
+ @param totalSegments The number of segments, between 1 and 1000000.
+ @param configuration A configuration.
+ @param pageHandler   Called with the items of each page, the segment they belong to, and a pointer to a Boolean that can be set to `YES` to stop the scan.
+
+ @return AWSTask. `task.result` is always `nil`. The task completes once every segment has been read, or after the scan was stopped.
+ */
+- (AWSTask *)parallelScan:(Class)resultClass
+               expression:(AWSDynamoDBScanExpression *)expression
+            totalSegments:(NSUInteger)totalSegments
+            configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
+              pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler;
+
+/**
+ Scans through an Amazon DynamoDB table in `totalSegments` segments at a time, using the specified configuration.
+
+ @param resultClass       The class of the result object.
+ @param expression        An expression object. `exclusiveStartKey` is ignored.
+ @param totalSegments     The number of segments, between 1 and 1000000.
+ @param configuration     A configuration.
+ @param pageHandler       Called with the items of each page, the segment they belong to, and a pointer to a Boolean that can be set to `YES` to stop the scan.
+ @param completionHandler The completion handler to call when the scan is complete.
+                          `error`: An error object that indicates why the request failed, or `nil` if the request was successful.
+ */
+- (void)parallelScan:(Class)resultClass
+          expression:(AWSDynamoDBScanExpression *)expression
+       totalSegments:(NSUInteger)totalSegments
+       configuration:(nullable AWSDynamoDBObjectMapperConfiguration *)configuration
+         pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler
+   completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler;
+
 @end
 
 /**
@@ -543,6 +793,21 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
  */
 @property (nonatomic, strong, nullable) NSNumber *consistentRead;
 
+/**
+ The maximum number of `BatchGetItem` or `BatchWriteItem` requests a batch operation has in flight at a time. The default is 4.
+ */
+@property (nonatomic, assign) NSUInteger maximumConcurrentBatchRequests;
+
+/**
+ How many times a batch operation sends keys or items DynamoDB returned as unprocessed before it fails with `AWSDynamoDBObjectMapperErrorUnprocessedItems`. The retries back off exponentially. The default is 8.
+ */
+@property (nonatomic, assign) NSUInteger maximumBatchRetryCount;
+
+/**
+ The number of pages `AWSDynamoDBPaginatedOutput` requests ahead of `loadNextPage`, and each segment of a parallel scan requests ahead of its page handler. The pages are requested in order, one at a time. The default is 0, which requests a page only when it is needed.
+ */
+@property (nonatomic, assign) NSUInteger readAheadPageCount;
+
 @end
 
 /**
@@ -689,7 +954,7 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 @property (nonatomic, strong, readonly , nullable) NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *lastEvaluatedKey;
 
 /**
- Loads the next page of items when `self.lastEvaluatedKey` is not `nil`.
+ Loads the next page of items when `self.lastEvaluatedKey` is not `nil`. With a `readAheadPageCount` in the configuration, the page may already be loaded, and the following pages are requested.
 
  @return `task.error` indicates why the request failed, or `nil` if the request was successful. `task.result` is always `nil`.
  */
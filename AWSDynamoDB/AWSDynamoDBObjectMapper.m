@@ -14,6 +14,7 @@
 //
 
 #import "AWSDynamoDBObjectMapper.h"
+#import "AWSDynamoDBObjectMapperCache.h"
 #import "AWSDynamoDB.h"
 #import "AWSBolts.h"
 #import "AWSCocoaLumberjack.h"
@@ -24,6 +25,16 @@ static NSString *const AWSInfoDynamoDBObjectMapper = @"DynamoDBObjectMapper";
 
 static const NSString *AWSDynamoDBObjectMapperHashKeyAttributePlaceHolder = @":awsddbomhashvalueplaceholder";
 NSString *const AWSDynamoDBObjectMapperUserAgent = @"mapper";
+NSString *const AWSDynamoDBObjectMapperErrorDomain = @"com.amazonaws.AWSDynamoDBObjectMapperErrorDomain";
+NSString *const AWSDynamoDBObjectMapperUnprocessedModelsKey = @"unprocessedModels";
+NSUInteger const AWSDynamoDBObjectMapperBatchGetItemLimit = 100;
+NSUInteger const AWSDynamoDBObjectMapperBatchWriteItemLimit = 25;
+
+static NSUInteger const AWSDynamoDBObjectMapperDefaultMaximumConcurrentBatchRequests = 4;
+static NSUInteger const AWSDynamoDBObjectMapperDefaultMaximumBatchRetryCount = 8;
+// In milliseconds.
+static uint32_t const AWSDynamoDBObjectMapperBatchRetryBaseDelay = 50;
+static uint32_t const AWSDynamoDBObjectMapperBatchRetryMaximumDelay = 5000;
 
 @interface NSString (AWSDynamoDBObjectMapperSaveBehavior)
 
@@ -119,6 +130,90 @@ NSString *const AWSDynamoDBObjectMapperUserAgent = @"mapper";
 @property (nonatomic, strong) AWSDynamoDBScanInput *scanInput;
 @property (nonatomic, strong) AWSDynamoDBQueryInput *queryInput;
 
+@property (nonatomic, assign) NSUInteger readAheadPageCount;
+@property (nonatomic, strong) NSMutableArray<AWSTask<AWSDynamoDBPaginatedOutput *> *> *readAheadTasks;
+
+- (void)readAheadAfterPage:(AWSTask<AWSDynamoDBPaginatedOutput *> *)pageTask;
+
+@end
+
+// One distinct key of a batch operation and the positions of the models with that key in the input.
+@interface AWSDynamoDBObjectMapperBatchEntry : NSObject
+
+@property (nonatomic, strong) NSString *identifier;
+@property (nonatomic, strong) NSString *tableName;
+@property (nonatomic, assign) Class modelClass;
+@property (nonatomic, strong) NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *key;
+@property (nonatomic, strong) AWSDynamoDBWriteRequest *writeRequest;
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *indexes;
+@property (nonatomic, strong) NSMutableArray *models;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperBatchEntry
+
+@end
+
+// Hands out the chunks of a batch operation to the requests running concurrently, and stops after the first failure.
+// The models of the chunks that failed or were never sent are collected for the error.
+@interface AWSDynamoDBObjectMapperBatchQueue : NSObject
+
+@property (nonatomic, strong) NSArray<NSArray<AWSDynamoDBObjectMapperBatchEntry *> *> *chunks;
+@property (nonatomic, assign) NSUInteger nextChunk;
+@property (nonatomic, strong) NSError *error;
+@property (nonatomic, strong) NSMutableArray *unprocessedModels;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperBatchQueue
+
+- (NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)dequeueChunk {
+    @synchronized (self) {
+        if (self.error || self.nextChunk >= self.chunks.count) {
+            return nil;
+        }
+        return self.chunks[self.nextChunk++];
+    }
+}
+
+- (void)failChunk:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)chunk
+        withError:(NSError *)error {
+    @synchronized (self) {
+        if (!self.error) {
+            self.error = error;
+            self.unprocessedModels = [NSMutableArray new];
+        }
+        // Retries that ran out name the models they didn't process; any other error leaves the whole chunk unknown.
+        NSArray *unprocessedModels = error.userInfo[AWSDynamoDBObjectMapperUnprocessedModelsKey];
+        if (unprocessedModels) {
+            [self.unprocessedModels addObjectsFromArray:unprocessedModels];
+        } else {
+            for (AWSDynamoDBObjectMapperBatchEntry *entry in chunk) {
+                [self.unprocessedModels addObjectsFromArray:entry.models];
+            }
+        }
+    }
+}
+
+- (NSError *)errorWithUnsentChunks {
+    @synchronized (self) {
+        if (!self.error) {
+            return nil;
+        }
+        NSMutableArray *unprocessedModels = [NSMutableArray arrayWithArray:self.unprocessedModels];
+        for (NSUInteger i = self.nextChunk; i < self.chunks.count; i++) {
+            for (AWSDynamoDBObjectMapperBatchEntry *entry in self.chunks[i]) {
+                [unprocessedModels addObjectsFromArray:entry.models];
+            }
+        }
+        NSMutableDictionary *userInfo = [NSMutableDictionary dictionaryWithDictionary:self.error.userInfo];
+        userInfo[AWSDynamoDBObjectMapperUnprocessedModelsKey] = unprocessedModels;
+        return [NSError errorWithDomain:self.error.domain
+                                   code:self.error.code
+                               userInfo:userInfo];
+    }
+}
+
 @end
 
 @interface AWSDynamoDB()
@@ -223,10 +318,28 @@ NSString *const AWSDynamoDBObjectMapperUserAgent = @"mapper";
 
 @end
 
+@interface AWSDynamoDBObjectMapperCache()
+
+- (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)itemForKey:(NSString *)key;
+- (void)setItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+         forKey:(NSString *)key;
+- (void)refreshItems:(NSDictionary<NSString *, NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *)itemsByKey;
+- (void)removeItemForKey:(NSString *)key;
+- (NSUInteger)beginFillForKey:(NSString *)key;
+- (void)fillItem:(nullable NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+          forKey:(NSString *)key
+      generation:(NSUInteger)generation;
+- (void)cancelFillForKey:(NSString *)key;
+- (void)recordLoadWithLatency:(NSTimeInterval)latency
+                          hit:(BOOL)hit;
+
+@end
+
 @interface AWSDynamoDBObjectMapper()
 
 @property (nonatomic, strong) AWSDynamoDB *dynamoDB;
 @property (nonatomic, strong) AWSDynamoDBObjectMapperConfiguration *objectMapperConfiguration;
+@property (nonatomic, strong) AWSSynchronizedMutableDictionary<NSString *, AWSDynamoDBObjectMapperCache *> *caches;
 
 - (AWSTask<AWSDynamoDBPaginatedOutput *> *)query:(Class)resultClass
                                       queryInput:(AWSDynamoDBQueryInput *)queryInput;
@@ -235,6 +348,141 @@ NSString *const AWSDynamoDBObjectMapperUserAgent = @"mapper";
 
 @end
 
+// Reads the segments of a parallel scan. Its state is only touched on `stateQueue`, and the page handler is only
+// called on `handlerQueue`, so pages reach the handler one at a time.
+@interface AWSDynamoDBParallelScan : NSObject
+
+@property (nonatomic, strong) AWSDynamoDBObjectMapper *objectMapper;
+@property (nonatomic, assign) Class resultClass;
+@property (nonatomic, strong) AWSDynamoDBScanInput *scanInput;
+@property (nonatomic, assign) NSUInteger totalSegments;
+@property (nonatomic, assign) NSUInteger readAheadPageCount;
+@property (nonatomic, copy) void (^pageHandler)(NSArray *items, NSUInteger segment, BOOL *stop);
+
+@property (nonatomic, strong) dispatch_queue_t stateQueue;
+@property (nonatomic, strong) dispatch_queue_t handlerQueue;
+@property (nonatomic, strong) AWSTaskCompletionSource *taskCompletionSource;
+@property (nonatomic, strong) NSMutableArray *lastEvaluatedKeys;
+@property (nonatomic, strong) NSMutableIndexSet *loadingSegments;
+@property (nonatomic, strong) NSMutableIndexSet *finishedSegments;
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *pendingPageCounts;
+@property (nonatomic, assign) NSUInteger pendingPageCount;
+@property (atomic, assign) BOOL stopped;
+@property (nonatomic, strong) NSError *error;
+
+@end
+
+@implementation AWSDynamoDBParallelScan
+
+- (AWSTask *)start {
+    self.stateQueue = dispatch_queue_create("com.amazonaws.AWSDynamoDBParallelScan.state", DISPATCH_QUEUE_SERIAL);
+    self.handlerQueue = dispatch_queue_create("com.amazonaws.AWSDynamoDBParallelScan.handler", DISPATCH_QUEUE_SERIAL);
+    self.taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    self.lastEvaluatedKeys = [NSMutableArray arrayWithCapacity:self.totalSegments];
+    self.pendingPageCounts = [NSMutableArray arrayWithCapacity:self.totalSegments];
+    for (NSUInteger segment = 0; segment < self.totalSegments; segment++) {
+        [self.lastEvaluatedKeys addObject:[NSNull null]];
+        [self.pendingPageCounts addObject:@0];
+    }
+    self.loadingSegments = [NSMutableIndexSet new];
+    self.finishedSegments = [NSMutableIndexSet new];
+
+    dispatch_async(self.stateQueue, ^{
+        for (NSUInteger segment = 0; segment < self.totalSegments; segment++) {
+            [self loadPageOfSegment:segment];
+        }
+    });
+
+    return self.taskCompletionSource.task;
+}
+
+- (void)loadPageOfSegment:(NSUInteger)segment {
+    [self.loadingSegments addIndex:segment];
+
+    AWSDynamoDBScanInput *scanInput = [self.scanInput copy];
+    scanInput.segment = @(segment);
+    scanInput.totalSegments = @(self.totalSegments);
+    id lastEvaluatedKey = self.lastEvaluatedKeys[segment];
+    scanInput.exclusiveStartKey = lastEvaluatedKey == [NSNull null] ? nil : lastEvaluatedKey;
+
+    [[self.objectMapper scan:self.resultClass
+                   scanInput:scanInput] continueWithBlock:^id(AWSTask<AWSDynamoDBPaginatedOutput *> *task) {
+        dispatch_async(self.stateQueue, ^{
+            [self segment:segment didLoadPage:task];
+        });
+        return nil;
+    }];
+}
+
+- (void)segment:(NSUInteger)segment didLoadPage:(AWSTask<AWSDynamoDBPaginatedOutput *> *)task {
+    [self.loadingSegments removeIndex:segment];
+    if (task.error && !self.error) {
+        self.error = task.error;
+    }
+    if (self.error || self.stopped) {
+        [self finishIfDone];
+        return;
+    }
+
+    AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+    if (paginatedOutput.lastEvaluatedKey) {
+        self.lastEvaluatedKeys[segment] = paginatedOutput.lastEvaluatedKey;
+    } else {
+        [self.finishedSegments addIndex:segment];
+    }
+    [self changePendingPageCountOfSegment:segment by:1];
+
+    NSArray *items = paginatedOutput.items;
+    dispatch_async(self.handlerQueue, ^{
+        if (!self.stopped) {
+            BOOL stop = NO;
+            self.pageHandler(items, segment, &stop);
+            // Set here so that the pages already waiting for the handler are dropped.
+            if (stop) {
+                self.stopped = YES;
+            }
+        }
+        dispatch_async(self.stateQueue, ^{
+            [self changePendingPageCountOfSegment:segment by:-1];
+            [self loadNextPageOfSegment:segment];
+            [self finishIfDone];
+        });
+    });
+
+    [self loadNextPageOfSegment:segment];
+}
+
+- (void)changePendingPageCountOfSegment:(NSUInteger)segment by:(NSInteger)change {
+    self.pendingPageCounts[segment] = @([self.pendingPageCounts[segment] integerValue] + change);
+    self.pendingPageCount += change;
+}
+
+// A segment has at most one request in flight, and holds off its next request while more than `readAheadPageCount`
+// of its pages are with the handler.
+- (void)loadNextPageOfSegment:(NSUInteger)segment {
+    if (self.error
+        || self.stopped
+        || [self.finishedSegments containsIndex:segment]
+        || [self.loadingSegments containsIndex:segment]
+        || [self.pendingPageCounts[segment] unsignedIntegerValue] > self.readAheadPageCount) {
+        return;
+    }
+    [self loadPageOfSegment:segment];
+}
+
+- (void)finishIfDone {
+    if (self.loadingSegments.count > 0 || self.pendingPageCount > 0) {
+        return;
+    }
+    if (self.error) {
+        [self.taskCompletionSource trySetError:self.error];
+    } else if (self.stopped || self.finishedSegments.count == self.totalSegments) {
+        [self.taskCompletionSource trySetResult:nil];
+    }
+}
+
+@end
+
 @implementation AWSDynamoDBObjectMapper
 
 static AWSSynchronizedMutableDictionary *_serviceClients = nil;
@@ -330,11 +578,26 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         _dynamoDB = [[AWSDynamoDB alloc] initWithConfiguration:_configuration];
 #pragma clang diagnostic pop
         _objectMapperConfiguration = [objectMapperConfiguration copy];
+        _caches = [AWSSynchronizedMutableDictionary new];
     }
 
     return self;
 }
 
+- (void)setCache:(AWSDynamoDBObjectMapperCache *)cache
+    forTableName:(NSString *)tableName {
+    if (cache) {
+        [self.caches setObject:cache
+                        forKey:tableName];
+    } else {
+        [self.caches removeObjectForKey:tableName];
+    }
+}
+
+- (AWSDynamoDBObjectMapperCache *)cacheForTableName:(NSString *)tableName {
+    return [self.caches objectForKey:tableName];
+}
+
 - (AWSTask *)save:(AWSDynamoDBObjectModel<AWSDynamoDBModeling> *)model {
     return [self save:model
         configuration:self.objectMapperConfiguration];
@@ -354,7 +617,9 @@ completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandl
             putItemInput.tableName = [[model class] performSelector:@selector(dynamoDBTableName)];
             putItemInput.item = [model itemForPutItemInput];
 
-            return [self.dynamoDB putItem:putItemInput];
+            return [self updateCacheForModel:model
+                                        item:putItemInput.item
+                                   afterTask:[self.dynamoDB putItem:putItemInput]];
             break;
         }
         case AWSDynamoDBObjectMapperSaveBehaviorAppendSet:
@@ -366,7 +631,14 @@ completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandl
             updateItemInput.attributeUpdates = [model itemForUpdateItemInput:configuration.saveBehavior];
             updateItemInput.key = [model key];
 
-            return [self.dynamoDB updateItem:updateItemInput];
+            // Only `AWSDynamoDBObjectMapperSaveBehaviorUpdate` leaves the item exactly as the model describes it.
+            NSDictionary *item = nil;
+            if (configuration.saveBehavior == AWSDynamoDBObjectMapperSaveBehaviorUpdate) {
+                item = [model itemForPutItemInput];
+            }
+            return [self updateCacheForModel:model
+                                        item:item
+                                   afterTask:[self.dynamoDB updateItem:updateItemInput]];
             break;
         }
 
@@ -407,7 +679,12 @@ completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandl
     deleteItemInput.tableName = [[model class] performSelector:@selector(dynamoDBTableName)];
     deleteItemInput.key = [model key];
 
-    return [self.dynamoDB deleteItem:deleteItemInput];
+    // The item is also dropped before the request, so that a concurrent load doesn't return it.
+    [[self.caches objectForKey:deleteItemInput.tableName] removeItemForKey:[self itemIdentifierForTableName:deleteItemInput.tableName
+                                                                                                       key:deleteItemInput.key]];
+    return [self updateCacheForModel:model
+                                item:nil
+                           afterTask:[self.dynamoDB deleteItem:deleteItemInput]];
 }
 
 - (void)remove:(AWSDynamoDBObjectModel<AWSDynamoDBModeling> *)model
@@ -468,9 +745,49 @@ completionHandler:completionHandler];
     }
     getItemInput.key = key;
 
-    return [[self.dynamoDB getItem:getItemInput] continueWithSuccessBlock:^id(AWSTask *task) {
+    AWSDynamoDBObjectMapperCache *cache = [self.caches objectForKey:getItemInput.tableName];
+    NSString *identifier = nil;
+    NSUInteger generation = 0;
+    BOOL consistentRead = [configuration.consistentRead boolValue];
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    if (cache) {
+        identifier = [self itemIdentifierForTableName:getItemInput.tableName
+                                                  key:key];
+        // A save or a remove of the item that completes while it is loaded is newer than what the load reads.
+        generation = [cache beginFillForKey:identifier];
+        NSDictionary *item = consistentRead ? nil : [cache itemForKey:identifier];
+        if (item) {
+            [cache cancelFillForKey:identifier];
+            NSError *error = nil;
+            id responseObject = [AWSMTLJSONAdapter modelOfClass:resultClass
+                                             fromJSONDictionary:[self removeAttributes:item]
+                                                          error:&error];
+            if (error) {
+                return [AWSTask taskWithError:error];
+            }
+            [cache recordLoadWithLatency:(double)(clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start) / NSEC_PER_SEC
+                                     hit:YES];
+            return [AWSTask taskWithResult:responseObject];
+        }
+    }
+
+    return [[self.dynamoDB getItem:getItemInput] continueWithBlock:^id(AWSTask *task) {
+        if (task.error || task.isCancelled) {
+            [cache cancelFillForKey:identifier];
+            return task;
+        }
         AWSDynamoDBGetItemOutput *getItemOutput = task.result;
 
+        if (cache) {
+            [cache fillItem:getItemOutput.item
+                     forKey:identifier
+                 generation:generation];
+            if (!consistentRead) {
+                [cache recordLoadWithLatency:(double)(clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start) / NSEC_PER_SEC
+                                         hit:NO];
+            }
+        }
+
         NSError *error = nil;
         NSDictionary *itemsDictionary = [self removeAttributes:getItemOutput.item];
 
@@ -506,6 +823,475 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBObjectModel<AWSDynamoDBModeling
     }];
 }
 
+- (AWSTask<NSArray *> *)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models {
+    return [self batchLoad:models
+             configuration:self.objectMapperConfiguration];
+}
+
+- (void)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+completionHandler:(void (^ _Nullable)(NSArray * _Nullable response, NSError * _Nullable error))completionHandler {
+    [self batchLoad:models
+      configuration:self.objectMapperConfiguration
+  completionHandler:completionHandler];
+}
+
+- (AWSTask<NSArray *> *)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+                    configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    configuration = configuration ?: self.objectMapperConfiguration;
+    NSArray<AWSDynamoDBObjectMapperBatchEntry *> *entries = [self batchEntriesForModels:models
+                                                                         writeRequest:nil];
+    NSMutableDictionary<NSString *, NSDictionary *> *items = [NSMutableDictionary new];
+
+    return [[self runBatchEntries:entries
+                        chunkSize:AWSDynamoDBObjectMapperBatchGetItemLimit
+                    configuration:configuration
+                            block:^AWSTask *(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *chunk) {
+                                return [self batchGetEntries:chunk
+                                                       items:items
+                                                     attempt:0
+                                               configuration:configuration];
+                            }] continueWithSuccessBlock:^id(AWSTask *task) {
+        NSMutableArray *results = [NSMutableArray arrayWithCapacity:models.count];
+        for (NSUInteger i = 0; i < models.count; i++) {
+            [results addObject:[NSNull null]];
+        }
+
+        NSError *error = nil;
+        for (AWSDynamoDBObjectMapperBatchEntry *entry in entries) {
+            NSDictionary *item = items[entry.identifier];
+            if (!item) {
+                continue;
+            }
+            NSDictionary *itemsDictionary = [self removeAttributes:item];
+            // Every position gets its own object, the same as when each of them is loaded with `load:`.
+            for (NSNumber *index in entry.indexes) {
+                id responseObject = [AWSMTLJSONAdapter modelOfClass:entry.modelClass
+                                                 fromJSONDictionary:itemsDictionary
+                                                              error:&error];
+                if (error) {
+                    return [AWSTask taskWithError:error];
+                }
+                results[index.unsignedIntegerValue] = responseObject;
+            }
+        }
+        return results;
+    }];
+}
+
+- (void)batchLoad:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+    configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+completionHandler:(void (^ _Nullable)(NSArray * _Nullable response, NSError * _Nullable error))completionHandler {
+    [[self batchLoad:models
+       configuration:configuration] continueWithBlock:^id _Nullable(AWSTask<NSArray *> * _Nonnull task) {
+        NSArray *response = task.result;
+        NSError *error = task.error;
+
+        if (completionHandler) {
+            completionHandler(response, error);
+        }
+        return nil;
+    }];
+}
+
+- (AWSTask *)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models {
+    return [self batchSave:models
+             configuration:self.objectMapperConfiguration];
+}
+
+- (void)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [self batchSave:models
+      configuration:self.objectMapperConfiguration
+  completionHandler:completionHandler];
+}
+
+- (AWSTask *)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+         configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    configuration = configuration ?: self.objectMapperConfiguration;
+    NSArray<AWSDynamoDBObjectMapperBatchEntry *> *entries = [self batchEntriesForModels:models
+                                                                         writeRequest:^AWSDynamoDBWriteRequest *(AWSDynamoDBObjectModel *model) {
+                                                                             AWSDynamoDBWriteRequest *writeRequest = [AWSDynamoDBWriteRequest new];
+                                                                             writeRequest.putRequest = [AWSDynamoDBPutRequest new];
+                                                                             writeRequest.putRequest.item = [model itemForPutItemInput];
+                                                                             return writeRequest;
+                                                                         }];
+    return [self updateCacheForEntries:entries
+                             afterTask:[self batchWriteEntries:entries
+                                                 configuration:configuration]];
+}
+
+- (void)batchSave:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+    configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [[self batchSave:models
+       configuration:configuration] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSError *error = task.error;
+
+        if (completionHandler) {
+            completionHandler(error);
+        }
+        return nil;
+    }];
+}
+
+- (AWSTask *)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models {
+    return [self batchRemove:models
+               configuration:self.objectMapperConfiguration];
+}
+
+- (void)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+  completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [self batchRemove:models
+        configuration:self.objectMapperConfiguration
+    completionHandler:completionHandler];
+}
+
+- (AWSTask *)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+           configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    configuration = configuration ?: self.objectMapperConfiguration;
+    NSArray<AWSDynamoDBObjectMapperBatchEntry *> *entries = [self batchEntriesForModels:models
+                                                                         writeRequest:^AWSDynamoDBWriteRequest *(AWSDynamoDBObjectModel *model) {
+                                                                             AWSDynamoDBWriteRequest *writeRequest = [AWSDynamoDBWriteRequest new];
+                                                                             writeRequest.deleteRequest = [AWSDynamoDBDeleteRequest new];
+                                                                             writeRequest.deleteRequest.key = [model key];
+                                                                             return writeRequest;
+                                                                         }];
+    return [self updateCacheForEntries:entries
+                             afterTask:[self batchWriteEntries:entries
+                                                 configuration:configuration]];
+}
+
+- (void)batchRemove:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+      configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+  completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [[self batchRemove:models
+         configuration:configuration] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSError *error = task.error;
+
+        if (completionHandler) {
+            completionHandler(error);
+        }
+        return nil;
+    }];
+}
+
+#pragma mark - Batch operations
+
+// DynamoDB rejects a batch request that names the same key twice, so models with the same key share one entry.
+- (NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)batchEntriesForModels:(NSArray<AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *)models
+                                                          writeRequest:(AWSDynamoDBWriteRequest * (^ _Nullable)(AWSDynamoDBObjectModel *model))writeRequest {
+    NSMutableArray<AWSDynamoDBObjectMapperBatchEntry *> *entries = [NSMutableArray new];
+    NSMutableDictionary<NSString *, AWSDynamoDBObjectMapperBatchEntry *> *entriesByIdentifier = [NSMutableDictionary new];
+
+    [models enumerateObjectsUsingBlock:^(AWSDynamoDBObjectModel<AWSDynamoDBModeling> *model, NSUInteger idx, BOOL *stop) {
+        NSString *tableName = [[model class] performSelector:@selector(dynamoDBTableName)];
+        NSDictionary *key = [model key];
+        NSString *identifier = [self itemIdentifierForTableName:tableName
+                                                             key:key];
+
+        AWSDynamoDBObjectMapperBatchEntry *entry = entriesByIdentifier[identifier];
+        if (!entry) {
+            entry = [AWSDynamoDBObjectMapperBatchEntry new];
+            entry.identifier = identifier;
+            entry.tableName = tableName;
+            entry.modelClass = [model class];
+            entry.key = key;
+            entry.indexes = [NSMutableArray new];
+            entry.models = [NSMutableArray new];
+            entriesByIdentifier[identifier] = entry;
+            [entries addObject:entry];
+        }
+        // The last model with a key is the one that is saved.
+        if (writeRequest) {
+            entry.writeRequest = writeRequest(model);
+        }
+        [entry.indexes addObject:@(idx)];
+        [entry.models addObject:model];
+    }];
+
+    return entries;
+}
+
+- (NSString *)itemIdentifierForTableName:(NSString *)tableName
+                                      key:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)key {
+    NSMutableString *identifier = [NSMutableString stringWithString:tableName];
+    for (NSString *attributeName in [[key allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        // Key attributes are always strings, numbers or binary.
+        AWSDynamoDBAttributeValue *attributeValue = key[attributeName];
+        NSString *value = attributeValue.S ?: [attributeValue.B base64EncodedStringWithOptions:0];
+        if (attributeValue.N) {
+            // DynamoDB returns numbers in its own notation, for example `100` for `1e+2`.
+            NSDecimalNumber *number = [NSDecimalNumber decimalNumberWithString:attributeValue.N];
+            value = [number isEqualToNumber:[NSDecimalNumber notANumber]] ? attributeValue.N : [number stringValue];
+        }
+        [identifier appendFormat:@"\x1f%@\x1f%@", attributeName, value];
+    }
+    return identifier;
+}
+
+- (AWSTask *)runBatchEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)entries
+                   chunkSize:(NSUInteger)chunkSize
+               configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+                       block:(AWSTask * (^)(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *chunk))block {
+    NSMutableArray *chunks = [NSMutableArray new];
+    for (NSUInteger location = 0; location < entries.count; location += chunkSize) {
+        [chunks addObject:[entries subarrayWithRange:NSMakeRange(location, MIN(chunkSize, entries.count - location))]];
+    }
+
+    AWSDynamoDBObjectMapperBatchQueue *queue = [AWSDynamoDBObjectMapperBatchQueue new];
+    queue.chunks = chunks;
+
+    NSUInteger concurrentRequests = MIN(MAX(configuration.maximumConcurrentBatchRequests, 1), chunks.count);
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray arrayWithCapacity:concurrentRequests];
+    for (NSUInteger i = 0; i < concurrentRequests; i++) {
+        [tasks addObject:[self runChunksInQueue:queue
+                                          block:block]];
+    }
+
+    return [[AWSTask taskForCompletionOfAllTasks:tasks] continueWithBlock:^id(AWSTask *task) {
+        NSError *error = [queue errorWithUnsentChunks];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+        return nil;
+    }];
+}
+
+- (AWSTask *)runChunksInQueue:(AWSDynamoDBObjectMapperBatchQueue *)queue
+                        block:(AWSTask * (^)(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *chunk))block {
+    NSArray<AWSDynamoDBObjectMapperBatchEntry *> *chunk = [queue dequeueChunk];
+    if (!chunk) {
+        return [AWSTask taskWithResult:nil];
+    }
+
+    return [block(chunk) continueWithBlock:^id(AWSTask *task) {
+        if (task.error) {
+            [queue failChunk:chunk
+                   withError:task.error];
+            return nil;
+        }
+        return [self runChunksInQueue:queue
+                                block:block];
+    }];
+}
+
+- (AWSTask *)batchGetEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)entries
+                       items:(NSMutableDictionary<NSString *, NSDictionary *> *)items
+                     attempt:(NSUInteger)attempt
+               configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    NSMutableDictionary<NSString *, AWSDynamoDBObjectMapperBatchEntry *> *entriesByIdentifier = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSArray<NSString *> *> *keyAttributesByTableName = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSMutableArray *> *keysByTableName = [NSMutableDictionary new];
+    for (AWSDynamoDBObjectMapperBatchEntry *entry in entries) {
+        entriesByIdentifier[entry.identifier] = entry;
+        if (!keysByTableName[entry.tableName]) {
+            keysByTableName[entry.tableName] = [NSMutableArray new];
+            keyAttributesByTableName[entry.tableName] = [entry.key allKeys];
+        }
+        [keysByTableName[entry.tableName] addObject:entry.key];
+    }
+
+    AWSDynamoDBBatchGetItemInput *batchGetItemInput = [AWSDynamoDBBatchGetItemInput new];
+    NSMutableDictionary<NSString *, AWSDynamoDBKeysAndAttributes *> *requestItems = [NSMutableDictionary new];
+    for (NSString *tableName in keysByTableName) {
+        AWSDynamoDBKeysAndAttributes *keysAndAttributes = [AWSDynamoDBKeysAndAttributes new];
+        keysAndAttributes.keys = keysByTableName[tableName];
+        keysAndAttributes.consistentRead = configuration.consistentRead;
+        requestItems[tableName] = keysAndAttributes;
+    }
+    batchGetItemInput.requestItems = requestItems;
+
+    return [[self.dynamoDB batchGetItem:batchGetItemInput] continueWithSuccessBlock:^id(AWSTask<AWSDynamoDBBatchGetItemOutput *> *task) {
+        AWSDynamoDBBatchGetItemOutput *batchGetItemOutput = task.result;
+
+        @synchronized (items) {
+            [batchGetItemOutput.responses enumerateKeysAndObjectsUsingBlock:^(NSString *tableName, NSArray<NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *tableItems, BOOL *stop) {
+                NSArray<NSString *> *keyAttributes = keyAttributesByTableName[tableName];
+                NSMutableDictionary<NSString *, NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *tableItemsByIdentifier = [NSMutableDictionary new];
+                for (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *item in tableItems) {
+                    NSDictionary *key = [item dictionaryWithValuesForKeys:keyAttributes];
+                    tableItemsByIdentifier[[self itemIdentifierForTableName:tableName key:key]] = item;
+                }
+                [items addEntriesFromDictionary:tableItemsByIdentifier];
+                [[self.caches objectForKey:tableName] refreshItems:tableItemsByIdentifier];
+            }];
+        }
+
+        NSMutableArray<AWSDynamoDBObjectMapperBatchEntry *> *unprocessedEntries = [NSMutableArray new];
+        [batchGetItemOutput.unprocessedKeys enumerateKeysAndObjectsUsingBlock:^(NSString *tableName, AWSDynamoDBKeysAndAttributes *keysAndAttributes, BOOL *stop) {
+            for (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *key in keysAndAttributes.keys) {
+                AWSDynamoDBObjectMapperBatchEntry *entry = entriesByIdentifier[[self itemIdentifierForTableName:tableName key:key]];
+                if (entry) {
+                    [unprocessedEntries addObject:entry];
+                }
+            }
+        }];
+
+        return [self retryUnprocessedEntries:unprocessedEntries
+                                     attempt:attempt
+                               configuration:configuration
+                                       block:^AWSTask *{
+                                           return [self batchGetEntries:unprocessedEntries
+                                                                  items:items
+                                                                attempt:attempt + 1
+                                                          configuration:configuration];
+                                       }];
+    }];
+}
+
+- (AWSTask *)batchWriteEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)entries
+                 configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    return [self runBatchEntries:entries
+                       chunkSize:AWSDynamoDBObjectMapperBatchWriteItemLimit
+                   configuration:configuration
+                           block:^AWSTask *(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *chunk) {
+                               return [self batchWriteEntries:chunk
+                                                      attempt:0
+                                                configuration:configuration];
+                           }];
+}
+
+- (AWSTask *)batchWriteEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)entries
+                       attempt:(NSUInteger)attempt
+                 configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    NSMutableDictionary<NSString *, AWSDynamoDBObjectMapperBatchEntry *> *entriesByIdentifier = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSArray<NSString *> *> *keyAttributesByTableName = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSMutableArray<AWSDynamoDBWriteRequest *> *> *requestItems = [NSMutableDictionary new];
+    for (AWSDynamoDBObjectMapperBatchEntry *entry in entries) {
+        entriesByIdentifier[entry.identifier] = entry;
+        if (!requestItems[entry.tableName]) {
+            requestItems[entry.tableName] = [NSMutableArray new];
+            keyAttributesByTableName[entry.tableName] = [entry.key allKeys];
+        }
+        [requestItems[entry.tableName] addObject:entry.writeRequest];
+    }
+
+    AWSDynamoDBBatchWriteItemInput *batchWriteItemInput = [AWSDynamoDBBatchWriteItemInput new];
+    batchWriteItemInput.requestItems = requestItems;
+
+    return [[self.dynamoDB batchWriteItem:batchWriteItemInput] continueWithSuccessBlock:^id(AWSTask<AWSDynamoDBBatchWriteItemOutput *> *task) {
+        AWSDynamoDBBatchWriteItemOutput *batchWriteItemOutput = task.result;
+
+        NSMutableArray<AWSDynamoDBObjectMapperBatchEntry *> *unprocessedEntries = [NSMutableArray new];
+        [batchWriteItemOutput.unprocessedItems enumerateKeysAndObjectsUsingBlock:^(NSString *tableName, NSArray<AWSDynamoDBWriteRequest *> *writeRequests, BOOL *stop) {
+            for (AWSDynamoDBWriteRequest *writeRequest in writeRequests) {
+                NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *key = writeRequest.deleteRequest.key;
+                if (writeRequest.putRequest) {
+                    key = [writeRequest.putRequest.item dictionaryWithValuesForKeys:keyAttributesByTableName[tableName]];
+                }
+                AWSDynamoDBObjectMapperBatchEntry *entry = entriesByIdentifier[[self itemIdentifierForTableName:tableName key:key]];
+                if (entry) {
+                    [unprocessedEntries addObject:entry];
+                }
+            }
+        }];
+
+        return [self retryUnprocessedEntries:unprocessedEntries
+                                     attempt:attempt
+                               configuration:configuration
+                                       block:^AWSTask *{
+                                           return [self batchWriteEntries:unprocessedEntries
+                                                                  attempt:attempt + 1
+                                                            configuration:configuration];
+                                       }];
+    }];
+}
+
+- (AWSTask *)retryUnprocessedEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)unprocessedEntries
+                             attempt:(NSUInteger)attempt
+                       configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+                               block:(AWSTask * (^)(void))block {
+    if ([unprocessedEntries count] == 0) {
+        return [AWSTask taskWithResult:nil];
+    }
+
+    if (attempt >= configuration.maximumBatchRetryCount) {
+        NSMutableArray *unprocessedModels = [NSMutableArray new];
+        for (AWSDynamoDBObjectMapperBatchEntry *entry in unprocessedEntries) {
+            [unprocessedModels addObjectsFromArray:entry.models];
+        }
+        AWSDDLogError(@"%lu keys are still unprocessed after %lu retries.", (unsigned long)[unprocessedEntries count], (unsigned long)attempt);
+        return [AWSTask taskWithError:[NSError errorWithDomain:AWSDynamoDBObjectMapperErrorDomain
+                                                          code:AWSDynamoDBObjectMapperErrorUnprocessedItems
+                                                      userInfo:@{AWSDynamoDBObjectMapperUnprocessedModelsKey : unprocessedModels}]];
+    }
+
+    // Unprocessed keys mean the table ran out of throughput, so the retries back off exponentially with full jitter.
+    uint32_t maximumDelay = MIN(AWSDynamoDBObjectMapperBatchRetryBaseDelay << MIN(attempt, 16), AWSDynamoDBObjectMapperBatchRetryMaximumDelay);
+    int delay = (int)arc4random_uniform(maximumDelay + 1);
+    AWSDDLogDebug(@"Retrying %lu unprocessed keys in %d ms.", (unsigned long)[unprocessedEntries count], delay);
+
+    return [[AWSTask taskWithDelay:delay] continueWithSuccessBlock:^id(AWSTask *task) {
+        return block();
+    }];
+}
+
+#pragma mark - Cache
+
+- (AWSTask *)updateCacheForModel:(AWSDynamoDBObjectModel<AWSDynamoDBModeling> *)model
+                            item:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+                       afterTask:(AWSTask *)task {
+    NSString *tableName = [[model class] performSelector:@selector(dynamoDBTableName)];
+    AWSDynamoDBObjectMapperCache *cache = [self.caches objectForKey:tableName];
+    if (!cache) {
+        return task;
+    }
+
+    NSString *identifier = [self itemIdentifierForTableName:tableName
+                                                        key:[model key]];
+    return [task continueWithBlock:^id(AWSTask *task) {
+        // A failed write may still have reached the table, so the cached copy can't be trusted either way.
+        if (item && !task.error && !task.isCancelled) {
+            [cache setItem:item
+                    forKey:identifier];
+        } else {
+            [cache removeItemForKey:identifier];
+        }
+        return task;
+    }];
+}
+
+- (AWSTask *)updateCacheForEntries:(NSArray<AWSDynamoDBObjectMapperBatchEntry *> *)entries
+                         afterTask:(AWSTask *)task {
+    return [task continueWithBlock:^id(AWSTask *task) {
+        for (AWSDynamoDBObjectMapperBatchEntry *entry in entries) {
+            AWSDynamoDBObjectMapperCache *cache = [self.caches objectForKey:entry.tableName];
+            NSDictionary *item = entry.writeRequest.putRequest.item;
+            if (item && !task.error && !task.isCancelled) {
+                [cache setItem:item
+                        forKey:entry.identifier];
+            } else {
+                [cache removeItemForKey:entry.identifier];
+            }
+        }
+        return task;
+    }];
+}
+
+// Items read through an index or a projection may be missing attributes, so they don't refresh the cache.
+- (void)refreshCacheWithItems:(NSArray<NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *)items
+                    tableName:(NSString *)tableName
+                  resultClass:(Class)resultClass {
+    AWSDynamoDBObjectMapperCache *cache = [self.caches objectForKey:tableName];
+    if (!cache) {
+        return;
+    }
+
+    NSMutableArray<NSString *> *keyAttributes = [NSMutableArray arrayWithObject:[self aws_hashKeyAttributeForClass:resultClass]];
+    NSString *rangeKeyAttribute = [self aws_rangeKeyAttributeForClass:resultClass];
+    if (rangeKeyAttribute) {
+        [keyAttributes addObject:rangeKeyAttribute];
+    }
+    NSMutableDictionary<NSString *, NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *itemsByIdentifier = [NSMutableDictionary new];
+    for (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *item in items) {
+        itemsByIdentifier[[self itemIdentifierForTableName:tableName
+                                                       key:[item dictionaryWithValuesForKeys:keyAttributes]]] = item;
+    }
+    [cache refreshItems:itemsByIdentifier];
+}
+
+#pragma mark -
+
 - (AWSTask<AWSDynamoDBPaginatedOutput *> *)query:(Class)resultClass
                                       expression:(AWSDynamoDBQueryExpression *)expression {
     return [self query:resultClass
@@ -579,8 +1365,14 @@ completionHandler:completionHandler];
     queryInput.filterExpression = expression.filterExpression;
     queryInput.projectionExpression = expression.projectionExpression;
 
-    return [self query:resultClass
-            queryInput:queryInput];
+    return [[self query:resultClass
+             queryInput:queryInput] continueWithSuccessBlock:^id(AWSTask<AWSDynamoDBPaginatedOutput *> *task) {
+        AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+        paginatedOutput.readAheadPageCount = configuration.readAheadPageCount;
+        [paginatedOutput readAheadAfterPage:nil];
+
+        return paginatedOutput;
+    }];
 }
 
 // Internal class
@@ -589,6 +1381,12 @@ completionHandler:completionHandler];
     return [[self.dynamoDB query:queryInput] continueWithSuccessBlock:^id(AWSTask *task) {
         AWSDynamoDBQueryOutput *queryOutput = task.result;
 
+        if (!queryInput.indexName && !queryInput.projectionExpression) {
+            [self refreshCacheWithItems:queryOutput.items
+                              tableName:queryInput.tableName
+                            resultClass:resultClass];
+        }
+
         NSMutableArray *items = [NSMutableArray new];
         NSError *error = nil;
         for (id item in queryOutput.items) {
@@ -651,6 +1449,22 @@ completionHandler:completionHandler];
 - (AWSTask<AWSDynamoDBPaginatedOutput *> *)scan:(Class)resultClass
                                      expression:(AWSDynamoDBScanExpression *)expression
                                   configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    AWSDynamoDBScanInput *scanInput = [self scanInput:resultClass
+                                           expression:expression];
+
+    return [[self scan:resultClass
+             scanInput:scanInput] continueWithSuccessBlock:^id(AWSTask<AWSDynamoDBPaginatedOutput *> *task) {
+        AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+        paginatedOutput.readAheadPageCount = configuration.readAheadPageCount;
+        [paginatedOutput readAheadAfterPage:nil];
+
+        return paginatedOutput;
+    }];
+}
+
+// Internal method
+- (AWSDynamoDBScanInput *)scanInput:(Class)resultClass
+                         expression:(AWSDynamoDBScanExpression *)expression {
     AWSDynamoDBScanInput *scanInput = [AWSDynamoDBScanInput new];
     scanInput.tableName = [resultClass performSelector:@selector(dynamoDBTableName)];
     scanInput.limit = expression.limit;
@@ -676,8 +1490,7 @@ completionHandler:completionHandler];
     scanInput.projectionExpression = expression.projectionExpression;
     scanInput.expressionAttributeNames = expression.expressionAttributeNames;
 
-    return [self scan:resultClass
-            scanInput:scanInput];
+    return scanInput;
 }
 
 // Internal class
@@ -686,6 +1499,12 @@ completionHandler:completionHandler];
     return [[self.dynamoDB scan:scanInput] continueWithSuccessBlock:^id(AWSTask *task) {
         AWSDynamoDBScanOutput *scanOutput = task.result;
 
+        if (!scanInput.indexName && !scanInput.projectionExpression) {
+            [self refreshCacheWithItems:scanOutput.items
+                              tableName:scanInput.tableName
+                            resultClass:resultClass];
+        }
+
         NSMutableArray *items = [NSMutableArray new];
         NSError *error = nil;
         for (id item in scanOutput.items) {
@@ -728,6 +1547,70 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
     }];
 }
 
+- (AWSTask *)parallelScan:(Class)resultClass
+               expression:(AWSDynamoDBScanExpression *)expression
+            totalSegments:(NSUInteger)totalSegments
+              pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler {
+    return [self parallelScan:resultClass
+                   expression:expression
+                totalSegments:totalSegments
+                configuration:self.objectMapperConfiguration
+                  pageHandler:pageHandler];
+}
+
+- (void)parallelScan:(Class)resultClass
+          expression:(AWSDynamoDBScanExpression *)expression
+       totalSegments:(NSUInteger)totalSegments
+         pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler
+   completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [self parallelScan:resultClass
+            expression:expression
+         totalSegments:totalSegments
+         configuration:self.objectMapperConfiguration
+           pageHandler:pageHandler
+     completionHandler:completionHandler];
+}
+
+- (AWSTask *)parallelScan:(Class)resultClass
+               expression:(AWSDynamoDBScanExpression *)expression
+            totalSegments:(NSUInteger)totalSegments
+            configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+              pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler {
+    configuration = configuration ?: self.objectMapperConfiguration;
+
+    AWSDynamoDBParallelScan *parallelScan = [AWSDynamoDBParallelScan new];
+    parallelScan.objectMapper = self;
+    parallelScan.resultClass = resultClass;
+    parallelScan.scanInput = [self scanInput:resultClass
+                                  expression:expression];
+    parallelScan.scanInput.exclusiveStartKey = nil;
+    parallelScan.totalSegments = MAX(totalSegments, 1);
+    parallelScan.readAheadPageCount = configuration.readAheadPageCount;
+    parallelScan.pageHandler = pageHandler;
+
+    return [parallelScan start];
+}
+
+- (void)parallelScan:(Class)resultClass
+          expression:(AWSDynamoDBScanExpression *)expression
+       totalSegments:(NSUInteger)totalSegments
+       configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration
+         pageHandler:(void (^)(NSArray<__kindof AWSDynamoDBObjectModel<AWSDynamoDBModeling> *> *items, NSUInteger segment, BOOL *stop))pageHandler
+   completionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
+    [[self parallelScan:resultClass
+             expression:expression
+          totalSegments:totalSegments
+          configuration:configuration
+            pageHandler:pageHandler] continueWithBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSError *error = task.error;
+
+        if (completionHandler) {
+            completionHandler(error);
+        }
+        return nil;
+    }];
+}
+
 #pragma mark - Utility
 
 - (NSDictionary *)removeAttributes:(NSDictionary *)item {
@@ -884,6 +1767,8 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 - (instancetype)init {
     if (self = [super init]) {
         _saveBehavior = AWSDynamoDBObjectMapperSaveBehaviorUpdate;
+        _maximumConcurrentBatchRequests = AWSDynamoDBObjectMapperDefaultMaximumConcurrentBatchRequests;
+        _maximumBatchRetryCount = AWSDynamoDBObjectMapperDefaultMaximumBatchRetryCount;
     }
 
     return self;
@@ -893,6 +1778,9 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
     AWSDynamoDBObjectMapperConfiguration *configuration = [[[self class] allocWithZone:zone] init];
     configuration.saveBehavior = self.saveBehavior;
     configuration.consistentRead = [self.consistentRead copy];
+    configuration.maximumConcurrentBatchRequests = self.maximumConcurrentBatchRequests;
+    configuration.maximumBatchRetryCount = self.maximumBatchRetryCount;
+    configuration.readAheadPageCount = self.readAheadPageCount;
     
     return configuration;
 }
@@ -911,6 +1799,9 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 
 - (AWSTask *)loadNextPage {
     if (self.lastEvaluatedKey) {
+        if (self.readAheadPageCount > 0) {
+            return [self loadReadAheadPage];
+        }
         return [self loadPage];
     }
     
@@ -929,8 +1820,14 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 }
 
 - (AWSTask *)reload {
+    @synchronized (self) {
+        [self.readAheadTasks removeAllObjects];
+    }
     self.lastEvaluatedKey = nil;
-    return [self loadPage];
+    return [[self loadPage] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        [self readAheadAfterPage:nil];
+        return nil;
+    }];
 }
 
 - (void)reloadWithCompletionHandler:(void (^ _Nullable)(NSError * _Nullable error))completionHandler {
@@ -946,6 +1843,9 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
 
 // Internal method
 - (AWSTask *)loadPage {
+    if ((self.queryInput || self.scanInput) && !self.dynamoDBObjectMapper) {
+        return [self objectMapperDeallocatedTask];
+    }
     if (self.queryInput) {
         self.queryInput.exclusiveStartKey = self.lastEvaluatedKey;
         return [[self.dynamoDBObjectMapper query:self.resultClass
@@ -972,4 +1872,90 @@ completionHandler:(void (^ _Nullable)(AWSDynamoDBPaginatedOutput * _Nullable res
     return [AWSTask taskWithResult:nil];
 }
 
+// Internal method
+- (AWSTask<AWSDynamoDBPaginatedOutput *> *)loadPageAfterKey:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)exclusiveStartKey {
+    if ((self.queryInput || self.scanInput) && !self.dynamoDBObjectMapper) {
+        return [self objectMapperDeallocatedTask];
+    }
+    // The inputs are copied because `loadPage` sets the start key of `queryInput` and `scanInput`.
+    if (self.queryInput) {
+        AWSDynamoDBQueryInput *queryInput = [self.queryInput copy];
+        queryInput.exclusiveStartKey = exclusiveStartKey;
+        return [self.dynamoDBObjectMapper query:self.resultClass
+                                     queryInput:queryInput];
+    }
+    if (self.scanInput) {
+        AWSDynamoDBScanInput *scanInput = [self.scanInput copy];
+        scanInput.exclusiveStartKey = exclusiveStartKey;
+        return [self.dynamoDBObjectMapper scan:self.resultClass
+                                     scanInput:scanInput];
+    }
+
+    return [AWSTask taskWithResult:nil];
+}
+
+// Internal method
+- (AWSTask *)objectMapperDeallocatedTask {
+    return [AWSTask taskWithError:[NSError errorWithDomain:AWSDynamoDBObjectMapperErrorDomain
+                                                      code:AWSDynamoDBObjectMapperErrorUnknown
+                                                  userInfo:@{NSLocalizedDescriptionKey : @"The object mapper that returned the paginated output has been deallocated."}]];
+}
+
+// Internal method
+- (void)readAheadAfterPage:(AWSTask<AWSDynamoDBPaginatedOutput *> *)pageTask {
+    @synchronized (self) {
+        if (!self.readAheadTasks) {
+            self.readAheadTasks = [NSMutableArray new];
+        }
+        // Each page is requested once the one before it has arrived, since its start key is that page's last key. Once
+        // the object mapper is gone, `loadReadAheadPage` fails instead of reading ahead.
+        while (self.readAheadTasks.count < self.readAheadPageCount && self.dynamoDBObjectMapper) {
+            AWSTask<AWSDynamoDBPaginatedOutput *> *previousTask = self.readAheadTasks.lastObject ?: pageTask;
+            AWSTask<AWSDynamoDBPaginatedOutput *> *task = nil;
+            if (previousTask) {
+                task = [previousTask continueWithSuccessBlock:^id _Nullable(AWSTask<AWSDynamoDBPaginatedOutput *> * _Nonnull previous) {
+                    NSDictionary *lastEvaluatedKey = previous.result.lastEvaluatedKey;
+                    return lastEvaluatedKey ? [self loadPageAfterKey:lastEvaluatedKey] : nil;
+                }];
+            } else if (self.lastEvaluatedKey) {
+                task = [self loadPageAfterKey:self.lastEvaluatedKey];
+            }
+            if (!task) {
+                break;
+            }
+            [self.readAheadTasks addObject:task];
+        }
+    }
+}
+
+// Internal method
+- (AWSTask *)loadReadAheadPage {
+    AWSTask<AWSDynamoDBPaginatedOutput *> *pageTask = nil;
+    @synchronized (self) {
+        pageTask = self.readAheadTasks.firstObject;
+        if (pageTask) {
+            [self.readAheadTasks removeObjectAtIndex:0];
+        }
+    }
+    if (!pageTask) {
+        pageTask = [self loadPageAfterKey:self.lastEvaluatedKey];
+    }
+    [self readAheadAfterPage:pageTask];
+
+    return [pageTask continueWithBlock:^id _Nullable(AWSTask<AWSDynamoDBPaginatedOutput *> * _Nonnull task) {
+        if (task.error) {
+            // The pages after this one failed with it. They are requested again by the next `loadNextPage`.
+            @synchronized (self) {
+                [self.readAheadTasks removeAllObjects];
+            }
+            return task;
+        }
+        AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+        self.lastEvaluatedKey = paginatedOutput.lastEvaluatedKey;
+        self.items = paginatedOutput.items;
+
+        return nil;
+    }];
+}
+
 @end
@@ -0,0 +1,122 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A local cache of the items of one Amazon DynamoDB table, for `AWSDynamoDBObjectMapper`.
+
+ Once set with `-[AWSDynamoDBObjectMapper setCache:forTableName:]`, `load:` returns items from the cache while they
+ are younger than `timeToLive`, and keeps the items it loads. The cache is keyed by the primary key of the items.
+
+ The cache is written through: a successful `save:` with `AWSDynamoDBObjectMapperSaveBehaviorClobber` or
+ `AWSDynamoDBObjectMapperSaveBehaviorUpdate` stores the saved item, and any other save or a remove drops it. Loads with
+ `consistentRead` set to `@YES` always read the table, and store what they read. Items read by `batchLoad:`, `query:`
+ and `scan:` replace the cached copies of the same items.
+
+ Writes by other clients are only noticed through `timeToLive` and `versionAttribute`.
+
+ Items are kept in memory, and the least recently used ones are evicted beyond `countLimit`. A cache with a
+ `databasePath` also keeps every item in a SQLite database, so it survives memory evictions and relaunches.
+ */
+@interface AWSDynamoDBObjectMapperCache : NSObject
+
+/**
+ Returns an in-memory cache.
+
+ @param countLimit The number of items kept in memory.
+ @param timeToLive How long a cached item is returned, in seconds.
+
+ @return The cache.
+ */
++ (instancetype)cacheWithCountLimit:(NSUInteger)countLimit
+                         timeToLive:(NSTimeInterval)timeToLive;
+
+/**
+ Returns a cache, with a SQLite tier if `databasePath` is set.
+
+ @param countLimit   The number of items kept in memory.
+ @param timeToLive   How long a cached item is returned, in seconds.
+ @param databasePath The file path of the SQLite database, created if necessary. Expired items are deleted from it when
+                     it is opened. Use one database per cache.
+
+ @return The cache. `nil` if the database couldn't be opened.
+ */
+- (nullable instancetype)initWithCountLimit:(NSUInteger)countLimit
+                                 timeToLive:(NSTimeInterval)timeToLive
+                               databasePath:(nullable NSString *)databasePath NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, assign, readonly) NSUInteger countLimit;
+
+@property (nonatomic, assign, readonly) NSTimeInterval timeToLive;
+
+@property (nonatomic, strong, readonly, nullable) NSString *databasePath;
+
+/**
+ The name of an attribute whose value changes on every write to an item, such as a version number the app increments.
+
+ When set, an item read by `batchLoad:`, `query:` or `scan:` replaces its cached copy only if its version is greater,
+ and drops it if the versions can't be compared. When `nil`, items read from the table always replace their cached
+ copies.
+ */
+@property (atomic, copy, nullable) NSString *versionAttribute;
+
+/**
+ The number of `load:` calls answered from memory or from the database.
+ */
+@property (atomic, assign, readonly) NSUInteger hitCount;
+
+/**
+ The number of `load:` calls answered from the database after the item was evicted from memory.
+ */
+@property (atomic, assign, readonly) NSUInteger databaseHitCount;
+
+/**
+ The number of `load:` calls that found no cached item and read the table. Consistent reads aren't counted.
+ */
+@property (atomic, assign, readonly) NSUInteger missCount;
+
+/**
+ `hitCount` divided by the number of `load:` calls that looked at the cache, or `0` before the first one.
+ */
+@property (atomic, assign, readonly) double hitRate;
+
+/**
+ The mean time in seconds of the `load:` calls answered from the cache.
+ */
+@property (atomic, assign, readonly) NSTimeInterval averageHitLatency;
+
+/**
+ The mean time in seconds of the `load:` calls that read the table after a miss.
+ */
+@property (atomic, assign, readonly) NSTimeInterval averageMissLatency;
+
+/**
+ Sets the counts and latencies to zero.
+ */
+- (void)resetStatistics;
+
+/**
+ Drops every item from memory and from the database.
+ */
+- (void)removeAllItems;
+
+@end
+
+NS_ASSUME_NONNULL_END
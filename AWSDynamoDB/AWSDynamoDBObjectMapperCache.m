@@ -0,0 +1,576 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSDynamoDBObjectMapperCache.h"
+#import <AWSCore/AWSCore.h>
+#import "AWSDynamoDBModel.h"
+
+@interface AWSDynamoDBObjectMapperCacheEntry : NSObject
+
+@property (nonatomic, strong) NSString *key;
+@property (nonatomic, strong) NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *item;
+@property (nonatomic, assign) NSTimeInterval expirationDate;
+// The entries are owned by the dictionary of the cache. The list only orders them, most recently used first.
+@property (nonatomic, unsafe_unretained) AWSDynamoDBObjectMapperCacheEntry *previous;
+@property (nonatomic, unsafe_unretained) AWSDynamoDBObjectMapperCacheEntry *next;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperCacheEntry
+
+@end
+
+// The reads of one key that are in flight. Writes to the key bump `generation`, so that the reads don't store what they
+// read over what was written.
+@interface AWSDynamoDBObjectMapperCacheFill : NSObject
+
+@property (nonatomic, assign) NSUInteger count;
+@property (nonatomic, assign) NSUInteger generation;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperCacheFill
+
+@end
+
+@interface AWSDynamoDBObjectMapperCache()
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSDynamoDBObjectMapperCacheEntry *> *entries;
+@property (nonatomic, unsafe_unretained) AWSDynamoDBObjectMapperCacheEntry *head;
+@property (nonatomic, unsafe_unretained) AWSDynamoDBObjectMapperCacheEntry *tail;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSDynamoDBObjectMapperCacheFill *> *fills;
+@property (nonatomic, strong) AWSFMDatabaseStore *databaseStore;
+// Runs the statements of `databaseStore` in the order they were issued, outside of the lock of the cache.
+@property (nonatomic, strong) dispatch_queue_t databaseQueue;
+
+@property (atomic, assign) NSUInteger hitCount;
+@property (atomic, assign) NSUInteger databaseHitCount;
+@property (atomic, assign) NSUInteger missCount;
+@property (nonatomic, assign) NSTimeInterval totalHitLatency;
+@property (nonatomic, assign) NSTimeInterval totalMissLatency;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperCache
+
++ (instancetype)cacheWithCountLimit:(NSUInteger)countLimit
+                         timeToLive:(NSTimeInterval)timeToLive {
+    return [[self alloc] initWithCountLimit:countLimit
+                                 timeToLive:timeToLive
+                               databasePath:nil];
+}
+
+- (instancetype)init {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:@"`- init` is not a valid initializer. Use `+ cacheWithCountLimit:timeToLive:` instead."
+                                 userInfo:nil];
+}
+
+- (instancetype)initWithCountLimit:(NSUInteger)countLimit
+                        timeToLive:(NSTimeInterval)timeToLive
+                      databasePath:(NSString *)databasePath {
+    if (self = [super init]) {
+        _countLimit = MAX(countLimit, 1);
+        _timeToLive = timeToLive;
+        _databasePath = [databasePath copy];
+        _entries = [NSMutableDictionary new];
+        _fills = [NSMutableDictionary new];
+
+        if (_databasePath) {
+            _databaseQueue = dispatch_queue_create("com.amazonaws.AWSDynamoDBObjectMapperCache", DISPATCH_QUEUE_SERIAL);
+            _databaseStore = [AWSFMDatabaseStore storeWithPath:_databasePath];
+            __block BOOL created = NO;
+            [_databaseStore inDatabase:^(AWSFMDatabase *db) {
+                created = [db executeUpdate:@"CREATE TABLE IF NOT EXISTS item (key TEXT PRIMARY KEY, data BLOB NOT NULL, expiration REAL NOT NULL)"]
+                && [db executeUpdate:@"DELETE FROM item WHERE expiration <= ?", @([NSDate timeIntervalSinceReferenceDate])];
+                if (!created) {
+                    AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                }
+            }];
+            if (!created) {
+                return nil;
+            }
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    AWSFMDatabaseStore *databaseStore = _databaseStore;
+    if (databaseStore) {
+        dispatch_async(_databaseQueue, ^{
+            [databaseStore close];
+        });
+    }
+}
+
+#pragma mark - Statistics
+
+- (double)hitRate {
+    @synchronized (self) {
+        NSUInteger lookupCount = self.hitCount + self.missCount;
+        return lookupCount > 0 ? (double)self.hitCount / lookupCount : 0;
+    }
+}
+
+- (NSTimeInterval)averageHitLatency {
+    @synchronized (self) {
+        return self.hitCount > 0 ? self.totalHitLatency / self.hitCount : 0;
+    }
+}
+
+- (NSTimeInterval)averageMissLatency {
+    @synchronized (self) {
+        return self.missCount > 0 ? self.totalMissLatency / self.missCount : 0;
+    }
+}
+
+- (void)resetStatistics {
+    @synchronized (self) {
+        self.hitCount = 0;
+        self.databaseHitCount = 0;
+        self.missCount = 0;
+        self.totalHitLatency = 0;
+        self.totalMissLatency = 0;
+    }
+}
+
+// Internal method
+- (void)recordLoadWithLatency:(NSTimeInterval)latency
+                          hit:(BOOL)hit {
+    @synchronized (self) {
+        if (hit) {
+            self.hitCount++;
+            self.totalHitLatency += latency;
+        } else {
+            self.missCount++;
+            self.totalMissLatency += latency;
+        }
+    }
+}
+
+#pragma mark - Items
+
+// Internal method
+- (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)itemForKey:(NSString *)key {
+    NSUInteger generation = 0;
+    @synchronized (self) {
+        AWSDynamoDBObjectMapperCacheEntry *entry = self.entries[key];
+        if (entry) {
+            if (entry.expirationDate <= [NSDate timeIntervalSinceReferenceDate]) {
+                // Expiring isn't a write, so the loads of the key in flight may still fill it.
+                [self dropItemForKey:key];
+                return nil;
+            }
+            [self moveEntryToHead:entry];
+            return entry.item;
+        }
+        if (!self.databaseStore) {
+            return nil;
+        }
+        generation = [self beginFillForKey:key];
+    }
+
+    __block NSTimeInterval expirationDate = 0;
+    __block NSDictionary *item = nil;
+    dispatch_sync(self.databaseQueue, ^{
+        item = [self databaseItemForKey:key expirationDate:&expirationDate];
+    });
+
+    @synchronized (self) {
+        BOOL current = [self endFillForKey:key generation:generation];
+        if (!current || !item || expirationDate <= [NSDate timeIntervalSinceReferenceDate]) {
+            return nil;
+        }
+        self.databaseHitCount++;
+        [self insertItem:item forKey:key expirationDate:expirationDate];
+        return item;
+    }
+}
+
+// Internal method
+- (void)setItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+         forKey:(NSString *)key {
+    NSData *data = [self archivedItem:&item];
+    @synchronized (self) {
+        self.fills[key].generation++;
+        [self storeItem:item data:data forKey:key];
+    }
+}
+
+// Internal method
+- (NSUInteger)beginFillForKey:(NSString *)key {
+    @synchronized (self) {
+        AWSDynamoDBObjectMapperCacheFill *fill = self.fills[key];
+        if (!fill) {
+            fill = [AWSDynamoDBObjectMapperCacheFill new];
+            self.fills[key] = fill;
+        }
+        fill.count++;
+        return fill.generation;
+    }
+}
+
+// Internal method
+- (void)fillItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+          forKey:(NSString *)key
+      generation:(NSUInteger)generation {
+    NSData *data = item ? [self archivedItem:&item] : nil;
+    @synchronized (self) {
+        if (![self endFillForKey:key generation:generation]) {
+            // The key was written since the read began, and the write is newer than what was read.
+            return;
+        }
+        if (item) {
+            [self storeItem:item data:data forKey:key];
+        } else {
+            [self dropItemForKey:key];
+        }
+    }
+}
+
+// Internal method
+- (void)cancelFillForKey:(NSString *)key {
+    @synchronized (self) {
+        [self endFillForKey:key generation:self.fills[key].generation];
+    }
+}
+
+// Internal method
+- (void)refreshItems:(NSDictionary<NSString *, NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *)itemsByKey {
+    // Refreshing is a fill: if a key is written while the cached item is compared, the write wins.
+    NSMutableDictionary<NSString *, NSNumber *> *generations = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSDictionary *> *cachedItems = [NSMutableDictionary new];
+    @synchronized (self) {
+        for (NSString *key in itemsByKey) {
+            NSDictionary *cachedItem = self.entries[key].item;
+            if (cachedItem) {
+                cachedItems[key] = cachedItem;
+            } else if (!self.databaseStore) {
+                continue;
+            }
+            generations[key] = @([self beginFillForKey:key]);
+        }
+    }
+
+    NSMutableArray<NSString *> *databaseKeys = [NSMutableArray new];
+    for (NSString *key in generations) {
+        NSDictionary *cachedItem = cachedItems[key];
+        if (cachedItem) {
+            [self refreshItem:itemsByKey[key] cachedItem:cachedItem forKey:key generation:generations[key].unsignedIntegerValue];
+        } else {
+            [databaseKeys addObject:key];
+        }
+    }
+    if (databaseKeys.count == 0) {
+        return;
+    }
+
+    // The items that are only in the database are compared after one read of them all, which runs on the database
+    // queue after the writes queued before it, rather than on the thread of the response.
+    dispatch_async(self.databaseQueue, ^{
+        NSDictionary<NSString *, NSDictionary *> *databaseItems = [self databaseItemsForKeys:databaseKeys];
+        for (NSString *key in databaseKeys) {
+            NSDictionary *cachedItem = databaseItems[key];
+            if (cachedItem) {
+                [self refreshItem:itemsByKey[key] cachedItem:cachedItem forKey:key generation:generations[key].unsignedIntegerValue];
+            } else {
+                [self cancelFillForKey:key];
+            }
+        }
+    });
+}
+
+- (void)refreshItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+         cachedItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)cachedItem
+             forKey:(NSString *)key
+         generation:(NSUInteger)generation {
+    NSString *versionAttribute = self.versionAttribute;
+    if (!versionAttribute) {
+        // Rewriting an unchanged item would only restart its time to live.
+        if ([item isEqualToDictionary:cachedItem]) {
+            [self cancelFillForKey:key];
+        } else {
+            [self storeRefreshedItem:item forKey:key generation:generation];
+        }
+        return;
+    }
+
+    AWSDynamoDBAttributeValue *version = item[versionAttribute];
+    AWSDynamoDBAttributeValue *cachedVersion = cachedItem[versionAttribute];
+    if (version.N && cachedVersion.N) {
+        NSComparisonResult result = [[NSDecimalNumber decimalNumberWithString:version.N] compare:[NSDecimalNumber decimalNumberWithString:cachedVersion.N]];
+        if (result == NSOrderedDescending) {
+            [self storeRefreshedItem:item forKey:key generation:generation];
+        } else {
+            [self cancelFillForKey:key];
+        }
+    } else if (version.S && [version.S isEqualToString:cachedVersion.S]) {
+        [self cancelFillForKey:key];
+    } else {
+        [self storeRefreshedItem:nil forKey:key generation:generation];
+    }
+}
+
+// A refresh is newer than what the other reads of the key in flight may return from the database, so for them it
+// counts as a write.
+- (void)storeRefreshedItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)item
+                    forKey:(NSString *)key
+                generation:(NSUInteger)generation {
+    NSData *data = item ? [self archivedItem:&item] : nil;
+    @synchronized (self) {
+        if (![self endFillForKey:key generation:generation]) {
+            return;
+        }
+        self.fills[key].generation++;
+        if (item) {
+            [self storeItem:item data:data forKey:key];
+        } else {
+            [self dropItemForKey:key];
+        }
+    }
+}
+
+// Internal method
+- (void)removeItemForKey:(NSString *)key {
+    @synchronized (self) {
+        self.fills[key].generation++;
+        [self dropItemForKey:key];
+    }
+}
+
+- (void)removeAllItems {
+    @synchronized (self) {
+        for (AWSDynamoDBObjectMapperCacheFill *fill in [self.fills allValues]) {
+            fill.generation++;
+        }
+        self.head = nil;
+        self.tail = nil;
+        [self.entries removeAllObjects];
+        [self performDatabaseBlock:^(AWSFMDatabase *db) {
+            if (![db executeUpdate:@"DELETE FROM item"]) {
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+            }
+        }];
+    }
+}
+
+// Must be called while the cache is locked. Returns whether no write happened since the fill began.
+- (BOOL)endFillForKey:(NSString *)key
+           generation:(NSUInteger)generation {
+    AWSDynamoDBObjectMapperCacheFill *fill = self.fills[key];
+    BOOL current = fill.generation == generation;
+    if (--fill.count == 0) {
+        [self.fills removeObjectForKey:key];
+    }
+    return current;
+}
+
+// Must be called while the cache is locked.
+- (void)storeItem:(NSDictionary *)item
+             data:(NSData *)data
+           forKey:(NSString *)key {
+    NSTimeInterval expirationDate = [NSDate timeIntervalSinceReferenceDate] + self.timeToLive;
+    [self insertItem:item forKey:key expirationDate:expirationDate];
+
+    if (!self.databaseStore) {
+        return;
+    }
+    if (!data) {
+        [self removeDatabaseItemForKey:key];
+        return;
+    }
+    [self performDatabaseBlock:^(AWSFMDatabase *db) {
+        if (![db executeUpdate:@"INSERT OR REPLACE INTO item (key, data, expiration) VALUES (?, ?, ?)", key, data, @(expirationDate)]) {
+            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+        }
+    }];
+}
+
+// Must be called while the cache is locked.
+- (void)dropItemForKey:(NSString *)key {
+    AWSDynamoDBObjectMapperCacheEntry *entry = self.entries[key];
+    if (entry) {
+        [self unlinkEntry:entry];
+        [self.entries removeObjectForKey:key];
+    }
+    [self removeDatabaseItemForKey:key];
+}
+
+// Replaces `item` with a copy that can be archived, and returns the archive if the cache has a database.
+- (NSData *)archivedItem:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> **)item {
+    // Items decoded lazily are subclasses of `NSDictionary` that can't be archived.
+    *item = [NSDictionary dictionaryWithDictionary:*item];
+    if (!self.databaseStore) {
+        return nil;
+    }
+
+    NSError *error = nil;
+    NSData *data = [AWSNSCodingUtilities versionSafeArchivedDataWithRootObject:*item
+                                                         requiringSecureCoding:YES
+                                                                         error:&error];
+    if (!data) {
+        AWSDDLogError(@"Failed to archive the item. [%@]", error);
+    }
+    return data;
+}
+
+#pragma mark - Memory
+
+- (void)insertItem:(NSDictionary *)item
+            forKey:(NSString *)key
+    expirationDate:(NSTimeInterval)expirationDate {
+    AWSDynamoDBObjectMapperCacheEntry *entry = self.entries[key];
+    if (!entry) {
+        entry = [AWSDynamoDBObjectMapperCacheEntry new];
+        entry.key = key;
+        self.entries[key] = entry;
+    }
+    entry.item = item;
+    entry.expirationDate = expirationDate;
+    [self moveEntryToHead:entry];
+
+    // Evicted items stay in the database.
+    while (self.entries.count > self.countLimit) {
+        AWSDynamoDBObjectMapperCacheEntry *leastRecentlyUsed = self.tail;
+        [self unlinkEntry:leastRecentlyUsed];
+        [self.entries removeObjectForKey:leastRecentlyUsed.key];
+    }
+}
+
+- (void)moveEntryToHead:(AWSDynamoDBObjectMapperCacheEntry *)entry {
+    if (self.head == entry) {
+        return;
+    }
+    [self unlinkEntry:entry];
+    entry.next = self.head;
+    self.head.previous = entry;
+    self.head = entry;
+    if (!self.tail) {
+        self.tail = entry;
+    }
+}
+
+- (void)unlinkEntry:(AWSDynamoDBObjectMapperCacheEntry *)entry {
+    if (entry.previous) {
+        entry.previous.next = entry.next;
+    } else if (self.head == entry) {
+        self.head = entry.next;
+    }
+    if (entry.next) {
+        entry.next.previous = entry.previous;
+    } else if (self.tail == entry) {
+        self.tail = entry.previous;
+    }
+    entry.previous = nil;
+    entry.next = nil;
+}
+
+#pragma mark - Database
+
+- (NSDictionary *)databaseItemForKey:(NSString *)key
+                      expirationDate:(NSTimeInterval *)expirationDate {
+    if (!self.databaseStore) {
+        return nil;
+    }
+
+    __block NSData *data = nil;
+    [self.databaseStore inReadDatabase:^(AWSFMDatabase *db) {
+        AWSFMResultSet *rs = [db executeQuery:@"SELECT data, expiration FROM item WHERE key = ?", key];
+        if (!rs) {
+            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+            return;
+        }
+        if ([rs next]) {
+            data = [rs dataForColumn:@"data"];
+            *expirationDate = [rs doubleForColumn:@"expiration"];
+        }
+        [rs close];
+    }];
+    return [self unarchivedItemWithData:data];
+}
+
+// Returns the items of the keys that haven't expired.
+- (NSDictionary<NSString *, NSDictionary *> *)databaseItemsForKeys:(NSArray<NSString *> *)keys {
+    // Stays well under the limit of SQLite on the number of parameters of a statement.
+    static NSUInteger const AWSDynamoDBObjectMapperCacheKeysPerQuery = 500;
+
+    NSMutableDictionary<NSString *, NSData *> *archives = [NSMutableDictionary new];
+    [self.databaseStore inReadDatabase:^(AWSFMDatabase *db) {
+        for (NSUInteger location = 0; location < keys.count; location += AWSDynamoDBObjectMapperCacheKeysPerQuery) {
+            NSArray<NSString *> *chunk = [keys subarrayWithRange:NSMakeRange(location, MIN(AWSDynamoDBObjectMapperCacheKeysPerQuery, keys.count - location))];
+            NSMutableArray<NSString *> *placeholders = [NSMutableArray arrayWithCapacity:chunk.count];
+            for (NSUInteger i = 0; i < chunk.count; i++) {
+                [placeholders addObject:@"?"];
+            }
+            NSString *query = [NSString stringWithFormat:@"SELECT key, data FROM item WHERE expiration > ? AND key IN (%@)", [placeholders componentsJoinedByString:@", "]];
+            NSArray *arguments = [@[@([NSDate timeIntervalSinceReferenceDate])] arrayByAddingObjectsFromArray:chunk];
+            AWSFMResultSet *rs = [db executeQuery:query withArgumentsInArray:arguments];
+            if (!rs) {
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                return;
+            }
+            while ([rs next]) {
+                archives[[rs stringForColumn:@"key"]] = [rs dataForColumn:@"data"];
+            }
+            [rs close];
+        }
+    }];
+
+    NSMutableDictionary<NSString *, NSDictionary *> *items = [NSMutableDictionary new];
+    for (NSString *key in archives) {
+        items[key] = [self unarchivedItemWithData:archives[key]];
+    }
+    return items;
+}
+
+- (NSDictionary *)unarchivedItemWithData:(NSData *)data {
+    if (!data) {
+        return nil;
+    }
+
+    NSError *error = nil;
+    NSSet *classes = [NSSet setWithObjects:[NSDictionary class], [NSArray class], [NSString class], [NSNumber class], [NSData class], [AWSDynamoDBAttributeValue class], nil];
+    NSDictionary *item = [AWSNSCodingUtilities versionSafeUnarchivedObjectOfClasses:classes
+                                                                           fromData:data
+                                                                              error:&error];
+    if (![item isKindOfClass:[NSDictionary class]]) {
+        AWSDDLogError(@"Failed to unarchive the cached item. [%@]", error);
+        return nil;
+    }
+    return item;
+}
+
+- (void)removeDatabaseItemForKey:(NSString *)key {
+    [self performDatabaseBlock:^(AWSFMDatabase *db) {
+        if (![db executeUpdate:@"DELETE FROM item WHERE key = ?", key]) {
+            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+        }
+    }];
+}
+
+// Queues a write. Writes are queued while the cache is locked, so they reach the database in the order of the changes
+// in memory, but run after the lock is released.
+- (void)performDatabaseBlock:(void (^)(AWSFMDatabase *db))block {
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
+    if (!databaseStore) {
+        return;
+    }
+    dispatch_async(self.databaseQueue, ^{
+        [databaseStore inDatabase:block];
+    });
+}
+
+@end
@@ -35,6 +35,13 @@ FOUNDATION_EXPORT NSString *const AWSDynamoDBSDKVersion;
  */
 @property (nonatomic, strong, readonly) AWSServiceConfiguration *configuration;
 
+/**
+ Whether the items of `scan:` and `query:` outputs are decoded lazily. When `YES`, `items` keeps the response body and
+ decodes each item, and each attribute of an item, the first time it is read, which suits pages where only a few
+ attributes of each item are used. Fully read, the items are equal to the ones decoded up front. The default is `NO`.
+ */
+@property (nonatomic, assign) BOOL lazilyDecodesItems;
+
 /**
  Returns the singleton service client. If the singleton object does not exist, the SDK instantiates the default service client with `defaultServiceConfiguration` from `[AWSServiceManager defaultServiceManager]`. The reference to this object is maintained by the SDK, and you do not need to retain it manually.
 
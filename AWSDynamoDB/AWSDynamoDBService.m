@@ -20,6 +20,7 @@
 #import <AWSCore/AWSService.h>
 #import <AWSCore/AWSURLRequestSerialization.h>
 #import <AWSCore/AWSURLResponseSerialization.h>
+#import <AWSCore/AWSJSONModelCodec.h>
 #import <AWSCore/AWSURLRequestRetryHandler.h>
 #import <AWSCore/AWSSynchronizedMutableDictionary.h>
 #import "AWSDynamoDBResources.h"
@@ -276,8 +277,17 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
             request = [AWSRequest new];
         }
 
+        // Items make up most of DynamoDB traffic, so models are encoded and decoded directly when the operation allows it.
+        AWSJSONModelCodec *codec = [AWSJSONModelCodec codecWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                   actionName:operationName
+                                                             modelClassPrefix:@"AWSDynamoDB"];
+        NSData *encodedBody = nil;
+        if ([request isMemberOfClass:codec.inputClass]) {
+            encodedBody = [codec JSONDataFromModel:request error:nil];
+        }
+
         AWSNetworkingRequest *networkingRequest = request.internalRequest;
-        if (request) {
+        if (request && !encodedBody) {
             networkingRequest.parameters = [[AWSMTLJSONAdapter JSONDictionaryFromModel:request] aws_removeNullValues];
         } else {
             networkingRequest.parameters = @{};
@@ -287,11 +297,18 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         headers[@"X-Amz-Target"] = [NSString stringWithFormat:@"%@.%@", targetPrefix, operationName];
         networkingRequest.headers = headers;
         networkingRequest.HTTPMethod = HTTPMethod;
-        networkingRequest.requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
-                                                                                                   actionName:operationName];
-        networkingRequest.responseSerializer = [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
-                                                                                             actionName:operationName
-                                                                                            outputClass:outputClass];
+        AWSJSONRequestSerializer *requestSerializer = [[AWSJSONRequestSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                                                    actionName:operationName];
+        requestSerializer.encodedBody = encodedBody;
+        networkingRequest.requestSerializer = requestSerializer;
+        AWSDynamoDBResponseSerializer *responseSerializer = [[AWSDynamoDBResponseSerializer alloc] initWithJSONDefinition:[[AWSDynamoDBResources sharedInstance] JSONObject]
+                                                                                                                actionName:operationName
+                                                                                                               outputClass:outputClass];
+        responseSerializer.codec = codec;
+        if (self.lazilyDecodesItems && ([operationName isEqualToString:@"Scan"] || [operationName isEqualToString:@"Query"])) {
+            responseSerializer.lazilyDecodedMemberName = @"Items";
+        }
+        networkingRequest.responseSerializer = responseSerializer;
         
         return [self.networking sendRequest:networkingRequest];
     }
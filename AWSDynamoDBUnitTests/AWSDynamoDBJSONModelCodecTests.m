@@ -0,0 +1,299 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSDynamoDB.h"
+#import "AWSDynamoDBResources.h"
+
+// About 1 MB of items once encoded.
+static const NSUInteger AWSDynamoDBJSONModelCodecTestsItemCount = 4000;
+
+@interface AWSDynamoDBJSONModelCodecTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+@property (nonatomic, strong) NSHTTPURLResponse *response;
+
+@end
+
+@implementation AWSDynamoDBJSONModelCodecTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSDynamoDBResources sharedInstance] JSONObject];
+    self.response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]
+                                                statusCode:200
+                                               HTTPVersion:@"HTTP/1.1"
+                                              headerFields:@{}];
+}
+
+- (AWSJSONModelCodec *)codecForOperation:(NSString *)operationName {
+    return [AWSJSONModelCodec codecWithJSONDefinition:self.definition
+                                           actionName:operationName
+                                     modelClassPrefix:@"AWSDynamoDB"];
+}
+
+#pragma mark - Helpers
+
+- (AWSDynamoDBAttributeValue *)attributeValueWithKey:(NSString *)key value:(id)value {
+    AWSDynamoDBAttributeValue *attributeValue = [AWSDynamoDBAttributeValue new];
+    [attributeValue setValue:value forKey:key];
+    return attributeValue;
+}
+
+- (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)itemAtIndex:(NSUInteger)index {
+    return @{@"id": [self attributeValueWithKey:@"S" value:[NSString stringWithFormat:@"item-%06lu", (unsigned long)index]],
+             @"count": [self attributeValueWithKey:@"N" value:[NSString stringWithFormat:@"%lu", (unsigned long)index]],
+             @"active": [self attributeValueWithKey:@"BOOLEAN" value:(index % 2 == 0 ? @YES : @NO)],
+             @"deleted": [self attributeValueWithKey:@"NIL" value:@YES],
+             @"digest": [self attributeValueWithKey:@"B" value:[@"\x01\x02\x03" dataUsingEncoding:NSUTF8StringEncoding]],
+             @"tags": [self attributeValueWithKey:@"SS" value:@[@"red", @"green", @"\"quoted\"\n"]],
+             @"scores": [self attributeValueWithKey:@"NS" value:@[@"1", @"2.5"]],
+             @"profile": [self attributeValueWithKey:@"M" value:@{@"name": [self attributeValueWithKey:@"S" value:@"Zoë 東京"],
+                                                                  @"visits": [self attributeValueWithKey:@"L" value:@[[self attributeValueWithKey:@"N" value:@"1"],
+                                                                                                                      [self attributeValueWithKey:@"N" value:@"2"]]]}]};
+}
+
+- (NSDictionary *)JSONItemAtIndex:(NSUInteger)index {
+    return @{@"id": @{@"S": [NSString stringWithFormat:@"item-%06lu", (unsigned long)index]},
+             @"count": @{@"N": [NSString stringWithFormat:@"%lu", (unsigned long)index]},
+             @"active": @{@"BOOL": (index % 2 == 0 ? @YES : @NO)},
+             @"digest": @{@"B": @"AQID"},
+             @"tags": @{@"SS": @[@"red", @"green", @"blue"]},
+             @"profile": @{@"M": @{@"name": @{@"S": @"Jane Doe"},
+                                   @"email": @{@"S": @"jane@example.com"},
+                                   @"visits": @{@"L": @[@{@"N": @"1"}, @{@"N": @"2"}, @{@"N": @"3"}]}}}};
+}
+
+- (NSData *)batchGetItemResponseData {
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSDynamoDBJSONModelCodecTestsItemCount; i++) {
+        [items addObject:[self JSONItemAtIndex:i]];
+    }
+    return [NSJSONSerialization dataWithJSONObject:@{@"Responses": @{@"Table": items},
+                                                     @"UnprocessedKeys": @{@"Other": @{@"Keys": @[@{@"id": @{@"S": @"a"}}],
+                                                                                       @"ConsistentRead": @YES}},
+                                                     @"ConsumedCapacity": @[@{@"TableName": @"Table", @"CapacityUnits": @2000.5}]}
+                                           options:kNilOptions
+                                             error:nil];
+}
+
+- (void)assertModel:(AWSModel *)model encodesLikeDictionaryPathForOperation:(NSString *)operationName {
+    NSError *error = nil;
+    NSData *expectedData = [AWSJSONBuilder jsonDataForDictionary:[[AWSMTLJSONAdapter JSONDictionaryFromModel:model] aws_removeNullValues]
+                                                      actionName:operationName
+                                           serviceDefinitionRule:self.definition
+                                                           error:&error];
+    XCTAssertNil(error);
+
+    NSData *data = [[self codecForOperation:operationName] JSONDataFromModel:model error:&error];
+    XCTAssertNil(error);
+    XCTAssertNotNil(data);
+
+    id expected = [NSJSONSerialization JSONObjectWithData:expectedData options:kNilOptions error:nil];
+    id actual = [NSJSONSerialization JSONObjectWithData:data options:kNilOptions error:nil];
+    XCTAssertNotNil(actual, @"%@", [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]);
+    XCTAssertEqualObjects(actual, expected);
+}
+
+- (void)assertData:(NSData *)data decodesLikeDictionaryPathForOperation:(NSString *)operationName outputClass:(Class)outputClass {
+    NSError *error = nil;
+    NSDictionary *JSONDictionary = [AWSJSONParser dictionaryForJsonData:data
+                                                               response:self.response
+                                                             actionName:operationName
+                                                  serviceDefinitionRule:self.definition
+                                                                  error:&error];
+    XCTAssertNil(error);
+    id expected = [AWSMTLJSONAdapter modelOfClass:outputClass fromJSONDictionary:JSONDictionary error:&error];
+    XCTAssertNil(error);
+
+    id actual = [[self codecForOperation:operationName] modelFromJSONData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertTrue([actual isKindOfClass:outputClass]);
+    XCTAssertEqualObjects(actual, expected);
+}
+
+#pragma mark - Conformance
+
+- (void)testCodecsForItemOperations {
+    NSDictionary<NSString *, NSArray *> *operations = @{@"BatchGetItem": @[[AWSDynamoDBBatchGetItemInput class], [AWSDynamoDBBatchGetItemOutput class]],
+                                                        @"BatchWriteItem": @[[AWSDynamoDBBatchWriteItemInput class], [AWSDynamoDBBatchWriteItemOutput class]],
+                                                        @"GetItem": @[[AWSDynamoDBGetItemInput class], [AWSDynamoDBGetItemOutput class]],
+                                                        @"PutItem": @[[AWSDynamoDBPutItemInput class], [AWSDynamoDBPutItemOutput class]],
+                                                        @"UpdateItem": @[[AWSDynamoDBUpdateItemInput class], [AWSDynamoDBUpdateItemOutput class]],
+                                                        @"Query": @[[AWSDynamoDBQueryInput class], [AWSDynamoDBQueryOutput class]],
+                                                        @"Scan": @[[AWSDynamoDBScanInput class], [AWSDynamoDBScanOutput class]],
+                                                        @"DescribeTable": @[[AWSDynamoDBDescribeTableInput class], [AWSDynamoDBDescribeTableOutput class]]};
+    for (NSString *operationName in operations) {
+        AWSJSONModelCodec *codec = [self codecForOperation:operationName];
+        XCTAssertNotNil(codec, @"%@", operationName);
+        XCTAssertEqual(codec.inputClass, operations[operationName][0]);
+        XCTAssertEqual(codec.outputClass, operations[operationName][1]);
+        XCTAssertTrue(codec == [self codecForOperation:operationName]);
+    }
+
+    XCTAssertNil([self codecForOperation:@"NoSuchOperation"]);
+    XCTAssertNil([AWSJSONModelCodec codecWithJSONDefinition:self.definition actionName:@"GetItem" modelClassPrefix:@"AWSNoSuchService"]);
+}
+
+- (void)testPutItemRequest {
+    AWSDynamoDBPutItemInput *input = [AWSDynamoDBPutItemInput new];
+    input.tableName = @"Table";
+    input.item = [self itemAtIndex:42];
+    input.conditionExpression = @"attribute_not_exists(#id)";
+    input.expressionAttributeNames = @{@"#id": @"id"};
+    input.returnValues = AWSDynamoDBReturnValueAllOld;
+    input.returnConsumedCapacity = AWSDynamoDBReturnConsumedCapacityTotal;
+
+    [self assertModel:input encodesLikeDictionaryPathForOperation:@"PutItem"];
+}
+
+- (void)testBatchWriteItemRequest {
+    NSMutableArray *requests = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 25; i++) {
+        AWSDynamoDBWriteRequest *writeRequest = [AWSDynamoDBWriteRequest new];
+        if (i % 5 == 0) {
+            writeRequest.deleteRequest = [AWSDynamoDBDeleteRequest new];
+            writeRequest.deleteRequest.key = @{@"id": [self attributeValueWithKey:@"S" value:@"gone"]};
+        } else {
+            writeRequest.putRequest = [AWSDynamoDBPutRequest new];
+            writeRequest.putRequest.item = [self itemAtIndex:i];
+        }
+        [requests addObject:writeRequest];
+    }
+    AWSDynamoDBBatchWriteItemInput *input = [AWSDynamoDBBatchWriteItemInput new];
+    input.requestItems = @{@"Table": requests};
+
+    [self assertModel:input encodesLikeDictionaryPathForOperation:@"BatchWriteItem"];
+}
+
+- (void)testQueryRequest {
+    AWSDynamoDBCondition *condition = [AWSDynamoDBCondition new];
+    condition.comparisonOperator = AWSDynamoDBComparisonOperatorBeginsWith;
+    condition.attributeValueList = @[[self attributeValueWithKey:@"S" value:@"item-"]];
+
+    AWSDynamoDBQueryInput *input = [AWSDynamoDBQueryInput new];
+    input.tableName = @"Table";
+    input.keyConditions = @{@"id": condition};
+    input.exclusiveStartKey = @{@"id": [self attributeValueWithKey:@"S" value:@"item-000010"]};
+    input.limit = @100;
+    input.scanIndexForward = @NO;
+    input.select = AWSDynamoDBSelectAllAttributes;
+
+    [self assertModel:input encodesLikeDictionaryPathForOperation:@"Query"];
+}
+
+- (void)testEmptyRequest {
+    [self assertModel:[AWSDynamoDBGetItemInput new] encodesLikeDictionaryPathForOperation:@"GetItem"];
+}
+
+- (void)testBatchGetItemResponse {
+    [self assertData:[self batchGetItemResponseData]
+decodesLikeDictionaryPathForOperation:@"BatchGetItem"
+         outputClass:[AWSDynamoDBBatchGetItemOutput class]];
+}
+
+- (void)testDescribeTableResponse {
+    NSDictionary *table = @{@"Table": @{@"TableName": @"Table",
+                                        @"TableStatus": @"ACTIVE",
+                                        @"CreationDateTime": @1700000000.25,
+                                        @"ItemCount": @12,
+                                        @"KeySchema": @[@{@"AttributeName": @"id", @"KeyType": @"HASH"}],
+                                        @"AttributeDefinitions": @[@{@"AttributeName": @"id", @"AttributeType": @"S"}],
+                                        @"ProvisionedThroughput": @{@"ReadCapacityUnits": @5,
+                                                                    @"WriteCapacityUnits": @5,
+                                                                    @"LastIncreaseDateTime": @1700000100},
+                                        @"Unknown": @"ignored"}};
+    [self assertData:[NSJSONSerialization dataWithJSONObject:table options:kNilOptions error:nil]
+decodesLikeDictionaryPathForOperation:@"DescribeTable"
+         outputClass:[AWSDynamoDBDescribeTableOutput class]];
+}
+
+- (void)testMalformedResponseFallsBack {
+    AWSJSONModelCodec *codec = [self codecForOperation:@"GetItem"];
+    NSError *error = nil;
+    XCTAssertNil([codec modelFromJSONData:[@"{\"Item\":[1]}" dataUsingEncoding:NSUTF8StringEncoding] error:&error]);
+    XCTAssertEqualObjects(error.domain, AWSJSONModelCodecErrorDomain);
+    XCTAssertNil([codec modelFromJSONData:[@"{\"__type\":\"ResourceNotFoundException\"}" dataUsingEncoding:NSUTF8StringEncoding] error:nil]);
+    XCTAssertNil([codec modelFromJSONData:[@"not json" dataUsingEncoding:NSUTF8StringEncoding] error:nil]);
+}
+
+- (void)testResponseSerializerReturnsModel {
+    AWSJSONResponseSerializer *serializer = [[AWSJSONResponseSerializer alloc] initWithJSONDefinition:self.definition
+                                                                                           actionName:@"GetItem"
+                                                                                          outputClass:[AWSDynamoDBGetItemOutput class]];
+    serializer.codec = [self codecForOperation:@"GetItem"];
+    NSError *error = nil;
+    AWSDynamoDBGetItemOutput *output = [serializer responseObjectForResponse:self.response
+                                                             originalRequest:nil
+                                                              currentRequest:nil
+                                                                        data:[@"{\"Item\":{\"id\":{\"S\":\"a\"}}}" dataUsingEncoding:NSUTF8StringEncoding]
+                                                                       error:&error];
+    XCTAssertNil(error);
+    XCTAssertTrue([output isKindOfClass:[AWSDynamoDBGetItemOutput class]]);
+    XCTAssertEqualObjects(output.item[@"id"].S, @"a");
+}
+
+#pragma mark - Benchmarks
+
+- (void)testBatchGetItemResponseDictionaryPathPerformance {
+    NSData *data = [self batchGetItemResponseData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSDictionary *JSONDictionary = [AWSJSONParser dictionaryForJsonData:data
+                                                                       response:self.response
+                                                                     actionName:@"BatchGetItem"
+                                                          serviceDefinitionRule:self.definition
+                                                                          error:nil];
+            AWSDynamoDBBatchGetItemOutput *output = [AWSMTLJSONAdapter modelOfClass:[AWSDynamoDBBatchGetItemOutput class]
+                                                                 fromJSONDictionary:JSONDictionary
+                                                                              error:nil];
+            XCTAssertEqual(output.responses[@"Table"].count, AWSDynamoDBJSONModelCodecTestsItemCount);
+        }];
+    }
+}
+
+- (void)testBatchGetItemResponseCodecPerformance {
+    NSData *data = [self batchGetItemResponseData];
+    AWSJSONModelCodec *codec = [self codecForOperation:@"BatchGetItem"];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSDynamoDBBatchGetItemOutput *output = [codec modelFromJSONData:data error:nil];
+            XCTAssertEqual(output.responses[@"Table"].count, AWSDynamoDBJSONModelCodecTestsItemCount);
+        }];
+    }
+}
+
+- (void)testBatchWriteItemRequestCodecPerformance {
+    NSMutableArray *requests = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSDynamoDBJSONModelCodecTestsItemCount; i++) {
+        AWSDynamoDBWriteRequest *writeRequest = [AWSDynamoDBWriteRequest new];
+        writeRequest.putRequest = [AWSDynamoDBPutRequest new];
+        writeRequest.putRequest.item = [self itemAtIndex:i];
+        [requests addObject:writeRequest];
+    }
+    AWSDynamoDBBatchWriteItemInput *input = [AWSDynamoDBBatchWriteItemInput new];
+    input.requestItems = @{@"Table": requests};
+    AWSJSONModelCodec *codec = [self codecForOperation:@"BatchWriteItem"];
+
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSData *data = [codec JSONDataFromModel:input error:nil];
+            XCTAssertGreaterThan(data.length, 1024 * 1024);
+        }];
+    }
+}
+
+@end
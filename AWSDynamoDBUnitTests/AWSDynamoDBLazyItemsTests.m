@@ -0,0 +1,186 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSDynamoDB.h"
+#import "AWSDynamoDBResources.h"
+
+// About 1 MB of items once encoded.
+static const NSUInteger AWSDynamoDBLazyItemsTestsItemCount = 5000;
+
+@interface AWSDynamoDBLazyItemsTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+@property (nonatomic, strong) NSHTTPURLResponse *response;
+
+@end
+
+@implementation AWSDynamoDBLazyItemsTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSDynamoDBResources sharedInstance] JSONObject];
+    self.response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]
+                                                statusCode:200
+                                               HTTPVersion:@"HTTP/1.1"
+                                              headerFields:@{}];
+}
+
+- (AWSJSONModelCodec *)codecForOperation:(NSString *)operationName {
+    return [AWSJSONModelCodec codecWithJSONDefinition:self.definition
+                                           actionName:operationName
+                                     modelClassPrefix:@"AWSDynamoDB"];
+}
+
+- (NSData *)dataWithString:(NSString *)string {
+    return [string dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSData *)scanResponseData {
+    NSMutableArray *items = [NSMutableArray arrayWithCapacity:AWSDynamoDBLazyItemsTestsItemCount];
+    for (NSUInteger i = 0; i < AWSDynamoDBLazyItemsTestsItemCount; i++) {
+        [items addObject:@{@"id": @{@"S": [NSString stringWithFormat:@"item-%06lu", (unsigned long)i]},
+                           @"count": @{@"N": [NSString stringWithFormat:@"%lu", (unsigned long)i]},
+                           @"active": @{@"BOOL": (i % 2 == 0 ? @YES : @NO)},
+                           @"email": @{@"S": @"jane@example.com"},
+                           @"tags": @{@"SS": @[@"red", @"green"]},
+                           @"profile": @{@"M": @{@"name": @{@"S": @"Jane Doe"},
+                                                 @"visits": @{@"L": @[@{@"N": @"1"}, @{@"N": @"2"}]}}}}];
+    }
+    return [NSJSONSerialization dataWithJSONObject:@{@"Count": @(AWSDynamoDBLazyItemsTestsItemCount),
+                                                     @"ScannedCount": @(AWSDynamoDBLazyItemsTestsItemCount),
+                                                     @"Items": items,
+                                                     @"LastEvaluatedKey": @{@"id": @{@"S": @"item-004999"}},
+                                                     @"ConsumedCapacity": @{@"TableName": @"Table", @"CapacityUnits": @128.5}}
+                                           options:kNilOptions
+                                             error:nil];
+}
+
+#pragma mark - Conformance
+
+- (void)testLazyScanOutputEqualsEagerOutput {
+    NSData *data = [self scanResponseData];
+    XCTAssertGreaterThan(data.length, 1000 * 1000);
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Scan"];
+
+    NSError *error = nil;
+    AWSDynamoDBScanOutput *expected = [codec modelFromJSONData:data error:&error];
+    XCTAssertNil(error);
+    AWSDynamoDBScanOutput *output = [codec modelFromJSONData:data lazilyDecodingListMember:@"Items" error:&error];
+    XCTAssertNil(error);
+
+    XCTAssertTrue([output isKindOfClass:[AWSDynamoDBScanOutput class]]);
+    XCTAssertEqualObjects(output.count, @(AWSDynamoDBLazyItemsTestsItemCount));
+    XCTAssertEqualObjects(output.lastEvaluatedKey, expected.lastEvaluatedKey);
+    XCTAssertEqualObjects(output.consumedCapacity, expected.consumedCapacity);
+    XCTAssertEqual(output.items.count, AWSDynamoDBLazyItemsTestsItemCount);
+    XCTAssertEqualObjects(output.items[4242][@"id"].S, @"item-004242");
+    XCTAssertEqualObjects(output.items[4242][@"profile"].M[@"visits"].L[1].N, @"2");
+    XCTAssertEqual(output.items[4242].count, 6);
+
+    // Reading everything gives the models decoded up front.
+    XCTAssertEqualObjects(output.items, expected.items);
+    XCTAssertEqualObjects(output, expected);
+}
+
+- (void)testLazyQueryOutput {
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Query"];
+    NSArray<NSString *> *bodies = @[@"{}",
+                                    @"{\"Items\":[]}",
+                                    @" { \"Count\" : 3 ,\n \"Items\" : [ { \"a\\u0062\" : { \"S\" : \"x\\\"y\" } , \"n\" : {\"N\":\"1\"} } , {} ,\n{\"k\":{\"S\":\"2\"}} ] , \"ScannedCount\" : 3 } ",
+                                    @"{\"Items\":[{\"nested\":{\"M\":{\"\\u6771\":{\"B\":\"AQID\"}}}}],\"Items2\":[1]}"];
+    for (NSString *body in bodies) {
+        NSData *data = [self dataWithString:body];
+        NSError *error = nil;
+        AWSDynamoDBQueryOutput *expected = [codec modelFromJSONData:data error:&error];
+        XCTAssertNil(error, @"%@", body);
+        AWSDynamoDBQueryOutput *output = [codec modelFromJSONData:data lazilyDecodingListMember:@"Items" error:&error];
+        XCTAssertNil(error, @"%@", body);
+        XCTAssertEqualObjects(output, expected, @"%@", body);
+    }
+
+    AWSDynamoDBQueryOutput *output = [codec modelFromJSONData:[self dataWithString:bodies[2]] lazilyDecodingListMember:@"Items" error:nil];
+    XCTAssertEqualObjects(output.items[0][@"ab"].S, @"x\"y");
+    XCTAssertEqualObjects(output.items[2][@"k"].S, @"2");
+    XCTAssertEqual(output.items[1].count, 0);
+}
+
+- (void)testMalformedBodyFallsBack {
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Scan"];
+    for (NSString *body in @[@"{\"Items\":[{\"a\":{\"S\":\"x\"}]", @"{\"Items\":[1]}", @"{\"__type\":\"ResourceNotFoundException\"}", @"not json"]) {
+        NSError *error = nil;
+        XCTAssertNil([codec modelFromJSONData:[self dataWithString:body] lazilyDecodingListMember:@"Items" error:&error], @"%@", body);
+        XCTAssertNil([codec modelFromJSONData:[self dataWithString:body] error:nil], @"%@", body);
+    }
+}
+
+- (void)testResponseSerializerDecodesItemsLazily {
+    AWSJSONResponseSerializer *serializer = [[AWSJSONResponseSerializer alloc] initWithJSONDefinition:self.definition
+                                                                                           actionName:@"Scan"
+                                                                                          outputClass:[AWSDynamoDBScanOutput class]];
+    serializer.codec = [self codecForOperation:@"Scan"];
+    serializer.lazilyDecodedMemberName = @"Items";
+    NSError *error = nil;
+    AWSDynamoDBScanOutput *output = [serializer responseObjectForResponse:self.response
+                                                          originalRequest:nil
+                                                           currentRequest:nil
+                                                                     data:[self dataWithString:@"{\"Count\":1,\"Items\":[{\"id\":{\"S\":\"a\"}}]}"]
+                                                                    error:&error];
+    XCTAssertNil(error);
+    XCTAssertTrue([output isKindOfClass:[AWSDynamoDBScanOutput class]]);
+    XCTAssertEqualObjects(output.items[0][@"id"].S, @"a");
+}
+
+#pragma mark - Benchmarks
+
+- (void)testScanTimeToFirstItemPerformance {
+    NSData *data = [self scanResponseData];
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Scan"];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSDynamoDBScanOutput *output = [codec modelFromJSONData:data error:nil];
+            XCTAssertEqualObjects(output.items[0][@"id"].S, @"item-000000");
+        }];
+    }
+}
+
+- (void)testLazyScanTimeToFirstItemPerformance {
+    NSData *data = [self scanResponseData];
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Scan"];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSDynamoDBScanOutput *output = [codec modelFromJSONData:data lazilyDecodingListMember:@"Items" error:nil];
+            XCTAssertEqualObjects(output.items[0][@"id"].S, @"item-000000");
+        }];
+    }
+}
+
+- (void)testLazyScanKeysOnlyPerformance {
+    NSData *data = [self scanResponseData];
+    AWSJSONModelCodec *codec = [self codecForOperation:@"Scan"];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSDynamoDBScanOutput *output = [codec modelFromJSONData:data lazilyDecodingListMember:@"Items" error:nil];
+            NSUInteger count = 0;
+            for (NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *item in output.items) {
+                count += item[@"id"].S.length > 0;
+            }
+            XCTAssertEqual(count, AWSDynamoDBLazyItemsTestsItemCount);
+        }];
+    }
+}
+
+@end
@@ -0,0 +1,387 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSDynamoDBTestStandIn.h"
+
+@interface AWSDynamoDBObjectMapper ()
+
+- (NSString *)itemIdentifierForTableName:(NSString *)tableName
+                                      key:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)key;
+
+@end
+
+static AWSDynamoDBTestRangeItem *AWSDynamoDBObjectMapperBatchTestsItemWithIndex(NSUInteger index) {
+    AWSDynamoDBTestRangeItem *item = [AWSDynamoDBTestRangeItem new];
+    item.identifier = [NSString stringWithFormat:@"user-%lu", (unsigned long)(index % 7)];
+    item.index = @(index);
+    return item;
+}
+
+// Serves BatchGetItem, GetItem and BatchWriteItem from memory the way DynamoDB validates them, after a fixed delay.
+@interface AWSDynamoDBObjectMapperBatchTestsStandIn : AWSDynamoDBTestStandIn
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDictionary *> *items;
+// Answers every other key or item of this many requests as unprocessed.
+@property (nonatomic, assign) NSUInteger throttledRequestCount;
+@property (nonatomic, assign) BOOL alwaysThrottled;
+@property (nonatomic, assign) NSUInteger requestCount;
+@property (nonatomic, assign) NSUInteger largestRequest;
+@property (nonatomic, assign) NSUInteger requestsInFlight;
+@property (nonatomic, assign) NSUInteger mostRequestsInFlight;
+@property (nonatomic, assign) NSUInteger violationCount;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperBatchTestsStandIn
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _items = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (NSString *)identifierForKey:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)key {
+    return [NSString stringWithFormat:@"%@/%@", key[@"identifier"].S, key[@"index"].N];
+}
+
+- (BOOL)beginRequestWithKeys:(NSArray<NSDictionary *> *)keys limit:(NSUInteger)limit {
+    @synchronized (self) {
+        self.requestCount++;
+        self.requestsInFlight++;
+        self.mostRequestsInFlight = MAX(self.mostRequestsInFlight, self.requestsInFlight);
+        self.largestRequest = MAX(self.largestRequest, keys.count);
+
+        NSMutableSet *identifiers = [NSMutableSet new];
+        for (NSDictionary *key in keys) {
+            [identifiers addObject:[self identifierForKey:key]];
+        }
+        if (keys.count == 0 || keys.count > limit || identifiers.count != keys.count) {
+            self.violationCount++;
+        }
+
+        if (self.alwaysThrottled) {
+            return YES;
+        }
+        if (self.throttledRequestCount > 0) {
+            self.throttledRequestCount--;
+            return YES;
+        }
+        return NO;
+    }
+}
+
+- (AWSTask *)endRequestWithResult:(id)result {
+    return [self respondWith:^id{
+        self.requestsInFlight--;
+        return result;
+    }];
+}
+
+- (AWSTask *)batchGetItem:(AWSDynamoDBBatchGetItemInput *)request {
+    NSArray<NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *keys = request.requestItems[AWSDynamoDBTestTableName].keys;
+    BOOL throttled = [self beginRequestWithKeys:keys limit:100];
+
+    NSMutableArray *items = [NSMutableArray new];
+    NSMutableArray *unprocessedKeys = [NSMutableArray new];
+    @synchronized (self) {
+        [keys enumerateObjectsUsingBlock:^(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *key, NSUInteger idx, BOOL *stop) {
+            if (throttled && (self.alwaysThrottled || idx % 2 == 1)) {
+                [unprocessedKeys addObject:key];
+                return;
+            }
+            NSDictionary *item = self.items[[self identifierForKey:key]];
+            if (item) {
+                [items addObject:item];
+            }
+        }];
+    }
+
+    AWSDynamoDBBatchGetItemOutput *output = [AWSDynamoDBBatchGetItemOutput new];
+    // DynamoDB returns the items in no particular order.
+    output.responses = @{AWSDynamoDBTestTableName: [[items reverseObjectEnumerator] allObjects]};
+    if (unprocessedKeys.count > 0) {
+        AWSDynamoDBKeysAndAttributes *keysAndAttributes = [AWSDynamoDBKeysAndAttributes new];
+        keysAndAttributes.keys = unprocessedKeys;
+        output.unprocessedKeys = @{AWSDynamoDBTestTableName: keysAndAttributes};
+    }
+    return [self endRequestWithResult:output];
+}
+
+- (AWSTask *)getItem:(AWSDynamoDBGetItemInput *)request {
+    [self beginRequestWithKeys:@[request.key] limit:1];
+
+    AWSDynamoDBGetItemOutput *output = [AWSDynamoDBGetItemOutput new];
+    @synchronized (self) {
+        output.item = self.items[[self identifierForKey:request.key]];
+    }
+    return [self endRequestWithResult:output];
+}
+
+- (AWSTask *)batchWriteItem:(AWSDynamoDBBatchWriteItemInput *)request {
+    NSArray<AWSDynamoDBWriteRequest *> *writeRequests = request.requestItems[AWSDynamoDBTestTableName];
+    NSMutableArray *keys = [NSMutableArray new];
+    for (AWSDynamoDBWriteRequest *writeRequest in writeRequests) {
+        [keys addObject:writeRequest.putRequest.item ?: writeRequest.deleteRequest.key];
+    }
+    BOOL throttled = [self beginRequestWithKeys:keys limit:25];
+
+    NSMutableArray *unprocessedItems = [NSMutableArray new];
+    @synchronized (self) {
+        [writeRequests enumerateObjectsUsingBlock:^(AWSDynamoDBWriteRequest *writeRequest, NSUInteger idx, BOOL *stop) {
+            if (throttled && (self.alwaysThrottled || idx % 2 == 1)) {
+                [unprocessedItems addObject:writeRequest];
+                return;
+            }
+            if (writeRequest.putRequest) {
+                self.items[[self identifierForKey:writeRequest.putRequest.item]] = writeRequest.putRequest.item;
+            } else {
+                [self.items removeObjectForKey:[self identifierForKey:writeRequest.deleteRequest.key]];
+            }
+        }];
+    }
+
+    AWSDynamoDBBatchWriteItemOutput *output = [AWSDynamoDBBatchWriteItemOutput new];
+    if (unprocessedItems.count > 0) {
+        output.unprocessedItems = @{AWSDynamoDBTestTableName: unprocessedItems};
+    }
+    return [self endRequestWithResult:output];
+}
+
+@end
+
+@interface AWSDynamoDBObjectMapperBatchTests : XCTestCase
+
+@property (nonatomic, strong) AWSDynamoDBObjectMapperBatchTestsStandIn *standIn;
+@property (nonatomic, strong) id mockDynamoDB;
+@property (nonatomic, strong) AWSDynamoDBObjectMapper *objectMapper;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperBatchTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    NSString *key = @"AWSDynamoDBObjectMapperBatchTests";
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1 credentialsProvider:nil];
+    [AWSDynamoDBObjectMapper registerDynamoDBObjectMapperWithConfiguration:configuration
+                                                 objectMapperConfiguration:[AWSDynamoDBObjectMapperConfiguration new]
+                                                                    forKey:key];
+    self.objectMapper = [AWSDynamoDBObjectMapper DynamoDBObjectMapperForKey:key];
+
+    self.standIn = [AWSDynamoDBObjectMapperBatchTestsStandIn new];
+    self.mockDynamoDB = [self.standIn mockDynamoDBOfObjectMapper:self.objectMapper];
+}
+
+- (void)tearDown {
+    [self.mockDynamoDB stopMocking];
+    [AWSDynamoDBObjectMapper removeDynamoDBObjectMapperForKey:@"AWSDynamoDBObjectMapperBatchTests"];
+    [super tearDown];
+}
+
+- (NSArray<AWSDynamoDBTestRangeItem *> *)itemsWithCount:(NSUInteger)count {
+    NSMutableArray *items = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        AWSDynamoDBTestRangeItem *item = AWSDynamoDBObjectMapperBatchTestsItemWithIndex(i);
+        item.name = [NSString stringWithFormat:@"Item %lu", (unsigned long)i];
+        [items addObject:item];
+    }
+    return items;
+}
+
+- (void)saveItems:(NSArray<AWSDynamoDBTestRangeItem *> *)items {
+    AWSTask *task = [self.objectMapper batchSave:items];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    self.standIn.requestCount = 0;
+    self.standIn.largestRequest = 0;
+    self.standIn.mostRequestsInFlight = 0;
+}
+
+- (void)testBatchLoadReturnsModelsInInputOrder {
+    [self saveItems:[self itemsWithCount:250]];
+
+    NSMutableArray *keys = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 250; i++) {
+        [keys addObject:AWSDynamoDBObjectMapperBatchTestsItemWithIndex((i * 37) % 250)];
+    }
+    // A key without an item, and a key asked for twice.
+    [keys insertObject:AWSDynamoDBObjectMapperBatchTestsItemWithIndex(1000) atIndex:10];
+    [keys addObject:AWSDynamoDBObjectMapperBatchTestsItemWithIndex(0)];
+
+    AWSTask<NSArray *> *task = [self.objectMapper batchLoad:keys];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(task.result.count, keys.count);
+    [task.result enumerateObjectsUsingBlock:^(id result, NSUInteger idx, BOOL *stop) {
+        if (idx == 10) {
+            XCTAssertEqualObjects(result, [NSNull null]);
+            return;
+        }
+        AWSDynamoDBTestRangeItem *item = result;
+        XCTAssertTrue([item isKindOfClass:[AWSDynamoDBTestRangeItem class]]);
+        XCTAssertEqualObjects(item.index, [keys[idx] index]);
+        XCTAssertEqualObjects(item.identifier, [keys[idx] identifier]);
+        XCTAssertEqualObjects(item.name, ([NSString stringWithFormat:@"Item %@", item.index]));
+    }];
+    XCTAssertNotEqual(task.result.firstObject, task.result.lastObject);
+
+    XCTAssertEqual(self.standIn.violationCount, 0);
+    XCTAssertEqual(self.standIn.requestCount, 3);
+    XCTAssertEqual(self.standIn.largestRequest, AWSDynamoDBObjectMapperBatchGetItemLimit);
+}
+
+- (void)testItemIdentifiersNormalizeNumbers {
+    NSMutableSet<NSString *> *identifiers = [NSMutableSet new];
+    for (NSString *number in @[@"100", @"1e2", @"1E+2", @"100.00", @"+100"]) {
+        AWSDynamoDBAttributeValue *identifier = [AWSDynamoDBAttributeValue new];
+        identifier.S = @"user-0";
+        AWSDynamoDBAttributeValue *index = [AWSDynamoDBAttributeValue new];
+        index.N = number;
+        [identifiers addObject:[self.objectMapper itemIdentifierForTableName:AWSDynamoDBTestTableName
+                                                                          key:@{@"identifier": identifier, @"index": index}]];
+    }
+    XCTAssertEqual(identifiers.count, 1);
+
+    AWSDynamoDBAttributeValue *string = [AWSDynamoDBAttributeValue new];
+    string.S = @"1e2";
+    XCTAssertFalse([identifiers containsObject:[self.objectMapper itemIdentifierForTableName:AWSDynamoDBTestTableName
+                                                                                          key:@{@"identifier": string}]]);
+}
+
+- (void)testBatchSaveAndRemoveSplitRequests {
+    NSArray *items = [self itemsWithCount:60];
+    [self saveItems:[items arrayByAddingObject:items.firstObject]];
+    XCTAssertEqual(self.standIn.items.count, 60);
+    XCTAssertEqual(self.standIn.violationCount, 0);
+
+    AWSTask *task = [self.objectMapper batchRemove:[items subarrayWithRange:NSMakeRange(0, 50)]];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(self.standIn.items.count, 10);
+    XCTAssertEqual(self.standIn.requestCount, 2);
+    XCTAssertEqual(self.standIn.largestRequest, AWSDynamoDBObjectMapperBatchWriteItemLimit);
+    XCTAssertEqual(self.standIn.violationCount, 0);
+}
+
+- (void)testConcurrentRequestsAreBounded {
+    self.standIn.requestDelay = 5;
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.maximumConcurrentBatchRequests = 3;
+    XCTAssertEqual([configuration copy].maximumConcurrentBatchRequests, 3);
+
+    AWSTask *task = [self.objectMapper batchSave:[self itemsWithCount:500] configuration:configuration];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(self.standIn.items.count, 500);
+    XCTAssertEqual(self.standIn.requestCount, 20);
+    XCTAssertEqual(self.standIn.mostRequestsInFlight, 3);
+}
+
+- (void)testUnprocessedKeysAndItemsAreRetried {
+    self.standIn.throttledRequestCount = 4;
+    [self saveItems:[self itemsWithCount:100]];
+    XCTAssertEqual(self.standIn.items.count, 100);
+
+    self.standIn.throttledRequestCount = 3;
+    AWSTask<NSArray *> *task = [self.objectMapper batchLoad:[self itemsWithCount:100]];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertFalse([task.result containsObject:[NSNull null]]);
+    XCTAssertEqual(self.standIn.requestCount, 4);
+    XCTAssertEqual(self.standIn.violationCount, 0);
+}
+
+- (void)testRetriesGiveUp {
+    [self saveItems:[self itemsWithCount:10]];
+    self.standIn.alwaysThrottled = YES;
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.maximumBatchRetryCount = 2;
+
+    NSArray *items = [self itemsWithCount:10];
+    AWSTask *task = [self.objectMapper batchRemove:items configuration:configuration];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects(task.error.domain, AWSDynamoDBObjectMapperErrorDomain);
+    XCTAssertEqual(task.error.code, AWSDynamoDBObjectMapperErrorUnprocessedItems);
+    XCTAssertEqualObjects([NSSet setWithArray:task.error.userInfo[AWSDynamoDBObjectMapperUnprocessedModelsKey]], [NSSet setWithArray:items]);
+    XCTAssertEqual(self.standIn.requestCount, 3);
+    XCTAssertEqual(self.standIn.items.count, 10);
+}
+
+- (void)testRetriesGiveUpWithUnsentChunks {
+    [self saveItems:[self itemsWithCount:100]];
+    self.standIn.alwaysThrottled = YES;
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.maximumBatchRetryCount = 2;
+    configuration.maximumConcurrentBatchRequests = 1;
+
+    // The first chunk runs out of retries, so the other three are never sent, and all their models are unprocessed.
+    NSArray *items = [self itemsWithCount:100];
+    AWSTask *task = [self.objectMapper batchRemove:items configuration:configuration];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects(task.error.domain, AWSDynamoDBObjectMapperErrorDomain);
+    XCTAssertEqual(task.error.code, AWSDynamoDBObjectMapperErrorUnprocessedItems);
+    NSArray *unprocessedModels = task.error.userInfo[AWSDynamoDBObjectMapperUnprocessedModelsKey];
+    XCTAssertEqual(unprocessedModels.count, 100);
+    XCTAssertEqualObjects([NSSet setWithArray:unprocessedModels], [NSSet setWithArray:items]);
+    XCTAssertEqual(self.standIn.requestCount, 3);
+    XCTAssertEqual(self.standIn.items.count, 100);
+}
+
+- (void)testBatchLoadIsFasterThanLoad {
+    NSUInteger const itemCount = 500;
+    NSArray<AWSDynamoDBTestRangeItem *> *items = [self itemsWithCount:itemCount];
+    [self saveItems:items];
+    self.standIn.requestDelay = 2;
+
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    for (AWSDynamoDBTestRangeItem *item in items) {
+        AWSTask *task = [self.objectMapper load:[AWSDynamoDBTestRangeItem class]
+                                        hashKey:item.identifier
+                                       rangeKey:item.index];
+        [task waitUntilFinished];
+        XCTAssertNotNil(task.result);
+    }
+    uint64_t loadElapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+    XCTAssertEqual(self.standIn.requestCount, itemCount);
+
+    self.standIn.requestCount = 0;
+    start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    AWSTask<NSArray *> *task = [self.objectMapper batchLoad:items];
+    [task waitUntilFinished];
+    uint64_t batchLoadElapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+    XCTAssertNil(task.error);
+    XCTAssertEqual(task.result.count, itemCount);
+    XCTAssertEqual(self.standIn.requestCount, (itemCount + AWSDynamoDBObjectMapperBatchGetItemLimit - 1) / AWSDynamoDBObjectMapperBatchGetItemLimit);
+    XCTAssertLessThan(batchLoadElapsed, loadElapsed);
+}
+
+- (void)testPerformanceOfBatchLoad {
+    NSArray<AWSDynamoDBTestRangeItem *> *items = [self itemsWithCount:500];
+    [self saveItems:items];
+    self.standIn.requestDelay = 2;
+
+    [self measureBlock:^{
+        AWSTask<NSArray *> *task = [self.objectMapper batchLoad:items];
+        [task waitUntilFinished];
+        XCTAssertNil(task.error);
+    }];
+}
+
+@end
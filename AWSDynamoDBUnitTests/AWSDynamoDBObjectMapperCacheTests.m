@@ -0,0 +1,500 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSDynamoDBTestStandIn.h"
+
+// Keeps a table in memory and answers GetItem, PutItem, UpdateItem, DeleteItem, BatchWriteItem and Query after a fixed
+// delay.
+@interface AWSDynamoDBObjectMapperCacheTestsStandIn : AWSDynamoDBTestStandIn
+
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *> *items;
+// How much longer GetItem takes than the other requests, in milliseconds. GetItem reads the item when it is sent.
+@property (atomic, assign) int getItemDelay;
+@property (atomic, assign) NSUInteger getItemCount;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperCacheTestsStandIn
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _items = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (void)setItemWithIdentifier:(NSString *)identifier
+                         name:(NSString *)name
+                      version:(NSUInteger)version {
+    AWSDynamoDBAttributeValue *identifierValue = [AWSDynamoDBAttributeValue new];
+    identifierValue.S = identifier;
+    AWSDynamoDBAttributeValue *nameValue = [AWSDynamoDBAttributeValue new];
+    nameValue.S = name;
+    AWSDynamoDBAttributeValue *versionValue = [AWSDynamoDBAttributeValue new];
+    versionValue.N = [NSString stringWithFormat:@"%lu", (unsigned long)version];
+    @synchronized (self) {
+        self.items[identifier] = @{@"identifier": identifierValue, @"name": nameValue, @"version": versionValue};
+    }
+}
+
+- (AWSTask *)getItem:(AWSDynamoDBGetItemInput *)request {
+    AWSDynamoDBGetItemOutput *output = [AWSDynamoDBGetItemOutput new];
+    @synchronized (self) {
+        self.getItemCount++;
+        output.item = self.items[request.key[@"identifier"].S];
+    }
+    return [[AWSTask taskWithDelay:self.getItemDelay] continueWithBlock:^id(AWSTask *task) {
+        return [self respondWith:^id{
+            return output;
+        }];
+    }];
+}
+
+- (AWSTask *)putItem:(AWSDynamoDBPutItemInput *)request {
+    return [self respondWith:^id{
+        self.items[request.item[@"identifier"].S] = request.item;
+        return [AWSDynamoDBPutItemOutput new];
+    }];
+}
+
+- (AWSTask *)updateItem:(AWSDynamoDBUpdateItemInput *)request {
+    return [self respondWith:^id{
+        NSString *identifier = request.key[@"identifier"].S;
+        NSMutableDictionary *item = [NSMutableDictionary dictionaryWithDictionary:self.items[identifier] ?: request.key];
+        [request.attributeUpdates enumerateKeysAndObjectsUsingBlock:^(NSString *attributeName, AWSDynamoDBAttributeValueUpdate *update, BOOL *stop) {
+            if (update.action == AWSDynamoDBAttributeActionDelete) {
+                [item removeObjectForKey:attributeName];
+            } else {
+                item[attributeName] = update.value;
+            }
+        }];
+        self.items[identifier] = item;
+        return [AWSDynamoDBUpdateItemOutput new];
+    }];
+}
+
+- (AWSTask *)deleteItem:(AWSDynamoDBDeleteItemInput *)request {
+    return [self respondWith:^id{
+        [self.items removeObjectForKey:request.key[@"identifier"].S];
+        return [AWSDynamoDBDeleteItemOutput new];
+    }];
+}
+
+- (AWSTask *)batchWriteItem:(AWSDynamoDBBatchWriteItemInput *)request {
+    return [self respondWith:^id{
+        for (AWSDynamoDBWriteRequest *writeRequest in request.requestItems[AWSDynamoDBTestTableName]) {
+            if (writeRequest.putRequest) {
+                self.items[writeRequest.putRequest.item[@"identifier"].S] = writeRequest.putRequest.item;
+            } else {
+                [self.items removeObjectForKey:writeRequest.deleteRequest.key[@"identifier"].S];
+            }
+        }
+        return [AWSDynamoDBBatchWriteItemOutput new];
+    }];
+}
+
+- (AWSTask *)query:(AWSDynamoDBQueryInput *)request {
+    return [self respondWith:^id{
+        AWSDynamoDBQueryOutput *output = [AWSDynamoDBQueryOutput new];
+        output.items = [self.items allValues];
+        return output;
+    }];
+}
+
+@end
+
+@interface AWSDynamoDBObjectMapperCacheTests : XCTestCase
+
+@property (nonatomic, strong) AWSDynamoDBObjectMapperCacheTestsStandIn *standIn;
+@property (nonatomic, strong) id mockDynamoDB;
+@property (nonatomic, strong) AWSDynamoDBObjectMapper *objectMapper;
+@property (nonatomic, strong) NSString *directory;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperCacheTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    self.directory = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    [[NSFileManager defaultManager] createDirectoryAtPath:self.directory withIntermediateDirectories:YES attributes:nil error:nil];
+
+    NSString *key = @"AWSDynamoDBObjectMapperCacheTests";
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1 credentialsProvider:nil];
+    [AWSDynamoDBObjectMapper registerDynamoDBObjectMapperWithConfiguration:configuration
+                                                 objectMapperConfiguration:[AWSDynamoDBObjectMapperConfiguration new]
+                                                                    forKey:key];
+    self.objectMapper = [AWSDynamoDBObjectMapper DynamoDBObjectMapperForKey:key];
+
+    AWSDynamoDBObjectMapperCacheTestsStandIn *standIn = [AWSDynamoDBObjectMapperCacheTestsStandIn new];
+    for (NSUInteger i = 0; i < 10; i++) {
+        [standIn setItemWithIdentifier:[NSString stringWithFormat:@"item-%lu", (unsigned long)i]
+                                  name:@"original"
+                               version:1];
+    }
+    self.standIn = standIn;
+
+    self.mockDynamoDB = [standIn mockDynamoDBOfObjectMapper:self.objectMapper];
+}
+
+- (void)tearDown {
+    [self.mockDynamoDB stopMocking];
+    [AWSDynamoDBObjectMapper removeDynamoDBObjectMapperForKey:@"AWSDynamoDBObjectMapperCacheTests"];
+    [[NSFileManager defaultManager] removeItemAtPath:self.directory error:nil];
+    [super tearDown];
+}
+
+- (AWSDynamoDBObjectMapperCache *)cacheWithCountLimit:(NSUInteger)countLimit
+                                           timeToLive:(NSTimeInterval)timeToLive {
+    AWSDynamoDBObjectMapperCache *cache = [AWSDynamoDBObjectMapperCache cacheWithCountLimit:countLimit
+                                                                                 timeToLive:timeToLive];
+    [self.objectMapper setCache:cache
+                   forTableName:AWSDynamoDBTestTableName];
+    return cache;
+}
+
+- (AWSDynamoDBTestItem *)loadItem:(NSUInteger)index
+                                      configuration:(AWSDynamoDBObjectMapperConfiguration *)configuration {
+    AWSTask *task = [self.objectMapper load:[AWSDynamoDBTestItem class]
+                                    hashKey:[NSString stringWithFormat:@"item-%lu", (unsigned long)index]
+                                   rangeKey:nil
+                              configuration:configuration ?: [AWSDynamoDBObjectMapperConfiguration new]];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    return task.result;
+}
+
+- (void)testLoadReturnsCachedItems {
+    AWSDynamoDBObjectMapperCache *cache = [self cacheWithCountLimit:100 timeToLive:60];
+    XCTAssertEqual([self.objectMapper cacheForTableName:AWSDynamoDBTestTableName], cache);
+
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"original");
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"changed" version:2];
+    AWSDynamoDBTestItem *item = [self loadItem:0 configuration:nil];
+    XCTAssertEqualObjects(item.name, @"original");
+    XCTAssertEqualObjects(item.version, @1);
+
+    XCTAssertEqual(self.standIn.getItemCount, 1);
+    XCTAssertEqual(cache.hitCount, 1);
+    XCTAssertEqual(cache.missCount, 1);
+    XCTAssertEqualWithAccuracy(cache.hitRate, 0.5, 0.001);
+
+    [self.objectMapper setCache:nil
+                   forTableName:AWSDynamoDBTestTableName];
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"changed");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+}
+
+- (void)testCachedItemsExpire {
+    [self cacheWithCountLimit:100 timeToLive:0.05];
+
+    [self loadItem:0 configuration:nil];
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"changed" version:2];
+    [NSThread sleepForTimeInterval:0.1];
+
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"changed");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+}
+
+- (void)testEvictedItemsAreReadFromTheDatabase {
+    NSString *databasePath = [self.directory stringByAppendingPathComponent:@"cache.db"];
+    AWSDynamoDBObjectMapperCache *cache = [[AWSDynamoDBObjectMapperCache alloc] initWithCountLimit:2
+                                                                                         timeToLive:60
+                                                                                       databasePath:databasePath];
+    XCTAssertNotNil(cache);
+    [self.objectMapper setCache:cache
+                   forTableName:AWSDynamoDBTestTableName];
+
+    for (NSUInteger i = 0; i < 4; i++) {
+        [self loadItem:i configuration:nil];
+    }
+    [self.standIn.items removeAllObjects];
+
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].identifier, @"item-0");
+    XCTAssertEqualObjects([self loadItem:3 configuration:nil].identifier, @"item-3");
+    XCTAssertEqual(self.standIn.getItemCount, 4);
+    XCTAssertEqual(cache.hitCount, 2);
+    XCTAssertEqual(cache.databaseHitCount, 1);
+
+    // A new cache on the same database starts with the items of the previous one.
+    AWSDynamoDBObjectMapperCache *reopenedCache = [[AWSDynamoDBObjectMapperCache alloc] initWithCountLimit:2
+                                                                                                 timeToLive:60
+                                                                                               databasePath:databasePath];
+    [self.objectMapper setCache:reopenedCache
+                   forTableName:AWSDynamoDBTestTableName];
+    XCTAssertEqualObjects([self loadItem:1 configuration:nil].identifier, @"item-1");
+    XCTAssertEqual(reopenedCache.databaseHitCount, 1);
+    XCTAssertEqual(self.standIn.getItemCount, 4);
+
+    [reopenedCache removeAllItems];
+    XCTAssertNil([self loadItem:1 configuration:nil]);
+    XCTAssertEqual(self.standIn.getItemCount, 5);
+}
+
+- (void)testSaveAndRemoveAreWrittenThrough {
+    [self cacheWithCountLimit:100 timeToLive:60];
+    [self loadItem:0 configuration:nil];
+
+    AWSDynamoDBTestItem *item = [AWSDynamoDBTestItem new];
+    item.identifier = @"item-0";
+    item.name = @"saved";
+    item.version = @2;
+    AWSTask *task = [self.objectMapper save:item];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"saved");
+    XCTAssertEqual(self.standIn.getItemCount, 1);
+
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.saveBehavior = AWSDynamoDBObjectMapperSaveBehaviorClobber;
+    item.name = @"clobbered";
+    task = [self.objectMapper save:item configuration:configuration];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"clobbered");
+    XCTAssertEqual(self.standIn.getItemCount, 1);
+
+    // Appending doesn't say what the item looks like afterwards, so the next load reads the table.
+    configuration.saveBehavior = AWSDynamoDBObjectMapperSaveBehaviorAppendSet;
+    task = [self.objectMapper save:item configuration:configuration];
+    [task waitUntilFinished];
+    [self loadItem:0 configuration:nil];
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+
+    task = [self.objectMapper remove:item];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertNil([self loadItem:0 configuration:nil]);
+    XCTAssertEqual(self.standIn.getItemCount, 3);
+}
+
+- (void)testBatchSaveAndRemoveAreWrittenThrough {
+    [self cacheWithCountLimit:100 timeToLive:60];
+
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 3; i++) {
+        AWSDynamoDBTestItem *item = [AWSDynamoDBTestItem new];
+        item.identifier = [NSString stringWithFormat:@"item-%lu", (unsigned long)i];
+        item.name = @"batch";
+        item.version = @2;
+        [items addObject:item];
+    }
+    AWSTask *task = [self.objectMapper batchSave:items];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    for (NSUInteger i = 0; i < 3; i++) {
+        XCTAssertEqualObjects([self loadItem:i configuration:nil].name, @"batch");
+    }
+    XCTAssertEqual(self.standIn.getItemCount, 0);
+
+    task = [self.objectMapper batchRemove:items];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    [self loadItem:0 configuration:nil];
+    XCTAssertEqual(self.standIn.getItemCount, 1);
+}
+
+- (void)testConsistentReadsBypassTheCache {
+    AWSDynamoDBObjectMapperCache *cache = [self cacheWithCountLimit:100 timeToLive:60];
+    [self loadItem:0 configuration:nil];
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"changed" version:2];
+
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.consistentRead = @YES;
+    XCTAssertEqualObjects([self loadItem:0 configuration:configuration].name, @"changed");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+    XCTAssertEqual(cache.missCount, 1);
+    XCTAssertEqual(cache.hitCount, 0);
+
+    // The consistent read refreshed the cached copy.
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"changed");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+}
+
+- (void)testQueryRefreshesNewerVersions {
+    AWSDynamoDBObjectMapperCache *cache = [self cacheWithCountLimit:100 timeToLive:60];
+    cache.versionAttribute = @"version";
+    [self loadItem:0 configuration:nil];
+    [self loadItem:1 configuration:nil];
+
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"newer" version:2];
+    [self.standIn setItemWithIdentifier:@"item-1" name:@"same version" version:1];
+    AWSDynamoDBQueryExpression *expression = [AWSDynamoDBQueryExpression new];
+    expression.keyConditionExpression = @"identifier = :identifier";
+    expression.expressionAttributeValues = @{@":identifier": @"item-0"};
+    AWSTask *task = [self.objectMapper query:[AWSDynamoDBTestItem class]
+                                  expression:expression];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"newer");
+    XCTAssertEqualObjects([self loadItem:1 configuration:nil].name, @"original");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+
+    // Items that weren't cached stay out of the cache.
+    [self loadItem:2 configuration:nil];
+    XCTAssertEqual(self.standIn.getItemCount, 3);
+
+    // Projected items may be missing attributes.
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"projected" version:3];
+    expression.projectionExpression = @"identifier, version";
+    task = [self.objectMapper query:[AWSDynamoDBTestItem class]
+                         expression:expression];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"newer");
+}
+
+- (void)testQueryRefreshesItemsEvictedToTheDatabase {
+    NSString *databasePath = [self.directory stringByAppendingPathComponent:@"cache.db"];
+    AWSDynamoDBObjectMapperCache *cache = [[AWSDynamoDBObjectMapperCache alloc] initWithCountLimit:1
+                                                                                         timeToLive:60
+                                                                                       databasePath:databasePath];
+    cache.versionAttribute = @"version";
+    [self.objectMapper setCache:cache
+                   forTableName:AWSDynamoDBTestTableName];
+    [self loadItem:0 configuration:nil];
+    [self loadItem:1 configuration:nil];
+
+    [self.standIn setItemWithIdentifier:@"item-0" name:@"newer" version:2];
+    AWSDynamoDBQueryExpression *expression = [AWSDynamoDBQueryExpression new];
+    expression.keyConditionExpression = @"identifier = :identifier";
+    expression.expressionAttributeValues = @{@":identifier": @"item-0"};
+    AWSTask *task = [self.objectMapper query:[AWSDynamoDBTestItem class]
+                                  expression:expression];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    // The evicted item is compared off the thread of the response, after one read of the database.
+    dispatch_sync([cache valueForKey:@"databaseQueue"], ^{});
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"newer");
+    XCTAssertEqual(self.standIn.getItemCount, 2);
+}
+
+- (void)testRefreshingUnchangedItemsKeepsTheirTimeToLive {
+    [self cacheWithCountLimit:100 timeToLive:0.3];
+    [self loadItem:0 configuration:nil];
+    [self loadItem:1 configuration:nil];
+    [NSThread sleepForTimeInterval:0.2];
+
+    [self.standIn setItemWithIdentifier:@"item-1" name:@"changed" version:1];
+    AWSDynamoDBQueryExpression *expression = [AWSDynamoDBQueryExpression new];
+    expression.keyConditionExpression = @"identifier = :identifier";
+    expression.expressionAttributeValues = @{@":identifier": @"item-0"};
+    AWSTask *task = [self.objectMapper query:[AWSDynamoDBTestItem class]
+                                  expression:expression];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    [NSThread sleepForTimeInterval:0.2];
+
+    // The unchanged item expired on time, and the changed one was rewritten with a new time to live.
+    [self loadItem:0 configuration:nil];
+    XCTAssertEqual(self.standIn.getItemCount, 3);
+    XCTAssertEqualObjects([self loadItem:1 configuration:nil].name, @"changed");
+    XCTAssertEqual(self.standIn.getItemCount, 3);
+}
+
+- (void)testLoadDoesNotOverwriteNewerSave {
+    [self cacheWithCountLimit:100 timeToLive:60];
+    self.standIn.getItemDelay = 500;
+
+    AWSTask<AWSDynamoDBTestItem *> *loadTask = [self.objectMapper load:[AWSDynamoDBTestItem class]
+                                                                hashKey:@"item-0"
+                                                               rangeKey:nil];
+    AWSDynamoDBTestItem *item = [AWSDynamoDBTestItem new];
+    item.identifier = @"item-0";
+    item.name = @"saved";
+    item.version = @2;
+    AWSTask *task = [self.objectMapper save:item];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertFalse(loadTask.isCompleted);
+
+    [loadTask waitUntilFinished];
+    XCTAssertEqualObjects(loadTask.result.name, @"original");
+    XCTAssertEqualObjects([self loadItem:0 configuration:nil].name, @"saved");
+    XCTAssertEqual(self.standIn.getItemCount, 1);
+
+    // Nor a newer remove.
+    [self.objectMapper setCache:[AWSDynamoDBObjectMapperCache cacheWithCountLimit:100 timeToLive:60]
+                   forTableName:AWSDynamoDBTestTableName];
+    self.standIn.getItemDelay = 500;
+    loadTask = [self.objectMapper load:[AWSDynamoDBTestItem class]
+                               hashKey:@"item-0"
+                              rangeKey:nil];
+    task = [self.objectMapper remove:item];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    [loadTask waitUntilFinished];
+    XCTAssertEqualObjects(loadTask.result.name, @"saved");
+    self.standIn.getItemDelay = 0;
+    XCTAssertNil([self loadItem:0 configuration:nil]);
+    XCTAssertEqual(self.standIn.getItemCount, 3);
+}
+
+- (void)testRepeatedLoadsAreServedFromTheCache {
+    NSUInteger const loadCount = 500;
+    NSUInteger const keyCount = 10;
+    self.standIn.requestDelay = 5;
+
+    for (NSUInteger i = 0; i < loadCount; i++) {
+        [self loadItem:arc4random_uniform(keyCount) configuration:nil];
+    }
+    XCTAssertEqual(self.standIn.getItemCount, loadCount);
+
+    AWSDynamoDBObjectMapperCache *cache = [self cacheWithCountLimit:keyCount timeToLive:60];
+    self.standIn.getItemCount = 0;
+    for (NSUInteger i = 0; i < loadCount; i++) {
+        [self loadItem:arc4random_uniform(keyCount) configuration:nil];
+    }
+    XCTAssertLessThanOrEqual(self.standIn.getItemCount, keyCount);
+    XCTAssertGreaterThan(cache.hitRate, 0.9);
+    XCTAssertLessThan(cache.averageHitLatency, cache.averageMissLatency);
+}
+
+- (void)testPerformanceOfCachedLoads {
+    NSUInteger const keyCount = 10;
+    self.standIn.requestDelay = 5;
+    [self cacheWithCountLimit:keyCount timeToLive:60];
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 500; i++) {
+            [self loadItem:arc4random_uniform(keyCount) configuration:nil];
+        }
+    }];
+}
+
+- (void)testPerformanceOfLoadsFromTheDatabase {
+    NSUInteger const keyCount = 10;
+    self.standIn.requestDelay = 5;
+    AWSDynamoDBObjectMapperCache *cache = [[AWSDynamoDBObjectMapperCache alloc] initWithCountLimit:2
+                                                                                         timeToLive:60
+                                                                                       databasePath:[self.directory stringByAppendingPathComponent:@"cache.db"]];
+    [self.objectMapper setCache:cache
+                   forTableName:AWSDynamoDBTestTableName];
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 500; i++) {
+            [self loadItem:arc4random_uniform(keyCount) configuration:nil];
+        }
+    }];
+    XCTAssertLessThanOrEqual(self.standIn.getItemCount, keyCount);
+}
+
+@end
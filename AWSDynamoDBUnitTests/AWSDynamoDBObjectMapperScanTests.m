@@ -0,0 +1,366 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSDynamoDBTestStandIn.h"
+
+// Pages through a table of numbered items the way Scan and Query do, after a fixed delay. Item `i` belongs to segment
+// `i % TotalSegments`.
+@interface AWSDynamoDBObjectMapperScanTestsStandIn : AWSDynamoDBTestStandIn
+
+@property (nonatomic, assign) NSUInteger itemCount;
+@property (nonatomic, assign) NSInteger failingSegment;
+@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSNumber *> *requestCounts;
+@property (nonatomic, assign) NSUInteger requestsInFlight;
+@property (nonatomic, assign) NSUInteger mostRequestsInFlight;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperScanTestsStandIn
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _failingSegment = -1;
+        _requestCounts = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (NSUInteger)requestCountOfSegment:(NSUInteger)segment {
+    @synchronized (self) {
+        return [self.requestCounts[@(segment)] unsignedIntegerValue];
+    }
+}
+
+- (NSUInteger)requestCount {
+    @synchronized (self) {
+        return [[self.requestCounts.allValues valueForKeyPath:@"@sum.self"] unsignedIntegerValue];
+    }
+}
+
+- (AWSTask *)pageOfSegment:(NSUInteger)segment
+             totalSegments:(NSUInteger)totalSegments
+         exclusiveStartKey:(NSDictionary<NSString *, AWSDynamoDBAttributeValue *> *)exclusiveStartKey
+                     limit:(NSUInteger)limit
+                     pages:(id (^)(NSArray *items, NSDictionary *lastEvaluatedKey))pages {
+    @synchronized (self) {
+        self.requestCounts[@(segment)] = @([self.requestCounts[@(segment)] unsignedIntegerValue] + 1);
+        self.requestsInFlight++;
+        self.mostRequestsInFlight = MAX(self.mostRequestsInFlight, self.requestsInFlight);
+    }
+
+    NSUInteger index = segment;
+    if (exclusiveStartKey) {
+        index = [[exclusiveStartKey[@"identifier"].S substringFromIndex:5] integerValue] + totalSegments;
+    }
+    NSMutableArray *items = [NSMutableArray new];
+    for (; index < self.itemCount && items.count < limit; index += totalSegments) {
+        AWSDynamoDBAttributeValue *identifier = [AWSDynamoDBAttributeValue new];
+        identifier.S = [NSString stringWithFormat:@"item-%05lu", (unsigned long)index];
+        AWSDynamoDBAttributeValue *number = [AWSDynamoDBAttributeValue new];
+        number.N = [NSString stringWithFormat:@"%lu", (unsigned long)index];
+        [items addObject:@{@"identifier": identifier, @"index": number}];
+    }
+    NSDictionary *lastEvaluatedKey = index < self.itemCount ? @{@"identifier": [items.lastObject objectForKey:@"identifier"]} : nil;
+    BOOL fails = (NSInteger)segment == self.failingSegment && exclusiveStartKey;
+
+    return [self respondWith:^id{
+        self.requestsInFlight--;
+        if (fails) {
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSDynamoDBErrorDomain code:AWSDynamoDBErrorInternalServer userInfo:nil]];
+        }
+        return pages(items, lastEvaluatedKey);
+    }];
+}
+
+- (AWSTask *)scan:(AWSDynamoDBScanInput *)request {
+    return [self pageOfSegment:[request.segment unsignedIntegerValue]
+                 totalSegments:request.totalSegments ? [request.totalSegments unsignedIntegerValue] : 1
+             exclusiveStartKey:request.exclusiveStartKey
+                         limit:[request.limit unsignedIntegerValue]
+                         pages:^id(NSArray *items, NSDictionary *lastEvaluatedKey) {
+                             AWSDynamoDBScanOutput *output = [AWSDynamoDBScanOutput new];
+                             output.items = items;
+                             output.lastEvaluatedKey = lastEvaluatedKey;
+                             return output;
+                         }];
+}
+
+- (AWSTask *)query:(AWSDynamoDBQueryInput *)request {
+    return [self pageOfSegment:0
+                 totalSegments:1
+             exclusiveStartKey:request.exclusiveStartKey
+                         limit:[request.limit unsignedIntegerValue]
+                         pages:^id(NSArray *items, NSDictionary *lastEvaluatedKey) {
+                             AWSDynamoDBQueryOutput *output = [AWSDynamoDBQueryOutput new];
+                             output.items = items;
+                             output.lastEvaluatedKey = lastEvaluatedKey;
+                             return output;
+                         }];
+}
+
+@end
+
+@interface AWSDynamoDBObjectMapperScanTests : XCTestCase
+
+@property (nonatomic, strong) AWSDynamoDBObjectMapperScanTestsStandIn *standIn;
+@property (nonatomic, strong) id mockDynamoDB;
+@property (nonatomic, strong) AWSDynamoDBObjectMapper *objectMapper;
+
+@end
+
+@implementation AWSDynamoDBObjectMapperScanTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    NSString *key = @"AWSDynamoDBObjectMapperScanTests";
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1 credentialsProvider:nil];
+    [AWSDynamoDBObjectMapper registerDynamoDBObjectMapperWithConfiguration:configuration
+                                                 objectMapperConfiguration:[AWSDynamoDBObjectMapperConfiguration new]
+                                                                    forKey:key];
+    self.objectMapper = [AWSDynamoDBObjectMapper DynamoDBObjectMapperForKey:key];
+
+    self.standIn = [AWSDynamoDBObjectMapperScanTestsStandIn new];
+    self.standIn.itemCount = 2000;
+    self.mockDynamoDB = [self.standIn mockDynamoDBOfObjectMapper:self.objectMapper];
+}
+
+- (void)tearDown {
+    [self.mockDynamoDB stopMocking];
+    [AWSDynamoDBObjectMapper removeDynamoDBObjectMapperForKey:@"AWSDynamoDBObjectMapperScanTests"];
+    [super tearDown];
+}
+
+- (AWSDynamoDBScanExpression *)scanExpression {
+    AWSDynamoDBScanExpression *expression = [AWSDynamoDBScanExpression new];
+    expression.limit = @100;
+    return expression;
+}
+
+- (AWSDynamoDBObjectMapperConfiguration *)configurationWithReadAheadPageCount:(NSUInteger)readAheadPageCount {
+    AWSDynamoDBObjectMapperConfiguration *configuration = [AWSDynamoDBObjectMapperConfiguration new];
+    configuration.readAheadPageCount = readAheadPageCount;
+    return configuration;
+}
+
+- (void)testParallelScanReadsEverySegmentInOrder {
+    self.standIn.requestDelay = 2;
+    NSMutableArray<NSMutableArray<NSNumber *> *> *indexesBySegment = [NSMutableArray new];
+    for (NSUInteger segment = 0; segment < 4; segment++) {
+        [indexesBySegment addObject:[NSMutableArray new]];
+    }
+
+    AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                         expression:[self scanExpression]
+                                      totalSegments:4
+                                      configuration:[self configurationWithReadAheadPageCount:1]
+                                        pageHandler:^(NSArray<AWSDynamoDBTestItem *> *items, NSUInteger segment, BOOL *stop) {
+                                            for (AWSDynamoDBTestItem *item in items) {
+                                                [indexesBySegment[segment] addObject:item.index];
+                                            }
+                                        }];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+
+    NSMutableIndexSet *indexes = [NSMutableIndexSet new];
+    [indexesBySegment enumerateObjectsUsingBlock:^(NSMutableArray<NSNumber *> *segmentIndexes, NSUInteger segment, BOOL *stop) {
+        XCTAssertEqual(segmentIndexes.count, 500);
+        [segmentIndexes enumerateObjectsUsingBlock:^(NSNumber *index, NSUInteger idx, BOOL *stop) {
+            XCTAssertEqual(index.unsignedIntegerValue, segment + idx * 4);
+            [indexes addIndex:index.unsignedIntegerValue];
+        }];
+    }];
+    XCTAssertEqual(indexes.count, 2000);
+    XCTAssertEqual([self.standIn requestCount], 20);
+    XCTAssertGreaterThan(self.standIn.mostRequestsInFlight, 1);
+    XCTAssertLessThanOrEqual(self.standIn.mostRequestsInFlight, 4);
+}
+
+- (void)testParallelScanReadAheadIsBounded {
+    NSUInteger const readAheadPageCount = 2;
+    NSMutableDictionary<NSNumber *, NSNumber *> *handledPageCounts = [NSMutableDictionary new];
+    __block NSUInteger violationCount = 0;
+
+    AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                         expression:[self scanExpression]
+                                      totalSegments:2
+                                      configuration:[self configurationWithReadAheadPageCount:readAheadPageCount]
+                                        pageHandler:^(NSArray *items, NSUInteger segment, BOOL *stop) {
+                                            NSUInteger handledPageCount = [handledPageCounts[@(segment)] unsignedIntegerValue] + 1;
+                                            handledPageCounts[@(segment)] = @(handledPageCount);
+                                            // The slow consumer lets the segments fill their read-ahead.
+                                            usleep(10000);
+                                            if ([self.standIn requestCountOfSegment:segment] > handledPageCount + readAheadPageCount) {
+                                                violationCount++;
+                                            }
+                                        }];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(violationCount, 0);
+    XCTAssertEqual([handledPageCounts[@0] unsignedIntegerValue], 10);
+    XCTAssertEqual([handledPageCounts[@1] unsignedIntegerValue], 10);
+    XCTAssertEqual([self.standIn requestCount], 20);
+}
+
+- (void)testParallelScanStops {
+    __block NSUInteger pageCount = 0;
+    AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                         expression:[self scanExpression]
+                                      totalSegments:4
+                                        pageHandler:^(NSArray *items, NSUInteger segment, BOOL *stop) {
+                                            pageCount++;
+                                            *stop = YES;
+                                        }];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual(pageCount, 1);
+    XCTAssertLessThanOrEqual([self.standIn requestCount], 4);
+}
+
+- (void)testParallelScanFailsWhenASegmentFails {
+    self.standIn.failingSegment = 2;
+    AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                         expression:[self scanExpression]
+                                      totalSegments:4
+                                        pageHandler:^(NSArray *items, NSUInteger segment, BOOL *stop) {
+                                        }];
+    [task waitUntilFinished];
+    XCTAssertEqualObjects(task.error.domain, AWSDynamoDBErrorDomain);
+    XCTAssertEqual(task.error.code, AWSDynamoDBErrorInternalServer);
+}
+
+- (void)testPaginatorReadAheadKeepsPagesInOrder {
+    AWSDynamoDBQueryExpression *expression = [AWSDynamoDBQueryExpression new];
+    expression.keyConditionExpression = @"identifier = :identifier";
+    expression.expressionAttributeValues = @{@":identifier": @"item"};
+    expression.limit = @100;
+
+    AWSTask<AWSDynamoDBPaginatedOutput *> *task = [self.objectMapper query:[AWSDynamoDBTestItem class]
+                                                                expression:expression
+                                                             configuration:[self configurationWithReadAheadPageCount:3]];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+
+    NSMutableArray<NSNumber *> *indexes = [NSMutableArray new];
+    while (YES) {
+        for (AWSDynamoDBTestItem *item in paginatedOutput.items) {
+            [indexes addObject:item.index];
+        }
+        if (!paginatedOutput.lastEvaluatedKey) {
+            break;
+        }
+        AWSTask *nextPageTask = [paginatedOutput loadNextPage];
+        [nextPageTask waitUntilFinished];
+        XCTAssertNil(nextPageTask.error);
+    }
+
+    XCTAssertEqual(indexes.count, 2000);
+    [indexes enumerateObjectsUsingBlock:^(NSNumber *index, NSUInteger idx, BOOL *stop) {
+        XCTAssertEqual(index.unsignedIntegerValue, idx);
+    }];
+    XCTAssertEqual([self.standIn requestCount], 20);
+
+    [[paginatedOutput reload] waitUntilFinished];
+    XCTAssertEqual([paginatedOutput.items.firstObject index].unsignedIntegerValue, 0);
+}
+
+- (void)testPaginatorReadAheadFailsOnceTheObjectMapperIsGone {
+    AWSTask<AWSDynamoDBPaginatedOutput *> *task = [self.objectMapper scan:[AWSDynamoDBTestItem class]
+                                                               expression:[self scanExpression]
+                                                            configuration:[self configurationWithReadAheadPageCount:3]];
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+    [paginatedOutput setValue:nil forKey:@"dynamoDBObjectMapper"];
+
+    // The pages requested before the object mapper went away may still arrive, but none are read ahead after them.
+    NSError *error = nil;
+    for (NSUInteger i = 0; i < 5 && !error; i++) {
+        AWSTask *nextPageTask = [paginatedOutput loadNextPage];
+        [nextPageTask waitUntilFinished];
+        error = nextPageTask.error;
+    }
+    XCTAssertEqualObjects(error.domain, AWSDynamoDBObjectMapperErrorDomain);
+    XCTAssertEqual(error.code, AWSDynamoDBObjectMapperErrorUnknown);
+    XCTAssertEqual([[paginatedOutput valueForKey:@"readAheadTasks"] count], 0);
+    XCTAssertLessThanOrEqual([self.standIn requestCount], 4);
+}
+
+- (void)testThroughputOfScans {
+    // Pages take 5 ms to arrive and 5 ms to process.
+    self.standIn.itemCount = 5000;
+    self.standIn.requestDelay = 5;
+    useconds_t const processingTime = 5000;
+
+    NSMutableDictionary<NSString *, NSNumber *> *itemsPerSecond = [NSMutableDictionary new];
+    for (NSNumber *readAheadPageCount in @[@0, @2]) {
+        uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+        AWSTask<AWSDynamoDBPaginatedOutput *> *task = [self.objectMapper scan:[AWSDynamoDBTestItem class]
+                                                                   expression:[self scanExpression]
+                                                                configuration:[self configurationWithReadAheadPageCount:readAheadPageCount.unsignedIntegerValue]];
+        [task waitUntilFinished];
+        AWSDynamoDBPaginatedOutput *paginatedOutput = task.result;
+        NSUInteger itemCount = 0;
+        while (YES) {
+            itemCount += paginatedOutput.items.count;
+            usleep(processingTime);
+            if (!paginatedOutput.lastEvaluatedKey) {
+                break;
+            }
+            [[paginatedOutput loadNextPage] waitUntilFinished];
+        }
+        uint64_t elapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+        XCTAssertEqual(itemCount, 5000);
+        itemsPerSecond[[NSString stringWithFormat:@"scan, %@ pages read ahead", readAheadPageCount]] = @(itemCount / ((double)elapsed / NSEC_PER_SEC));
+    }
+
+    uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+    __block NSUInteger itemCount = 0;
+    AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                         expression:[self scanExpression]
+                                      totalSegments:4
+                                      configuration:[self configurationWithReadAheadPageCount:2]
+                                        pageHandler:^(NSArray *items, NSUInteger segment, BOOL *stop) {
+                                            itemCount += items.count;
+                                            usleep(processingTime);
+                                        }];
+    [task waitUntilFinished];
+    uint64_t elapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+    XCTAssertEqual(itemCount, 5000);
+    itemsPerSecond[@"parallelScan, 4 segments, 2 pages read ahead"] = @(itemCount / ((double)elapsed / NSEC_PER_SEC));
+
+    XCTAssertGreaterThan([itemsPerSecond[@"scan, 2 pages read ahead"] doubleValue], [itemsPerSecond[@"scan, 0 pages read ahead"] doubleValue]);
+    XCTAssertGreaterThan([itemsPerSecond[@"parallelScan, 4 segments, 2 pages read ahead"] doubleValue], [itemsPerSecond[@"scan, 0 pages read ahead"] doubleValue]);
+}
+
+- (void)testPerformanceOfParallelScan {
+    self.standIn.requestDelay = 5;
+    [self measureBlock:^{
+        AWSTask *task = [self.objectMapper parallelScan:[AWSDynamoDBTestItem class]
+                                             expression:[self scanExpression]
+                                          totalSegments:4
+                                          configuration:[self configurationWithReadAheadPageCount:2]
+                                            pageHandler:^(NSArray *items, NSUInteger segment, BOOL *stop) {
+                                            }];
+        [task waitUntilFinished];
+        XCTAssertNil(task.error);
+    }];
+}
+
+@end
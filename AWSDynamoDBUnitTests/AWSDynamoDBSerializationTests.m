@@ -0,0 +1,108 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSDynamoDBResources.h"
+
+// About 1 MB of items once encoded.
+static const NSUInteger AWSDynamoDBSerializationTestsItemCount = 4000;
+
+@interface AWSDynamoDBSerializationTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+@property (nonatomic, strong) NSHTTPURLResponse *response;
+
+@end
+
+@implementation AWSDynamoDBSerializationTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSDynamoDBResources sharedInstance] JSONObject];
+    self.response = [[NSHTTPURLResponse alloc] initWithURL:[NSURL URLWithString:@"https://dynamodb.us-east-1.amazonaws.com"]
+                                                statusCode:200
+                                               HTTPVersion:@"HTTP/1.1"
+                                              headerFields:@{}];
+}
+
+- (NSDictionary *)itemAtIndex:(NSUInteger)index {
+    return @{@"id": @{@"S": [NSString stringWithFormat:@"item-%06lu", (unsigned long)index]},
+             @"count": @{@"N": [NSString stringWithFormat:@"%lu", (unsigned long)index]},
+             @"active": @{@"BOOL": @(index % 2 == 0)},
+             @"tags": @{@"SS": @[@"red", @"green", @"blue"]},
+             @"profile": @{@"M": @{@"name": @{@"S": @"Jane Doe"},
+                                   @"email": @{@"S": @"jane@example.com"},
+                                   @"visits": @{@"L": @[@{@"N": @"1"}, @{@"N": @"2"}, @{@"N": @"3"}]}}}};
+}
+
+- (NSData *)batchGetItemResponseData {
+    NSMutableArray *items = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSDynamoDBSerializationTestsItemCount; i++) {
+        [items addObject:[self itemAtIndex:i]];
+    }
+    return [NSJSONSerialization dataWithJSONObject:@{@"Responses": @{@"Table": items},
+                                                     @"UnprocessedKeys": @{},
+                                                     @"ConsumedCapacity": @[@{@"TableName": @"Table", @"CapacityUnits": @2000}]}
+                                           options:kNilOptions
+                                             error:nil];
+}
+
+- (void)testBatchGetItemResponse {
+    NSError *error = nil;
+    NSDictionary *result = [AWSJSONParser dictionaryForJsonData:[self batchGetItemResponseData]
+                                                       response:self.response
+                                                     actionName:@"BatchGetItem"
+                                          serviceDefinitionRule:self.definition
+                                                          error:&error];
+    XCTAssertNil(error);
+    NSArray *items = result[@"Responses"][@"Table"];
+    XCTAssertEqual(items.count, AWSDynamoDBSerializationTestsItemCount);
+    XCTAssertEqualObjects(items[7], [self itemAtIndex:7]);
+    XCTAssertEqualObjects(result[@"ConsumedCapacity"][0][@"CapacityUnits"], @2000);
+}
+
+- (void)testBatchGetItemResponsePerformance {
+    NSData *data = [self batchGetItemResponseData];
+    [self measureBlock:^{
+        NSError *error = nil;
+        NSDictionary *result = [AWSJSONParser dictionaryForJsonData:data
+                                                           response:self.response
+                                                         actionName:@"BatchGetItem"
+                                              serviceDefinitionRule:self.definition
+                                                              error:&error];
+        XCTAssertEqual([result[@"Responses"][@"Table"] count], AWSDynamoDBSerializationTestsItemCount);
+    }];
+}
+
+- (void)testBatchWriteItemRequestPerformance {
+    NSMutableArray *requests = [NSMutableArray new];
+    for (NSUInteger i = 0; i < AWSDynamoDBSerializationTestsItemCount; i++) {
+        [requests addObject:@{@"PutRequest": @{@"Item": [self itemAtIndex:i]}}];
+    }
+    NSDictionary *params = @{@"RequestItems": @{@"Table": requests}};
+
+    [self measureBlock:^{
+        NSError *error = nil;
+        NSData *data = [AWSJSONBuilder jsonDataForDictionary:params
+                                                  actionName:@"BatchWriteItem"
+                                       serviceDefinitionRule:self.definition
+                                                       error:&error];
+        XCTAssertNil(error);
+        XCTAssertGreaterThan(data.length, 1024 * 1024);
+    }];
+}
+
+@end
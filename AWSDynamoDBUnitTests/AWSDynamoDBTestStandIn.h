@@ -0,0 +1,66 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSDynamoDB.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSDynamoDBTestTableName;
+
+/**
+ The model of the object mapper tests, keyed by `identifier`.
+ */
+@interface AWSDynamoDBTestItem : AWSDynamoDBObjectModel <AWSDynamoDBModeling>
+
+@property (nonatomic, strong, nullable) NSString *identifier;
+@property (nonatomic, strong, nullable) NSNumber *index;
+@property (nonatomic, strong, nullable) NSString *name;
+@property (nonatomic, strong, nullable) NSNumber *version;
+
+@end
+
+/**
+ The model of the object mapper tests, keyed by `identifier` and `index`.
+ */
+@interface AWSDynamoDBTestRangeItem : AWSDynamoDBTestItem
+
+@end
+
+/**
+ A local stand-in for DynamoDB. Subclasses answer the operations the tests need, such as `getItem:` or `scan:`, with the
+ same signature as `AWSDynamoDB`.
+ */
+@interface AWSDynamoDBTestStandIn : NSObject
+
+/**
+ How long every response takes, in milliseconds.
+ */
+@property (atomic, assign) int requestDelay;
+
+/**
+ Completes with the result of `response` after `requestDelay`. `response` runs while the stand-in is locked.
+ */
+- (AWSTask *)respondWith:(id _Nullable (^)(void))response;
+
+/**
+ Partially mocks the DynamoDB client of `objectMapper` so that every operation the receiver implements is answered by
+ the receiver. Call `stopMocking` on the returned mock when the test ends.
+ */
+- (id)mockDynamoDBOfObjectMapper:(AWSDynamoDBObjectMapper *)objectMapper;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,97 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSDynamoDBTestStandIn.h"
+#import "OCMock.h"
+
+NSString *const AWSDynamoDBTestTableName = @"AWSDynamoDBTestTable";
+
+@interface AWSDynamoDBObjectMapper ()
+
+@property (nonatomic, strong) AWSDynamoDB *dynamoDB;
+
+@end
+
+@implementation AWSDynamoDBTestItem
+
++ (NSString *)dynamoDBTableName {
+    return AWSDynamoDBTestTableName;
+}
+
++ (NSString *)hashKeyAttribute {
+    return @"identifier";
+}
+
+@end
+
+@implementation AWSDynamoDBTestRangeItem
+
++ (NSString *)rangeKeyAttribute {
+    return @"index";
+}
+
+@end
+
+@implementation AWSDynamoDBTestStandIn
+
+- (AWSTask *)respondWith:(id (^)(void))response {
+    return [[AWSTask taskWithDelay:self.requestDelay] continueWithBlock:^id(AWSTask *task) {
+        @synchronized (self) {
+            return response();
+        }
+    }];
+}
+
+- (void (^)(NSInvocation *))answerWithSelector:(SEL)selector {
+    AWSTask *(*answer)(id, SEL, id) = (AWSTask *(*)(id, SEL, id))[self methodForSelector:selector];
+    return ^(NSInvocation *invocation) {
+        __unsafe_unretained id request = nil;
+        [invocation getArgument:&request atIndex:2];
+        AWSTask *task = answer(self, selector, request);
+        [invocation retainArguments];
+        [invocation setReturnValue:&task];
+    };
+}
+
+- (id)mockDynamoDBOfObjectMapper:(AWSDynamoDBObjectMapper *)objectMapper {
+    id mockDynamoDB = OCMPartialMock(objectMapper.dynamoDB);
+    if ([self respondsToSelector:@selector(getItem:)]) {
+        OCMStub([mockDynamoDB getItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(getItem:)]);
+    }
+    if ([self respondsToSelector:@selector(putItem:)]) {
+        OCMStub([mockDynamoDB putItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(putItem:)]);
+    }
+    if ([self respondsToSelector:@selector(updateItem:)]) {
+        OCMStub([mockDynamoDB updateItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(updateItem:)]);
+    }
+    if ([self respondsToSelector:@selector(deleteItem:)]) {
+        OCMStub([mockDynamoDB deleteItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(deleteItem:)]);
+    }
+    if ([self respondsToSelector:@selector(batchGetItem:)]) {
+        OCMStub([mockDynamoDB batchGetItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(batchGetItem:)]);
+    }
+    if ([self respondsToSelector:@selector(batchWriteItem:)]) {
+        OCMStub([mockDynamoDB batchWriteItem:[OCMArg any]]).andDo([self answerWithSelector:@selector(batchWriteItem:)]);
+    }
+    if ([self respondsToSelector:@selector(query:)]) {
+        OCMStub([mockDynamoDB query:[OCMArg any]]).andDo([self answerWithSelector:@selector(query:)]);
+    }
+    if ([self respondsToSelector:@selector(scan:)]) {
+        OCMStub([mockDynamoDB scan:[OCMArg any]]).andDo([self answerWithSelector:@selector(scan:)]);
+    }
+    return mockDynamoDB;
+}
+
+@end
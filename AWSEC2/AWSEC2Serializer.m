@@ -61,19 +61,26 @@
     }];
     
     //Need to add version and actionName
-    NSError *error = nil;
-    NSDictionary *formattedParams = [AWSEC2ParamBuilder buildFormattedParams:parameters
-                                                                  actionName:self.actionName
-                                                       serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
-    if (error) {
-        return [AWSTask taskWithError:error];
-    }
-    
-    NSMutableString *queryString = [NSMutableString new];
-    [self processParameters:formattedParams queryString:queryString];
-    
-    if ([queryString length] > 0) {
-        request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+    NSData *formData = [AWSEC2ParamBuilder formDataForParams:parameters
+                                                  actionName:self.actionName
+                                       serviceDefinitionRule:self.serviceDefinitionJSON];
+    if (formData) {
+        request.HTTPBody = formData;
+    } else {
+        NSError *error = nil;
+        NSDictionary *formattedParams = [AWSEC2ParamBuilder buildFormattedParams:parameters
+                                                                      actionName:self.actionName
+                                                           serviceDefinitionRule:self.serviceDefinitionJSON error:&error];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
+        
+        NSMutableString *queryString = [NSMutableString new];
+        [self processParameters:formattedParams queryString:queryString];
+        
+        if ([queryString length] > 0) {
+            request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        }
     }
     
     //contruct additional headers
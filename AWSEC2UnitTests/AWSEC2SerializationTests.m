@@ -0,0 +1,174 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSEC2Resources.h"
+
+// About 3 MB of indented response.
+static const NSUInteger AWSEC2SerializationTestsReservationCount = 1000;
+
+@interface AWSXMLParser()
+
+@property (nonatomic, assign) BOOL usesStreamDecoder;
+
+@end
+
+@interface AWSEC2SerializationTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+
+@end
+
+@implementation AWSEC2SerializationTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSEC2Resources sharedInstance] JSONObject];
+}
+
+// EC2 indents its responses, so every structure also carries whitespace text.
+- (NSData *)describeInstancesResponseData {
+    NSMutableString *xml = [NSMutableString stringWithString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                            "<DescribeInstancesResponse xmlns=\"http://ec2.amazonaws.com/doc/2016-11-15/\">\n"
+                            "    <requestId>8f7724cf-496f-496e-8fe3-example</requestId>\n"
+                            "    <reservationSet>\n"];
+    for (NSUInteger i = 0; i < AWSEC2SerializationTestsReservationCount; i++) {
+        [xml appendFormat:@"        <item>\n"
+         "            <reservationId>r-%017lu</reservationId>\n"
+         "            <ownerId>123456789012</ownerId>\n"
+         "            <groupSet/>\n"
+         "            <instancesSet>\n"
+         "                <item>\n"
+         "                    <instanceId>i-%017lu</instanceId>\n"
+         "                    <imageId>ami-0abcdef1234567890</imageId>\n"
+         "                    <instanceState>\n"
+         "                        <code>16</code>\n"
+         "                        <name>running</name>\n"
+         "                    </instanceState>\n"
+         "                    <privateDnsName>ip-10-0-0-1.ec2.internal</privateDnsName>\n"
+         "                    <dnsName/>\n"
+         "                    <reason/>\n"
+         "                    <amiLaunchIndex>0</amiLaunchIndex>\n"
+         "                    <productCodes/>\n"
+         "                    <instanceType>t3.micro</instanceType>\n"
+         "                    <launchTime>2026-10-19T12:00:00.000Z</launchTime>\n"
+         "                    <placement>\n"
+         "                        <availabilityZone>us-east-1a</availabilityZone>\n"
+         "                        <groupName/>\n"
+         "                        <tenancy>default</tenancy>\n"
+         "                    </placement>\n"
+         "                    <monitoring>\n"
+         "                        <state>disabled</state>\n"
+         "                    </monitoring>\n"
+         "                    <subnetId>subnet-0123456789abcdef0</subnetId>\n"
+         "                    <vpcId>vpc-0123456789abcdef0</vpcId>\n"
+         "                    <privateIpAddress>10.0.0.1</privateIpAddress>\n"
+         "                    <groupSet>\n"
+         "                        <item>\n"
+         "                            <groupId>sg-0123456789abcdef0</groupId>\n"
+         "                            <groupName>default</groupName>\n"
+         "                        </item>\n"
+         "                    </groupSet>\n"
+         "                    <architecture>x86_64</architecture>\n"
+         "                    <rootDeviceType>ebs</rootDeviceType>\n"
+         "                    <rootDeviceName>/dev/xvda</rootDeviceName>\n"
+         "                    <blockDeviceMapping>\n"
+         "                        <item>\n"
+         "                            <deviceName>/dev/xvda</deviceName>\n"
+         "                            <ebs>\n"
+         "                                <volumeId>vol-0123456789abcdef0</volumeId>\n"
+         "                                <status>attached</status>\n"
+         "                                <attachTime>2026-10-19T12:00:01.000Z</attachTime>\n"
+         "                                <deleteOnTermination>true</deleteOnTermination>\n"
+         "                            </ebs>\n"
+         "                        </item>\n"
+         "                    </blockDeviceMapping>\n"
+         "                    <tagSet>\n"
+         "                        <item>\n"
+         "                            <key>Name</key>\n"
+         "                            <value>web-%lu</value>\n"
+         "                        </item>\n"
+         "                        <item>\n"
+         "                            <key>env</key>\n"
+         "                            <value>prod</value>\n"
+         "                        </item>\n"
+         "                    </tagSet>\n"
+         "                    <ebsOptimized>false</ebsOptimized>\n"
+         "                    <cpuOptions>\n"
+         "                        <coreCount>1</coreCount>\n"
+         "                        <threadsPerCore>2</threadsPerCore>\n"
+         "                    </cpuOptions>\n"
+         "                </item>\n"
+         "            </instancesSet>\n"
+         "        </item>\n", (unsigned long)i, (unsigned long)i, (unsigned long)i];
+    }
+    [xml appendString:@"    </reservationSet>\n</DescribeInstancesResponse>\n"];
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)testDescribeInstancesStreamDecoderMatchesDictionaryTree {
+    NSData *data = [self describeInstancesResponseData];
+    AWSXMLParser *treeParser = [AWSXMLParser new];
+    treeParser.usesStreamDecoder = NO;
+    NSDictionary *expected = [treeParser dictionaryForXMLData:data
+                                                   actionName:@"DescribeInstances"
+                                        serviceDefinitionRule:self.definition
+                                                        error:nil];
+
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"DescribeInstances"
+                                                        serviceDefinitionRule:self.definition];
+    NSError *error = nil;
+    NSDictionary *result = [decoder dictionaryForXMLData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(result, expected);
+
+    NSArray *reservations = result[@"Reservations"];
+    XCTAssertEqual(reservations.count, AWSEC2SerializationTestsReservationCount);
+    NSDictionary *instance = [reservations[7][@"Instances"] firstObject];
+    XCTAssertEqualObjects(instance[@"InstanceId"], @"i-00000000000000007");
+    XCTAssertEqualObjects(instance[@"State"][@"Code"], @16);
+    XCTAssertEqualObjects(instance[@"Tags"][0][@"Value"], @"web-7");
+    XCTAssertEqualObjects(instance[@"EbsOptimized"], @NO);
+}
+
+- (void)testDescribeInstancesStreamDecoderPerformance {
+    NSData *data = [self describeInstancesResponseData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"DescribeInstances"
+                                                                serviceDefinitionRule:self.definition];
+            NSDictionary *result = [decoder dictionaryForXMLData:data error:nil];
+            XCTAssertEqual([result[@"Reservations"] count], AWSEC2SerializationTestsReservationCount);
+        }];
+    }
+}
+
+- (void)testDescribeInstancesDictionaryTreePerformance {
+    NSData *data = [self describeInstancesResponseData];
+    AWSXMLParser *treeParser = [AWSXMLParser new];
+    treeParser.usesStreamDecoder = NO;
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSDictionary *result = [treeParser dictionaryForXMLData:data
+                                                         actionName:@"DescribeInstances"
+                                              serviceDefinitionRule:self.definition
+                                                              error:nil];
+            XCTAssertEqual([result[@"Reservations"] count], AWSEC2SerializationTestsReservationCount);
+        }];
+    }
+}
+
+@end
@@ -22,6 +22,7 @@ NSUInteger const AWSKinesisAbstractClientByteLimitDefault = 5 * 1024 * 1024; //
 NSTimeInterval const AWSKinesisAbstractClientAgeLimitDefault = 0.0; // Keeps the data indefinitely unless it hits the size limit.
 NSString *const AWSKinesisAbstractClientUserAgent = @"recorder";
 NSUInteger const AWSKinesisAbstractClientBatchRecordByteLimitDefault = 512 * 1024; // 512KB
+NSUInteger const AWSKinesisAbstractClientBatchRecordCountLimitDefault = 128;
 NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazonaws/AWSKinesisRecorder";
 
 @protocol AWSKinesisRecorderHelper <NSObject>
@@ -41,12 +42,17 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
                        notificationSender:(id)notificationSender
                                  fileSize:(NSUInteger)fileSize;
 
+@optional
+
+// The maximum number of saved records read for one submission.
+- (NSUInteger)batchRecordsCountLimit;
+
 @end
 
 @interface AWSAbstractKinesisRecorder()
 
 @property (nonatomic, strong) id<AWSKinesisRecorderHelper> recorderHelper;
-@property (nonatomic, strong) AWSFMDatabaseQueue *databaseQueue;
+@property (nonatomic, strong) AWSFMDatabaseStore *databaseStore;
 @property (nonatomic, strong) NSString *databasePath;
 
 @end
@@ -87,8 +93,8 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
 
         // Creates a database for the identifier if it doesn't exist.
         AWSDDLogDebug(@"Database path: [%@]", _databasePath);
-        _databaseQueue = [AWSFMDatabaseQueue serialDatabaseQueueWithPath:_databasePath];
-        [_databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        _databaseStore = [AWSFMDatabaseStore storeWithPath:_databasePath];
+        [_databaseStore inDatabase:^(AWSFMDatabase *db) {
             if (![db executeStatements:@"PRAGMA auto_vacuum = FULL"]) {
                 AWSDDLogError(@"Failed to enable 'auto_vacuum' to 'FULL'. %@", db.lastError);
             }
@@ -122,6 +128,22 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
     return queue;
 }
 
+// Submissions run here instead of on `sharedQueue`, after the blocks queued there before them, so saving a record only
+// waits for the writer connection while the submitted records are deleted, not for the read and the network request in
+// between. Submissions are background uploads, so they run at utility quality of service. They stay on a serial queue
+// rather than the pool of `+[AWSExecutor executorWithQualityOfService:]`, since two at once would send the same records.
++ (dispatch_queue_t)submissionQueue {
+    static dispatch_queue_t queue;
+    static dispatch_once_t predicate;
+
+    dispatch_once(&predicate, ^{
+        dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0);
+        queue = dispatch_queue_create("com.amazonaws.AWSKinesisRecorder.submission", attributes);
+    });
+
+    return queue;
+}
+
 - (AWSTask *)saveRecord:(NSData *)data
              streamName:(NSString *)streamName {
     return [self saveRecord:data streamName:streamName partitionKey:[[NSUUID UUID] UUIDString]];
@@ -135,9 +157,8 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
         return [AWSTask taskWithError:[self.recorderHelper dataTooLargeError]];
     }
 
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     NSTimeInterval diskAgeLimit = self.diskAgeLimit;
-    NSString *databasePath = self.databasePath;
     NSUInteger notificationByteThreshold = self.notificationByteThreshold;
     NSUInteger diskByteLimit = self.diskByteLimit;
     __weak id notificationSender = self;
@@ -145,7 +166,7 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSKinesisRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         // Inserts a new record to the database.
         __block NSError *error = nil;
-        [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        [databaseStore inDatabase:^(AWSFMDatabase *db) {
             BOOL result = [db executeUpdate:
                            @"INSERT INTO record ("
                            @"partition_key, stream_name, data, timestamp, retry_count"
@@ -168,8 +189,9 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
             }
         }];
 
+        __block BOOL deletedOldRecords = NO;
         if (!error && diskAgeLimit > 0) {
-            [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+            [databaseStore inDatabase:^(AWSFMDatabase *db) {
                 // Deletes old records exceeding the threshold.
                 BOOL result = [db executeUpdate:
                                @"DELETE FROM record "
@@ -182,6 +204,7 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
                     AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                     error = db.lastError;
                 }
+                deletedOldRecords = result && [db changes] > 0;
             }];
         }
 
@@ -189,35 +212,35 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
             return [AWSTask taskWithError:error];
         }
 
-        NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:databasePath
-                                                                                    error:&error];
-        if (attributes) {
-            NSUInteger fileSize = (NSUInteger)[attributes fileSize];
-            [self.recorderHelper checkByteThresholdForNotification:notificationByteThreshold
-                                                notificationSender:notificationSender
-                                                          fileSize:fileSize];
-            if (fileSize > diskByteLimit) {
-                // Deletes the oldest record if it exceeds the disk size threshold.
-                [databaseQueue inDatabase:^(AWSFMDatabase *db) {
-                    BOOL result = [db executeUpdate:
-                                   @"DELETE FROM record "
-                                   @"WHERE rowid IN ( "
-                                   @"SELECT rowid "
-                                   @"FROM record "
-                                   @"ORDER BY timestamp ASC "
-                                   @"LIMIT 1 "
-                                   @")"
-                                   ];
-                    if (!result) {
-                        AWSDDLogError(@"SQLite error. [%@]", db.lastError);
-                        error = db.lastError;
-                        return;
-                    }
-                }];
-
-            }
-        } else if (error) {
-            return [AWSTask taskWithError:error];
+        // The log of the database counts towards the disk usage, and deleted records only free their space once it is
+        // checkpointed.
+        NSUInteger fileSize = (NSUInteger)databaseStore.fileSize;
+        if (deletedOldRecords || fileSize > diskByteLimit) {
+            [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
+            fileSize = (NSUInteger)databaseStore.fileSize;
+        }
+        [self.recorderHelper checkByteThresholdForNotification:notificationByteThreshold
+                                            notificationSender:notificationSender
+                                                      fileSize:fileSize];
+        if (fileSize > diskByteLimit) {
+            // Deletes the oldest record if it exceeds the disk size threshold.
+            [databaseStore inDatabase:^(AWSFMDatabase *db) {
+                BOOL result = [db executeUpdate:
+                               @"DELETE FROM record "
+                               @"WHERE rowid IN ( "
+                               @"SELECT rowid "
+                               @"FROM record "
+                               @"ORDER BY timestamp ASC "
+                               @"LIMIT 1 "
+                               @")"
+                               ];
+                if (!result) {
+                    AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                    error = db.lastError;
+                    return;
+                }
+            }];
+            [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
         }
 
         return nil;
@@ -225,32 +248,43 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
 }
 
 - (AWSTask *)submitAllRecords {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
 
-    return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSKinesisRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+    AWSTask *pendingSavesTask = [AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSKinesisRecorder sharedQueue]] withBlock:^id _Nullable{
+        return nil;
+    }];
+
+    return [pendingSavesTask continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSKinesisRecorder submissionQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         __block NSUInteger batchSize = 0;
         __block BOOL stop = NO;
+        NSUInteger batchRecordsCountLimit = AWSKinesisAbstractClientBatchRecordCountLimitDefault;
+        if ([self.recorderHelper respondsToSelector:@selector(batchRecordsCountLimit)]) {
+            batchRecordsCountLimit = [self.recorderHelper batchRecordsCountLimit];
+        }
 
         do {
-            [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
-                NSMutableArray *rowIds = nil;
-
+            // Reads the batch on a reader, so the writer is only held for the short transaction after the submission.
+            __block NSMutableArray *rowIds = nil;
+            __block NSMutableArray *temporaryRecords = nil;
+            [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
                 AWSFMResultSet *rs = [db executeQuery:
                                       @"SELECT rowid, partition_key, data, retry_count, stream_name "
                                       @"FROM record "
                                       @"WHERE stream_name = (SELECT stream_name FROM record ORDER BY timestamp ASC LIMIT 1) "
                                       @"ORDER BY timestamp ASC "
-                                      @"LIMIT 128"];
+                                      @"LIMIT :limit"
+                          withParameterDictionary:@{
+                                                    @"limit" : @(batchRecordsCountLimit)
+                                                    }];
                 if (!rs) {
-                    AWSDDLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+                    AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                     error = db.lastError;
-                    *rollback = YES;
                     return;
                 }
 
                 NSUInteger batchDataSize = 0;
-                NSMutableArray *temporaryRecords = [NSMutableArray new];
+                temporaryRecords = [NSMutableArray new];
                 rowIds = [NSMutableArray new];
                 while ([rs next]) {
                     [temporaryRecords addObject:@{
@@ -266,49 +300,53 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
                         break;
                     }
                 }
-                rs = nil;
-                batchSize = [temporaryRecords count];
-
-                if (batchSize > 0) {
-                    __block NSMutableArray *putRowIds = [NSMutableArray new];
-                    __block NSMutableArray *retryRowIds = [NSMutableArray new];
+                [rs close];
+            }];
+            if (error) {
+                break;
+            }
+            batchSize = [temporaryRecords count];
 
-                    NSString *streamName = temporaryRecords[0][@"stream_name"];
+            NSMutableArray *putRowIds = [NSMutableArray new];
+            NSMutableArray *retryRowIds = [NSMutableArray new];
+            if (batchSize > 0) {
+                NSString *streamName = temporaryRecords[0][@"stream_name"];
 
-                    AWSTask *submitTask = \
-                        [self.recorderHelper submitRecordsForStream:streamName
-                                                            records:temporaryRecords
-                                                             rowIds:rowIds
-                                                          putRowIds:putRowIds
-                                                        retryRowIds:retryRowIds
-                                                               stop:&stop];
+                AWSTask *submitTask = \
+                    [self.recorderHelper submitRecordsForStream:streamName
+                                                        records:temporaryRecords
+                                                         rowIds:rowIds
+                                                      putRowIds:putRowIds
+                                                    retryRowIds:retryRowIds
+                                                           stop:&stop];
 
-                    [submitTask waitUntilFinished];
+                [submitTask waitUntilFinished];
 
-                    if (submitTask.error) {
-                        error = submitTask.error;
-                    }
+                if (submitTask.error) {
+                    error = submitTask.error;
+                }
+            }
 
-                    for (NSString *rowId in putRowIds) {
-                        BOOL result = [db executeUpdate:@"DELETE FROM record WHERE rowid = :rowid"
-                                withParameterDictionary:@{
-                                                          @"rowid" : rowId
-                                                          }];
-                        if (!result) {
-                            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
-                            error = db.lastError;
-                        }
+            [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                for (NSString *rowId in putRowIds) {
+                    BOOL result = [db executeUpdate:@"DELETE FROM record WHERE rowid = :rowid"
+                            withParameterDictionary:@{
+                                                      @"rowid" : rowId
+                                                      }];
+                    if (!result) {
+                        AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                        error = db.lastError;
                     }
+                }
 
-                    for (NSString *rowId in retryRowIds) {
-                        BOOL result = [db executeUpdate:@"UPDATE record SET retry_count = retry_count + 1 WHERE rowid = :rowid"
-                                withParameterDictionary:@{
-                                                          @"rowid" : rowId
-                                                          }];
-                        if (!result) {
-                            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
-                            error = db.lastError;
-                        }
+                for (NSString *rowId in retryRowIds) {
+                    BOOL result = [db executeUpdate:@"UPDATE record SET retry_count = retry_count + 1 WHERE rowid = :rowid"
+                            withParameterDictionary:@{
+                                                      @"rowid" : rowId
+                                                      }];
+                    if (!result) {
+                        AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                        error = db.lastError;
                     }
                 }
 
@@ -320,6 +358,7 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
                 }
             }];
         } while (!stop && !error && batchSize > 0);
+        [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
 
         if (error) {
             return [AWSTask taskWithError:error];
@@ -330,16 +369,17 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
 }
 
 - (AWSTask *)removeAllRecords {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
 
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSKinesisRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
-        [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        [databaseStore inDatabase:^(AWSFMDatabase *db) {
             if (![db executeUpdate:@"DELETE FROM record"]) {
                 AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
             }
         }];
+        [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
 
         if (error) {
             return [AWSTask taskWithError:error];
@@ -350,15 +390,7 @@ NSString *const AWSKinesisAbstractClientRecorderDatabasePathPrefix = @"com/amazo
 }
 
 - (NSUInteger)diskBytesUsed {
-    NSError *error = nil;
-    NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:self.databasePath
-                                                                                error:&error];
-    if (attributes) {
-        return (NSUInteger)[attributes fileSize];
-    } else {
-        AWSDDLogError(@"Error [%@]", error);
-        return 0;
-    }
+    return (NSUInteger)self.databaseStore.fileSize;
 }
 
 - (void)setBatchRecordsByteLimit:(NSUInteger)batchRecordsByteLimit {
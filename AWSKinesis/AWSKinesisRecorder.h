@@ -43,6 +43,20 @@ FOUNDATION_EXPORT NSString *const AWSKinesisRecorderByteThresholdReachedNotifica
  */
 @interface AWSKinesisRecorder : AWSAbstractKinesisRecorder
 
+/**
+ Whether saved records are packed into Kinesis Producer Library (KPL) aggregated records when they are submitted. The default is `NO`.
+
+ @discussion Records whose partition keys map to the same shard are sent together as one Kinesis record, so many small records use one record of the shard's throughput and one `PutRecords` entry. The partition key of each record is kept inside the aggregated record. Consumers need to deaggregate the records, for example with the Kinesis Client Library or the Kinesis aggregation libraries.
+
+ The recorder calls `ListShards` to learn the hash key ranges of the stream, so the credentials need the `kinesis:ListShards` permission. When the shards cannot be listed, records are sent one by one.
+ */
+@property (nonatomic, assign, getter=isAggregationEnabled) BOOL aggregationEnabled;
+
+/**
+ The maximum size in bytes of an aggregated record, including its partition key. The default value is 50KB. The maximum is 1MB.
+ */
+@property (nonatomic, assign) NSUInteger aggregatedRecordByteLimit;
+
 /**
  Returns a shared instance of this service client using `[AWSServiceManager defaultServiceManager].defaultServiceConfiguration`. When `defaultServiceConfiguration` is not set, this method returns nil.
 
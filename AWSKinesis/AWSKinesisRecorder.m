@@ -15,6 +15,7 @@
 
 #import "AWSKinesisRecorder.h"
 #import "AWSKinesis.h"
+#import "AWSKinesisRecordAggregator.h"
 
 // Constants
 NSString *const AWSKinesisRecorderErrorDomain = @"com.amazonaws.AWSKinesisRecorderErrorDomain";
@@ -23,6 +24,16 @@ NSString *const AWSKinesisRecorderByteThresholdReachedNotificationDiskBytesUsedK
 
 static NSString *const AWSInfoKinesisRecorder = @"KinesisRecorder";
 
+NSUInteger const AWSKinesisRecorderAggregatedRecordByteLimitDefault = 50 * 1024; // 50KB
+NSUInteger const AWSKinesisRecorderAggregatedRecordByteLimitMaximum = 1024 * 1024; // 1MB
+// Aggregated records carry many saved records each, so a submission reads more of them.
+NSUInteger const AWSKinesisRecorderAggregatedBatchRecordsCountLimit = 5000;
+NSUInteger const AWSKinesisRecorderBatchRecordsCountLimit = 128;
+// The maximum number of records in a `PutRecords` request.
+NSUInteger const AWSKinesisRecorderPutRecordsCountLimit = 500;
+// How long to send records unaggregated after the shards of a stream could not be listed.
+NSTimeInterval const AWSKinesisRecorderShardListingRetryInterval = 5 * 60;
+
 // Legacy constants
 NSString *const AWSKinesisRecorderCacheName = @"com.amazonaws.AWSKinesisRecorderCacheName.Cache";
 
@@ -35,6 +46,10 @@ NSString *const AWSKinesisRecorderCacheName = @"com.amazonaws.AWSKinesisRecorder
 @interface AWSKinesisRecorderHelper : NSObject <AWSKinesisRecorderHelper>
 
 @property (nonatomic, strong) AWSKinesis *kinesis;
+@property (nonatomic, assign, getter=isAggregationEnabled) BOOL aggregationEnabled;
+@property (nonatomic, assign) NSUInteger aggregatedRecordByteLimit;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, AWSKinesisRecordAggregator *> *aggregators;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSDate *> *shardListingFailureDates;
 
 @end
 
@@ -144,6 +159,26 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
     return self;
 }
 
+- (AWSKinesisRecorderHelper *)kinesisRecorderHelper {
+    return (AWSKinesisRecorderHelper *)self.recorderHelper;
+}
+
+- (BOOL)isAggregationEnabled {
+    return [self kinesisRecorderHelper].aggregationEnabled;
+}
+
+- (void)setAggregationEnabled:(BOOL)aggregationEnabled {
+    [self kinesisRecorderHelper].aggregationEnabled = aggregationEnabled;
+}
+
+- (NSUInteger)aggregatedRecordByteLimit {
+    return [self kinesisRecorderHelper].aggregatedRecordByteLimit;
+}
+
+- (void)setAggregatedRecordByteLimit:(NSUInteger)aggregatedRecordByteLimit {
+    [self kinesisRecorderHelper].aggregatedRecordByteLimit = MIN(aggregatedRecordByteLimit, AWSKinesisRecorderAggregatedRecordByteLimitMaximum);
+}
+
 @end
 
 @implementation AWSKinesisRecorderHelper
@@ -151,26 +186,142 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
 - (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration {
     if (self = [super init]) {
         _kinesis = [[AWSKinesis alloc] initWithConfiguration:configuration];
+        _aggregatedRecordByteLimit = AWSKinesisRecorderAggregatedRecordByteLimitDefault;
+        _aggregators = [NSMutableDictionary new];
+        _shardListingFailureDates = [NSMutableDictionary new];
     }
 
     return self;
 }
 
+- (NSUInteger)batchRecordsCountLimit {
+    return self.aggregationEnabled ? AWSKinesisRecorderAggregatedBatchRecordsCountLimit : AWSKinesisRecorderBatchRecordsCountLimit;
+}
+
+- (AWSTask *)listShardsForStream:(NSString *)streamName
+                       nextToken:(NSString *)nextToken
+                          shards:(NSMutableArray<AWSKinesisShard *> *)shards {
+    AWSKinesisListShardsInput *listShardsInput = [AWSKinesisListShardsInput new];
+    // The stream name cannot be sent together with a token.
+    if (nextToken) {
+        listShardsInput.nextToken = nextToken;
+    } else {
+        listShardsInput.streamName = streamName;
+    }
+
+    return [[self.kinesis listShards:listShardsInput] continueWithSuccessBlock:^id(AWSTask<AWSKinesisListShardsOutput *> *task) {
+        if (task.result.shards) {
+            [shards addObjectsFromArray:task.result.shards];
+        }
+        if (task.result.nextToken) {
+            return [self listShardsForStream:streamName
+                                   nextToken:task.result.nextToken
+                                      shards:shards];
+        }
+        return nil;
+    }];
+}
+
+// Returns the aggregator for the current shards of the stream, or nil when they could not be listed.
+- (AWSTask<AWSKinesisRecordAggregator *> *)aggregatorForStream:(NSString *)streamName {
+    @synchronized(self.aggregators) {
+        AWSKinesisRecordAggregator *aggregator = self.aggregators[streamName];
+        if (aggregator) {
+            return [AWSTask taskWithResult:aggregator];
+        }
+        NSDate *failureDate = self.shardListingFailureDates[streamName];
+        if (failureDate && -[failureDate timeIntervalSinceNow] < AWSKinesisRecorderShardListingRetryInterval) {
+            return [AWSTask taskWithResult:nil];
+        }
+    }
+
+    NSMutableArray<AWSKinesisShard *> *shards = [NSMutableArray new];
+    return [[self listShardsForStream:streamName nextToken:nil shards:shards] continueWithBlock:^id(AWSTask *task) {
+        AWSKinesisRecordAggregator *aggregator = nil;
+        if (!task.error) {
+            aggregator = [[AWSKinesisRecordAggregator alloc] initWithShards:shards];
+        }
+
+        @synchronized(self.aggregators) {
+            if (aggregator) {
+                self.aggregators[streamName] = aggregator;
+                [self.shardListingFailureDates removeObjectForKey:streamName];
+            } else if (![task.error.domain isEqualToString:NSURLErrorDomain]) {
+                // For example, the credentials are not allowed to call ListShards.
+                AWSDDLogWarn(@"Sending records unaggregated. Failed to list the shards of [%@]: [%@]", streamName, task.error);
+                self.shardListingFailureDates[streamName] = [NSDate date];
+            }
+        }
+        return aggregator;
+    }];
+}
+
 - (AWSTask *)submitRecordsForStream:(NSString *)streamName
                             records:(NSArray *)temporaryRecords
                              rowIds:(NSArray *)rowIds
                           putRowIds:(NSMutableArray *)putRowIds
                         retryRowIds:(NSMutableArray *)retryRowIds
                                stop:(BOOL *)stop {
-    NSMutableArray *records = [NSMutableArray new];
+    AWSTask *aggregatorTask = [AWSTask taskWithResult:nil];
+    if (self.aggregationEnabled) {
+        aggregatorTask = [self aggregatorForStream:streamName];
+    }
 
-    for (NSDictionary *recordDictionary in temporaryRecords) {
-        AWSKinesisPutRecordsRequestEntry *requestEntry = [AWSKinesisPutRecordsRequestEntry new];
-        requestEntry.partitionKey = recordDictionary[@"partition_key"];
-        requestEntry.data = recordDictionary[@"data"];
-        streamName = recordDictionary[@"stream_name"];
+    return [aggregatorTask continueWithBlock:^id(AWSTask *task) {
+        return [self putRecordsForStream:streamName
+                                 records:temporaryRecords
+                                  rowIds:rowIds
+                              aggregator:task.result
+                               putRowIds:putRowIds
+                             retryRowIds:retryRowIds
+                                    stop:stop];
+    }];
+}
 
-        [records addObject:requestEntry];
+- (AWSTask *)putRecordsForStream:(NSString *)streamName
+                         records:(NSArray *)temporaryRecords
+                          rowIds:(NSArray *)rowIds
+                      aggregator:(AWSKinesisRecordAggregator *)aggregator
+                       putRowIds:(NSMutableArray *)putRowIds
+                     retryRowIds:(NSMutableArray *)retryRowIds
+                            stop:(BOOL *)stop {
+    NSMutableArray *records = [NSMutableArray new];
+    // The saved records sent in each request entry, and the shard each entry is expected to go to.
+    NSMutableArray<NSArray *> *recordRowIds = [NSMutableArray new];
+    NSMutableArray<NSString *> *shardIds = [NSMutableArray new];
+
+    if (aggregator) {
+        NSMutableArray<NSString *> *partitionKeys = [NSMutableArray arrayWithCapacity:[temporaryRecords count]];
+        NSMutableArray<NSData *> *data = [NSMutableArray arrayWithCapacity:[temporaryRecords count]];
+        for (NSDictionary *recordDictionary in temporaryRecords) {
+            [partitionKeys addObject:recordDictionary[@"partition_key"]];
+            [data addObject:recordDictionary[@"data"]];
+        }
+
+        NSArray<AWSKinesisAggregatedRecord *> *aggregatedRecords = [aggregator aggregateRecordsWithPartitionKeys:partitionKeys
+                                                                                                             data:data
+                                                                                                maximumRecordSize:self.aggregatedRecordByteLimit];
+        for (AWSKinesisAggregatedRecord *aggregatedRecord in aggregatedRecords) {
+            if ([records count] == AWSKinesisRecorderPutRecordsCountLimit) {
+                // The rest stays saved and goes with the next request.
+                break;
+            }
+            [records addObject:aggregatedRecord.requestEntry];
+            [recordRowIds addObject:[rowIds objectsAtIndexes:aggregatedRecord.recordIndexes]];
+            [shardIds addObject:aggregatedRecord.shardId];
+        }
+    } else {
+        for (NSUInteger i = 0; i < [temporaryRecords count] && i < AWSKinesisRecorderPutRecordsCountLimit; i++) {
+            NSDictionary *recordDictionary = temporaryRecords[i];
+            AWSKinesisPutRecordsRequestEntry *requestEntry = [AWSKinesisPutRecordsRequestEntry new];
+            requestEntry.partitionKey = recordDictionary[@"partition_key"];
+            requestEntry.data = recordDictionary[@"data"];
+            streamName = recordDictionary[@"stream_name"];
+
+            [records addObject:requestEntry];
+            [recordRowIds addObject:@[rowIds[i]]];
+            [shardIds addObject:@""];
+        }
     }
 
     AWSKinesisPutRecordsInput *putRecordsInput = [AWSKinesisPutRecordsInput new];
@@ -188,8 +339,9 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
         }
         if (task.result) {
             AWSKinesisPutRecordsOutput *putRecordsOutput = task.result;
+            BOOL shardsChanged = NO;
 
-            for (int i = 0; i < [putRecordsOutput.records count]; i++) {
+            for (int i = 0; i < [putRecordsOutput.records count] && i < [recordRowIds count]; i++) {
                 AWSKinesisPutRecordsResultEntry *resultEntry = putRecordsOutput.records[i];
                 if (resultEntry.errorCode) {
                     AWSDDLogInfo(@"Error Code: [%@] Error Message: [%@]", resultEntry.errorCode, resultEntry.errorMessage);
@@ -198,9 +350,23 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
                 // we should retry. So, don't delete the row from the database.
                 if (![resultEntry.errorCode isEqualToString:@"ProvisionedThroughputExceededException"]
                     && ![resultEntry.errorCode isEqualToString:@"InternalFailure"]) {
-                    [putRowIds addObject:rowIds[i]];
+                    [putRowIds addObjectsFromArray:recordRowIds[i]];
                 } else {
-                    [retryRowIds addObject:rowIds[i]];
+                    [retryRowIds addObjectsFromArray:recordRowIds[i]];
+                }
+
+                if ([shardIds[i] length] > 0
+                    && resultEntry.shardId
+                    && ![resultEntry.shardId isEqualToString:shardIds[i]]) {
+                    shardsChanged = YES;
+                }
+            }
+
+            if (shardsChanged) {
+                // The stream was resharded. List its shards again before the next aggregation.
+                AWSDDLogDebug(@"The shards of [%@] changed.", streamName);
+                @synchronized(self.aggregators) {
+                    [self.aggregators removeObjectForKey:streamName];
                 }
             }
         }
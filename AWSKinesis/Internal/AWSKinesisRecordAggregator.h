@@ -0,0 +1,82 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+@class AWSKinesisShard;
+@class AWSKinesisPutRecordsRequestEntry;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ One `PutRecords` entry built from one or more user records.
+ */
+@interface AWSKinesisAggregatedRecord : NSObject
+
+@property (nonatomic, strong, readonly) AWSKinesisPutRecordsRequestEntry *requestEntry;
+
+/**
+ The shard the entry is expected to be written to.
+ */
+@property (nonatomic, strong, readonly) NSString *shardId;
+
+/**
+ The positions of the user records in the entry, in the arrays passed to the aggregator.
+ */
+@property (nonatomic, strong, readonly) NSIndexSet *recordIndexes;
+
+@end
+
+/**
+ Packs user records that hash to the same shard into Kinesis Producer Library aggregated records, which the KPL, the
+ Kinesis Client Library and the Kinesis aggregation libraries deaggregate on the consumer side.
+
+ An aggregated record is the magic number `F3 89 9A C2`, an `AggregatedRecord` protocol buffer holding the partition
+ keys and data of its user records, and the MD5 digest of the protocol buffer. Its own partition key is the one of its
+ first user record, so it lands on the shard that every user record in it maps to.
+ */
+@interface AWSKinesisRecordAggregator : NSObject
+
+/**
+ Returns an aggregator for the open shards of a stream, or `nil` if `shards` has no open shard with a valid hash key range.
+ */
+- (nullable instancetype)initWithShards:(NSArray<AWSKinesisShard *> *)shards;
+
+/**
+ The open shard whose hash key range holds the MD5 hash of `partitionKey`.
+ */
+- (nullable NSString *)shardIdForPartitionKey:(NSString *)partitionKey;
+
+/**
+ Groups the records by shard and packs each group into as few entries as `maximumRecordSize` allows, keeping the order of
+ the records within a shard. A record that is alone in its entry, or too large to share one, is sent as is.
+
+ @param partitionKeys     The partition key of each record.
+ @param data              The data of each record.
+ @param maximumRecordSize The maximum size of an entry's data and partition key together.
+ */
+- (NSArray<AWSKinesisAggregatedRecord *> *)aggregateRecordsWithPartitionKeys:(NSArray<NSString *> *)partitionKeys
+                                                                         data:(NSArray<NSData *> *)data
+                                                            maximumRecordSize:(NSUInteger)maximumRecordSize;
+
+/**
+ Encodes records in the aggregated record format, regardless of their shards.
+ */
++ (NSData *)aggregatedDataWithPartitionKeys:(NSArray<NSString *> *)partitionKeys
+                                       data:(NSArray<NSData *> *)data;
+
+@end
+
+NS_ASSUME_NONNULL_END
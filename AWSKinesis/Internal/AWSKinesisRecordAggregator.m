@@ -0,0 +1,366 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSKinesisRecordAggregator.h"
+#import <CommonCrypto/CommonDigest.h>
+#import "AWSKinesisModel.h"
+
+static const uint8_t AWSKinesisAggregatedRecordMagic[] = {0xF3, 0x89, 0x9A, 0xC2};
+
+// Protocol buffer keys of the AggregatedRecord and Record fields used here.
+static const uint8_t AWSKinesisAggregatedRecordPartitionKeyTableKey = (1 << 3) | 2;
+static const uint8_t AWSKinesisAggregatedRecordRecordsKey = (3 << 3) | 2;
+static const uint8_t AWSKinesisRecordPartitionKeyIndexKey = (1 << 3) | 0;
+static const uint8_t AWSKinesisRecordDataKey = (3 << 3) | 2;
+
+#pragma mark - Hash keys
+
+// An unsigned 128 bit hash key, most significant word first.
+typedef struct {
+    uint32_t words[4];
+} AWSKinesisHashKey;
+
+typedef struct {
+    AWSKinesisHashKey startingHashKey;
+    AWSKinesisHashKey endingHashKey;
+    NSUInteger shardIndex;
+} AWSKinesisHashKeyRange;
+
+static BOOL AWSKinesisHashKeyFromString(NSString *string, AWSKinesisHashKey *hashKey) {
+    memset(hashKey, 0, sizeof(AWSKinesisHashKey));
+    const char *characters = [string UTF8String];
+    if (characters == NULL || *characters == '\0') {
+        return NO;
+    }
+    for (; *characters != '\0'; characters++) {
+        if (*characters < '0' || *characters > '9') {
+            return NO;
+        }
+        uint64_t carry = (uint64_t)(*characters - '0');
+        for (int i = 3; i >= 0; i--) {
+            uint64_t value = (uint64_t)hashKey->words[i] * 10 + carry;
+            hashKey->words[i] = (uint32_t)value;
+            carry = value >> 32;
+        }
+        if (carry > 0) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+static AWSKinesisHashKey AWSKinesisHashKeyForPartitionKey(NSString *partitionKey) {
+    NSData *data = [partitionKey dataUsingEncoding:NSUTF8StringEncoding];
+    uint8_t digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5([data bytes], (CC_LONG)[data length], digest);
+
+    AWSKinesisHashKey hashKey;
+    for (int i = 0; i < 4; i++) {
+        hashKey.words[i] = ((uint32_t)digest[i * 4] << 24)
+        | ((uint32_t)digest[i * 4 + 1] << 16)
+        | ((uint32_t)digest[i * 4 + 2] << 8)
+        | (uint32_t)digest[i * 4 + 3];
+    }
+    return hashKey;
+}
+
+static int AWSKinesisHashKeyCompare(const AWSKinesisHashKey *a, const AWSKinesisHashKey *b) {
+    for (int i = 0; i < 4; i++) {
+        if (a->words[i] != b->words[i]) {
+            return (a->words[i] < b->words[i]) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static int AWSKinesisHashKeyRangeCompare(const void *a, const void *b) {
+    return AWSKinesisHashKeyCompare(&((const AWSKinesisHashKeyRange *)a)->startingHashKey,
+                                    &((const AWSKinesisHashKeyRange *)b)->startingHashKey);
+}
+
+#pragma mark - Protocol buffers
+
+static NSUInteger AWSKinesisVarintLength(uint64_t value) {
+    NSUInteger length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        length++;
+    }
+    return length;
+}
+
+static uint8_t *AWSKinesisWriteVarint(uint8_t *cursor, uint64_t value) {
+    while (value >= 0x80) {
+        *cursor++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *cursor++ = (uint8_t)value;
+    return cursor;
+}
+
+static NSUInteger AWSKinesisRecordMessageLength(NSUInteger partitionKeyIndex, NSUInteger dataLength) {
+    return 1 + AWSKinesisVarintLength(partitionKeyIndex) + 1 + AWSKinesisVarintLength(dataLength) + dataLength;
+}
+
+@interface AWSKinesisAggregatedRecord()
+
+@property (nonatomic, strong) AWSKinesisPutRecordsRequestEntry *requestEntry;
+@property (nonatomic, strong) NSString *shardId;
+@property (nonatomic, strong) NSIndexSet *recordIndexes;
+
+@end
+
+@implementation AWSKinesisAggregatedRecord
+
+@end
+
+// Collects the user records of one aggregated record and keeps track of its encoded size.
+@interface AWSKinesisAggregatedRecordBuilder : NSObject
+
+@property (nonatomic, strong) NSString *shardId;
+@property (nonatomic, strong) NSMutableArray<NSData *> *partitionKeyTable;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> *partitionKeyIndexes;
+@property (nonatomic, strong) NSMutableArray<NSString *> *partitionKeys;
+@property (nonatomic, strong) NSMutableArray<NSData *> *data;
+@property (nonatomic, strong) NSMutableIndexSet *recordIndexes;
+@property (nonatomic, assign) NSUInteger protobufLength;
+@property (nonatomic, assign) NSUInteger outerPartitionKeyLength;
+
+@end
+
+@implementation AWSKinesisAggregatedRecordBuilder
+
+- (instancetype)initWithShardId:(NSString *)shardId {
+    if (self = [super init]) {
+        _shardId = shardId;
+        _partitionKeyTable = [NSMutableArray new];
+        _partitionKeyIndexes = [NSMutableDictionary new];
+        _partitionKeys = [NSMutableArray new];
+        _data = [NSMutableArray new];
+        _recordIndexes = [NSMutableIndexSet new];
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return [self.data count];
+}
+
+// Returns the growth of the protocol buffer, and the index of the partition key, if the record were added.
+- (NSUInteger)protobufLengthForPartitionKey:(NSString *)partitionKey
+                                       data:(NSData *)data
+                          partitionKeyIndex:(NSUInteger *)partitionKeyIndex
+                           partitionKeyData:(NSData **)partitionKeyData {
+    NSUInteger length = 0;
+    NSNumber *index = self.partitionKeyIndexes[partitionKey];
+    if (index) {
+        *partitionKeyIndex = [index unsignedIntegerValue];
+        *partitionKeyData = nil;
+    } else {
+        *partitionKeyIndex = [self.partitionKeyTable count];
+        *partitionKeyData = [partitionKey dataUsingEncoding:NSUTF8StringEncoding];
+        length += 1 + AWSKinesisVarintLength([*partitionKeyData length]) + [*partitionKeyData length];
+    }
+    NSUInteger messageLength = AWSKinesisRecordMessageLength(*partitionKeyIndex, [data length]);
+    length += 1 + AWSKinesisVarintLength(messageLength) + messageLength;
+    return length;
+}
+
+- (NSUInteger)sizeByAddingPartitionKey:(NSString *)partitionKey data:(NSData *)data {
+    NSUInteger partitionKeyIndex = 0;
+    NSData *partitionKeyData = nil;
+    NSUInteger protobufLength = self.protobufLength + [self protobufLengthForPartitionKey:partitionKey
+                                                                                     data:data
+                                                                        partitionKeyIndex:&partitionKeyIndex
+                                                                         partitionKeyData:&partitionKeyData];
+    NSUInteger outerPartitionKeyLength = [self count] > 0 ? self.outerPartitionKeyLength : [partitionKey lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    return sizeof(AWSKinesisAggregatedRecordMagic) + protobufLength + CC_MD5_DIGEST_LENGTH + outerPartitionKeyLength;
+}
+
+- (void)addPartitionKey:(NSString *)partitionKey data:(NSData *)data index:(NSUInteger)index {
+    NSUInteger partitionKeyIndex = 0;
+    NSData *partitionKeyData = nil;
+    self.protobufLength += [self protobufLengthForPartitionKey:partitionKey
+                                                          data:data
+                                             partitionKeyIndex:&partitionKeyIndex
+                                              partitionKeyData:&partitionKeyData];
+    if (partitionKeyData) {
+        self.partitionKeyIndexes[partitionKey] = @(partitionKeyIndex);
+        [self.partitionKeyTable addObject:partitionKeyData];
+    }
+    if ([self count] == 0) {
+        self.outerPartitionKeyLength = [partitionKey lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    }
+    [self.partitionKeys addObject:partitionKey];
+    [self.data addObject:data];
+    [self.recordIndexes addIndex:index];
+}
+
+- (NSData *)aggregatedData {
+    NSMutableData *aggregatedData = [NSMutableData dataWithLength:sizeof(AWSKinesisAggregatedRecordMagic) + self.protobufLength + CC_MD5_DIGEST_LENGTH];
+    uint8_t *bytes = [aggregatedData mutableBytes];
+    memcpy(bytes, AWSKinesisAggregatedRecordMagic, sizeof(AWSKinesisAggregatedRecordMagic));
+    uint8_t *protobuf = bytes + sizeof(AWSKinesisAggregatedRecordMagic);
+    uint8_t *cursor = protobuf;
+
+    for (NSData *partitionKeyData in self.partitionKeyTable) {
+        *cursor++ = AWSKinesisAggregatedRecordPartitionKeyTableKey;
+        cursor = AWSKinesisWriteVarint(cursor, [partitionKeyData length]);
+        memcpy(cursor, [partitionKeyData bytes], [partitionKeyData length]);
+        cursor += [partitionKeyData length];
+    }
+
+    for (NSUInteger i = 0; i < [self count]; i++) {
+        NSUInteger partitionKeyIndex = [self.partitionKeyIndexes[self.partitionKeys[i]] unsignedIntegerValue];
+        NSData *data = self.data[i];
+        *cursor++ = AWSKinesisAggregatedRecordRecordsKey;
+        cursor = AWSKinesisWriteVarint(cursor, AWSKinesisRecordMessageLength(partitionKeyIndex, [data length]));
+        *cursor++ = AWSKinesisRecordPartitionKeyIndexKey;
+        cursor = AWSKinesisWriteVarint(cursor, partitionKeyIndex);
+        *cursor++ = AWSKinesisRecordDataKey;
+        cursor = AWSKinesisWriteVarint(cursor, [data length]);
+        memcpy(cursor, [data bytes], [data length]);
+        cursor += [data length];
+    }
+
+    CC_MD5(protobuf, (CC_LONG)self.protobufLength, cursor);
+    return aggregatedData;
+}
+
+- (AWSKinesisAggregatedRecord *)aggregatedRecord {
+    AWSKinesisPutRecordsRequestEntry *requestEntry = [AWSKinesisPutRecordsRequestEntry new];
+    requestEntry.partitionKey = [self.partitionKeys firstObject];
+    // A single record gains nothing from aggregation.
+    requestEntry.data = ([self count] == 1) ? [self.data firstObject] : [self aggregatedData];
+
+    AWSKinesisAggregatedRecord *aggregatedRecord = [AWSKinesisAggregatedRecord new];
+    aggregatedRecord.requestEntry = requestEntry;
+    aggregatedRecord.shardId = self.shardId;
+    aggregatedRecord.recordIndexes = [self.recordIndexes copy];
+    return aggregatedRecord;
+}
+
+@end
+
+#pragma mark - AWSKinesisRecordAggregator
+
+@interface AWSKinesisRecordAggregator()
+
+@property (nonatomic, strong) NSArray<NSString *> *shardIds;
+@property (nonatomic, strong) NSData *hashKeyRanges;
+
+@end
+
+@implementation AWSKinesisRecordAggregator
+
+- (instancetype)initWithShards:(NSArray<AWSKinesisShard *> *)shards {
+    if (self = [super init]) {
+        NSMutableArray<NSString *> *shardIds = [NSMutableArray new];
+        NSMutableData *hashKeyRanges = [NSMutableData new];
+        for (AWSKinesisShard *shard in shards) {
+            // Closed shards no longer accept records, and their children cover the same hash keys.
+            if (shard.sequenceNumberRange.endingSequenceNumber || !shard.shardId) {
+                continue;
+            }
+            AWSKinesisHashKeyRange range;
+            if (!AWSKinesisHashKeyFromString(shard.hashKeyRange.startingHashKey, &range.startingHashKey)
+                || !AWSKinesisHashKeyFromString(shard.hashKeyRange.endingHashKey, &range.endingHashKey)) {
+                continue;
+            }
+            range.shardIndex = [shardIds count];
+            [shardIds addObject:shard.shardId];
+            [hashKeyRanges appendBytes:&range length:sizeof(range)];
+        }
+
+        if ([shardIds count] == 0) {
+            return nil;
+        }
+        qsort([hashKeyRanges mutableBytes], [shardIds count], sizeof(AWSKinesisHashKeyRange), AWSKinesisHashKeyRangeCompare);
+        _shardIds = shardIds;
+        _hashKeyRanges = hashKeyRanges;
+    }
+    return self;
+}
+
+- (NSString *)shardIdForPartitionKey:(NSString *)partitionKey {
+    AWSKinesisHashKey hashKey = AWSKinesisHashKeyForPartitionKey(partitionKey);
+    const AWSKinesisHashKeyRange *ranges = [self.hashKeyRanges bytes];
+
+    // Finds the last range starting at or before the hash key.
+    NSUInteger low = 0;
+    NSUInteger high = [self.shardIds count];
+    while (low < high) {
+        NSUInteger middle = low + (high - low) / 2;
+        if (AWSKinesisHashKeyCompare(&ranges[middle].startingHashKey, &hashKey) <= 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low == 0 || AWSKinesisHashKeyCompare(&hashKey, &ranges[low - 1].endingHashKey) > 0) {
+        return nil;
+    }
+    return self.shardIds[ranges[low - 1].shardIndex];
+}
+
+- (NSArray<AWSKinesisAggregatedRecord *> *)aggregateRecordsWithPartitionKeys:(NSArray<NSString *> *)partitionKeys
+                                                                         data:(NSArray<NSData *> *)data
+                                                            maximumRecordSize:(NSUInteger)maximumRecordSize {
+    NSMutableArray<AWSKinesisAggregatedRecord *> *aggregatedRecords = [NSMutableArray new];
+    NSMutableDictionary<NSString *, AWSKinesisAggregatedRecordBuilder *> *buildersByShardId = [NSMutableDictionary new];
+    NSMutableArray<AWSKinesisAggregatedRecordBuilder *> *builders = [NSMutableArray new];
+
+    for (NSUInteger i = 0; i < [partitionKeys count]; i++) {
+        NSString *partitionKey = partitionKeys[i];
+        NSString *shardId = [self shardIdForPartitionKey:partitionKey];
+        AWSKinesisAggregatedRecordBuilder *builder = shardId ? buildersByShardId[shardId] : nil;
+
+        if (builder && [builder sizeByAddingPartitionKey:partitionKey data:data[i]] > maximumRecordSize) {
+            [aggregatedRecords addObject:[builder aggregatedRecord]];
+            [builders removeObjectIdenticalTo:builder];
+            [buildersByShardId removeObjectForKey:shardId];
+            builder = nil;
+        }
+
+        if (!builder) {
+            builder = [[AWSKinesisAggregatedRecordBuilder alloc] initWithShardId:shardId ?: @""];
+            if (!shardId || [builder sizeByAddingPartitionKey:partitionKey data:data[i]] > maximumRecordSize) {
+                // Sent on its own.
+                [builder addPartitionKey:partitionKey data:data[i] index:i];
+                [aggregatedRecords addObject:[builder aggregatedRecord]];
+                continue;
+            }
+            buildersByShardId[shardId] = builder;
+            [builders addObject:builder];
+        }
+        [builder addPartitionKey:partitionKey data:data[i] index:i];
+    }
+
+    for (AWSKinesisAggregatedRecordBuilder *builder in builders) {
+        [aggregatedRecords addObject:[builder aggregatedRecord]];
+    }
+    return aggregatedRecords;
+}
+
++ (NSData *)aggregatedDataWithPartitionKeys:(NSArray<NSString *> *)partitionKeys
+                                       data:(NSArray<NSData *> *)data {
+    AWSKinesisAggregatedRecordBuilder *builder = [[AWSKinesisAggregatedRecordBuilder alloc] initWithShardId:@""];
+    for (NSUInteger i = 0; i < [partitionKeys count]; i++) {
+        [builder addPartitionKey:partitionKeys[i] data:data[i] index:i];
+    }
+    return [builder aggregatedData];
+}
+
+@end
@@ -0,0 +1,466 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <CommonCrypto/CommonDigest.h>
+#import "AWSTestUtility.h"
+#import "AWSKinesis.h"
+#import "AWSKinesisRecordAggregator.h"
+
+static NSString *const AWSKinesisRecordAggregationTestsStreamName = @"AWSKinesisRecordAggregationTestsStream";
+static const NSUInteger AWSKinesisRecordAggregationTestsRecordCount = 1000;
+
+@interface AWSKinesis()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+// Which of four equal hash key ranges the partition key falls in.
+static NSUInteger AWSKinesisRecordAggregationTestsShardIndex(NSString *partitionKey) {
+    NSData *data = [partitionKey dataUsingEncoding:NSUTF8StringEncoding];
+    uint8_t digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5([data bytes], (CC_LONG)[data length], digest);
+    return digest[0] >> 6;
+}
+
+static NSArray<AWSKinesisShard *> *AWSKinesisRecordAggregationTestsShards(void) {
+    NSArray<NSString *> *startingHashKeys = @[@"0",
+                                              @"85070591730234615865843651857942052864",
+                                              @"170141183460469231731687303715884105728",
+                                              @"255211775190703847597530955573826158592"];
+    NSArray<NSString *> *endingHashKeys = @[@"85070591730234615865843651857942052863",
+                                            @"170141183460469231731687303715884105727",
+                                            @"255211775190703847597530955573826158591",
+                                            @"340282366920938463463374607431768211455"];
+    NSMutableArray<AWSKinesisShard *> *shards = [NSMutableArray new];
+
+    // A closed parent shard covering everything, which must be ignored.
+    AWSKinesisShard *closedShard = [AWSKinesisShard new];
+    closedShard.shardId = @"shardId-closed";
+    closedShard.hashKeyRange = [AWSKinesisHashKeyRange new];
+    closedShard.hashKeyRange.startingHashKey = [startingHashKeys firstObject];
+    closedShard.hashKeyRange.endingHashKey = [endingHashKeys lastObject];
+    closedShard.sequenceNumberRange = [AWSKinesisSequenceNumberRange new];
+    closedShard.sequenceNumberRange.startingSequenceNumber = @"1";
+    closedShard.sequenceNumberRange.endingSequenceNumber = @"2";
+    [shards addObject:closedShard];
+
+    // Listed out of order on purpose.
+    for (NSNumber *index in @[@2, @0, @3, @1]) {
+        AWSKinesisShard *shard = [AWSKinesisShard new];
+        shard.shardId = [NSString stringWithFormat:@"shardId-%@", index];
+        shard.hashKeyRange = [AWSKinesisHashKeyRange new];
+        shard.hashKeyRange.startingHashKey = startingHashKeys[index.unsignedIntegerValue];
+        shard.hashKeyRange.endingHashKey = endingHashKeys[index.unsignedIntegerValue];
+        shard.sequenceNumberRange = [AWSKinesisSequenceNumberRange new];
+        shard.sequenceNumberRange.startingSequenceNumber = @"3";
+        [shards addObject:shard];
+    }
+    return shards;
+}
+
+// Reads a Kinesis record back into its user records, the way the deaggregation libraries do. Records that are not
+// aggregated come back as they are.
+static NSArray<NSArray *> *AWSKinesisRecordAggregationTestsDeaggregate(NSString *partitionKey, NSData *data) {
+    static const uint8_t magic[] = {0xF3, 0x89, 0x9A, 0xC2};
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    if (length < sizeof(magic) + CC_MD5_DIGEST_LENGTH || memcmp(bytes, magic, sizeof(magic)) != 0) {
+        return @[@[partitionKey, data]];
+    }
+
+    const uint8_t *protobuf = bytes + sizeof(magic);
+    NSUInteger protobufLength = length - sizeof(magic) - CC_MD5_DIGEST_LENGTH;
+    uint8_t digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5(protobuf, (CC_LONG)protobufLength, digest);
+    if (memcmp(digest, protobuf + protobufLength, CC_MD5_DIGEST_LENGTH) != 0) {
+        return @[@[partitionKey, data]];
+    }
+
+    uint64_t (^readVarint)(const uint8_t **, const uint8_t *) = ^uint64_t(const uint8_t **cursor, const uint8_t *end) {
+        uint64_t value = 0;
+        for (int shift = 0; *cursor < end; shift += 7) {
+            uint8_t byte = *(*cursor)++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                break;
+            }
+        }
+        return value;
+    };
+
+    NSMutableArray<NSString *> *partitionKeyTable = [NSMutableArray new];
+    NSMutableArray<NSArray *> *records = [NSMutableArray new];
+    const uint8_t *cursor = protobuf;
+    const uint8_t *end = protobuf + protobufLength;
+    while (cursor < end) {
+        uint64_t key = readVarint(&cursor, end);
+        if ((key & 7) != 2) {
+            readVarint(&cursor, end);
+            continue;
+        }
+        uint64_t fieldLength = readVarint(&cursor, end);
+        const uint8_t *fieldEnd = cursor + fieldLength;
+        if (key >> 3 == 1) {
+            [partitionKeyTable addObject:[[NSString alloc] initWithBytes:cursor length:fieldLength encoding:NSUTF8StringEncoding]];
+        } else if (key >> 3 == 3) {
+            uint64_t partitionKeyIndex = 0;
+            NSData *recordData = nil;
+            while (cursor < fieldEnd) {
+                uint64_t recordKey = readVarint(&cursor, fieldEnd);
+                if ((recordKey & 7) == 0) {
+                    uint64_t value = readVarint(&cursor, fieldEnd);
+                    if (recordKey >> 3 == 1) {
+                        partitionKeyIndex = value;
+                    }
+                } else {
+                    uint64_t valueLength = readVarint(&cursor, fieldEnd);
+                    if (recordKey >> 3 == 3) {
+                        recordData = [NSData dataWithBytes:cursor length:valueLength];
+                    }
+                    cursor += valueLength;
+                }
+            }
+            [records addObject:@[partitionKeyTable[partitionKeyIndex], recordData]];
+        }
+        cursor = fieldEnd;
+    }
+    return records;
+}
+
+// A local stand-in for the Kinesis service.
+@interface AWSKinesisStandIn : AWSKinesis
+
+@property (nonatomic, assign) NSUInteger putRecordsCount;
+@property (nonatomic, assign) NSUInteger listShardsCount;
+@property (nonatomic, strong) NSError *listShardsError;
+@property (nonatomic, strong) NSString *shardIdOverride;
+@property (nonatomic, strong) NSMutableArray<NSArray *> *receivedRecords;
+
+@end
+
+@implementation AWSKinesisStandIn
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration {
+    if (self = [super initWithConfiguration:configuration]) {
+        _receivedRecords = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (AWSTask<AWSKinesisListShardsOutput *> *)listShards:(AWSKinesisListShardsInput *)request {
+    @synchronized(self) {
+        self.listShardsCount++;
+    }
+    if (self.listShardsError) {
+        return [AWSTask taskWithError:self.listShardsError];
+    }
+
+    // Returns the shards two pages at a time.
+    NSArray<AWSKinesisShard *> *shards = AWSKinesisRecordAggregationTestsShards();
+    NSUInteger start = request.nextToken ? (NSUInteger)[request.nextToken integerValue] : 0;
+    AWSKinesisListShardsOutput *output = [AWSKinesisListShardsOutput new];
+    output.shards = [shards subarrayWithRange:NSMakeRange(start, MIN(2, [shards count] - start))];
+    if (start + 2 < [shards count]) {
+        output.nextToken = [NSString stringWithFormat:@"%lu", (unsigned long)(start + 2)];
+    }
+    return [AWSTask taskWithResult:output];
+}
+
+- (AWSTask<AWSKinesisPutRecordsOutput *> *)putRecords:(AWSKinesisPutRecordsInput *)request {
+    NSMutableArray<AWSKinesisPutRecordsResultEntry *> *resultEntries = [NSMutableArray new];
+    @synchronized(self) {
+        self.putRecordsCount++;
+        for (AWSKinesisPutRecordsRequestEntry *requestEntry in request.records) {
+            NSUInteger shardIndex = AWSKinesisRecordAggregationTestsShardIndex(requestEntry.partitionKey);
+            for (NSArray *record in AWSKinesisRecordAggregationTestsDeaggregate(requestEntry.partitionKey, requestEntry.data)) {
+                // Every user record has to belong to the shard the Kinesis record is written to.
+                NSAssert(AWSKinesisRecordAggregationTestsShardIndex(record[0]) == shardIndex, @"The record is on the wrong shard.");
+                [self.receivedRecords addObject:record];
+            }
+
+            AWSKinesisPutRecordsResultEntry *resultEntry = [AWSKinesisPutRecordsResultEntry new];
+            resultEntry.shardId = self.shardIdOverride ?: [NSString stringWithFormat:@"shardId-%lu", (unsigned long)shardIndex];
+            resultEntry.sequenceNumber = [NSString stringWithFormat:@"%lu", (unsigned long)[self.receivedRecords count]];
+            [resultEntries addObject:resultEntry];
+        }
+    }
+
+    AWSKinesisPutRecordsOutput *output = [AWSKinesisPutRecordsOutput new];
+    output.records = resultEntries;
+    output.failedRecordCount = @0;
+    return [AWSTask taskWithResult:output];
+}
+
+@end
+
+@interface AWSKinesisRecordAggregationTests : XCTestCase
+
+@property (nonatomic, strong) NSString *recorderKey;
+@property (nonatomic, strong) AWSKinesisRecorder *recorder;
+@property (nonatomic, strong) AWSKinesisStandIn *kinesis;
+
+@end
+
+@implementation AWSKinesisRecordAggregationTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1
+                                                                         credentialsProvider:nil];
+    self.recorderKey = [[NSUUID UUID] UUIDString];
+    [AWSKinesisRecorder registerKinesisRecorderWithConfiguration:configuration forKey:self.recorderKey];
+    self.recorder = [AWSKinesisRecorder KinesisRecorderForKey:self.recorderKey];
+    self.kinesis = [[AWSKinesisStandIn alloc] initWithConfiguration:configuration];
+    [[self.recorder valueForKey:@"recorderHelper"] setValue:self.kinesis forKey:@"kinesis"];
+}
+
+- (void)tearDown {
+    [[self.recorder removeAllRecords] waitUntilFinished];
+    [AWSKinesisRecorder removeKinesisRecorderForKey:self.recorderKey];
+    [super tearDown];
+}
+
+- (NSData *)recordDataForIndex:(NSUInteger)index {
+    NSString *event = [NSString stringWithFormat:@"{\"event\":\"screen_view\",\"index\":%lu,\"screen\":\"home\",\"session\":\"%@\"}",
+                       (unsigned long)index, [[NSUUID UUID] UUIDString]];
+    return [event dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (NSArray<NSArray *> *)saveRecords:(NSUInteger)count {
+    NSMutableArray<NSArray *> *records = [NSMutableArray new];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSString *partitionKey = [[NSUUID UUID] UUIDString];
+        NSData *data = [self recordDataForIndex:i];
+        [[self.recorder saveRecord:data
+                        streamName:AWSKinesisRecordAggregationTestsStreamName
+                      partitionKey:partitionKey] waitUntilFinished];
+        [records addObject:@[partitionKey, data]];
+    }
+    return records;
+}
+
+#pragma mark - Aggregation
+
+- (void)testAggregatedRecordFormat {
+    NSData *data = [AWSKinesisRecordAggregator aggregatedDataWithPartitionKeys:@[@"a", @"bb", @"a"]
+                                                                          data:@[[@"hello" dataUsingEncoding:NSUTF8StringEncoding],
+                                                                                 [NSData data],
+                                                                                 [@"x" dataUsingEncoding:NSUTF8StringEncoding]]];
+    const uint8_t expected[] = {
+        0xF3, 0x89, 0x9A, 0xC2,
+        0x0A, 0x01, 'a',
+        0x0A, 0x02, 'b', 'b',
+        0x1A, 0x09, 0x08, 0x00, 0x1A, 0x05, 'h', 'e', 'l', 'l', 'o',
+        0x1A, 0x04, 0x08, 0x01, 0x1A, 0x00,
+        0x1A, 0x05, 0x08, 0x00, 0x1A, 0x01, 'x',
+    };
+    XCTAssertEqual([data length], sizeof(expected) + CC_MD5_DIGEST_LENGTH);
+    XCTAssertEqualObjects([data subdataWithRange:NSMakeRange(0, sizeof(expected))], [NSData dataWithBytes:expected length:sizeof(expected)]);
+
+    uint8_t digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5(expected + 4, (CC_LONG)(sizeof(expected) - 4), digest);
+    XCTAssertEqualObjects([data subdataWithRange:NSMakeRange(sizeof(expected), CC_MD5_DIGEST_LENGTH)], [NSData dataWithBytes:digest length:CC_MD5_DIGEST_LENGTH]);
+
+    NSArray *records = AWSKinesisRecordAggregationTestsDeaggregate(@"a", data);
+    XCTAssertEqualObjects(records, (@[@[@"a", [@"hello" dataUsingEncoding:NSUTF8StringEncoding]],
+                                      @[@"bb", [NSData data]],
+                                      @[@"a", [@"x" dataUsingEncoding:NSUTF8StringEncoding]]]));
+}
+
+- (void)testRecordsAreGroupedByShard {
+    AWSKinesisRecordAggregator *aggregator = [[AWSKinesisRecordAggregator alloc] initWithShards:AWSKinesisRecordAggregationTestsShards()];
+    XCTAssertNotNil(aggregator);
+
+    NSMutableArray<NSString *> *partitionKeys = [NSMutableArray new];
+    NSMutableArray<NSData *> *data = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 3000; i++) {
+        // Some partition keys repeat.
+        [partitionKeys addObject:(i % 3 == 0) ? [NSString stringWithFormat:@"user-%lu", (unsigned long)i % 10] : [[NSUUID UUID] UUIDString]];
+        [data addObject:[self recordDataForIndex:i]];
+        XCTAssertEqualObjects([aggregator shardIdForPartitionKey:partitionKeys[i]],
+                              ([NSString stringWithFormat:@"shardId-%lu", (unsigned long)AWSKinesisRecordAggregationTestsShardIndex(partitionKeys[i])]));
+    }
+
+    NSUInteger maximumRecordSize = 10 * 1024;
+    NSArray<AWSKinesisAggregatedRecord *> *aggregatedRecords = [aggregator aggregateRecordsWithPartitionKeys:partitionKeys
+                                                                                                         data:data
+                                                                                            maximumRecordSize:maximumRecordSize];
+    XCTAssertLessThan([aggregatedRecords count], 3000 / 20);
+
+    NSMutableIndexSet *indexes = [NSMutableIndexSet new];
+    NSMutableDictionary<NSString *, NSMutableArray *> *receivedByShard = [NSMutableDictionary new];
+    for (AWSKinesisAggregatedRecord *aggregatedRecord in aggregatedRecords) {
+        AWSKinesisPutRecordsRequestEntry *requestEntry = aggregatedRecord.requestEntry;
+        XCTAssertLessThanOrEqual([requestEntry.data length] + [requestEntry.partitionKey lengthOfBytesUsingEncoding:NSUTF8StringEncoding], maximumRecordSize);
+        XCTAssertEqualObjects([aggregator shardIdForPartitionKey:requestEntry.partitionKey], aggregatedRecord.shardId);
+        XCTAssertFalse([indexes containsIndexes:aggregatedRecord.recordIndexes]);
+        [indexes addIndexes:aggregatedRecord.recordIndexes];
+
+        NSArray *records = AWSKinesisRecordAggregationTestsDeaggregate(requestEntry.partitionKey, requestEntry.data);
+        XCTAssertEqual([records count], [aggregatedRecord.recordIndexes count]);
+        __block NSUInteger position = 0;
+        [aggregatedRecord.recordIndexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+            XCTAssertEqualObjects(records[position], (@[partitionKeys[index], data[index]]));
+            position++;
+        }];
+
+        if (!receivedByShard[aggregatedRecord.shardId]) {
+            receivedByShard[aggregatedRecord.shardId] = [NSMutableArray new];
+        }
+        [receivedByShard[aggregatedRecord.shardId] addObjectsFromArray:records];
+    }
+    XCTAssertEqual([indexes count], 3000);
+
+    // The records of each shard keep their order.
+    for (NSString *shardId in receivedByShard) {
+        NSMutableArray *expected = [NSMutableArray new];
+        for (NSUInteger i = 0; i < 3000; i++) {
+            if ([[aggregator shardIdForPartitionKey:partitionKeys[i]] isEqualToString:shardId]) {
+                [expected addObject:@[partitionKeys[i], data[i]]];
+            }
+        }
+        XCTAssertEqualObjects(receivedByShard[shardId], expected);
+    }
+}
+
+- (void)testRecordsLargerThanTheLimitAreSentAsIs {
+    AWSKinesisRecordAggregator *aggregator = [[AWSKinesisRecordAggregator alloc] initWithShards:AWSKinesisRecordAggregationTestsShards()];
+    NSArray<NSData *> *data = @[[self recordDataForIndex:0],
+                                [NSMutableData dataWithLength:2000],
+                                [self recordDataForIndex:2],
+                                [self recordDataForIndex:3]];
+    NSArray<AWSKinesisAggregatedRecord *> *aggregatedRecords = [aggregator aggregateRecordsWithPartitionKeys:@[@"key", @"key", @"key", @"key"]
+                                                                                                         data:data
+                                                                                            maximumRecordSize:1000];
+    XCTAssertEqual([aggregatedRecords count], 3);
+    // A record alone in its entry isn't wrapped.
+    XCTAssertEqualObjects(aggregatedRecords[0].requestEntry.data, data[0]);
+    XCTAssertEqualObjects(aggregatedRecords[1].requestEntry.data, data[1]);
+    XCTAssertEqualObjects(aggregatedRecords[1].recordIndexes, [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqualObjects(AWSKinesisRecordAggregationTestsDeaggregate(@"key", aggregatedRecords[2].requestEntry.data),
+                          (@[@[@"key", data[2]], @[@"key", data[3]]]));
+}
+
+- (void)testShardsWithoutValidHashKeyRangesHaveNoAggregator {
+    XCTAssertNil([[AWSKinesisRecordAggregator alloc] initWithShards:@[]]);
+
+    AWSKinesisShard *shard = [AWSKinesisShard new];
+    shard.shardId = @"shardId-0";
+    shard.hashKeyRange = [AWSKinesisHashKeyRange new];
+    shard.hashKeyRange.startingHashKey = @"0";
+    shard.hashKeyRange.endingHashKey = @"340282366920938463463374607431768211456";
+    XCTAssertNil([[AWSKinesisRecordAggregator alloc] initWithShards:@[shard]]);
+}
+
+#pragma mark - Recorder
+
+- (void)testRecorderSubmitsAggregatedRecords {
+    self.recorder.aggregationEnabled = YES;
+    NSArray<NSArray *> *records = [self saveRecords:AWSKinesisRecordAggregationTestsRecordCount];
+
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.putRecordsCount, 1);
+    XCTAssertEqual(self.kinesis.listShardsCount, 3);
+    XCTAssertEqualObjects([NSSet setWithArray:self.kinesis.receivedRecords], [NSSet setWithArray:records]);
+    XCTAssertEqual([self.kinesis.receivedRecords count], AWSKinesisRecordAggregationTestsRecordCount);
+
+    // The shards are listed once per stream.
+    [self saveRecords:10];
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.listShardsCount, 3);
+    XCTAssertEqual([self.kinesis.receivedRecords count], AWSKinesisRecordAggregationTestsRecordCount + 10);
+}
+
+- (void)testRecorderSendsRecordsOneByOneByDefault {
+    XCTAssertFalse(self.recorder.isAggregationEnabled);
+    NSArray<NSArray *> *records = [self saveRecords:AWSKinesisRecordAggregationTestsRecordCount];
+
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.putRecordsCount, (AWSKinesisRecordAggregationTestsRecordCount + 127) / 128);
+    XCTAssertEqual(self.kinesis.listShardsCount, 0);
+    XCTAssertEqualObjects([NSSet setWithArray:self.kinesis.receivedRecords], [NSSet setWithArray:records]);
+}
+
+- (void)testRecorderListsShardsAgainAfterResharding {
+    self.recorder.aggregationEnabled = YES;
+    self.kinesis.shardIdOverride = @"shardId-after-resharding";
+    [self saveRecords:10];
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.listShardsCount, 3);
+
+    [self saveRecords:10];
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.listShardsCount, 6);
+    XCTAssertEqual([self.kinesis.receivedRecords count], 20);
+}
+
+- (void)testRecorderSendsRecordsOneByOneWhenShardsCannotBeListed {
+    self.recorder.aggregationEnabled = YES;
+    self.kinesis.listShardsError = [NSError errorWithDomain:AWSKinesisErrorDomain
+                                                       code:AWSKinesisErrorUnknown
+                                                   userInfo:nil];
+    NSArray<NSArray *> *records = [self saveRecords:200];
+
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqualObjects([NSSet setWithArray:self.kinesis.receivedRecords], [NSSet setWithArray:records]);
+    // Up to 500 records per request.
+    XCTAssertEqual(self.kinesis.putRecordsCount, 1);
+
+    // Listing isn't retried right away.
+    [self saveRecords:10];
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.listShardsCount, 1);
+}
+
+- (void)testAggregatedRecordByteLimit {
+    XCTAssertEqual(self.recorder.aggregatedRecordByteLimit, 50 * 1024);
+    self.recorder.aggregatedRecordByteLimit = 2 * 1024 * 1024;
+    XCTAssertEqual(self.recorder.aggregatedRecordByteLimit, 1024 * 1024);
+}
+
+#pragma mark - Performance
+
+- (void)measureSubmissionWithAggregation:(BOOL)aggregationEnabled {
+    self.recorder.aggregationEnabled = aggregationEnabled;
+    [self measureMetrics:@[XCTPerformanceMetric_WallClockTime] automaticallyStartMeasuring:NO forBlock:^{
+        [self saveRecords:AWSKinesisRecordAggregationTestsRecordCount];
+        NSUInteger putRecordsCount = self.kinesis.putRecordsCount;
+        NSUInteger receivedRecordCount = [self.kinesis.receivedRecords count];
+
+        [self startMeasuring];
+        AWSTask *task = [[self.recorder submitAllRecords] waitUntilFinished];
+        [self stopMeasuring];
+
+        XCTAssertNil(task.error);
+        XCTAssertEqual([self.kinesis.receivedRecords count] - receivedRecordCount, AWSKinesisRecordAggregationTestsRecordCount);
+        // Aggregated records fit in one request, where records sent one by one take one per 128.
+        XCTAssertEqual(self.kinesis.putRecordsCount - putRecordsCount,
+                       aggregationEnabled ? 1 : (AWSKinesisRecordAggregationTestsRecordCount + 127) / 128);
+    }];
+}
+
+- (void)testSubmitAggregatedRecordsPerformance {
+    [self measureSubmissionWithAggregation:YES];
+}
+
+- (void)testSubmitRecordsPerformance {
+    [self measureSubmissionWithAggregation:NO];
+}
+
+@end
@@ -0,0 +1,139 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSKinesis.h"
+
+static NSString *const AWSKinesisRecorderConcurrencyTestsStreamName = @"AWSKinesisRecorderConcurrencyTestsStream";
+
+@interface AWSKinesis()
+
+- (instancetype)initWithConfiguration:(AWSServiceConfiguration *)configuration;
+
+@end
+
+// A local stand-in for the Kinesis service that accepts every record after `requestDelay` milliseconds.
+@interface AWSKinesisSlowStandIn : AWSKinesis
+
+@property (atomic, assign) int requestDelay;
+@property (atomic, assign) NSUInteger putRecordsCount;
+
+@end
+
+@implementation AWSKinesisSlowStandIn
+
+- (AWSTask<AWSKinesisPutRecordsOutput *> *)putRecords:(AWSKinesisPutRecordsInput *)request {
+    self.putRecordsCount++;
+    return [[AWSTask taskWithDelay:self.requestDelay] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+        NSMutableArray<AWSKinesisPutRecordsResultEntry *> *resultEntries = [NSMutableArray new];
+        for (NSUInteger i = 0; i < [request.records count]; i++) {
+            AWSKinesisPutRecordsResultEntry *resultEntry = [AWSKinesisPutRecordsResultEntry new];
+            resultEntry.shardId = @"shardId-0";
+            resultEntry.sequenceNumber = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+            [resultEntries addObject:resultEntry];
+        }
+
+        AWSKinesisPutRecordsOutput *output = [AWSKinesisPutRecordsOutput new];
+        output.records = resultEntries;
+        output.failedRecordCount = @0;
+        return output;
+    }];
+}
+
+@end
+
+@interface AWSKinesisRecorderConcurrencyTests : XCTestCase
+
+@property (nonatomic, strong) NSString *recorderKey;
+@property (nonatomic, strong) AWSKinesisRecorder *recorder;
+@property (nonatomic, strong) AWSKinesisSlowStandIn *kinesis;
+
+@end
+
+@implementation AWSKinesisRecorderConcurrencyTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1
+                                                                         credentialsProvider:nil];
+    self.recorderKey = [[NSUUID UUID] UUIDString];
+    [AWSKinesisRecorder registerKinesisRecorderWithConfiguration:configuration forKey:self.recorderKey];
+    self.recorder = [AWSKinesisRecorder KinesisRecorderForKey:self.recorderKey];
+    self.kinesis = [[AWSKinesisSlowStandIn alloc] initWithConfiguration:configuration];
+    [[self.recorder valueForKey:@"recorderHelper"] setValue:self.kinesis forKey:@"kinesis"];
+}
+
+- (void)tearDown {
+    [[self.recorder removeAllRecords] waitUntilFinished];
+    [AWSKinesisRecorder removeKinesisRecorderForKey:self.recorderKey];
+    [super tearDown];
+}
+
+- (AWSTask *)saveRecords:(NSUInteger)count {
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSString *event = [NSString stringWithFormat:@"{\"event\":\"screen_view\",\"index\":%lu}", (unsigned long)i];
+        [tasks addObject:[self.recorder saveRecord:[event dataUsingEncoding:NSUTF8StringEncoding]
+                                        streamName:AWSKinesisRecorderConcurrencyTestsStreamName]];
+    }
+    return [AWSTask taskForCompletionOfAllTasks:tasks];
+}
+
+- (void)testSubmissionIncludesRecordsSavedBeforeIt {
+    [self saveRecords:10];
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.putRecordsCount, 1);
+
+    // Nothing is left to submit.
+    XCTAssertNil([[self.recorder submitAllRecords] waitUntilFinished].error);
+    XCTAssertEqual(self.kinesis.putRecordsCount, 1);
+}
+
+- (void)testSavingDoesNotWaitForSubmission {
+    XCTAssertNil([[self saveRecords:100] waitUntilFinished].error);
+    self.kinesis.requestDelay = 2000;
+    AWSTask *submitTask = [self.recorder submitAllRecords];
+
+    // Gives the submission time to read its batch and send it.
+    [NSThread sleepForTimeInterval:0.5];
+    XCTAssertEqual(self.kinesis.putRecordsCount, 1);
+    XCTAssertFalse(submitTask.isCompleted);
+
+    AWSTask *saveTask = [self saveRecords:10];
+    [saveTask waitUntilFinished];
+    XCTAssertNil(saveTask.error);
+    XCTAssertFalse(submitTask.isCompleted);
+
+    XCTAssertNil([submitTask waitUntilFinished].error);
+}
+
+- (void)testSavePerformanceDuringSubmission {
+    self.kinesis.requestDelay = 100;
+    [self measureMetrics:@[XCTPerformanceMetric_WallClockTime] automaticallyStartMeasuring:NO forBlock:^{
+        [[self saveRecords:500] waitUntilFinished];
+        AWSTask *submitTask = [self.recorder submitAllRecords];
+
+        [self startMeasuring];
+        [[self saveRecords:500] waitUntilFinished];
+        [self stopMeasuring];
+
+        [submitTask waitUntilFinished];
+    }];
+}
+
+@end
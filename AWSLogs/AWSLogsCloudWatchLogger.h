@@ -0,0 +1,115 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <AWSCore/AWSCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSLogs;
+
+/**
+ The maximum number of log events in one `PutLogEvents` request.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSLogsCloudWatchLoggerBatchEventLimit;
+
+/**
+ The maximum size of one `PutLogEvents` request, counted as the UTF-8 length of each message plus 26 bytes per event.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSLogsCloudWatchLoggerBatchByteLimit;
+
+/**
+ A logger that ships log statements to an Amazon CloudWatch Logs log stream.
+
+ Log statements are kept in a SQLite database on the device, saved in groups as configured by `saveThreshold` and
+ `saveInterval`, and uploaded in the background in `PutLogEvents` batches of up to
+ `AWSLogsCloudWatchLoggerBatchEventLimit` events and `AWSLogsCloudWatchLoggerBatchByteLimit` bytes. A batch is sent in
+ chronological order and spans at most 24 hours. Only one request per log stream is in flight at a time, and the
+ sequence token of each response is passed to the next request.
+
+ The upload interval adapts to the volume of log statements: it is halved, down to `minimumUploadInterval`, while
+ batches are full, and doubled, up to `maximumUploadInterval`, while they are mostly empty. When CloudWatch Logs
+ throttles a request or can't be reached, the events are kept and the upload is retried with exponential backoff.
+ Events older than `maxAge` are deleted without being uploaded. Statements the SDK logs while a `PutLogEvents` request
+ is in flight, such as the networking errors of that request, are not stored, so that failed uploads don't feed
+ themselves.
+
+ The log group and log stream must exist.
+
+    AWSLogsCloudWatchLogger *logger = [[AWSLogsCloudWatchLogger alloc] initWithLogs:[AWSLogs defaultLogs]
+                                                                      logGroupName:@"MyApp"
+                                                                     logStreamName:deviceIdentifier];
+    [AWSDDLog addLogger:logger withLevel:AWSDDLogLevelInfo];
+ */
+@interface AWSLogsCloudWatchLogger : AWSDDAbstractDatabaseLogger
+
+/**
+ Initializes a logger that uploads to the given log stream. Events that weren't uploaded by an earlier logger for the
+ same log stream are uploaded by this one.
+
+ @param logs          The service client used to upload log events.
+ @param logGroupName  The name of the log group.
+ @param logStreamName The name of the log stream.
+ */
+- (instancetype)initWithLogs:(AWSLogs *)logs
+                logGroupName:(NSString *)logGroupName
+               logStreamName:(NSString *)logStreamName NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) AWSLogs *logs;
+
+@property (nonatomic, strong, readonly) NSString *logGroupName;
+
+@property (nonatomic, strong, readonly) NSString *logStreamName;
+
+/**
+ The shortest time between two uploads. The default is 1 second.
+ */
+@property (atomic, assign) NSTimeInterval minimumUploadInterval;
+
+/**
+ The longest time between two uploads, and the longest backoff after a failed upload. The default is 60 seconds.
+ */
+@property (atomic, assign) NSTimeInterval maximumUploadInterval;
+
+/**
+ The time until the next upload.
+ */
+@property (atomic, assign, readonly) NSTimeInterval uploadInterval;
+
+/**
+ The number of `PutLogEvents` requests sent, including those that failed.
+ */
+@property (atomic, assign, readonly) NSUInteger requestCount;
+
+/**
+ Saves the pending log statements and uploads every saved event now.
+
+ @return A task that completes when the upload stopped. `task.result` is always `nil`. `task.error` is set if events
+         were kept because an upload failed.
+ */
+- (AWSTask *)uploadLogEvents;
+
+/**
+ Deletes the saved events that haven't been uploaded.
+
+ @return A task whose `task.result` is always `nil`.
+ */
+- (AWSTask *)removeAllLogEvents;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,502 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <CommonCrypto/CommonDigest.h>
+#import "AWSLogsCloudWatchLogger.h"
+#import "AWSLogsService.h"
+
+NSUInteger const AWSLogsCloudWatchLoggerBatchEventLimit = 10000;
+NSUInteger const AWSLogsCloudWatchLoggerBatchByteLimit = 1048576;
+
+static NSUInteger const AWSLogsCloudWatchLoggerEventOverhead = 26;
+static NSUInteger const AWSLogsCloudWatchLoggerEventByteLimit = 256 * 1024;
+static long long const AWSLogsCloudWatchLoggerBatchSpan = 24 * 60 * 60 * 1000; // 24 hours in milliseconds
+static NSTimeInterval const AWSLogsCloudWatchLoggerMinimumUploadIntervalDefault = 1;
+static NSTimeInterval const AWSLogsCloudWatchLoggerMaximumUploadIntervalDefault = 60;
+static NSString *const AWSLogsCloudWatchLoggerDatabasePathPrefix = @"com/amazonaws/AWSLogsCloudWatchLogger";
+
+// This logger can't report its own errors through AWSDDLog: on the logger queue that would deadlock, and anything logged
+// while uploading would be stored and uploaded in turn. So we use primitive logging macros around NSLog.
+
+#ifndef AWSLOGS_NSLOG_LEVEL
+    #define AWSLOGS_NSLOG_LEVEL 2
+#endif
+
+#define NSLogError(frmt, ...)    do{ if(AWSLOGS_NSLOG_LEVEL >= 1) NSLog((@"AWSLogsCloudWatchLogger: " frmt), ##__VA_ARGS__); } while(0)
+#define NSLogWarn(frmt, ...)     do{ if(AWSLOGS_NSLOG_LEVEL >= 2) NSLog((@"AWSLogsCloudWatchLogger: " frmt), ##__VA_ARGS__); } while(0)
+#define NSLogDebug(frmt, ...)    do{ if(AWSLOGS_NSLOG_LEVEL >= 4) NSLog((@"AWSLogsCloudWatchLogger: " frmt), ##__VA_ARGS__); } while(0)
+
+// Truncates `message` at a character boundary so that its event fits in a request.
+static NSString *AWSLogsCloudWatchLoggerTruncatedMessage(NSString *message) {
+    NSUInteger maxLength = AWSLogsCloudWatchLoggerEventByteLimit - AWSLogsCloudWatchLoggerEventOverhead;
+    if ([message lengthOfBytesUsingEncoding:NSUTF8StringEncoding] <= maxLength) {
+        return message;
+    }
+
+    NSMutableData *data = [NSMutableData dataWithLength:maxLength];
+    NSUInteger usedLength = 0;
+    [message getBytes:data.mutableBytes
+            maxLength:maxLength
+           usedLength:&usedLength
+             encoding:NSUTF8StringEncoding
+              options:0
+                range:NSMakeRange(0, message.length)
+       remainingRange:NULL];
+    return [[NSString alloc] initWithBytes:data.bytes length:usedLength encoding:NSUTF8StringEncoding];
+}
+
+@interface AWSLogsCloudWatchLoggerBatch : NSObject
+
+@property (nonatomic, strong) NSMutableArray<AWSLogsInputLogEvent *> *logEvents;
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *rowIds;
+
+// Whether more events were saved than fit in the batch.
+@property (nonatomic, assign, getter=isFull) BOOL full;
+
+@end
+
+@implementation AWSLogsCloudWatchLoggerBatch
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _logEvents = [NSMutableArray new];
+        _rowIds = [NSMutableArray new];
+    }
+    return self;
+}
+
+@end
+
+@interface AWSLogsCloudWatchLogger () {
+    // Accessed on the logger queue.
+    NSMutableArray<AWSLogsInputLogEvent *> *_unsavedLogEvents;
+    NSUInteger _savedEventCount;
+    NSUInteger _savedByteCount;
+
+    // Accessed on the upload queue.
+    dispatch_queue_t _uploadQueue;
+    dispatch_source_t _uploadTimer;
+    NSString *_sequenceToken;
+    NSUInteger _failureCount;
+}
+
+@property (nonatomic, strong) AWSFMDatabaseStore *databaseStore;
+@property (atomic, assign, readwrite) NSTimeInterval uploadInterval;
+@property (atomic, assign, readwrite) NSUInteger requestCount;
+// When the last PutLogEvents request started and ended, as time intervals since the reference date.
+@property (atomic, assign) NSTimeInterval uploadStart;
+@property (atomic, assign) NSTimeInterval uploadEnd;
+
+@end
+
+@implementation AWSLogsCloudWatchLogger
+
+- (instancetype)initWithLogs:(AWSLogs *)logs
+                logGroupName:(NSString *)logGroupName
+               logStreamName:(NSString *)logStreamName {
+    if (self = [super init]) {
+        _logs = logs;
+        _logGroupName = [logGroupName copy];
+        _logStreamName = [logStreamName copy];
+        _minimumUploadInterval = AWSLogsCloudWatchLoggerMinimumUploadIntervalDefault;
+        _maximumUploadInterval = AWSLogsCloudWatchLoggerMaximumUploadIntervalDefault;
+        _uploadInterval = AWSLogsCloudWatchLoggerMinimumUploadIntervalDefault;
+        _unsavedLogEvents = [NSMutableArray new];
+        _uploadQueue = dispatch_queue_create("com.amazonaws.AWSLogsCloudWatchLogger.upload",
+                                             dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+
+        NSString *databaseDirectoryPath = [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject
+                                           stringByAppendingPathComponent:AWSLogsCloudWatchLoggerDatabasePathPrefix];
+        NSError *error = nil;
+        if (![[NSFileManager defaultManager] createDirectoryAtPath:databaseDirectoryPath
+                                       withIntermediateDirectories:YES
+                                                        attributes:nil
+                                                             error:&error]) {
+            AWSDDLogError(@"Failed to create a directory for database. [%@]", error);
+        }
+
+        NSString *databasePath = [databaseDirectoryPath stringByAppendingPathComponent:
+                                  [[self class] databaseNameForLogGroupName:_logGroupName logStreamName:_logStreamName]];
+        AWSDDLogDebug(@"Database path: [%@]", databasePath);
+        _databaseStore = [AWSFMDatabaseStore storeWithPath:databasePath];
+        [_databaseStore inDatabase:^(AWSFMDatabase *db) {
+            if (![db executeStatements:
+                  @"CREATE TABLE IF NOT EXISTS event ("
+                  @"timestamp INTEGER NOT NULL,"
+                  @"message TEXT NOT NULL,"
+                  @"size INTEGER NOT NULL);"
+                  @"CREATE INDEX IF NOT EXISTS event_timestamp ON event (timestamp);"]) {
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+            }
+        }];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_uploadTimer) {
+        dispatch_source_cancel(_uploadTimer);
+    }
+}
+
++ (NSString *)databaseNameForLogGroupName:(NSString *)logGroupName logStreamName:(NSString *)logStreamName {
+    NSData *data = [[NSString stringWithFormat:@"%@\n%@", logGroupName, logStreamName] dataUsingEncoding:NSUTF8StringEncoding];
+    unsigned char digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(data.bytes, (CC_LONG)data.length, digest);
+
+    NSMutableString *name = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2 + 3];
+    for (int i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [name appendFormat:@"%02x", digest[i]];
+    }
+    [name appendString:@".db"];
+    return name;
+}
+
+#pragma mark - AWSDDAbstractDatabaseLogger
+
+// The db_ methods run on the logger queue.
+
+- (BOOL)db_log:(AWSDDLogMessage *)logMessage {
+    // The SDK logs the failures of this logger's own requests, for example the networking errors of a PutLogEvents
+    // request. Storing them would upload them, and each failed upload would queue more events.
+    NSTimeInterval timestamp = [logMessage.timestamp timeIntervalSinceReferenceDate];
+    NSTimeInterval uploadStart = self.uploadStart;
+    NSTimeInterval uploadEnd = self.uploadEnd;
+    if (uploadStart > 0 && timestamp >= uploadStart && (uploadEnd < uploadStart || timestamp <= uploadEnd)
+        && [logMessage.fileName hasPrefix:@"AWS"]) {
+        return NO;
+    }
+
+    NSString *message = _logFormatter ? [_logFormatter formatLogMessage:logMessage] : logMessage.message;
+    if (message.length == 0) {
+        return NO;
+    }
+
+    AWSLogsInputLogEvent *logEvent = [AWSLogsInputLogEvent new];
+    logEvent.message = AWSLogsCloudWatchLoggerTruncatedMessage(message);
+    logEvent.timestamp = @((long long)(logMessage.timestamp.timeIntervalSince1970 * 1000));
+    [_unsavedLogEvents addObject:logEvent];
+    return YES;
+}
+
+- (void)db_save {
+    if (_unsavedLogEvents.count == 0) {
+        return;
+    }
+
+    __block NSUInteger byteCount = 0;
+    [self.databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        for (AWSLogsInputLogEvent *logEvent in self->_unsavedLogEvents) {
+            NSUInteger size = [logEvent.message lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + AWSLogsCloudWatchLoggerEventOverhead;
+            if (![db executeUpdate:@"INSERT INTO event (timestamp, message, size) VALUES (?, ?, ?)",
+                  logEvent.timestamp, logEvent.message, @(size)]) {
+                NSLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+                *rollback = YES;
+                byteCount = 0;
+                return;
+            }
+            byteCount += size;
+        }
+    }];
+
+    if (byteCount > 0) {
+        _savedEventCount += _unsavedLogEvents.count;
+        _savedByteCount += byteCount;
+    }
+    [_unsavedLogEvents removeAllObjects];
+
+    // Upload a full batch without waiting for the timer.
+    if (_savedEventCount >= AWSLogsCloudWatchLoggerBatchEventLimit || _savedByteCount >= AWSLogsCloudWatchLoggerBatchByteLimit) {
+        _savedEventCount = 0;
+        _savedByteCount = 0;
+        __weak __typeof__(self) weakSelf = self;
+        dispatch_async(_uploadQueue, ^{
+            __typeof__(self) strongSelf = weakSelf;
+            // Don't cut a backoff short.
+            if (strongSelf && strongSelf->_failureCount == 0) {
+                [strongSelf upload_uploadLogEvents];
+                [strongSelf upload_scheduleUpload];
+            }
+        });
+    }
+}
+
+- (void)db_delete {
+    if (_maxAge <= 0.0) {
+        return;
+    }
+
+    long long timestamp = (long long)(([[NSDate date] timeIntervalSince1970] - _maxAge) * 1000);
+    [self.databaseStore inDatabase:^(AWSFMDatabase *db) {
+        if (![db executeUpdate:@"DELETE FROM event WHERE timestamp < ?", @(timestamp)]) {
+            NSLogError(@"SQLite error. [%@]", db.lastError);
+        }
+    }];
+}
+
+- (void)db_saveAndDelete {
+    [self db_save];
+    [self db_delete];
+}
+
+- (void)didAddLogger {
+    [super didAddLogger];
+
+    dispatch_async(_uploadQueue, ^{
+        [self upload_scheduleUpload];
+    });
+}
+
+- (void)willRemoveLogger {
+    [super willRemoveLogger];
+
+    dispatch_async(_uploadQueue, ^{
+        if (self->_uploadTimer) {
+            dispatch_source_cancel(self->_uploadTimer);
+            self->_uploadTimer = nil;
+        }
+    });
+}
+
+#pragma mark - Public API
+
+- (AWSTask *)uploadLogEvents {
+    AWSTaskCompletionSource *completionSource = [AWSTaskCompletionSource taskCompletionSource];
+
+    // Save on the logger queue first, so that the upload includes every statement this logger received.
+    dispatch_async(self.loggerQueue, ^{
+        @autoreleasepool {
+            [self savePendingLogEntries];
+        }
+        dispatch_async(self->_uploadQueue, ^{
+            NSError *error = [self upload_uploadLogEvents];
+            if (self->_uploadTimer) {
+                [self upload_scheduleUpload];
+            }
+
+            if (error) {
+                [completionSource setError:error];
+            } else {
+                [completionSource setResult:nil];
+            }
+        });
+    });
+
+    return completionSource.task;
+}
+
+- (AWSTask *)removeAllLogEvents {
+    AWSTaskCompletionSource *completionSource = [AWSTaskCompletionSource taskCompletionSource];
+
+    dispatch_async(self.loggerQueue, ^{
+        [self->_unsavedLogEvents removeAllObjects];
+        __block NSError *error = nil;
+        [self.databaseStore inDatabase:^(AWSFMDatabase *db) {
+            if (![db executeUpdate:@"DELETE FROM event"]) {
+                error = db.lastError;
+            }
+        }];
+
+        if (error) {
+            [completionSource setError:error];
+        } else {
+            [completionSource setResult:nil];
+        }
+    });
+
+    return completionSource.task;
+}
+
+#pragma mark - Uploading
+
+// The upload_ methods run on the upload queue.
+
+- (void)upload_scheduleUpload {
+    if (!_uploadTimer) {
+        _uploadTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, _uploadQueue);
+        __weak __typeof__(self) weakSelf = self;
+        dispatch_source_set_event_handler(_uploadTimer, ^{
+            @autoreleasepool {
+                [weakSelf upload_uploadLogEvents];
+                [weakSelf upload_scheduleUpload];
+            }
+        });
+        dispatch_resume(_uploadTimer);
+    }
+
+    // Changes to the minimum and maximum take effect here.
+    NSTimeInterval minimum = self.minimumUploadInterval;
+    NSTimeInterval interval = MIN(MAX(self.maximumUploadInterval, minimum), MAX(minimum, self.uploadInterval));
+    self.uploadInterval = interval;
+    dispatch_source_set_timer(_uploadTimer,
+                              dispatch_time(DISPATCH_TIME_NOW, (int64_t)(interval * NSEC_PER_SEC)),
+                              DISPATCH_TIME_FOREVER,
+                              (uint64_t)(interval * 0.1 * NSEC_PER_SEC));
+}
+
+// Sends batches until every saved event is uploaded or a request fails, then adapts the upload interval.
+- (NSError *)upload_uploadLogEvents {
+    NSError *error = nil;
+    NSUInteger batchCount = 0;
+    BOOL full = NO;
+
+    do {
+        AWSLogsCloudWatchLoggerBatch *batch = [self upload_nextBatchWithError:&error];
+        if (batch.logEvents.count == 0) {
+            break;
+        }
+
+        error = [self upload_sendBatch:batch];
+        batchCount++;
+        full = batch.isFull;
+    } while (!error && full);
+
+    NSTimeInterval minimum = self.minimumUploadInterval;
+    NSTimeInterval maximum = MAX(self.maximumUploadInterval, minimum);
+    NSTimeInterval interval = self.uploadInterval;
+    if (error) {
+        // Exponential backoff with jitter, so that devices that failed together don't retry together.
+        _failureCount++;
+        interval = MIN(maximum, minimum * pow(2, MIN(_failureCount, 16)));
+        interval *= 0.5 + 0.5 * ((double)arc4random() / UINT32_MAX);
+    } else {
+        _failureCount = 0;
+        if (batchCount > 1 || full) {
+            interval /= 2;
+        } else if (batchCount == 0) {
+            interval *= 2;
+        }
+    }
+    self.uploadInterval = MIN(maximum, MAX(minimum, interval));
+
+    return error;
+}
+
+- (AWSLogsCloudWatchLoggerBatch *)upload_nextBatchWithError:(NSError **)error {
+    AWSLogsCloudWatchLoggerBatch *batch = [AWSLogsCloudWatchLoggerBatch new];
+
+    __block NSError *databaseError = nil;
+    // Reading on a reader lets the logger queue save events while the batch is read and sent.
+    [self.databaseStore inReadDatabase:^(AWSFMDatabase *db) {
+        // One more row than fits tells whether the batch is full.
+        AWSFMResultSet *rs = [db executeQuery:@"SELECT rowid, timestamp, message, size FROM event ORDER BY timestamp ASC, rowid ASC LIMIT ?",
+                              @(AWSLogsCloudWatchLoggerBatchEventLimit + 1)];
+        if (!rs) {
+            databaseError = db.lastError;
+            return;
+        }
+
+        NSUInteger byteCount = 0;
+        long long firstTimestamp = 0;
+        while ([rs next]) {
+            long long timestamp = [rs longLongIntForColumnIndex:1];
+            NSUInteger size = (NSUInteger)[rs longLongIntForColumnIndex:3];
+            if (batch.logEvents.count == 0) {
+                firstTimestamp = timestamp;
+            }
+            if (batch.logEvents.count == AWSLogsCloudWatchLoggerBatchEventLimit
+                || byteCount + size > AWSLogsCloudWatchLoggerBatchByteLimit
+                || timestamp - firstTimestamp >= AWSLogsCloudWatchLoggerBatchSpan) {
+                batch.full = YES;
+                break;
+            }
+
+            AWSLogsInputLogEvent *logEvent = [AWSLogsInputLogEvent new];
+            logEvent.timestamp = @(timestamp);
+            logEvent.message = [rs stringForColumnIndex:2];
+            [batch.logEvents addObject:logEvent];
+            [batch.rowIds addObject:@([rs longLongIntForColumnIndex:0])];
+            byteCount += size;
+        }
+        [rs close];
+    }];
+
+    if (databaseError) {
+        NSLogError(@"SQLite error. [%@]", databaseError);
+        if (error) {
+            *error = databaseError;
+        }
+        return nil;
+    }
+    return batch;
+}
+
+- (NSError *)upload_sendBatch:(AWSLogsCloudWatchLoggerBatch *)batch {
+    // A rejected sequence token is corrected from the error and the batch is sent again, once.
+    for (NSUInteger attempt = 0; attempt < 2; attempt++) {
+        AWSLogsPutLogEventsRequest *request = [AWSLogsPutLogEventsRequest new];
+        request.logGroupName = self.logGroupName;
+        request.logStreamName = self.logStreamName;
+        request.logEvents = batch.logEvents;
+        request.sequenceToken = _sequenceToken;
+
+        self.requestCount++;
+        self.uploadStart = [NSDate timeIntervalSinceReferenceDate];
+        AWSTask<AWSLogsPutLogEventsResponse *> *task = [self.logs putLogEvents:request];
+        [task waitUntilFinished];
+        self.uploadEnd = [NSDate timeIntervalSinceReferenceDate];
+
+        NSError *error = task.error;
+        if (!error) {
+            AWSLogsRejectedLogEventsInfo *rejectedLogEventsInfo = task.result.rejectedLogEventsInfo;
+            if (rejectedLogEventsInfo) {
+                NSLogWarn(@"CloudWatch Logs rejected events that are too old or too new. [%@]", rejectedLogEventsInfo);
+            }
+            _sequenceToken = task.result.nextSequenceToken;
+            return [self upload_deleteBatch:batch];
+        }
+
+        if ([error.domain isEqualToString:AWSLogsErrorDomain]) {
+            NSString *expectedSequenceToken = error.userInfo[@"expectedSequenceToken"];
+            switch (error.code) {
+                case AWSLogsErrorDataAlreadyAccepted:
+                    // An earlier upload was accepted, but its events weren't deleted.
+                    _sequenceToken = [expectedSequenceToken isKindOfClass:[NSString class]] ? expectedSequenceToken : nil;
+                    return [self upload_deleteBatch:batch];
+                case AWSLogsErrorInvalidSequenceToken:
+                    _sequenceToken = [expectedSequenceToken isKindOfClass:[NSString class]] ? expectedSequenceToken : nil;
+                    continue;
+                case AWSLogsErrorInvalidParameter:
+                case AWSLogsErrorValidation:
+                    // The batch would be rejected every time.
+                    NSLogError(@"CloudWatch Logs rejected a batch of %lu events, deleting them. [%@]", (unsigned long)batch.logEvents.count, error);
+                    [self upload_deleteBatch:batch];
+                    return error;
+                default:
+                    break;
+            }
+        }
+
+        // Throttling, an unreachable service, or a missing log stream. Keep the events and back off.
+        NSLogDebug(@"Failed to upload log events. [%@]", error);
+        return error;
+    }
+
+    return [NSError errorWithDomain:AWSLogsErrorDomain code:AWSLogsErrorInvalidSequenceToken userInfo:nil];
+}
+
+- (NSError *)upload_deleteBatch:(AWSLogsCloudWatchLoggerBatch *)batch {
+    __block NSError *error = nil;
+    NSString *rowIds = [batch.rowIds componentsJoinedByString:@","];
+    [self.databaseStore inDatabase:^(AWSFMDatabase *db) {
+        if (![db executeUpdate:[NSString stringWithFormat:@"DELETE FROM event WHERE rowid IN (%@)", rowIds]]) {
+            NSLogError(@"SQLite error. [%@]", db.lastError);
+            error = db.lastError;
+        }
+    }];
+    return error;
+}
+
+@end
@@ -0,0 +1,245 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "OCMock.h"
+#import "AWSTestUtility.h"
+#import "AWSLogsService.h"
+#import "AWSLogsCloudWatchLogger.h"
+
+#define AWSLogsCloudWatchLoggerTestsLog(log, frmt, ...) \
+    [log log:NO level:AWSDDLogLevelVerbose flag:AWSDDLogFlagInfo context:0 file:__FILE__ function:__PRETTY_FUNCTION__ line:__LINE__ tag:nil format:(frmt), ##__VA_ARGS__]
+
+// Logs the way a source file of the app or of the SDK would.
+#define AWSLogsCloudWatchLoggerTestsLogFromFile(log, filename, frmt, ...) \
+    [log log:NO level:AWSDDLogLevelVerbose flag:AWSDDLogFlagError context:0 file:filename function:__PRETTY_FUNCTION__ line:__LINE__ tag:nil format:(frmt), ##__VA_ARGS__]
+
+// Accepts PutLogEvents requests the way CloudWatch Logs validates them.
+@interface AWSLogsCloudWatchLoggerTestsStandIn : NSObject
+
+@property (nonatomic, strong) NSMutableArray<NSString *> *messages;
+@property (nonatomic, strong) NSMutableArray<NSNumber *> *batchSizes;
+@property (nonatomic, strong, nullable) NSString *expectedSequenceToken;
+@property (nonatomic, assign) NSUInteger throttledRequestCount;
+@property (nonatomic, assign) NSUInteger violationCount;
+// Called for every request, before it is answered.
+@property (nonatomic, copy, nullable) void (^requestHandler)(void);
+
+@end
+
+@implementation AWSLogsCloudWatchLoggerTestsStandIn
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _messages = [NSMutableArray new];
+        _batchSizes = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (AWSTask *)putLogEvents:(AWSLogsPutLogEventsRequest *)request {
+    if (self.requestHandler) {
+        self.requestHandler();
+    }
+    @synchronized (self) {
+        if (self.throttledRequestCount > 0) {
+            self.throttledRequestCount--;
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSLogsErrorDomain code:AWSLogsErrorThrottling userInfo:nil]];
+        }
+        if (!(request.sequenceToken == self.expectedSequenceToken || [request.sequenceToken isEqualToString:self.expectedSequenceToken])) {
+            NSDictionary *userInfo = self.expectedSequenceToken ? @{@"expectedSequenceToken": self.expectedSequenceToken} : nil;
+            return [AWSTask taskWithError:[NSError errorWithDomain:AWSLogsErrorDomain code:AWSLogsErrorInvalidSequenceToken userInfo:userInfo]];
+        }
+
+        NSUInteger byteCount = 0;
+        long long previousTimestamp = request.logEvents.firstObject.timestamp.longLongValue;
+        for (AWSLogsInputLogEvent *logEvent in request.logEvents) {
+            byteCount += [logEvent.message lengthOfBytesUsingEncoding:NSUTF8StringEncoding] + 26;
+            if (logEvent.timestamp.longLongValue < previousTimestamp
+                || logEvent.timestamp.longLongValue - request.logEvents.firstObject.timestamp.longLongValue > 24 * 60 * 60 * 1000) {
+                self.violationCount++;
+            }
+            previousTimestamp = logEvent.timestamp.longLongValue;
+            [self.messages addObject:logEvent.message];
+        }
+        if (request.logEvents.count > AWSLogsCloudWatchLoggerBatchEventLimit || byteCount > AWSLogsCloudWatchLoggerBatchByteLimit) {
+            self.violationCount++;
+        }
+        [self.batchSizes addObject:@(request.logEvents.count)];
+
+        self.expectedSequenceToken = [NSUUID UUID].UUIDString;
+        AWSLogsPutLogEventsResponse *response = [AWSLogsPutLogEventsResponse new];
+        response.nextSequenceToken = self.expectedSequenceToken;
+        return [AWSTask taskWithResult:response];
+    }
+}
+
+@end
+
+@interface AWSLogsCloudWatchLoggerTests : XCTestCase
+
+@property (nonatomic, strong) AWSLogsCloudWatchLoggerTestsStandIn *standIn;
+@property (nonatomic, strong) id mockLogs;
+@property (nonatomic, strong) AWSLogsCloudWatchLogger *logger;
+@property (nonatomic, strong) AWSDDLog *log;
+
+@end
+
+@implementation AWSLogsCloudWatchLoggerTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    NSString *key = @"AWSLogsCloudWatchLoggerTests";
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1 credentialsProvider:nil];
+    [AWSLogs registerLogsWithConfiguration:configuration forKey:key];
+
+    AWSLogsCloudWatchLoggerTestsStandIn *standIn = [AWSLogsCloudWatchLoggerTestsStandIn new];
+    self.standIn = standIn;
+    self.mockLogs = OCMPartialMock([AWSLogs LogsForKey:key]);
+    OCMStub([self.mockLogs putLogEvents:[OCMArg any]]).andDo(^(NSInvocation *invocation) {
+        __unsafe_unretained AWSLogsPutLogEventsRequest *request = nil;
+        [invocation getArgument:&request atIndex:2];
+        AWSTask *task = [standIn putLogEvents:request];
+        [invocation retainArguments];
+        [invocation setReturnValue:&task];
+    });
+
+    self.logger = [[AWSLogsCloudWatchLogger alloc] initWithLogs:self.mockLogs
+                                                   logGroupName:@"AWSLogsCloudWatchLoggerTests"
+                                                  logStreamName:[NSUUID UUID].UUIDString];
+    self.logger.logFormatter = nil;
+    // Uploads are started by the tests, not by the timer.
+    self.logger.minimumUploadInterval = 100;
+    self.logger.maximumUploadInterval = 10000;
+    self.log = [AWSDDLog new];
+    [self.log addLogger:self.logger];
+}
+
+- (void)tearDown {
+    [self.log removeAllLoggers];
+    [[self.logger removeAllLogEvents] waitUntilFinished];
+    [self.mockLogs stopMocking];
+    [AWSLogs removeLogsForKey:@"AWSLogsCloudWatchLoggerTests"];
+    [super tearDown];
+}
+
+- (AWSTask *)upload {
+    [self.log flushLog];
+    AWSTask *task = [self.logger uploadLogEvents];
+    [task waitUntilFinished];
+    return task;
+}
+
+- (void)testUploadsInOrderedBatches {
+    NSUInteger const eventCount = 25000;
+
+    for (NSUInteger i = 0; i < eventCount; i++) {
+        AWSLogsCloudWatchLoggerTestsLog(self.log, @"Event %lu", (unsigned long)i);
+    }
+    AWSTask *task = [self upload];
+
+    XCTAssertNil(task.error);
+    XCTAssertEqual(self.standIn.messages.count, eventCount);
+    XCTAssertEqualObjects(self.standIn.messages.firstObject, @"Event 0");
+    XCTAssertEqualObjects(self.standIn.messages.lastObject, ([NSString stringWithFormat:@"Event %lu", (unsigned long)eventCount - 1]));
+    for (NSUInteger i = 0; i < eventCount; i += 997) {
+        XCTAssertEqualObjects(self.standIn.messages[i], ([NSString stringWithFormat:@"Event %lu", (unsigned long)i]));
+    }
+    XCTAssertEqual(self.standIn.violationCount, 0);
+    // Full batches are also uploaded while the events are being saved.
+    XCTAssertEqual([[self.standIn.batchSizes valueForKeyPath:@"@max.self"] unsignedIntegerValue], AWSLogsCloudWatchLoggerBatchEventLimit);
+    XCTAssertGreaterThanOrEqual(self.logger.requestCount, 3);
+}
+
+- (void)testPerformanceOfShippingEvents {
+    NSUInteger const eventCount = 5000;
+    [self measureBlock:^{
+        NSUInteger messageCount = self.standIn.messages.count;
+        for (NSUInteger i = 0; i < eventCount; i++) {
+            AWSLogsCloudWatchLoggerTestsLog(self.log, @"Event %lu", (unsigned long)i);
+        }
+        XCTAssertNil([self upload].error);
+        XCTAssertEqual(self.standIn.messages.count - messageCount, eventCount);
+    }];
+}
+
+- (void)testBatchesStayWithinByteLimit {
+    NSString *message = [@"" stringByPaddingToLength:10 * 1024 withString:@"x" startingAtIndex:0];
+    for (NSUInteger i = 0; i < 300; i++) {
+        AWSLogsCloudWatchLoggerTestsLog(self.log, @"%@", message);
+    }
+
+    XCTAssertNil([self upload].error);
+    XCTAssertEqual(self.standIn.messages.count, 300);
+    XCTAssertEqual(self.standIn.violationCount, 0);
+    XCTAssertEqual(self.standIn.batchSizes.count, 3);
+}
+
+- (void)testInvalidSequenceTokenIsCorrected {
+    self.standIn.expectedSequenceToken = @"token-from-an-earlier-launch";
+    AWSLogsCloudWatchLoggerTestsLog(self.log, @"Event");
+
+    XCTAssertNil([self upload].error);
+    XCTAssertEqualObjects(self.standIn.messages, @[@"Event"]);
+    XCTAssertEqual(self.logger.requestCount, 2);
+
+    AWSLogsCloudWatchLoggerTestsLog(self.log, @"Next event");
+    XCTAssertNil([self upload].error);
+    XCTAssertEqual(self.standIn.messages.count, 2);
+    XCTAssertEqual(self.logger.requestCount, 3);
+}
+
+- (void)testThrottlingKeepsEventsAndBacksOff {
+    self.standIn.throttledRequestCount = 1;
+    AWSLogsCloudWatchLoggerTestsLog(self.log, @"Event");
+
+    AWSTask *task = [self upload];
+    XCTAssertEqualObjects(task.error.domain, AWSLogsErrorDomain);
+    XCTAssertEqual(task.error.code, AWSLogsErrorThrottling);
+    XCTAssertEqual(self.standIn.messages.count, 0);
+    XCTAssertGreaterThanOrEqual(self.logger.uploadInterval, 100);
+
+    self.standIn.throttledRequestCount = 3;
+    for (NSUInteger i = 0; i < 3; i++) {
+        [self upload];
+    }
+    XCTAssertGreaterThan(self.logger.uploadInterval, 400);
+
+    XCTAssertNil([self upload].error);
+    XCTAssertEqualObjects(self.standIn.messages, @[@"Event"]);
+}
+
+- (void)testFailedUploadDoesNotLogEventsToUpload {
+    AWSDDLog *log = self.log;
+    self.standIn.throttledRequestCount = 1;
+    self.standIn.requestHandler = ^{
+        // The networking layer of the SDK reports the failed request while it is in flight.
+        AWSLogsCloudWatchLoggerTestsLogFromFile(log, "AWSURLSessionManager.m", @"Session task failed with error: throttled");
+        AWSLogsCloudWatchLoggerTestsLogFromFile(log, "ViewController.m", @"App event");
+    };
+    AWSLogsCloudWatchLoggerTestsLog(self.log, @"Event");
+
+    AWSTask *task = [self upload];
+    XCTAssertEqual(task.error.code, AWSLogsErrorThrottling);
+    self.standIn.requestHandler = nil;
+
+    XCTAssertNil([self upload].error);
+    XCTAssertEqualObjects(self.standIn.messages, (@[@"Event", @"App event"]));
+    XCTAssertEqual(self.logger.requestCount, 2);
+}
+
+@end
@@ -53,7 +53,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 @interface AWSPinpointEventRecorder()
 
 @property (nonatomic, weak) AWSPinpointContext *context;
-@property (nonatomic, strong) AWSFMDatabaseQueue *databaseQueue;
+@property (nonatomic, strong) AWSFMDatabaseStore *databaseStore;
 @property (nonatomic, strong) NSString *databasePath;
 @property (nonatomic, strong) NSObject *lock;
 
@@ -115,8 +115,8 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
         
         // Creates a database for the identifier if it doesn't exist.
         AWSDDLogDebug(@"Database path: [%@]", _databasePath);
-        _databaseQueue = [AWSFMDatabaseQueue serialDatabaseQueueWithPath:_databasePath];
-        [_databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        _databaseStore = [AWSFMDatabaseStore storeWithPath:_databasePath];
+        [_databaseStore inDatabase:^(AWSFMDatabase *db) {
             db.shouldCacheStatements = YES;
             if (![db executeStatements:@"PRAGMA auto_vacuum = FULL"]) {
                 AWSDDLogError(@"Failed to enable 'auto_vacuum' to 'FULL'. %@", db.lastError);
@@ -161,7 +161,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (void) dealloc {
-    [_databaseQueue close];
+    [_databaseStore close];
 }
 
 + (dispatch_queue_t)sharedQueue {
@@ -175,6 +175,26 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
     return queue;
 }
 
+// Reads and submissions run here instead of on `sharedQueue`. Reads use their own connections and submissions only
+// take the writer connection for the updates after the response, so saving an event doesn't wait for either.
++ (dispatch_queue_t)concurrentQueue {
+    static dispatch_queue_t queue;
+    static dispatch_once_t predicate;
+
+    dispatch_once(&predicate, ^{
+        queue = dispatch_queue_create("com.amazonaws.AWSPinpointEventRecorder.concurrent", DISPATCH_QUEUE_CONCURRENT);
+    });
+
+    return queue;
+}
+
+// Completes once the blocks queued on `sharedQueue` before it have run, so a read sees the events saved before it.
++ (AWSTask *)taskAfterPendingWrites {
+    return [AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nullable{
+        return nil;
+    }];
+}
+
 - (AWSPinpointSession *)validateOrRetrieveSession:(AWSPinpointSession *) session {
     if (session && session.sessionId && session.sessionId.length >=1) {
         return session;
@@ -224,9 +244,8 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 
 - (AWSTask<AWSPinpointEvent *> *) saveEvent:(AWSPinpointEvent *) eventToSave {
     
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     NSTimeInterval diskAgeLimit = self.diskAgeLimit;
-    NSString *databasePath = self.databasePath;
     NSUInteger notificationByteThreshold = self.notificationByteThreshold;
     NSUInteger diskByteLimit = self.diskByteLimit;
     __weak id notificationSender = self;
@@ -237,7 +256,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         // Inserts a new record to the database.
         __block NSError *error = nil;
-        [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        [databaseStore inDatabase:^(AWSFMDatabase *db) {
             
             NSString *sessionId = event.session.sessionId;
             NSString *stopTime = [event.session.stopTime aws_stringValue:AWSDateISO8601DateFormat3];
@@ -290,8 +309,9 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
             }
         }];
         
+        __block BOOL deletedOldEvents = NO;
         if (!error && diskAgeLimit > 0) {
-            [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+            [databaseStore inDatabase:^(AWSFMDatabase *db) {
                 // Deletes old events exceeding the threshold.
                 BOOL result = [db executeUpdate:
                                @"DELETE FROM Event "
@@ -304,6 +324,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                     AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                     error = db.lastError;
                 }
+                deletedOldEvents = result && [db changes] > 0;
             }];
         }
         
@@ -311,49 +332,51 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
             return [AWSTask taskWithError:error];
         }
         
-        NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:databasePath
-                                                                                    error:&error];
-        if (attributes) {
-            NSUInteger fileSize = (NSUInteger)[attributes fileSize];
-            [self checkByteThresholdForNotification:notificationByteThreshold
-                                 notificationSender:notificationSender
-                                           fileSize:fileSize];
-            if (fileSize > diskByteLimit) {
-                //First Flush the dirty events
-                [databaseQueue inDatabase:^(AWSFMDatabase *db) {
-                    if (![db executeUpdate:@"DELETE FROM DirtyEvent"]) {
+        // The log of the database counts towards the disk usage, and deleted events only free their space once it is
+        // checkpointed.
+        NSUInteger fileSize = (NSUInteger)databaseStore.fileSize;
+        if (deletedOldEvents || fileSize > diskByteLimit) {
+            [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
+            fileSize = (NSUInteger)databaseStore.fileSize;
+        }
+        [self checkByteThresholdForNotification:notificationByteThreshold
+                             notificationSender:notificationSender
+                                       fileSize:fileSize];
+        if (fileSize > diskByteLimit) {
+            //First Flush the dirty events
+            [databaseStore inDatabase:^(AWSFMDatabase *db) {
+                if (![db executeUpdate:@"DELETE FROM DirtyEvent"]) {
+                    AWSDDLogError(@"SQLite error. [%@]", db.lastError);
+                    error = db.lastError;
+                }
+            }];
+            [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
+            
+            if (error) {
+                return [AWSTask taskWithError:error];
+            }
+            
+            if ([self diskBytesUsed] > diskByteLimit) {
+                // Deletes the oldest event if it still exceeds the disk size threshold after clearing the dirty events.
+                [databaseStore inDatabase:^(AWSFMDatabase *db) {
+                    AWSDDLogWarn(@"Deleting oldest event from disk, diskByteLimit has been reached.");
+                    BOOL result = [db executeUpdate:
+                                   @"DELETE FROM Event "
+                                   @"WHERE id IN ( "
+                                   @"SELECT id "
+                                   @"FROM Event "
+                                   @"ORDER BY timestamp ASC "
+                                   @"LIMIT 1 "
+                                   @")"
+                                   ];
+                    if (!result) {
                         AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                         error = db.lastError;
+                        return;
                     }
                 }];
-                
-                if (error) {
-                    return [AWSTask taskWithError:error];
-                }
-                
-                if ([self diskBytesUsed] > diskByteLimit) {
-                    // Deletes the oldest event if it still exceeds the disk size threshold after clearing the dirty events.
-                    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
-                        AWSDDLogWarn(@"Deleting oldest event from disk, diskByteLimit has been reached.");
-                        BOOL result = [db executeUpdate:
-                                       @"DELETE FROM Event "
-                                       @"WHERE id IN ( "
-                                       @"SELECT id "
-                                       @"FROM Event "
-                                       @"ORDER BY timestamp ASC "
-                                       @"LIMIT 1 "
-                                       @")"
-                                       ];
-                        if (!result) {
-                            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
-                            error = db.lastError;
-                            return;
-                        }
-                    }];
-                }
+                [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
             }
-        } else if (error) {
-            return [AWSTask taskWithError:error];
         }
         
         return [AWSTask taskWithResult:event];
@@ -361,13 +384,13 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (AWSTask*) updateSessionStartWithEventSourceAttributes:(NSDictionary*) attributes {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     NSString *sessionId = [self validateOrRetrieveSessionId:self.context.sessionClient.session.sessionId];
     
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         
-        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
             NSError *codingError;
             NSData *attributesData = [AWSNSCodingUtilities versionSafeArchivedDataWithRootObject:attributes
                                                                            requiringSecureCoding:YES
@@ -406,14 +429,14 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 
 //Only used for testing
 - (AWSTask*) getCurrentSession: (AWSPinpointSession*) session {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     NSString *sessionId = [self validateOrRetrieveSessionId:session.sessionId];
     
-    return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+    return [[AWSPinpointEventRecorder taskAfterPendingWrites] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder concurrentQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         __block AWSPinpointEvent *event;
         
-        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
             AWSFMResultSet *rs = [db executeQuery:
                                   @"SELECT id, attributes, eventType, metrics, eventTimestamp, sessionId, sessionStartTime, sessionStopTime, timestamp, retryCount "
                                   @"FROM Event "
@@ -423,9 +446,8 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                     @"sessionId": sessionId
                                                     }];
             if (!rs) {
-                AWSDDLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
-                *rollback = YES;
                 return;
             }
             
@@ -435,7 +457,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                         error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring attributes from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -444,7 +465,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                      error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring metrics from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -472,22 +492,21 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (AWSTask<NSArray<AWSPinpointEvent *> *> *) getEventsWithLimit:(NSNumber *) limit {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     
-    return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+    return [[AWSPinpointEventRecorder taskAfterPendingWrites] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder concurrentQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         __block NSMutableArray *events = [NSMutableArray new];
         
-        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
             AWSFMResultSet *rs = [db executeQuery:[NSString stringWithFormat:
                                                    @"SELECT id, attributes, eventType, metrics, eventTimestamp, sessionId, sessionStartTime, sessionStopTime, timestamp, retryCount "
                                                    @"FROM Event "
                                                    @"ORDER BY timestamp ASC "
                                                    @"LIMIT %@", limit]];
             if (!rs) {
-                AWSDDLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
-                *rollback = YES;
                 return;
             }
 
@@ -497,7 +516,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                         error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring event attributes from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -506,7 +524,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                      error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring event metrics from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -535,22 +552,21 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (AWSTask<NSArray<AWSPinpointEvent *> *> *) getDirtyEventsWithLimit:(NSNumber *) limit {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     
-    return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
+    return [[AWSPinpointEventRecorder taskAfterPendingWrites] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder concurrentQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         __block NSMutableArray *events = [NSMutableArray new];
         
-        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+        [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
             AWSFMResultSet *rs = [db executeQuery:[NSString stringWithFormat:
                                                    @"SELECT id, attributes, eventType, metrics, eventTimestamp, sessionId, sessionStartTime, sessionStopTime, timestamp, retryCount "
                                                    @"FROM DirtyEvent "
                                                    @"ORDER BY timestamp ASC "
                                                    @"LIMIT %@", limit]];
             if (!rs) {
-                AWSDDLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+                AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
-                *rollback = YES;
                 return;
             }
             
@@ -560,7 +576,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                         error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring dirty event attributes from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -569,7 +584,6 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                                                                      error:&error];
                 if (error) {
                     AWSDDLogError(@"Error restoring dirty event metrics from DB: %@", error);
-                    *rollback = YES;
                     return;
                 }
 
@@ -690,10 +704,11 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (void) getBatchRecords:(void (^)(NSDictionary *eventsWithEventId, NSError *error))result {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     __block NSError *error = nil;
+    __block NSMutableDictionary *temporaryEventsWithEventId = nil;
     
-    [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+    [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
         AWSFMResultSet *rs = [db executeQuery:[NSString stringWithFormat:
                                                @"SELECT id, attributes, eventType, metrics, eventTimestamp, sessionId, sessionStartTime, sessionStopTime, timestamp, retryCount "
                                                @"FROM Event "
@@ -702,13 +717,12 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                                                @"LIMIT %@",
                                                [NSNumber numberWithInteger:AWSPinpointClientValidEvent], [NSNumber numberWithInteger:AWSPinpointServiceDefinedMaxEventsPerBatch]]];
         if (!rs) {
-            AWSDDLogError(@"SQLite error. Rolling back... [%@]", db.lastError);
+            AWSDDLogError(@"SQLite error. [%@]", db.lastError);
             error = db.lastError;
-            *rollback = YES;
             return;
         }
         
-        NSMutableDictionary *temporaryEventsWithEventId = [NSMutableDictionary new];
+        temporaryEventsWithEventId = [NSMutableDictionary new];
         while ([rs next]) {
             [temporaryEventsWithEventId setObject:@{
                                          @"id": [rs stringForColumn:@"id"],
@@ -736,18 +750,21 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                 break;
             }
         }
-        rs = nil;
-        
-        result(temporaryEventsWithEventId, error);
+        [rs close];
     }];
+    
+    // The next batch is submitted from `result`, so it runs after the reader is returned.
+    if (temporaryEventsWithEventId) {
+        result(temporaryEventsWithEventId, error);
+    }
 }
 
 - (AWSTask<NSDictionary <NSString *, NSDictionary *> *> *)submitBatchEvents:(NSDictionary*) eventsWithEventId
                                                             endpointProfile:(AWSPinpointEndpointProfile *) endpointProfile {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     NSDictionary *temporaryEvents = [eventsWithEventId copy];
 
-    return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]]
+    return [[AWSPinpointEventRecorder taskAfterPendingWrites] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder concurrentQueue]]
                                              withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
         __block NSMutableDictionary *events = [NSMutableDictionary new];
@@ -766,7 +783,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
         return [[AWSTask taskForCompletionOfAllTasksWithResults:@[submitTask]] continueWithBlock:^id _Nullable(AWSTask * _Nonnull t) {
             AWSTask *failTask = [AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                 // If an event failed three times, mark even as dirty
-                [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                     BOOL result = [db executeUpdate:[NSString stringWithFormat:
                                                      @"UPDATE Event "
                                                      @"SET dirty = %@ "
@@ -781,7 +798,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
             
             AWSTask *moveTask = [AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                 //Move dirty events into DirtyEvent table
-                [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                     BOOL result = [db executeUpdate:[NSString stringWithFormat:
                                                      @"INSERT INTO DirtyEvent "
                                                      @"SELECT * FROM Event "
@@ -796,7 +813,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
             
             AWSTask *deleteTask = [AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                 //Delete dirty events
-                [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                     BOOL result = [db executeUpdate:[NSString stringWithFormat:
                                                      @"DELETE FROM Event "
                                                      @"WHERE dirty = %@ ", [NSNumber numberWithInteger:AWSPinpointClientInvalidEvent]]];
@@ -819,16 +836,17 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (AWSTask *)removeAllEvents {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
-        [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        [databaseStore inDatabase:^(AWSFMDatabase *db) {
             if (![db executeUpdate:@"DELETE FROM Event"]) {
                 AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
             }
         }];
+        [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
         
         if (error) {
             return [AWSTask taskWithError:error];
@@ -839,16 +857,17 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (AWSTask *)removeAllDirtyEvents {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     
     return [[AWSTask taskWithResult:nil] continueWithExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
         __block NSError *error = nil;
-        [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+        [databaseStore inDatabase:^(AWSFMDatabase *db) {
             if (![db executeUpdate:@"DELETE FROM DirtyEvent"]) {
                 AWSDDLogError(@"SQLite error. [%@]", db.lastError);
                 error = db.lastError;
             }
         }];
+        [databaseStore checkpointWithMode:AWSFMDatabaseCheckpointModeTruncate error:nil];
         
         if (error) {
             return [AWSTask taskWithError:error];
@@ -859,15 +878,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 }
 
 - (uint64_t)diskBytesUsed {
-    NSError *error = nil;
-    NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:self.databasePath
-                                                                                error:&error];
-    if (attributes) {
-        return [attributes fileSize];
-    } else {
-        AWSDDLogError(@"Error [%@]", error);
-        return 0;
-    }
+    return self.databaseStore.fileSize;
 }
 
 - (void)setBatchRecordsByteLimit:(NSUInteger)batchRecordsByteLimit {
@@ -988,7 +999,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
 - (AWSTask *)putEvents:(NSDictionary *) temporaryEvents
                  error:(NSError* __autoreleasing *) error
        endpointProfile:(AWSPinpointEndpointProfile *) profile {
-    AWSFMDatabaseQueue *databaseQueue = self.databaseQueue;
+    AWSFMDatabaseStore *databaseStore = self.databaseStore;
     
     // events to be submitted, and returned back to caller for debugging
     // aggregate attributes, metrics...
@@ -1057,7 +1068,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                 
                 return [AWSTask taskForCompletionOfAllTasksWithResults:@[[AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                     for (__block NSString *eventID in _temporaryEvents) {
-                        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                        [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                             BOOL result = [db executeUpdate:[NSString stringWithFormat:@"UPDATE Event SET dirty = %@ WHERE id = :id", [NSNumber numberWithInteger:AWSPinpointClientInvalidEvent]]
                                     withParameterDictionary:@{
                                                               @"id" : eventID
@@ -1074,7 +1085,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                 AWSDDLogError(@"Unable to successfully deliver events to server. Events will be retried. Error Message:%@", task.error);
                 return [AWSTask taskForCompletionOfAllTasksWithResults:@[[AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                     for (__block NSString *eventID in _temporaryEvents) {
-                        [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                        [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                             BOOL result = [db executeUpdate:@"UPDATE Event SET retryCount = retryCount + 1 WHERE id = :id"
                                     withParameterDictionary:@{
                                                               @"id" : eventID
@@ -1110,7 +1121,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
             return [[AWSTask taskForCompletionOfAllTasksWithResults:@[[AWSTask taskFromExecutor:[AWSExecutor executorWithDispatchQueue:[AWSPinpointEventRecorder sharedQueue]] withBlock:^id _Nonnull{
                 //submitted events, update database
                 for (__block NSString *eventID in [_processedEvents objectForKey:@"acceptedEvents"]) {
-                    [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                    [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                         BOOL result = [db executeUpdate:@"DELETE FROM Event WHERE id = :id"
                                 withParameterDictionary:@{
                                                           @"id" : eventID
@@ -1123,7 +1134,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                 }
                 //retryable events, update database
                 for (__block NSString *eventID in [_processedEvents objectForKey:@"retryableEvents"]) {
-                    [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                    [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                         BOOL result = [db executeUpdate:@"UPDATE Event SET retryCount = retryCount + 1 WHERE id = :id"
                                 withParameterDictionary:@{
                                                           @"id" : eventID
@@ -1137,7 +1148,7 @@ NSString *const FAILURE_REASON = @"NSLocalizedFailureReason";
                 
                 //rejected events, mark dirty, update database
                 for (__block NSString *eventID in [_processedEvents objectForKey:@"dirtyEvents"]) {
-                    [databaseQueue inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
+                    [databaseStore inTransaction:^(AWSFMDatabase *db, BOOL *rollback) {
                         BOOL result = [db executeUpdate:[NSString stringWithFormat:@"UPDATE Event SET dirty = %@ WHERE id = :id", [NSNumber numberWithInteger:AWSPinpointClientInvalidEvent]]
                                 withParameterDictionary:@{
                                                           @"id" : eventID
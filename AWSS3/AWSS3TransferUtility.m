@@ -57,7 +57,7 @@ static int const AWSS3TransferUtilityMultiPartDefaultConcurrencyLimit = 5;
 @property (strong, nonatomic) AWSSynchronizedMutableDictionary *taskDictionary;
 @property (strong, nonatomic) AWSSynchronizedMutableDictionary *completedTaskDictionary;
 @property (copy, nonatomic) void (^backgroundURLSessionCompletionHandler)(void);
-@property (strong, nonatomic) AWSFMDatabaseQueue *databaseQueue;
+@property (strong, nonatomic) AWSFMDatabaseStore *databaseStore;
 @end
 
 @interface AWSS3TransferUtility (Validation)
@@ -325,7 +325,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
         _completedTaskDictionary = [AWSSynchronizedMutableDictionary new];
         
         //Instantiate the Database Helper
-        self.databaseQueue = [AWSS3TransferUtilityDatabaseHelper createDatabase:self.cacheDirectoryPath];
+        self.databaseStore = [AWSS3TransferUtilityDatabaseHelper createDatabase:self.cacheDirectoryPath];
 
         if (recoverState) {
             //Recover the state from the previous time this was instantiated
@@ -359,7 +359,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
       tempTransferDictionary: (NSMutableDictionary *) tempTransferDictionary
 {
     //Get All Tasks from DB
-    NSMutableArray *tasks = [AWSS3TransferUtilityDatabaseHelper getTransferTaskDataFromDB:_sessionIdentifier databaseQueue:_databaseQueue];
+    NSMutableArray *tasks = [AWSS3TransferUtilityDatabaseHelper getTransferTaskDataFromDB:_sessionIdentifier databaseStore:_databaseStore];
     
     //Iterate through the tasks and populate transferRequests and Multipart dictionary.
     for( NSMutableDictionary *task in tasks ) {
@@ -367,12 +367,12 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
         int sessionTaskID = [[task objectForKey:@"session_task_id"] intValue];
         
         if ([transferType isEqualToString:@"UPLOAD"]) {
-            AWSS3TransferUtilityUploadTask *transferUtilityUploadTask = [self hydrateUploadTask:task sessionIdentifier:self.sessionIdentifier databaseQueue:self.databaseQueue];
+            AWSS3TransferUtilityUploadTask *transferUtilityUploadTask = [self hydrateUploadTask:task sessionIdentifier:self.sessionIdentifier databaseStore:self.databaseStore];
             
             //If task is completed, no more processing is required.
             if (transferUtilityUploadTask.status == AWSS3TransferUtilityTransferStatusCompleted ) {
                 [self.completedTaskDictionary setObject:transferUtilityUploadTask forKey:transferUtilityUploadTask.transferID];
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID databaseQueue:self->_databaseQueue];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID databaseStore:self->_databaseStore];
                 continue;
             }
             //Lodge in temporary Dictionary
@@ -380,12 +380,12 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
             AWSDDLogDebug(@"Found upload [%@] with taskIdentifier [%d]",transferUtilityUploadTask.transferID,sessionTaskID );
         }
         else if ([transferType isEqualToString:@"DOWNLOAD"]) {
-            AWSS3TransferUtilityDownloadTask *transferUtilityDownloadTask = [self hydrateDownloadTask:task sessionIdentifier:self.sessionIdentifier databaseQueue:self.databaseQueue];
+            AWSS3TransferUtilityDownloadTask *transferUtilityDownloadTask = [self hydrateDownloadTask:task sessionIdentifier:self.sessionIdentifier databaseStore:self.databaseStore];
             
             //If task is completed, no more processing is required.
             if (transferUtilityDownloadTask.status == AWSS3TransferUtilityTransferStatusCompleted ) {
                 [self.completedTaskDictionary setObject:transferUtilityDownloadTask forKey:transferUtilityDownloadTask.transferID];
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityDownloadTask.transferID databaseQueue:self->_databaseQueue];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityDownloadTask.transferID databaseStore:self->_databaseStore];
                 continue;
             }
             //Lodge in temporary Dictionary for linking
@@ -393,7 +393,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
             AWSDDLogDebug(@"Found download [%@] with taskIdentifier [%d]",transferUtilityDownloadTask.transferID,sessionTaskID );
         }
         else if ([transferType isEqualToString:@"MULTI_PART_UPLOAD"]) {
-            AWSS3TransferUtilityMultiPartUploadTask *transferUtilityMultiPartUploadTask = [self hydrateMultiPartUploadTask:task sessionIdentifier:self.sessionIdentifier databaseQueue:self.databaseQueue];
+            AWSS3TransferUtilityMultiPartUploadTask *transferUtilityMultiPartUploadTask = [self hydrateMultiPartUploadTask:task sessionIdentifier:self.sessionIdentifier databaseStore:self.databaseStore];
             
             //If task is completed, no more processing is required.
             if (transferUtilityMultiPartUploadTask.status == AWSS3TransferUtilityTransferStatusCompleted ||
@@ -401,7 +401,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
                 transferUtilityMultiPartUploadTask.status == AWSS3TransferUtilityTransferStatusCancelled ||
                 transferUtilityMultiPartUploadTask.status == AWSS3TransferUtilityTransferStatusError) {
                 [self.completedTaskDictionary setObject:transferUtilityMultiPartUploadTask forKey:transferUtilityMultiPartUploadTask.transferID];
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityMultiPartUploadTask.transferID databaseQueue:self->_databaseQueue];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityMultiPartUploadTask.transferID databaseStore:self->_databaseStore];
                 continue;
             }
             
@@ -417,7 +417,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
             AWSS3TransferUtilityMultiPartUploadTask *multiPartUploadTask = [tempMultiPartMasterTaskDictionary objectForKey:subTask.uploadID];
             if ( !multiPartUploadTask ) {
                 //Couldn't find the multipart upload master record. Must be an orphan part record. Clean up the DB and continue.
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:subTask.transferID databaseQueue:self->_databaseQueue];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:subTask.transferID databaseStore:self->_databaseStore];
                 continue;
             }
             //Check if the subTask is is already completed. If it is, add it to the completed parts list, update the progress object and go to the next iteration of the loop
@@ -568,7 +568,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
     }
     [self.completedTaskDictionary setObject:transferUtilityTask forKey:transferUtilityTask.transferID];
     [self.taskDictionary removeObjectForKey:@(transferUtilityTask.taskIdentifier)];
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityTask.transferID databaseQueue:self->_databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityTask.transferID databaseStore:self->_databaseStore];
 }
 
 - (void) handleUnlinkedTransfers:(NSMutableDictionary *) tempMultiPartMasterTaskDictionary
@@ -586,7 +586,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
                 [self.completedTaskDictionary setObject:transferUtilityUploadTask forKey:transferUtilityUploadTask.transferID];
                 
                 //Delete the transfer record from the DB
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseQueue:self->_databaseQueue ];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseStore:self->_databaseStore ];
                 AWSDDLogDebug(@"Deleted transfer request from the DB");
             }
             //Check if the transfer is in a paused state and the input file for the transfer exists.
@@ -601,7 +601,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
                 transferUtilityUploadTask.status = AWSS3TransferUtilityTransferStatusUnknown;
                 [self.completedTaskDictionary setObject:transferUtilityUploadTask forKey:transferUtilityUploadTask.transferID];
                 //Delete the transfer record from the DB
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseQueue:self->_databaseQueue ];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseStore:self->_databaseStore ];
                 AWSDDLogDebug(@"Deleted transfer request from the DB");
             }
         }
@@ -619,7 +619,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
             
             if (downloadTask.status == AWSS3TransferUtilityTransferStatusCompleted ) {
                 [self.completedTaskDictionary setObject:downloadTask forKey:downloadTask.transferID];
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseQueue:self->_databaseQueue ];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseStore:self->_databaseStore ];
                 AWSDDLogDebug(@"Deleted transfer request from DB");
             }
             else if (downloadTask.status == AWSS3TransferUtilityTransferStatusPaused) {
@@ -632,7 +632,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
                 
                 downloadTask.status = AWSS3TransferUtilityTransferStatusUnknown;
                 [self.completedTaskDictionary setObject:downloadTask forKey:downloadTask.transferID];
-                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseQueue:self->_databaseQueue ];
+                [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID taskIdentifier:[taskIdentifier integerValue] databaseStore:self->_databaseStore ];
                 AWSDDLogDebug(@"Deleted transfer request from DB");
             }
         }
@@ -692,11 +692,11 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
 
 -(AWSS3TransferUtilityUploadTask *) hydrateUploadTask: (NSMutableDictionary *) task
                                     sessionIdentifier: (NSString *) sessionIdentifier
-                                        databaseQueue: (AWSFMDatabaseQueue *) databaseQueue
+                                        databaseStore: (AWSFMDatabaseStore *) databaseStore
 {
     AWSS3TransferUtilityUploadTask *transferUtilityUploadTask = [AWSS3TransferUtilityUploadTask new];
     transferUtilityUploadTask.nsURLSessionID = sessionIdentifier;
-    transferUtilityUploadTask.databaseQueue = databaseQueue;
+    transferUtilityUploadTask.databaseStore = databaseStore;
     transferUtilityUploadTask.transferType = [task objectForKey:@"transfer_type"];
     transferUtilityUploadTask.bucket = [task objectForKey:@"bucket_name"];
     transferUtilityUploadTask.key = [task objectForKey:@"key"];
@@ -716,11 +716,11 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
 
 - (AWSS3TransferUtilityDownloadTask *) hydrateDownloadTask: (NSMutableDictionary *) task
                                          sessionIdentifier: (NSString *) sessionIdentifier
-                                             databaseQueue: (AWSFMDatabaseQueue *) databaseQueue
+                                             databaseStore: (AWSFMDatabaseStore *) databaseStore
 {
     AWSS3TransferUtilityDownloadTask *transferUtilityDownloadTask = [AWSS3TransferUtilityDownloadTask new];
     transferUtilityDownloadTask.nsURLSessionID = sessionIdentifier;
-    transferUtilityDownloadTask.databaseQueue = databaseQueue;
+    transferUtilityDownloadTask.databaseStore = databaseStore;
     transferUtilityDownloadTask.transferType = [task objectForKey:@"transfer_type"];
     transferUtilityDownloadTask.bucket = [task objectForKey:@"bucket_name"];
     transferUtilityDownloadTask.key = [task objectForKey:@"key"];
@@ -739,11 +739,11 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
 
 -( AWSS3TransferUtilityMultiPartUploadTask *) hydrateMultiPartUploadTask: (NSMutableDictionary *) task
                                                        sessionIdentifier: (NSString *) sessionIdentifier
-                                                           databaseQueue: (AWSFMDatabaseQueue *) databaseQueue
+                                                           databaseStore: (AWSFMDatabaseStore *) databaseStore
 {
     AWSS3TransferUtilityMultiPartUploadTask *transferUtilityMultiPartUploadTask = [AWSS3TransferUtilityMultiPartUploadTask new];
     transferUtilityMultiPartUploadTask.nsURLSessionID = sessionIdentifier;
-    transferUtilityMultiPartUploadTask.databaseQueue = databaseQueue;
+    transferUtilityMultiPartUploadTask.databaseStore = databaseStore;
     transferUtilityMultiPartUploadTask.transferType = [task objectForKey:@"transfer_type"];
     transferUtilityMultiPartUploadTask.bucket = [task objectForKey:@"bucket_name"];
     transferUtilityMultiPartUploadTask.key = [task objectForKey:@"key"];
@@ -886,7 +886,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
     //Create TransferUtility Upload Task
     AWSS3TransferUtilityUploadTask *transferUtilityUploadTask = [AWSS3TransferUtilityUploadTask new];
     transferUtilityUploadTask.nsURLSessionID = self.sessionIdentifier;
-    transferUtilityUploadTask.databaseQueue = self.databaseQueue;
+    transferUtilityUploadTask.databaseStore = self.databaseStore;
     transferUtilityUploadTask.transferType = @"UPLOAD";
     transferUtilityUploadTask.bucket = bucket;
     transferUtilityUploadTask.key = key;
@@ -900,7 +900,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
     transferUtilityUploadTask.status = AWSS3TransferUtilityTransferStatusInProgress;
     
     //Add to Database
-    [AWSS3TransferUtilityDatabaseHelper insertUploadTransferRequestInDB:transferUtilityUploadTask databaseQueue:self->_databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper insertUploadTransferRequestInDB:transferUtilityUploadTask databaseStore:self->_databaseStore];
     
     return [self createUploadTask:transferUtilityUploadTask];
 }
@@ -1000,7 +1000,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
                                                                  eTag:@""
                                                                status:transferUtilityUploadTask.status
                                                           retry_count:transferUtilityUploadTask.retryCount
-                                                        databaseQueue:self->_databaseQueue];
+                                                        databaseStore:self->_databaseStore];
         if (startTransfer) {
             [uploadTask resume];
         }
@@ -1015,7 +1015,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
     [self.taskDictionary removeObjectForKey:@(transferUtilityUploadTask.taskIdentifier)];
    
     //Remove from Database
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:transferUtilityUploadTask.taskIdentifier databaseQueue:_databaseQueue ];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:transferUtilityUploadTask.transferID taskIdentifier:transferUtilityUploadTask.taskIdentifier databaseStore:_databaseStore ];
     
     AWSDDLogDebug(@"Removed object from key %@", @(transferUtilityUploadTask.taskIdentifier) );
     transferUtilityUploadTask.retryCount = transferUtilityUploadTask.retryCount + 1;
@@ -1148,7 +1148,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
     //Create TransferUtility Multipart Upload Task
     AWSS3TransferUtilityMultiPartUploadTask *transferUtilityMultiPartUploadTask = [AWSS3TransferUtilityMultiPartUploadTask new];
     transferUtilityMultiPartUploadTask.nsURLSessionID = self.sessionIdentifier;
-    transferUtilityMultiPartUploadTask.databaseQueue = self.databaseQueue;
+    transferUtilityMultiPartUploadTask.databaseStore = self.databaseStore;
     transferUtilityMultiPartUploadTask.transferType = @"MULTI_PART_UPLOAD";
     transferUtilityMultiPartUploadTask.bucket = bucket;
     transferUtilityMultiPartUploadTask.key = key;
@@ -1185,8 +1185,8 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
 
     [AWSS3CreateMultipartUploadRequest propagateHeaderInformation:uploadRequest requestHeaders:transferUtilityMultiPartUploadTask.expression.requestHeaders];
     
-    //Initiate the multi part
-    return [[self.s3 createMultipartUpload:uploadRequest] continueWithBlock:^id(AWSTask *task) {
+    //Initiate the multi part. Splitting the file into parts is file I/O the caller doesn't wait for, so it runs at utility quality of service.
+    return [[self.s3 createMultipartUpload:uploadRequest] continueWithExecutor:[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility] withBlock:^id(AWSTask *task) {
         //Initiation of multi part failed.
         if (task.error) {
             if (transferUtilityMultiPartUploadTask.temporaryFileCreated) {
@@ -1213,7 +1213,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
         transferUtilityMultiPartUploadTask.uploadID = output.uploadId;
         
         //Save the Multipart Upload in the DB
-        [AWSS3TransferUtilityDatabaseHelper insertMultiPartUploadRequestInDB:transferUtilityMultiPartUploadTask databaseQueue:self->_databaseQueue];
+        [AWSS3TransferUtilityDatabaseHelper insertMultiPartUploadRequestInDB:transferUtilityMultiPartUploadTask databaseStore:self->_databaseStore];
         
         AWSDDLogInfo(@"Initiated multipart upload on server: %@", output.uploadId);
         AWSDDLogInfo(@"Concurrency Limit is %@", self.transferUtilityConfiguration.multiPartConcurrencyLimit);
@@ -1255,7 +1255,7 @@ static AWSS3TransferUtility *_defaultS3TransferUtility = nil;
             if (!subTaskCreationError) {
                 //Save in Database after the file has been created, so that file can be referenced incase upload is paused and needs to be restarted.
                 [AWSS3TransferUtilityDatabaseHelper insertMultiPartUploadRequestSubTaskInDB:transferUtilityMultiPartUploadTask subTask:subTask
-            databaseQueue:self.databaseQueue];
+            databaseStore:self.databaseStore];
             } else {
                 //Abort the request, so the server can clean up any partials.
                 [self callAbortMultiPartForUploadTask:transferUtilityMultiPartUploadTask];
@@ -1512,7 +1512,7 @@ internalDictionaryToAddSubTaskTo: (NSMutableDictionary *) internalDictionaryToAd
                                                                  eTag:@""
                                                                status:subTask.status
                                                           retry_count:transferUtilityMultiPartUploadTask.retryCount
-                                                        databaseQueue:self.databaseQueue];
+                                                        databaseStore:self.databaseStore];
 
         if (startTransfer) {
             AWSDDLogDebug(@"[CreateUploadSubTask] startTransfer is true, Starting subTask %@", @(subTask.taskIdentifier));
@@ -1632,7 +1632,7 @@ internalDictionaryToAddSubTaskTo: (NSMutableDictionary *) internalDictionaryToAd
     //Create Download Task and set it up.
     AWSS3TransferUtilityDownloadTask *transferUtilityDownloadTask = [AWSS3TransferUtilityDownloadTask new];
     transferUtilityDownloadTask.nsURLSessionID = self.sessionIdentifier;
-    transferUtilityDownloadTask.databaseQueue = self.databaseQueue;
+    transferUtilityDownloadTask.databaseStore = self.databaseStore;
     transferUtilityDownloadTask.transferType = @"DOWNLOAD";
     transferUtilityDownloadTask.location = fileURL;
     transferUtilityDownloadTask.bucket = bucket;
@@ -1646,7 +1646,7 @@ internalDictionaryToAddSubTaskTo: (NSMutableDictionary *) internalDictionaryToAd
     transferUtilityDownloadTask.status = AWSS3TransferUtilityTransferStatusInProgress;
     
     //Create task in database
-    [AWSS3TransferUtilityDatabaseHelper insertDownloadTransferRequestInDB:transferUtilityDownloadTask databaseQueue:self->_databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper insertDownloadTransferRequestInDB:transferUtilityDownloadTask databaseStore:self->_databaseStore];
     
     return [self createDownloadTask:transferUtilityDownloadTask];
 }
@@ -1704,7 +1704,7 @@ internalDictionaryToAddSubTaskTo: (NSMutableDictionary *) internalDictionaryToAd
                                                                  eTag:@""
                                                                status:transferUtilityDownloadTask.status
                                                           retry_count:transferUtilityDownloadTask.retryCount
-                                                        databaseQueue:self.databaseQueue];
+                                                        databaseStore:self.databaseStore];
         
         if ( startTransfer) {
             [downloadTask resume];
@@ -2200,7 +2200,7 @@ didCompleteWithError:(NSError *)error {
                                                            taskIdentifier:subTask.taskIdentifier
                                                                      eTag:subTask.eTag
                                                                    status:subTask.status
-                                                              retry_count:transferUtilityMultiPartUploadTask.retryCount databaseQueue:self.databaseQueue];
+                                                              retry_count:transferUtilityMultiPartUploadTask.retryCount databaseStore:self.databaseStore];
             
             //If there are parts waiting to be uploaded, pick from the waiting parts list and move it to inProgress
             if ([transferUtilityMultiPartUploadTask.waitingPartsDictionary count] > 0) {
@@ -2256,7 +2256,7 @@ didCompleteWithError:(NSError *)error {
                 
                 
                 //Call the Multipart completion step here.
-                [[ self callFinishMultiPartForUploadTask:transferUtilityMultiPartUploadTask] continueWithBlock:^id (AWSTask *task) {
+                [[ self callFinishMultiPartForUploadTask:transferUtilityMultiPartUploadTask] continueWithExecutor:[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility] withBlock:^id (AWSTask *task) {
                     if (task.error) {
                         AWSDDLogError(@"Error finishing up MultiPartForUpload Task[%@]", task.error);
                         transferUtilityMultiPartUploadTask.error = error;
@@ -2304,7 +2304,7 @@ didCompleteWithError:(NSError *)error {
         if (downloadTask.cancelled) {
             [self.completedTaskDictionary setObject:downloadTask forKey:downloadTask.transferID];
             [self.taskDictionary removeObjectForKey:@(downloadTask.sessionTask.taskIdentifier)];
-            [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID databaseQueue:_databaseQueue];
+            [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID databaseStore:_databaseStore];
             return;
         }
         
@@ -2348,7 +2348,7 @@ didCompleteWithError:(NSError *)error {
         }
         [self.completedTaskDictionary setObject:downloadTask forKey:downloadTask.transferID];
         [self.taskDictionary removeObjectForKey:@(downloadTask.sessionTask.taskIdentifier)];
-        [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID databaseQueue:_databaseQueue];
+        [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:downloadTask.transferID databaseStore:_databaseStore];
         [self completeTask:downloadTask];
     }
 }
@@ -2449,7 +2449,7 @@ totalBytesExpectedToSend:(int64_t)totalBytesExpectedToSend {
     }
     
     //Remove data from the Database.
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:task.transferID databaseQueue:_databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:task.transferID databaseStore:_databaseStore];
 }
 
 - (void) cleanupForUploadTask: (AWSS3TransferUtilityUploadTask *) uploadTask {
@@ -2465,7 +2465,7 @@ totalBytesExpectedToSend:(int64_t)totalBytesExpectedToSend {
     }
     
     //Remove data from the Database.
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:uploadTask.transferID databaseQueue:_databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:uploadTask.transferID databaseStore:_databaseStore];
 }
 
 - (BOOL) isErrorRetriable:(NSInteger) HTTPStatusCode
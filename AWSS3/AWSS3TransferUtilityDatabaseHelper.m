@@ -27,7 +27,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
 
 @implementation AWSS3TransferUtilityDatabaseHelper
 
-+ (AWSFMDatabaseQueue *) createDatabase:(NSString*) cacheDirectoryPath {
++ (AWSFMDatabaseStore *) createDatabase:(NSString*) cacheDirectoryPath {
     //Create temporary Dir to hold DB
     NSString *const AWSS3TransferUtilityCreateAWSTransfer =  @"CREATE TABLE IF NOT EXISTS awstransfer ("
     @"transfer_id TEXT NOT NULL,"
@@ -62,29 +62,29 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
     NSString * databasePath = [dbDirPath stringByAppendingString:AWSS3TransferUtilityDatabaseName];
     //Open the database if the directory exists
     AWSDDLogInfo(@"Transfer Utility Database Path: [%@]", databasePath);
-    AWSFMDatabaseQueue *databaseQueue = [AWSFMDatabaseQueue databaseQueueWithPath: databasePath];
+    AWSFMDatabaseStore *databaseStore = [AWSFMDatabaseStore storeWithPath: databasePath];
     
-    if (!databaseQueue) {
-        AWSDDLogError(@"Unable to create Database Queue for [%@]", databasePath);
+    if (!databaseStore) {
+        AWSDDLogError(@"Unable to create Database Store for [%@]", databasePath);
         return nil;
     }
     
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    [databaseStore inDatabase:^(AWSFMDatabase *db) {
         if (! [db executeUpdate: AWSS3TransferUtilityCreateAWSTransfer]) {
             AWSDDLogError(@"Failed to create awstransfer Database table. [%@]", db.lastError);
         }
     }];
-    return databaseQueue;
+    return databaseStore;
 }
 
 
 //Delete a transfer request given its transfer ID
 + (void) deleteTransferRequestFromDB:(NSString *) transferID
-                       databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                       databaseStore: (AWSFMDatabaseStore *) databaseStore {
     NSString *const AWSS3TransferUtilityDeleteTransfer =  @"DELETE FROM awstransfer "
     @"WHERE transfer_id=:transfer_id";
     
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    [databaseStore inDatabase:^(AWSFMDatabase *db) {
         BOOL result = [db executeUpdate: AWSS3TransferUtilityDeleteTransfer
                 withParameterDictionary:@{
                                           @"transfer_id": transferID
@@ -102,11 +102,11 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
 //Delete a transfer request given its transfer ID and task Identifier.
 + (void) deleteTransferRequestFromDB:(NSString *) transferID
                       taskIdentifier: (NSUInteger) taskIdentifier
-                       databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                       databaseStore: (AWSFMDatabaseStore *) databaseStore {
     NSString *const AWSS3TransferUtilityDeleteATask =  @"DELETE FROM awstransfer "
     @"WHERE transfer_id=:transfer_id and "
     @"      session_task_id=:session_task_id ";
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    [databaseStore inDatabase:^(AWSFMDatabase *db) {
         BOOL result = [db executeUpdate:AWSS3TransferUtilityDeleteATask
                 withParameterDictionary:@{
                                           @"transfer_id": transferID,
@@ -126,12 +126,12 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                               eTag: (NSString *) eTag
                             status: (AWSS3TransferUtilityTransferStatusType) status
                        retry_count: (NSUInteger) retryCount
-                     databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                     databaseStore: (AWSFMDatabaseStore *) databaseStore {
     NSString *const AWSS3TransferUtilityUpdateTransferUtilityStatusAndETag = @"UPDATE awstransfer "
     @"SET status=:status, etag = :etag, session_task_id = :session_task_id, retry_count = :retry_count "
     @"WHERE transfer_id=:transfer_id and "
     @"      part_number =:part_number ";
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    [databaseStore inDatabase:^(AWSFMDatabase *db) {
         BOOL result = [db executeUpdate: AWSS3TransferUtilityUpdateTransferUtilityStatusAndETag
                 withParameterDictionary:@{
                                           @"transfer_id": transferID,
@@ -151,7 +151,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
 
 
 + (void) insertUploadTransferRequestInDB:(AWSS3TransferUtilityUploadTask *) task
-                           databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                           databaseStore: (AWSFMDatabaseStore *) databaseStore {
     
     [AWSS3TransferUtilityDatabaseHelper insertTransferRequestInDB:task.transferID
                                                    nsURLSessionID:task.nsURLSessionID
@@ -169,11 +169,11 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                                                        retryCount:@(task.retryCount)
                                                requestHeadersJSON:[AWSS3TransferUtilityDatabaseHelper getJSONRepresentation:task.expression.requestHeaders]
                                             requestParametersJSON:[AWSS3TransferUtilityDatabaseHelper getJSONRepresentation:task.expression.requestParameters]
-                                                    databaseQueue:databaseQueue];
+                                                    databaseStore:databaseStore];
 }
 
 + (void) insertDownloadTransferRequestInDB:(AWSS3TransferUtilityDownloadTask *) task
-                             databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                             databaseStore: (AWSFMDatabaseStore *) databaseStore {
     NSString *file = task.file;
     if(!file) {
         file = @"";
@@ -194,11 +194,11 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                                                        retryCount:@(task.retryCount)
                                                requestHeadersJSON:[self getJSONRepresentation:task.expression.requestHeaders]
                                             requestParametersJSON:[self getJSONRepresentation:task.expression.requestParameters]
-                                                    databaseQueue:databaseQueue];
+                                                    databaseStore:databaseStore];
 }
 
 + (void) insertMultiPartUploadRequestInDB:(AWSS3TransferUtilityMultiPartUploadTask *) task
-                            databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                            databaseStore: (AWSFMDatabaseStore *) databaseStore {
     [AWSS3TransferUtilityDatabaseHelper insertTransferRequestInDB:task.transferID
                                                    nsURLSessionID:task.nsURLSessionID
                                                    taskIdentifier:@0
@@ -215,12 +215,12 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                                                        retryCount:@(task.retryCount)
                                                requestHeadersJSON:[self getJSONRepresentation:task.expression.requestHeaders]
                                             requestParametersJSON:[self getJSONRepresentation:task.expression.requestParameters]
-                                                    databaseQueue:databaseQueue];
+                                                    databaseStore:databaseStore];
 }
 
 + (void) insertMultiPartUploadRequestSubTaskInDB:(AWSS3TransferUtilityMultiPartUploadTask *) task
                                          subTask:(AWSS3TransferUtilityUploadSubTask *) subTask
-                                   databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                                   databaseStore: (AWSFMDatabaseStore *) databaseStore {
     [AWSS3TransferUtilityDatabaseHelper insertTransferRequestInDB:task.transferID
                                                    nsURLSessionID:task.nsURLSessionID
                                                    taskIdentifier:@(subTask.taskIdentifier)
@@ -237,7 +237,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                                                        retryCount:@(0)
                                                requestHeadersJSON:[self getJSONRepresentation:task.expression.requestHeaders]
                                             requestParametersJSON:[self getJSONRepresentation:task.expression.requestParameters]
-                                                    databaseQueue:databaseQueue];
+                                                    databaseStore:databaseStore];
 }
 
 + (void) insertTransferRequestInDB: (NSString *) transferID
@@ -256,7 +256,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
                         retryCount: (NSNumber *) retryCount
                 requestHeadersJSON: (NSString *) requestHeadersJSON
              requestParametersJSON: (NSString *) requestParametersJSON
-                     databaseQueue: (AWSFMDatabaseQueue *) databaseQueue {
+                     databaseStore: (AWSFMDatabaseStore *) databaseStore {
     NSString *const AWSS3TransferUtiltyInsertIntoAWSTransfer = @"INSERT INTO awstransfer ("
     @"transfer_id,ns_url_session_id, session_task_id, transfer_type, bucket_name, key, part_number, multi_part_id, etag, file, "
     @"temporary_file_created, content_length, status, retry_count, request_headers, request_parameters"
@@ -270,7 +270,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
         tempFileCreated = [NSNumber numberWithInt:1];
     }
     
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    [databaseStore inDatabase:^(AWSFMDatabase *db) {
         BOOL result = [db executeUpdate: AWSS3TransferUtiltyInsertIntoAWSTransfer
                 withParameterDictionary:@{
                                           @"transfer_id": transferID,
@@ -298,7 +298,7 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
 }
 
 + (NSMutableArray *) getTransferTaskDataFromDB:(NSString *)nsURLSessionID
-                                 databaseQueue: (AWSFMDatabaseQueue *) databaseQueue
+                                 databaseStore: (AWSFMDatabaseStore *) databaseStore
 {
     NSString *const AWSS3TransferUtilityQueryAWSTransfer = @"Select transfer_id, session_task_id, "
     @"transfer_type, bucket_name, key, part_number, multi_part_id, etag, file, temporary_file_created, content_length, "
@@ -307,8 +307,8 @@ NSString *const AWSS3TransferUtilityDatabaseName = @"transfer_utility_database";
     @"Where ns_url_session_id=:ns_url_session_id order by transfer_id, part_number";
     
     NSMutableArray *tasks = [NSMutableArray new];
-    //Read from DB
-    [databaseQueue inDatabase:^(AWSFMDatabase *db) {
+    //Read from DB without waiting for transfers being saved
+    [databaseStore inReadDatabase:^(AWSFMDatabase *db) {
         //Get all AWSTransferRecords
         AWSFMResultSet *rs = [db executeQuery:AWSS3TransferUtilityQueryAWSTransfer
                       withParameterDictionary:@{
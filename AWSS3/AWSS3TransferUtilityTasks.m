@@ -56,7 +56,7 @@
                                                              eTag:@""
                                                            status:self.status
                                                       retry_count:self.retryCount
-                                                    databaseQueue:self.databaseQueue];
+                                                    databaseStore:self.databaseStore];
 }
 
 - (void)suspend {
@@ -73,7 +73,7 @@
                                                              eTag:@""
                                                            status:self.status
                                                       retry_count:self.retryCount
-                                                    databaseQueue:self.databaseQueue];
+                                                    databaseStore:self.databaseStore];
 }
 
 - (NSURLRequest *)request {
@@ -102,7 +102,7 @@
     self.status = AWSS3TransferUtilityTransferStatusCancelled;
     self.cancelled = YES;
     [self.sessionTask cancel];
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseQueue:self.databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseStore:self.databaseStore];
 }
 
 -(void) setCompletionHandler:(AWSS3TransferUtilityUploadCompletionHandlerBlock)completionHandler {
@@ -152,7 +152,7 @@
         [subTask.sessionTask cancel];
     }
 
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseQueue:self.databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseStore:self.databaseStore];
 }
 
 - (void)resume {
@@ -170,7 +170,7 @@
                                                                  eTag:subTask.eTag
                                                                status:subTask.status
                                                           retry_count:self.retryCount
-                                                        databaseQueue:self.databaseQueue];
+                                                        databaseStore:self.databaseStore];
         [subTask.sessionTask resume];
     }
     self.status = AWSS3TransferUtilityTransferStatusInProgress;
@@ -181,7 +181,7 @@
                                                              eTag:@""
                                                            status:self.status
                                                       retry_count:self.retryCount
-                                                    databaseQueue:self.databaseQueue];
+                                                    databaseStore:self.databaseStore];
 }
 
 - (void)suspend {
@@ -201,7 +201,7 @@
                                                                  eTag:subTask.eTag
                                                                status:subTask.status
                                                           retry_count:self.retryCount
-                                                        databaseQueue:self.databaseQueue];
+                                                        databaseStore:self.databaseStore];
     }
     self.status = AWSS3TransferUtilityTransferStatusPaused;
     //Update the Master Record
@@ -211,7 +211,7 @@
                                                              eTag:@""
                                                            status:self.status
                                                       retry_count:self.retryCount
-                                                    databaseQueue:self.databaseQueue];
+                                                    databaseStore:self.databaseStore];
 }
 
 -(void) setCompletionHandler:(AWSS3TransferUtilityMultiPartUploadCompletionHandlerBlock)completionHandler {
@@ -243,7 +243,7 @@
     self.cancelled = YES;
     self.status = AWSS3TransferUtilityTransferStatusCancelled;
     [self.sessionTask cancel];
-    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseQueue:self.databaseQueue];
+    [AWSS3TransferUtilityDatabaseHelper deleteTransferRequestFromDB:self.transferID databaseStore:self.databaseStore];
 }
 
 -(void) setCompletionHandler:(AWSS3TransferUtilityDownloadCompletionHandlerBlock)completionHandler {
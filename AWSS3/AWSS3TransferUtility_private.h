@@ -32,7 +32,7 @@
 @property (copy) NSString *file;
 @property (copy) NSString *transferType;
 @property AWSS3TransferUtilityTransferStatusType status;
-@property (strong) AWSFMDatabaseQueue *databaseQueue;
+@property (strong) AWSFMDatabaseStore *databaseStore;
 
 @end
 
@@ -144,14 +144,14 @@
 
 @interface AWSS3TransferUtilityDatabaseHelper()
 
-+ (AWSFMDatabaseQueue *) createDatabase:(NSString*) cacheDirectoryPath;
++ (AWSFMDatabaseStore *) createDatabase:(NSString*) cacheDirectoryPath;
 
 + (void) deleteTransferRequestFromDB:(NSString *) transferID
-                         databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                         databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) deleteTransferRequestFromDB:(NSString *) transferID
                       taskIdentifier: (NSUInteger) taskIdentifier
-                       databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                       databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) updateTransferRequestInDB: (NSString *) transferID
                         partNumber: (NSNumber *) partNumber
@@ -159,23 +159,23 @@
                               eTag: (NSString *) eTag
                             status: (AWSS3TransferUtilityTransferStatusType) status
                        retry_count: (NSUInteger) retryCount
-                     databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                     databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) insertUploadTransferRequestInDB:(AWSS3TransferUtilityUploadTask *) task
-                             databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                             databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) insertDownloadTransferRequestInDB:(AWSS3TransferUtilityDownloadTask *) task
-                             databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                             databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) insertMultiPartUploadRequestInDB:(AWSS3TransferUtilityMultiPartUploadTask *) task
-                            databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                            databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (void) insertMultiPartUploadRequestSubTaskInDB:(AWSS3TransferUtilityMultiPartUploadTask *) task
                                          subTask:(AWSS3TransferUtilityUploadSubTask *) subTask
-                                   databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                                   databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (NSMutableArray *) getTransferTaskDataFromDB:(NSString *)nsURLSessionID
-                                 databaseQueue: (AWSFMDatabaseQueue *) databaseQueue;
+                                 databaseStore: (AWSFMDatabaseStore *) databaseStore;
 
 + (NSString *) getJSONRepresentation: (NSDictionary *) dict;
 + (NSDictionary*) getDictionaryFromJson: (NSString *)json;
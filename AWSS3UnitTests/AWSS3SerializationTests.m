@@ -0,0 +1,151 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import <AWSCore/AWSCore.h>
+#import "AWSS3Resources.h"
+
+// About 1 MB of listing once encoded.
+static const NSUInteger AWSS3SerializationTestsObjectCount = 3000;
+
+@interface AWSXMLParser()
+
+@property (nonatomic, assign) BOOL usesStreamDecoder;
+
+@end
+
+@interface AWSS3SerializationTests : XCTestCase
+
+@property (nonatomic, strong) NSDictionary *definition;
+
+@end
+
+@implementation AWSS3SerializationTests
+
+- (void)setUp {
+    [super setUp];
+    self.definition = [[AWSS3Resources sharedInstance] JSONObject];
+}
+
+- (NSData *)listObjectsResponseData {
+    NSMutableString *xml = [NSMutableString stringWithString:@"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                            "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                            "<Name>bucket</Name><Prefix></Prefix><KeyCount>3000</KeyCount><MaxKeys>3000</MaxKeys><IsTruncated>false</IsTruncated>"];
+    for (NSUInteger i = 0; i < AWSS3SerializationTestsObjectCount; i++) {
+        [xml appendFormat:@"<Contents><Key>photos/2026/10/%06lu.jpg</Key><LastModified>2026-10-19T12:00:00.000Z</LastModified>"
+         "<ETag>&quot;0123456789abcdef0123456789abcdef&quot;</ETag><Size>%lu</Size><StorageClass>STANDARD</StorageClass>"
+         "<Owner><ID>75aa57f09aa0c8caeab4f8c24e99d10f8e7faeebf76c078efc7c6caea54ba06a</ID><DisplayName>owner</DisplayName></Owner>"
+         "</Contents>", (unsigned long)i, (unsigned long)(i * 1024)];
+    }
+    [xml appendString:@"</ListBucketResult>"];
+    return [xml dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)testListObjectsV2Response {
+    NSError *error = nil;
+    NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:[self listObjectsResponseData]
+                                                                    actionName:@"ListObjectsV2"
+                                                         serviceDefinitionRule:self.definition
+                                                                         error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqualObjects(result[@"Name"], @"bucket");
+    NSArray *contents = result[@"Contents"];
+    XCTAssertEqual(contents.count, AWSS3SerializationTestsObjectCount);
+    XCTAssertEqualObjects(contents[7][@"Key"], @"photos/2026/10/000007.jpg");
+    XCTAssertEqualObjects(contents[7][@"Owner"][@"DisplayName"], @"owner");
+}
+
+- (void)testListObjectsV2ResponsePerformance {
+    NSData *data = [self listObjectsResponseData];
+    [self measureBlock:^{
+        NSError *error = nil;
+        NSDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:data
+                                                                        actionName:@"ListObjectsV2"
+                                                             serviceDefinitionRule:self.definition
+                                                                             error:&error];
+        XCTAssertEqual([result[@"Contents"] count], AWSS3SerializationTestsObjectCount);
+    }];
+}
+
+- (void)testListObjectsV2StreamDecoderMatchesDictionaryTree {
+    NSData *data = [self listObjectsResponseData];
+    AWSXMLParser *treeParser = [AWSXMLParser new];
+    treeParser.usesStreamDecoder = NO;
+    NSDictionary *expected = [treeParser dictionaryForXMLData:data
+                                                   actionName:@"ListObjectsV2"
+                                        serviceDefinitionRule:self.definition
+                                                        error:nil];
+
+    AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"ListObjectsV2"
+                                                        serviceDefinitionRule:self.definition];
+    NSError *error = nil;
+    NSDictionary *result = [decoder dictionaryForXMLData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual([result[@"Contents"] count], AWSS3SerializationTestsObjectCount);
+    XCTAssertEqualObjects(result, expected);
+
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    [data writeToFile:path atomically:YES];
+    XCTAssertEqualObjects([decoder dictionaryForXMLStream:[NSInputStream inputStreamWithFileAtPath:path] error:nil], expected);
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+}
+
+- (void)testListObjectsV2StreamDecoderPerformance {
+    NSData *data = [self listObjectsResponseData];
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            AWSXMLStreamDecoder *decoder = [AWSXMLStreamDecoder decoderWithActionName:@"ListObjectsV2"
+                                                                serviceDefinitionRule:self.definition];
+            NSDictionary *result = [decoder dictionaryForXMLData:data error:nil];
+            XCTAssertEqual([result[@"Contents"] count], AWSS3SerializationTestsObjectCount);
+        }];
+    }
+}
+
+- (void)testListObjectsV2DictionaryTreePerformance {
+    NSData *data = [self listObjectsResponseData];
+    AWSXMLParser *treeParser = [AWSXMLParser new];
+    treeParser.usesStreamDecoder = NO;
+    if (@available(iOS 13.0, *)) {
+        [self measureWithMetrics:@[[XCTClockMetric new], [XCTMemoryMetric new]] block:^{
+            NSDictionary *result = [treeParser dictionaryForXMLData:data
+                                                         actionName:@"ListObjectsV2"
+                                              serviceDefinitionRule:self.definition
+                                                              error:nil];
+            XCTAssertEqual([result[@"Contents"] count], AWSS3SerializationTestsObjectCount);
+        }];
+    }
+}
+
+- (void)testDeleteObjectsRequestPerformance {
+    NSMutableArray *objects = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 1000; i++) {
+        [objects addObject:@{@"Key": [NSString stringWithFormat:@"photos/2026/10/%06lu.jpg", (unsigned long)i],
+                             @"VersionId": @"3HL4kqtJlcpXroDTDmJ+rmSpXd3dIbrHY+MTRCxf3vjVBH40Nr8X8gdRQBpUMLUo"}];
+    }
+    NSDictionary *params = @{@"Bucket": @"bucket", @"Delete": @{@"Objects": objects, @"Quiet": @YES}};
+
+    [self measureBlock:^{
+        NSError *error = nil;
+        NSString *xml = [AWSXMLBuilder xmlStringForDictionary:params
+                                                   actionName:@"DeleteObjects"
+                                        serviceDefinitionRule:self.definition
+                                                        error:&error];
+        XCTAssertNil(error);
+        XCTAssertTrue([xml containsString:@"<Key>photos/2026/10/000999.jpg</Key>"]);
+    }];
+}
+
+@end
@@ -40,3 +40,5 @@ FOUNDATION_EXPORT const unsigned char AWSSQSVersionString[] DEPRECATED_MSG_ATTRI
 
 #import <AWSCore/AWSCore.h>
 #import "AWSSQSService.h"
+#import "AWSSQSProducer.h"
+#import "AWSSQSConsumer.h"
@@ -0,0 +1,74 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <AWSCore/AWSCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSSQSBatchResultErrorEntry;
+
+/**
+ Collects the entries of a batch request, and sends them when `AWSSQSBatchEntryLimit` entries or `maximumByteCount`
+ bytes are pending, when `lingerTime` has passed since the first pending entry was added, or when the buffer is
+ flushed.
+
+ `sendBatch` is called with the entries of one batch and returns a task whose result has one object per entry, in the
+ same order: the result of the entry, or an `NSError` if the entry failed. If the task fails, every entry fails with
+ its error.
+ */
+@interface AWSSQSBatchBuffer : NSObject
+
+- (instancetype)initWithMaximumByteCount:(NSUInteger)maximumByteCount
+                               sendBatch:(AWSTask<NSArray *> * (^)(NSArray *entries))sendBatch NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (atomic, assign) NSTimeInterval lingerTime;
+
+/**
+ The number of batches sent.
+ */
+@property (atomic, assign, readonly) NSUInteger batchCount;
+
+/**
+ Adds an entry to the pending batch.
+
+ @return A task that completes with the result of the entry once its batch is sent.
+ */
+- (AWSTask *)addEntry:(id)entry
+            byteCount:(NSUInteger)byteCount;
+
+/**
+ Sends the pending batch.
+
+ @return A task that completes once every batch sent so far has completed. `task.result` is always `nil`.
+ */
+- (AWSTask *)flush;
+
+/**
+ Returns the results of a batch of `entryCount` entries numbered from `0`, as `sendBatch` returns them.
+
+ @param entryCount The number of entries in the request.
+ @param successful The successful result entries. Each must have an `identifier`.
+ @param failed     The failed result entries.
+ */
++ (NSArray *)resultsForEntryCount:(NSUInteger)entryCount
+                       successful:(nullable NSArray *)successful
+                           failed:(nullable NSArray<AWSSQSBatchResultErrorEntry *> *)failed;
+
+@end
+
+NS_ASSUME_NONNULL_END
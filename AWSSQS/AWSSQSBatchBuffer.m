@@ -0,0 +1,196 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSSQSBatchBuffer.h"
+#import "AWSSQSModel.h"
+#import "AWSSQSProducer.h"
+
+@interface AWSSQSBatchBuffer()
+
+@property (nonatomic, assign) NSUInteger maximumByteCount;
+@property (nonatomic, copy) AWSTask<NSArray *> * (^sendBatch)(NSArray *entries);
+
+// Only touched on `queue`.
+@property (nonatomic, strong) dispatch_queue_t queue;
+@property (nonatomic, strong) NSMutableArray *pendingEntries;
+@property (nonatomic, strong) NSMutableArray<AWSTaskCompletionSource *> *pendingTaskCompletionSources;
+@property (nonatomic, assign) NSUInteger pendingByteCount;
+@property (nonatomic, assign) NSUInteger generation;
+@property (nonatomic, strong) NSMutableSet<AWSTask *> *sendingTasks;
+
+@property (atomic, assign) NSUInteger batchCount;
+
+@end
+
+@implementation AWSSQSBatchBuffer
+
+- (instancetype)init {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:@"`- init` is not a valid initializer. Use `- initWithMaximumByteCount:sendBatch:` instead."
+                                 userInfo:nil];
+}
+
+- (instancetype)initWithMaximumByteCount:(NSUInteger)maximumByteCount
+                               sendBatch:(AWSTask<NSArray *> * (^)(NSArray *entries))sendBatch {
+    if (self = [super init]) {
+        _maximumByteCount = maximumByteCount;
+        _sendBatch = [sendBatch copy];
+        _queue = dispatch_queue_create("com.amazonaws.AWSSQSBatchBuffer", DISPATCH_QUEUE_SERIAL);
+        _pendingEntries = [NSMutableArray new];
+        _pendingTaskCompletionSources = [NSMutableArray new];
+        _sendingTasks = [NSMutableSet new];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    for (AWSTaskCompletionSource *taskCompletionSource in _pendingTaskCompletionSources) {
+        [taskCompletionSource trySetError:[NSError errorWithDomain:AWSSQSErrorDomain
+                                                              code:AWSSQSErrorUnknown
+                                                          userInfo:@{NSLocalizedDescriptionKey : @"The batch wasn't sent."}]];
+    }
+}
+
+- (AWSTask *)addEntry:(id)entry
+            byteCount:(NSUInteger)byteCount {
+    AWSTaskCompletionSource *taskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+    dispatch_sync(self.queue, ^{
+        if ([self.pendingEntries count] > 0 && self.pendingByteCount + byteCount > self.maximumByteCount) {
+            [self sendPendingEntries];
+        }
+
+        [self.pendingEntries addObject:entry];
+        [self.pendingTaskCompletionSources addObject:taskCompletionSource];
+        self.pendingByteCount += byteCount;
+
+        if ([self.pendingEntries count] >= AWSSQSBatchEntryLimit) {
+            [self sendPendingEntries];
+        } else if ([self.pendingEntries count] == 1) {
+            [self sendPendingEntriesAfterLingerTime];
+        }
+    });
+    return taskCompletionSource.task;
+}
+
+- (AWSTask *)flush {
+    __block NSArray<AWSTask *> *tasks = nil;
+    dispatch_sync(self.queue, ^{
+        [self sendPendingEntries];
+        tasks = [self.sendingTasks allObjects];
+    });
+    return [[AWSTask taskForCompletionOfAllTasks:tasks] continueWithBlock:^id(AWSTask *task) {
+        return nil;
+    }];
+}
+
+// Must be called on `queue`.
+- (void)sendPendingEntriesAfterLingerTime {
+    NSUInteger generation = self.generation;
+    __weak AWSSQSBatchBuffer *weakSelf = self;
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.lingerTime * NSEC_PER_SEC)), self.queue, ^{
+        AWSSQSBatchBuffer *strongSelf = weakSelf;
+        // The batch may have been sent, full or flushed, since the timer was set.
+        if (strongSelf.generation == generation) {
+            [strongSelf sendPendingEntries];
+        }
+    });
+}
+
+// Must be called on `queue`.
+- (void)sendPendingEntries {
+    if ([self.pendingEntries count] == 0) {
+        return;
+    }
+
+    NSArray *entries = [self.pendingEntries copy];
+    NSArray<AWSTaskCompletionSource *> *taskCompletionSources = [self.pendingTaskCompletionSources copy];
+    [self.pendingEntries removeAllObjects];
+    [self.pendingTaskCompletionSources removeAllObjects];
+    self.pendingByteCount = 0;
+    self.generation++;
+    self.batchCount++;
+
+    AWSTask<NSArray *> *sendTask = self.sendBatch(entries);
+    if (!sendTask) {
+        // The owner of the buffer is gone.
+        sendTask = [AWSTask taskWithError:[NSError errorWithDomain:AWSSQSErrorDomain
+                                                              code:AWSSQSErrorUnknown
+                                                          userInfo:@{NSLocalizedDescriptionKey : @"The batch wasn't sent."}]];
+    }
+
+    // The entry tasks complete off `queue`, so that their continuations can add entries.
+    AWSTask *task = [sendTask continueWithExecutor:[AWSExecutor executorWithQualityOfService:NSQualityOfServiceUtility]
+                                         withBlock:^id(AWSTask<NSArray *> *task) {
+        [taskCompletionSources enumerateObjectsUsingBlock:^(AWSTaskCompletionSource *taskCompletionSource, NSUInteger idx, BOOL *stop) {
+            id result = idx < [task.result count] ? task.result[idx] : nil;
+            if (task.error) {
+                [taskCompletionSource trySetError:task.error];
+            } else if ([result isKindOfClass:[NSError class]]) {
+                [taskCompletionSource trySetError:result];
+            } else if (result) {
+                [taskCompletionSource trySetResult:result];
+            } else {
+                [taskCompletionSource trySetError:[NSError errorWithDomain:AWSSQSErrorDomain
+                                                                      code:AWSSQSErrorUnknown
+                                                                  userInfo:@{NSLocalizedDescriptionKey : @"The batch response has no result for the entry."}]];
+            }
+        }];
+        return nil;
+    }];
+
+    [self.sendingTasks addObject:task];
+    [task continueWithBlock:^id(AWSTask *task) {
+        dispatch_async(self.queue, ^{
+            [self.sendingTasks removeObject:task];
+        });
+        return nil;
+    }];
+}
+
++ (NSArray *)resultsForEntryCount:(NSUInteger)entryCount
+                       successful:(NSArray *)successful
+                           failed:(NSArray<AWSSQSBatchResultErrorEntry *> *)failed {
+    NSMutableArray *results = [NSMutableArray arrayWithCapacity:entryCount];
+    for (NSUInteger i = 0; i < entryCount; i++) {
+        [results addObject:[NSNull null]];
+    }
+
+    for (id resultEntry in successful) {
+        NSInteger index = [[resultEntry identifier] integerValue];
+        if (index >= 0 && index < (NSInteger)entryCount) {
+            results[index] = resultEntry;
+        }
+    }
+    for (AWSSQSBatchResultErrorEntry *errorEntry in failed) {
+        NSInteger index = [errorEntry.identifier integerValue];
+        if (index >= 0 && index < (NSInteger)entryCount) {
+            results[index] = [NSError errorWithDomain:AWSSQSErrorDomain
+                                                 code:AWSSQSErrorUnknown
+                                             userInfo:@{NSLocalizedDescriptionKey : errorEntry.message ?: errorEntry.code ?: @"The batch entry failed.",
+                                                        AWSSQSBatchResultErrorEntryKey : errorEntry}];
+        }
+    }
+
+    for (NSUInteger i = 0; i < entryCount; i++) {
+        if (results[i] == [NSNull null]) {
+            results[i] = [NSError errorWithDomain:AWSSQSErrorDomain
+                                             code:AWSSQSErrorUnknown
+                                         userInfo:@{NSLocalizedDescriptionKey : @"The batch response has no result for the entry."}];
+        }
+    }
+    return results;
+}
+
+@end
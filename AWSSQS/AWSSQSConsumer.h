@@ -0,0 +1,139 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <AWSCore/AWSCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSSQS;
+@class AWSSQSMessage;
+
+/**
+ Receives messages from an Amazon SQS queue and hands them to a message handler.
+
+ The consumer keeps `concurrentReceiveCount` long-poll `ReceiveMessage` requests open, and holds at most
+ `bufferLimit` received messages that aren't handled yet. Up to `maximumConcurrentMessageCount` messages are handled
+ at a time. A message is deleted once its handler succeeds, and deletions are sent in `DeleteMessageBatch` requests of
+ up to `AWSSQSBatchEntryLimit` entries, or `lingerTime` after the first one.
+
+ While a message is buffered or handled, its visibility timeout is extended by `visibilityTimeout` in
+ `ChangeMessageVisibilityBatch` requests whenever less than half of it is left, so that the queue doesn't deliver it
+ to another consumer. A message whose handler fails is made visible again right away, so that the queue delivers it
+ again.
+
+    AWSSQSConsumer *consumer = [[AWSSQSConsumer alloc] initWithSQS:[AWSSQS defaultSQS]
+                                                          queueUrl:queueUrl];
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        return [self processMessage:message];
+    }];
+ */
+@interface AWSSQSConsumer : NSObject
+
+/**
+ Initializes a consumer of the given queue.
+
+ @param SQS      The service client used to receive and delete the messages.
+ @param queueUrl The URL of the queue.
+ */
+- (instancetype)initWithSQS:(AWSSQS *)SQS
+                   queueUrl:(NSString *)queueUrl NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) AWSSQS *SQS;
+
+@property (nonatomic, strong, readonly) NSString *queueUrl;
+
+/**
+ The number of `ReceiveMessage` requests kept open. The default is 2.
+ */
+@property (atomic, assign) NSUInteger concurrentReceiveCount;
+
+/**
+ The number of received messages waiting for a handler, including those that open `ReceiveMessage` requests may
+ return. No more messages are requested while the buffer is full. The default is 100.
+ */
+@property (atomic, assign) NSUInteger bufferLimit;
+
+/**
+ The number of messages handled at a time. The default is 10.
+ */
+@property (atomic, assign) NSUInteger maximumConcurrentMessageCount;
+
+/**
+ How long a `ReceiveMessage` request waits for messages, in seconds, up to 20. The default is 20 seconds.
+ */
+@property (atomic, assign) NSUInteger waitTimeSeconds;
+
+/**
+ The visibility timeout requested for received messages, and added to it each time it is extended, in seconds. The
+ default is 30 seconds.
+ */
+@property (atomic, assign) NSUInteger visibilityTimeout;
+
+/**
+ How long a batch of deletions waits for more after its first one, in seconds. The default is 0.05 seconds.
+ */
+@property (atomic, assign) NSTimeInterval lingerTime;
+
+/**
+ Whether the consumer is receiving messages.
+ */
+@property (atomic, assign, readonly, getter=isRunning) BOOL running;
+
+/**
+ The number of messages received.
+ */
+@property (atomic, assign, readonly) NSUInteger receivedMessageCount;
+
+/**
+ The number of messages deleted after their handler succeeded.
+ */
+@property (atomic, assign, readonly) NSUInteger deletedMessageCount;
+
+/**
+ The number of messages whose handler failed, or that couldn't be deleted.
+ */
+@property (atomic, assign, readonly) NSUInteger failedMessageCount;
+
+/**
+ The number of received messages waiting for a handler.
+ */
+@property (atomic, assign, readonly) NSUInteger bufferedMessageCount;
+
+/**
+ Starts receiving messages. Does nothing if the consumer is running.
+
+ @param messageHandler Called on a background queue for each message. Returns a task that completes when the message
+                       is handled, or `nil` if it was handled synchronously. The message is deleted unless the task
+                       fails or is cancelled.
+ */
+- (void)startWithMessageHandler:(AWSTask * _Nullable (^)(AWSSQSMessage *message))messageHandler;
+
+/**
+ Stops receiving messages. Buffered messages are made visible again right away, the messages being handled are
+ finished, and their deletions are sent. Messages returned afterwards by the `ReceiveMessage` requests still open are
+ made visible again too.
+
+ @return A task that completes once the messages being handled are finished and deleted, and the `ReceiveMessage`
+         requests still open have returned, which takes up to `waitTimeSeconds`. `task.result` is always `nil`. The
+         task fails if the consumer is started again before then.
+ */
+- (AWSTask *)stop;
+
+@end
+
+NS_ASSUME_NONNULL_END
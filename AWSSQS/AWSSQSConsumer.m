@@ -0,0 +1,394 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSSQSConsumer.h"
+#import "AWSSQSService.h"
+#import "AWSSQSProducer.h"
+#import "AWSSQSBatchBuffer.h"
+
+static NSUInteger const AWSSQSConsumerDefaultConcurrentReceiveCount = 2;
+static NSUInteger const AWSSQSConsumerDefaultBufferLimit = 100;
+static NSUInteger const AWSSQSConsumerDefaultMaximumConcurrentMessageCount = 10;
+static NSUInteger const AWSSQSConsumerMaximumWaitTimeSeconds = 20;
+static NSUInteger const AWSSQSConsumerDefaultVisibilityTimeout = 30;
+static NSTimeInterval const AWSSQSConsumerDefaultLingerTime = 0.05;
+static NSTimeInterval const AWSSQSConsumerReceiveRetryBaseDelay = 0.1;
+static NSTimeInterval const AWSSQSConsumerReceiveRetryMaximumDelay = 20;
+
+// A received message and the time its visibility timeout expires.
+@interface AWSSQSConsumerMessage : NSObject
+
+@property (nonatomic, strong) AWSSQSMessage *message;
+@property (nonatomic, assign) NSTimeInterval visibilityDeadline;
+
+@end
+
+@implementation AWSSQSConsumerMessage
+
+@end
+
+@interface AWSSQSConsumer()
+
+@property (nonatomic, strong) AWSSQSBatchBuffer *deleteBuffer;
+@property (nonatomic, strong) AWSSQSBatchBuffer *visibilityBuffer;
+
+// Only touched on `stateQueue`.
+@property (nonatomic, strong) dispatch_queue_t stateQueue;
+@property (nonatomic, copy) AWSTask * (^messageHandler)(AWSSQSMessage *message);
+@property (nonatomic, strong) dispatch_source_t visibilityTimer;
+@property (nonatomic, strong) NSMutableArray<AWSSQSConsumerMessage *> *bufferedMessages;
+@property (nonatomic, strong) NSMutableSet<AWSSQSConsumerMessage *> *handledMessages;
+@property (nonatomic, assign) NSUInteger receiveRequestCount;
+@property (nonatomic, assign) NSUInteger requestedMessageCount;
+@property (nonatomic, assign) NSUInteger receiveFailureCount;
+@property (nonatomic, strong) AWSTaskCompletionSource *stopTaskCompletionSource;
+
+@property (atomic, assign, readwrite, getter=isRunning) BOOL running;
+@property (atomic, assign) NSUInteger receivedMessageCount;
+@property (atomic, assign) NSUInteger deletedMessageCount;
+@property (atomic, assign) NSUInteger failedMessageCount;
+@property (atomic, assign) NSUInteger bufferedMessageCount;
+
+@end
+
+@implementation AWSSQSConsumer
+
+- (instancetype)init {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:@"`- init` is not a valid initializer. Use `- initWithSQS:queueUrl:` instead."
+                                 userInfo:nil];
+}
+
+- (instancetype)initWithSQS:(AWSSQS *)SQS
+                   queueUrl:(NSString *)queueUrl {
+    if (self = [super init]) {
+        _SQS = SQS;
+        _queueUrl = [queueUrl copy];
+        _concurrentReceiveCount = AWSSQSConsumerDefaultConcurrentReceiveCount;
+        _bufferLimit = AWSSQSConsumerDefaultBufferLimit;
+        _maximumConcurrentMessageCount = AWSSQSConsumerDefaultMaximumConcurrentMessageCount;
+        _waitTimeSeconds = AWSSQSConsumerMaximumWaitTimeSeconds;
+        _visibilityTimeout = AWSSQSConsumerDefaultVisibilityTimeout;
+        _stateQueue = dispatch_queue_create("com.amazonaws.AWSSQSConsumer", DISPATCH_QUEUE_SERIAL);
+        _bufferedMessages = [NSMutableArray new];
+        _handledMessages = [NSMutableSet new];
+
+        __weak AWSSQSConsumer *weakSelf = self;
+        _deleteBuffer = [[AWSSQSBatchBuffer alloc] initWithMaximumByteCount:NSUIntegerMax
+                                                                  sendBatch:^AWSTask<NSArray *> *(NSArray<AWSSQSDeleteMessageBatchRequestEntry *> *entries) {
+                                                                      return [weakSelf deleteEntries:entries];
+                                                                  }];
+        _deleteBuffer.lingerTime = AWSSQSConsumerDefaultLingerTime;
+        _visibilityBuffer = [[AWSSQSBatchBuffer alloc] initWithMaximumByteCount:NSUIntegerMax
+                                                                      sendBatch:^AWSTask<NSArray *> *(NSArray<AWSSQSChangeMessageVisibilityBatchRequestEntry *> *entries) {
+                                                                          return [weakSelf changeVisibilityOfEntries:entries];
+                                                                      }];
+        _visibilityBuffer.lingerTime = AWSSQSConsumerDefaultLingerTime;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_visibilityTimer) {
+        dispatch_source_cancel(_visibilityTimer);
+    }
+}
+
+- (NSTimeInterval)lingerTime {
+    return self.deleteBuffer.lingerTime;
+}
+
+- (void)setLingerTime:(NSTimeInterval)lingerTime {
+    self.deleteBuffer.lingerTime = lingerTime;
+    self.visibilityBuffer.lingerTime = lingerTime;
+}
+
+- (void)startWithMessageHandler:(AWSTask * (^)(AWSSQSMessage *message))messageHandler {
+    dispatch_sync(self.stateQueue, ^{
+        if (self.running) {
+            return;
+        }
+        self.messageHandler = messageHandler;
+        self.running = YES;
+        // A stop that hasn't finished yet never will.
+        [self.stopTaskCompletionSource trySetError:[NSError errorWithDomain:AWSSQSErrorDomain
+                                                                       code:AWSSQSErrorUnknown
+                                                                   userInfo:@{NSLocalizedDescriptionKey : @"The consumer was restarted before it stopped."}]];
+        self.stopTaskCompletionSource = nil;
+        [self startVisibilityTimer];
+        [self receiveMessages];
+    });
+}
+
+- (AWSTask *)stop {
+    __block AWSTask *task = nil;
+    dispatch_sync(self.stateQueue, ^{
+        self.running = NO;
+        if (!self.stopTaskCompletionSource) {
+            self.stopTaskCompletionSource = [AWSTaskCompletionSource taskCompletionSource];
+        }
+        task = self.stopTaskCompletionSource.task;
+
+        for (AWSSQSConsumerMessage *consumerMessage in self.bufferedMessages) {
+            [self releaseMessage:consumerMessage.message];
+        }
+        [self.bufferedMessages removeAllObjects];
+        self.bufferedMessageCount = 0;
+
+        [self finishStoppingIfDone];
+    });
+    return task;
+}
+
+#pragma mark - Receiving
+
+// Keeps `concurrentReceiveCount` requests open, as long as the messages they may return fit in the buffer.
+- (void)receiveMessages {
+    while (self.running && self.receiveRequestCount < MAX(self.concurrentReceiveCount, 1)) {
+        NSInteger capacity = (NSInteger)self.bufferLimit - (NSInteger)[self.bufferedMessages count] - (NSInteger)self.requestedMessageCount;
+        if (capacity <= 0) {
+            break;
+        }
+        [self receiveMessagesWithCount:MIN((NSUInteger)capacity, AWSSQSBatchEntryLimit)];
+    }
+}
+
+- (void)receiveMessagesWithCount:(NSUInteger)count {
+    self.receiveRequestCount++;
+    self.requestedMessageCount += count;
+
+    AWSSQSReceiveMessageRequest *request = [AWSSQSReceiveMessageRequest new];
+    request.queueUrl = self.queueUrl;
+    request.maxNumberOfMessages = @(count);
+    request.waitTimeSeconds = @(MIN(self.waitTimeSeconds, AWSSQSConsumerMaximumWaitTimeSeconds));
+    request.visibilityTimeout = @(self.visibilityTimeout);
+    request.attributeNames = @[@"All"];
+    request.messageAttributeNames = @[@"All"];
+
+    [[self.SQS receiveMessage:request] continueWithBlock:^id(AWSTask<AWSSQSReceiveMessageResult *> *task) {
+        dispatch_async(self.stateQueue, ^{
+            [self didReceiveMessages:task.result.messages
+                               count:count
+                               error:task.error];
+        });
+        return nil;
+    }];
+}
+
+- (void)didReceiveMessages:(NSArray<AWSSQSMessage *> *)messages
+                     count:(NSUInteger)count
+                     error:(NSError *)error {
+    if (error && !self.running) {
+        self.receiveRequestCount--;
+        self.requestedMessageCount -= count;
+        [self finishStoppingIfDone];
+        return;
+    }
+    if (error) {
+        // The request keeps its place until the retry, so that a failing queue isn't polled in a loop.
+        self.receiveFailureCount++;
+        NSTimeInterval delay = MIN(AWSSQSConsumerReceiveRetryBaseDelay * (1 << MIN(self.receiveFailureCount - 1, 16)), AWSSQSConsumerReceiveRetryMaximumDelay);
+        delay *= 0.5 + arc4random_uniform(1000) / 2000.0;
+        AWSDDLogError(@"Failed to receive messages. Retrying in %.1f seconds. [%@]", delay, error);
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)), self.stateQueue, ^{
+            self.receiveRequestCount--;
+            self.requestedMessageCount -= count;
+            [self receiveMessages];
+            [self finishStoppingIfDone];
+        });
+        return;
+    }
+
+    self.receiveFailureCount = 0;
+    self.receiveRequestCount--;
+    self.requestedMessageCount -= count;
+    self.receivedMessageCount += [messages count];
+
+    NSTimeInterval visibilityDeadline = [NSDate timeIntervalSinceReferenceDate] + self.visibilityTimeout;
+    for (AWSSQSMessage *message in messages) {
+        if (!self.running) {
+            [self releaseMessage:message];
+            continue;
+        }
+        AWSSQSConsumerMessage *consumerMessage = [AWSSQSConsumerMessage new];
+        consumerMessage.message = message;
+        consumerMessage.visibilityDeadline = visibilityDeadline;
+        [self.bufferedMessages addObject:consumerMessage];
+    }
+    self.bufferedMessageCount = [self.bufferedMessages count];
+
+    [self handleMessages];
+    [self receiveMessages];
+    [self finishStoppingIfDone];
+}
+
+#pragma mark - Handling
+
+- (void)handleMessages {
+    while ([self.bufferedMessages count] > 0 && [self.handledMessages count] < MAX(self.maximumConcurrentMessageCount, 1)) {
+        AWSSQSConsumerMessage *consumerMessage = [self.bufferedMessages firstObject];
+        [self.bufferedMessages removeObjectAtIndex:0];
+        [self.handledMessages addObject:consumerMessage];
+
+        AWSTask * (^messageHandler)(AWSSQSMessage *message) = self.messageHandler;
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            AWSTask *task = messageHandler(consumerMessage.message) ?: [AWSTask taskWithResult:nil];
+            [task continueWithBlock:^id(AWSTask *task) {
+                BOOL succeeded = !task.error && !task.isCancelled;
+                dispatch_async(self.stateQueue, ^{
+                    [self didHandleMessage:consumerMessage
+                                 succeeded:succeeded];
+                });
+                return nil;
+            }];
+        });
+    }
+    self.bufferedMessageCount = [self.bufferedMessages count];
+}
+
+- (void)didHandleMessage:(AWSSQSConsumerMessage *)consumerMessage
+               succeeded:(BOOL)succeeded {
+    [self.handledMessages removeObject:consumerMessage];
+
+    if (succeeded) {
+        AWSSQSDeleteMessageBatchRequestEntry *entry = [AWSSQSDeleteMessageBatchRequestEntry new];
+        entry.receiptHandle = consumerMessage.message.receiptHandle;
+        [[self.deleteBuffer addEntry:entry
+                           byteCount:0] continueWithBlock:^id(AWSTask *task) {
+            dispatch_async(self.stateQueue, ^{
+                if (task.error) {
+                    AWSDDLogError(@"Failed to delete message %@. [%@]", consumerMessage.message.messageId, task.error);
+                    self.failedMessageCount++;
+                } else {
+                    self.deletedMessageCount++;
+                }
+            });
+            return nil;
+        }];
+    } else {
+        self.failedMessageCount++;
+        [self releaseMessage:consumerMessage.message];
+    }
+
+    [self handleMessages];
+    [self receiveMessages];
+    [self finishStoppingIfDone];
+}
+
+- (void)finishStoppingIfDone {
+    // The messages of the open `ReceiveMessage` requests are released once they return, so the stop waits for them too.
+    if (self.running || !self.stopTaskCompletionSource || [self.handledMessages count] > 0 || self.receiveRequestCount > 0) {
+        return;
+    }
+
+    if (self.visibilityTimer) {
+        dispatch_source_cancel(self.visibilityTimer);
+        self.visibilityTimer = nil;
+    }
+
+    AWSTaskCompletionSource *stopTaskCompletionSource = self.stopTaskCompletionSource;
+    [[AWSTask taskForCompletionOfAllTasks:@[[self.deleteBuffer flush], [self.visibilityBuffer flush]]] continueWithBlock:^id(AWSTask *task) {
+        [stopTaskCompletionSource trySetResult:nil];
+        return nil;
+    }];
+}
+
+#pragma mark - Visibility
+
+- (void)startVisibilityTimer {
+    if (self.visibilityTimer || self.visibilityTimeout == 0) {
+        return;
+    }
+
+    // Checks four times per visibility timeout, so a message is extended before it has less than a quarter left.
+    uint64_t interval = (uint64_t)(self.visibilityTimeout * NSEC_PER_SEC / 4);
+    self.visibilityTimer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.stateQueue);
+    dispatch_source_set_timer(self.visibilityTimer, dispatch_time(DISPATCH_TIME_NOW, interval), interval, interval / 10);
+    __weak AWSSQSConsumer *weakSelf = self;
+    dispatch_source_set_event_handler(self.visibilityTimer, ^{
+        [weakSelf extendVisibility];
+    });
+    dispatch_resume(self.visibilityTimer);
+}
+
+- (void)extendVisibility {
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    NSUInteger visibilityTimeout = self.visibilityTimeout;
+
+    NSMutableArray<AWSSQSConsumerMessage *> *heldMessages = [NSMutableArray arrayWithArray:self.bufferedMessages];
+    [heldMessages addObjectsFromArray:[self.handledMessages allObjects]];
+    for (AWSSQSConsumerMessage *consumerMessage in heldMessages) {
+        if (consumerMessage.visibilityDeadline - now >= visibilityTimeout / 2.0) {
+            continue;
+        }
+        consumerMessage.visibilityDeadline = now + visibilityTimeout;
+
+        AWSSQSChangeMessageVisibilityBatchRequestEntry *entry = [AWSSQSChangeMessageVisibilityBatchRequestEntry new];
+        entry.receiptHandle = consumerMessage.message.receiptHandle;
+        entry.visibilityTimeout = @(visibilityTimeout);
+        [[self.visibilityBuffer addEntry:entry
+                               byteCount:0] continueWithBlock:^id(AWSTask *task) {
+            if (task.error) {
+                AWSDDLogWarn(@"Failed to extend the visibility timeout of message %@. [%@]", consumerMessage.message.messageId, task.error);
+            }
+            return nil;
+        }];
+    }
+}
+
+// Makes a message that won't be handled visible to other consumers right away.
+- (void)releaseMessage:(AWSSQSMessage *)message {
+    AWSSQSChangeMessageVisibilityBatchRequestEntry *entry = [AWSSQSChangeMessageVisibilityBatchRequestEntry new];
+    entry.receiptHandle = message.receiptHandle;
+    entry.visibilityTimeout = @0;
+    [self.visibilityBuffer addEntry:entry
+                          byteCount:0];
+}
+
+#pragma mark - Batches
+
+- (AWSTask<NSArray *> *)deleteEntries:(NSArray<AWSSQSDeleteMessageBatchRequestEntry *> *)entries {
+    [entries enumerateObjectsUsingBlock:^(AWSSQSDeleteMessageBatchRequestEntry *entry, NSUInteger idx, BOOL *stop) {
+        entry.identifier = [NSString stringWithFormat:@"%lu", (unsigned long)idx];
+    }];
+
+    AWSSQSDeleteMessageBatchRequest *request = [AWSSQSDeleteMessageBatchRequest new];
+    request.queueUrl = self.queueUrl;
+    request.entries = entries;
+
+    return [[self.SQS deleteMessageBatch:request] continueWithSuccessBlock:^id(AWSTask<AWSSQSDeleteMessageBatchResult *> *task) {
+        return [AWSSQSBatchBuffer resultsForEntryCount:[entries count]
+                                            successful:task.result.successful
+                                                failed:task.result.failed];
+    }];
+}
+
+- (AWSTask<NSArray *> *)changeVisibilityOfEntries:(NSArray<AWSSQSChangeMessageVisibilityBatchRequestEntry *> *)entries {
+    [entries enumerateObjectsUsingBlock:^(AWSSQSChangeMessageVisibilityBatchRequestEntry *entry, NSUInteger idx, BOOL *stop) {
+        entry.identifier = [NSString stringWithFormat:@"%lu", (unsigned long)idx];
+    }];
+
+    AWSSQSChangeMessageVisibilityBatchRequest *request = [AWSSQSChangeMessageVisibilityBatchRequest new];
+    request.queueUrl = self.queueUrl;
+    request.entries = entries;
+
+    return [[self.SQS changeMessageVisibilityBatch:request] continueWithSuccessBlock:^id(AWSTask<AWSSQSChangeMessageVisibilityBatchResult *> *task) {
+        return [AWSSQSBatchBuffer resultsForEntryCount:[entries count]
+                                            successful:task.result.successful
+                                                failed:task.result.failed];
+    }];
+}
+
+@end
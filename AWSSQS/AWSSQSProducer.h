@@ -0,0 +1,117 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <AWSCore/AWSCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class AWSSQS;
+@class AWSSQSSendMessageBatchRequestEntry;
+@class AWSSQSSendMessageBatchResultEntry;
+
+/**
+ The maximum number of entries in one `SendMessageBatch`, `DeleteMessageBatch` or `ChangeMessageVisibilityBatch`
+ request, and the maximum number of messages returned by one `ReceiveMessage` request.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSSQSBatchEntryLimit;
+
+/**
+ The maximum total size of the messages of one `SendMessageBatch` request, counted as the UTF-8 length of each message
+ body plus the names, types and values of its message attributes.
+ */
+FOUNDATION_EXPORT NSUInteger const AWSSQSBatchByteLimit;
+
+/**
+ The `userInfo` key of the `AWSSQSBatchResultErrorEntry` that describes why one entry of a batch request failed.
+ */
+FOUNDATION_EXPORT NSString *const AWSSQSBatchResultErrorEntryKey;
+
+/**
+ Sends messages to an Amazon SQS queue in `SendMessageBatch` requests.
+
+ Messages are collected into a batch, which is sent when it holds `AWSSQSBatchEntryLimit` messages or
+ `AWSSQSBatchByteLimit` bytes, or `lingerTime` after its first message was added. Each message gets its own task, so a
+ message that fails doesn't fail the others of its batch. Messages still pending when the producer is deallocated fail,
+ so call `flush` before releasing it.
+
+ Batches are sent as soon as they are complete, and may be in flight at the same time. Messages of a FIFO queue that
+ must stay in order should be sent one batch at a time, by waiting for `flush` between batches.
+
+    AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:[AWSSQS defaultSQS]
+                                                          queueUrl:queueUrl];
+    [[producer sendMessageBody:@"Hello"] continueWithBlock:^id(AWSTask<AWSSQSSendMessageBatchResultEntry *> *task) {
+        ...
+    }];
+ */
+@interface AWSSQSProducer : NSObject
+
+/**
+ Initializes a producer that sends messages to the given queue.
+
+ @param SQS      The service client used to send the messages.
+ @param queueUrl The URL of the queue.
+ */
+- (instancetype)initWithSQS:(AWSSQS *)SQS
+                   queueUrl:(NSString *)queueUrl NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (nonatomic, strong, readonly) AWSSQS *SQS;
+
+@property (nonatomic, strong, readonly) NSString *queueUrl;
+
+/**
+ How long a batch waits for more messages after its first one, in seconds. The default is 0.05 seconds. A longer time
+ sends fuller batches when messages trickle in, at the cost of latency.
+ */
+@property (atomic, assign) NSTimeInterval lingerTime;
+
+/**
+ The number of `SendMessageBatch` requests sent.
+ */
+@property (atomic, assign, readonly) NSUInteger requestCount;
+
+/**
+ Sends a message with the given body.
+
+ @param messageBody The body of the message.
+
+ @return A task that completes once the batch of the message is sent. `task.result` is the result of the message.
+         `task.error` is set if the message wasn't sent. When SQS rejected only this message,
+         `task.error.userInfo[AWSSQSBatchResultErrorEntryKey]` says why.
+ */
+- (AWSTask<AWSSQSSendMessageBatchResultEntry *> *)sendMessageBody:(NSString *)messageBody;
+
+/**
+ Sends a message with attributes, a delay, or FIFO parameters.
+
+ @param entry The message. Its `identifier` is ignored, since each batch numbers its own entries.
+
+ @return A task that completes once the batch of the message is sent. See `sendMessageBody:`.
+ */
+- (AWSTask<AWSSQSSendMessageBatchResultEntry *> *)sendMessage:(AWSSQSSendMessageBatchRequestEntry *)entry;
+
+/**
+ Sends the pending batch now.
+
+ @return A task that completes once every message added so far has been sent or has failed. `task.result` is always
+         `nil`.
+ */
+- (AWSTask *)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
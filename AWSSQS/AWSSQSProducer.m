@@ -0,0 +1,112 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSSQSProducer.h"
+#import "AWSSQSService.h"
+#import "AWSSQSBatchBuffer.h"
+
+NSUInteger const AWSSQSBatchEntryLimit = 10;
+NSUInteger const AWSSQSBatchByteLimit = 256 * 1024;
+NSString *const AWSSQSBatchResultErrorEntryKey = @"AWSSQSBatchResultErrorEntry";
+
+static NSTimeInterval const AWSSQSProducerDefaultLingerTime = 0.05;
+
+@interface AWSSQSProducer()
+
+@property (nonatomic, strong) AWSSQSBatchBuffer *buffer;
+
+@end
+
+@implementation AWSSQSProducer
+
+- (instancetype)init {
+    @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                   reason:@"`- init` is not a valid initializer. Use `- initWithSQS:queueUrl:` instead."
+                                 userInfo:nil];
+}
+
+- (instancetype)initWithSQS:(AWSSQS *)SQS
+                   queueUrl:(NSString *)queueUrl {
+    if (self = [super init]) {
+        _SQS = SQS;
+        _queueUrl = [queueUrl copy];
+
+        __weak AWSSQSProducer *weakSelf = self;
+        _buffer = [[AWSSQSBatchBuffer alloc] initWithMaximumByteCount:AWSSQSBatchByteLimit
+                                                            sendBatch:^AWSTask<NSArray *> *(NSArray<AWSSQSSendMessageBatchRequestEntry *> *entries) {
+                                                                return [weakSelf sendEntries:entries];
+                                                            }];
+        _buffer.lingerTime = AWSSQSProducerDefaultLingerTime;
+    }
+    return self;
+}
+
+- (NSTimeInterval)lingerTime {
+    return self.buffer.lingerTime;
+}
+
+- (void)setLingerTime:(NSTimeInterval)lingerTime {
+    self.buffer.lingerTime = lingerTime;
+}
+
+- (NSUInteger)requestCount {
+    return self.buffer.batchCount;
+}
+
+- (AWSTask<AWSSQSSendMessageBatchResultEntry *> *)sendMessageBody:(NSString *)messageBody {
+    AWSSQSSendMessageBatchRequestEntry *entry = [AWSSQSSendMessageBatchRequestEntry new];
+    entry.messageBody = messageBody;
+    return [self sendMessage:entry];
+}
+
+- (AWSTask<AWSSQSSendMessageBatchResultEntry *> *)sendMessage:(AWSSQSSendMessageBatchRequestEntry *)entry {
+    NSUInteger byteCount = [entry.messageBody lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    for (NSString *name in entry.messageAttributes) {
+        AWSSQSMessageAttributeValue *value = entry.messageAttributes[name];
+        byteCount += [name lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+        byteCount += [value.dataType lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+        byteCount += [value.stringValue lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+        byteCount += [value.binaryValue length];
+    }
+
+    // The entry is copied, because its identifier is set when its batch is sent.
+    return [self.buffer addEntry:[entry copy]
+                       byteCount:byteCount];
+}
+
+- (AWSTask *)flush {
+    return [self.buffer flush];
+}
+
+- (AWSTask<NSArray *> *)sendEntries:(NSArray<AWSSQSSendMessageBatchRequestEntry *> *)entries {
+    [entries enumerateObjectsUsingBlock:^(AWSSQSSendMessageBatchRequestEntry *entry, NSUInteger idx, BOOL *stop) {
+        entry.identifier = [NSString stringWithFormat:@"%lu", (unsigned long)idx];
+    }];
+
+    AWSSQSSendMessageBatchRequest *request = [AWSSQSSendMessageBatchRequest new];
+    request.queueUrl = self.queueUrl;
+    request.entries = entries;
+
+    return [[self.SQS sendMessageBatch:request] continueWithSuccessBlock:^id(AWSTask<AWSSQSSendMessageBatchResult *> *task) {
+        if ([task.result.failed count] > 0) {
+            AWSDDLogWarn(@"%lu of %lu messages weren't sent.", (unsigned long)[task.result.failed count], (unsigned long)[entries count]);
+        }
+        return [AWSSQSBatchBuffer resultsForEntryCount:[entries count]
+                                            successful:task.result.successful
+                                                failed:task.result.failed];
+    }];
+}
+
+@end
@@ -0,0 +1,381 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <XCTest/XCTest.h>
+#import "AWSTestUtility.h"
+#import "AWSSQSTestStandIn.h"
+
+@interface AWSSQSConsumerTests : XCTestCase
+
+@property (nonatomic, strong) AWSSQSTestStandIn *queue;
+@property (nonatomic, strong) id mockSQS;
+@property (nonatomic, strong) AWSSQS *SQS;
+
+@end
+
+@implementation AWSSQSConsumerTests
+
+- (void)setUp {
+    [super setUp];
+    [AWSTestUtility setupFakeCognitoCredentialsProvider];
+
+    NSString *key = @"AWSSQSConsumerTests";
+    AWSServiceConfiguration *configuration = [[AWSServiceConfiguration alloc] initWithRegion:AWSRegionUSEast1 credentialsProvider:nil];
+    [AWSSQS registerSQSWithConfiguration:configuration forKey:key];
+    self.SQS = [AWSSQS SQSForKey:key];
+
+    AWSSQSTestStandIn *queue = [AWSSQSTestStandIn new];
+    queue.requestDelay = 2;
+    self.queue = queue;
+
+    self.mockSQS = [queue mockSQS:self.SQS];
+}
+
+- (void)tearDown {
+    [self.mockSQS stopMocking];
+    [AWSSQS removeSQSForKey:@"AWSSQSConsumerTests"];
+    [super tearDown];
+}
+
+- (BOOL)waitFor:(BOOL (^)(void))condition
+        timeout:(NSTimeInterval)timeout {
+    NSDate *deadline = [NSDate dateWithTimeIntervalSinceNow:timeout];
+    while (!condition()) {
+        if ([deadline timeIntervalSinceNow] < 0) {
+            return NO;
+        }
+        [NSThread sleepForTimeInterval:0.01];
+    }
+    return YES;
+}
+
+- (AWSSQSConsumer *)consumer {
+    AWSSQSConsumer *consumer = [[AWSSQSConsumer alloc] initWithSQS:self.SQS
+                                                          queueUrl:AWSSQSTestQueueUrl];
+    consumer.waitTimeSeconds = 1;
+    return consumer;
+}
+
+- (void)testProducerSendsFullBatches {
+    AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:self.SQS
+                                                          queueUrl:AWSSQSTestQueueUrl];
+    producer.lingerTime = 1;
+
+    NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < 25; i++) {
+        [tasks addObject:[producer sendMessageBody:[NSString stringWithFormat:@"message-%lu", (unsigned long)i]]];
+    }
+    XCTAssertTrue([self waitFor:^BOOL{
+        return [self.queue messageCount] == 20;
+    } timeout:0.5]);
+    XCTAssertEqual(producer.requestCount, 2);
+
+    // The last batch isn't full, so it waits for its linger time unless it is flushed.
+    [[producer flush] waitUntilFinished];
+    XCTAssertEqual([self.queue messageCount], 25);
+    XCTAssertEqualObjects(self.queue.sendBatchSizes, (@[@10, @10, @5]));
+    for (AWSTask<AWSSQSSendMessageBatchResultEntry *> *task in tasks) {
+        [task waitUntilFinished];
+        XCTAssertNil(task.error);
+        XCTAssertNotNil(task.result.messageId);
+    }
+}
+
+- (void)testProducerSendsAfterLingerTime {
+    AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:self.SQS
+                                                          queueUrl:AWSSQSTestQueueUrl];
+    producer.lingerTime = 0.1;
+
+    AWSTask *task = [producer sendMessageBody:@"message"];
+    [NSThread sleepForTimeInterval:0.05];
+    XCTAssertEqual([self.queue messageCount], 0);
+    [task waitUntilFinished];
+    XCTAssertNil(task.error);
+    XCTAssertEqual([self.queue messageCount], 1);
+    XCTAssertEqual(producer.requestCount, 1);
+}
+
+- (void)testProducerFailsOnlyRejectedMessages {
+    AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:self.SQS
+                                                          queueUrl:AWSSQSTestQueueUrl];
+    AWSTask *valid = [producer sendMessageBody:@"valid"];
+    AWSTask *invalid = [producer sendMessageBody:@"invalid"];
+    [[producer flush] waitUntilFinished];
+
+    XCTAssertNil(valid.error);
+    XCTAssertEqualObjects(invalid.error.domain, AWSSQSErrorDomain);
+    AWSSQSBatchResultErrorEntry *errorEntry = invalid.error.userInfo[AWSSQSBatchResultErrorEntryKey];
+    XCTAssertEqualObjects(errorEntry.code, @"InvalidMessageContents");
+    XCTAssertEqual(producer.requestCount, 1);
+    XCTAssertEqual([self.queue messageCount], 1);
+}
+
+- (void)testConsumerHandlesAndDeletesEveryMessage {
+    for (NSUInteger i = 0; i < 200; i++) {
+        [self.queue addMessageWithBody:[NSString stringWithFormat:@"message-%lu", (unsigned long)i]];
+    }
+
+    NSMutableSet<NSString *> *bodies = [NSMutableSet new];
+    __block NSUInteger handledCount = 0;
+    AWSSQSConsumer *consumer = [self consumer];
+    consumer.concurrentReceiveCount = 3;
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        @synchronized (bodies) {
+            [bodies addObject:message.body];
+            handledCount++;
+        }
+        return nil;
+    }];
+    XCTAssertTrue(consumer.isRunning);
+
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.deletedMessageCount == 200;
+    } timeout:10]);
+    [[consumer stop] waitUntilFinished];
+    XCTAssertFalse(consumer.isRunning);
+
+    XCTAssertEqual(handledCount, 200);
+    XCTAssertEqual([bodies count], 200);
+    XCTAssertEqual([self.queue messageCount], 0);
+    XCTAssertEqual(consumer.receivedMessageCount, 200);
+    XCTAssertEqual(consumer.failedMessageCount, 0);
+    XCTAssertLessThanOrEqual(self.queue.mostReceivesInFlight, 3);
+    for (NSNumber *size in self.queue.deleteBatchSizes) {
+        XCTAssertLessThanOrEqual([size unsignedIntegerValue], 10);
+    }
+    XCTAssertLessThan([self.queue.deleteBatchSizes count], 60);
+}
+
+- (void)testConsumerBufferIsBounded {
+    for (NSUInteger i = 0; i < 100; i++) {
+        [self.queue addMessageWithBody:[NSString stringWithFormat:@"message-%lu", (unsigned long)i]];
+    }
+
+    AWSTaskCompletionSource *handled = [AWSTaskCompletionSource taskCompletionSource];
+    AWSSQSConsumer *consumer = [self consumer];
+    consumer.bufferLimit = 15;
+    consumer.maximumConcurrentMessageCount = 5;
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        return handled.task;
+    }];
+
+    [NSThread sleepForTimeInterval:0.3];
+    XCTAssertLessThanOrEqual(consumer.bufferedMessageCount, 15);
+    XCTAssertGreaterThan(consumer.bufferedMessageCount, 0);
+    XCTAssertLessThanOrEqual(consumer.receivedMessageCount, 20);
+
+    // Stopping releases the buffered messages right away and finishes the ones being handled.
+    AWSTask *stop = [consumer stop];
+    [handled setResult:nil];
+    [stop waitUntilFinished];
+    XCTAssertEqual(consumer.deletedMessageCount, 5);
+    XCTAssertEqual([self.queue messageCount], 95);
+    XCTAssertTrue([self waitFor:^BOOL{
+        return [self.queue visibleMessageCount] == 95;
+    } timeout:2]);
+}
+
+- (void)testConsumerExtendsVisibilityOfSlowMessages {
+    [self.queue addMessageWithBody:@"slow"];
+
+    __block NSUInteger handledCount = 0;
+    AWSSQSConsumer *consumer = [self consumer];
+    consumer.visibilityTimeout = 1;
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        @synchronized (self) {
+            handledCount++;
+        }
+        return [AWSTask taskWithDelay:2000];
+    }];
+
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.deletedMessageCount == 1;
+    } timeout:5]);
+    [[consumer stop] waitUntilFinished];
+
+    XCTAssertEqual(handledCount, 1);
+    XCTAssertGreaterThanOrEqual([self.queue.visibilityTimeouts count], 2);
+    XCTAssertEqual([self.queue messageCount], 0);
+}
+
+- (void)testConsumerReleasesFailedMessages {
+    [self.queue addMessageWithBody:@"fails"];
+
+    __block NSUInteger handledCount = 0;
+    AWSSQSConsumer *consumer = [self consumer];
+    consumer.visibilityTimeout = 60;
+    consumer.lingerTime = 0;
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        @synchronized (self) {
+            handledCount++;
+        }
+        return [AWSTask taskWithError:[NSError errorWithDomain:@"AWSSQSConsumerTests" code:0 userInfo:nil]];
+    }];
+
+    // The message is delivered again long before its visibility timeout.
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.failedMessageCount >= 2;
+    } timeout:5]);
+    [[consumer stop] waitUntilFinished];
+
+    XCTAssertEqual(consumer.deletedMessageCount, 0);
+    XCTAssertEqual(handledCount, consumer.failedMessageCount);
+    XCTAssertTrue([self.queue.visibilityTimeouts containsObject:@0]);
+    XCTAssertEqual([self.queue messageCount], 1);
+    XCTAssertEqual([self.queue visibleMessageCount], 1);
+}
+
+- (void)testStopWaitsForOpenReceives {
+    AWSSQSConsumer *consumer = [self consumer];
+    __block NSUInteger handledCount = 0;
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        @synchronized (self) {
+            handledCount++;
+        }
+        return nil;
+    }];
+    XCTAssertTrue([self waitFor:^BOOL{
+        return self.queue.receivesInFlight > 0;
+    } timeout:1]);
+
+    AWSTask *stop = [consumer stop];
+    [NSThread sleepForTimeInterval:0.1];
+    XCTAssertFalse(stop.isCompleted);
+
+    // A message returned by an open receive after the stop is made visible again before the stop completes.
+    [self.queue addMessageWithBody:@"late"];
+    [stop waitUntilFinished];
+    XCTAssertNil(stop.error);
+    XCTAssertEqual(self.queue.receivesInFlight, 0);
+    XCTAssertEqual(consumer.receivedMessageCount, 1);
+    XCTAssertEqual(handledCount, 0);
+    XCTAssertEqual([self.queue visibleMessageCount], 1);
+}
+
+- (void)testRestartFailsPendingStop {
+    [self.queue addMessageWithBody:@"message"];
+
+    AWSTaskCompletionSource *handled = [AWSTaskCompletionSource taskCompletionSource];
+    AWSSQSConsumer *consumer = [self consumer];
+    AWSTask * (^messageHandler)(AWSSQSMessage *message) = ^AWSTask *(AWSSQSMessage *message) {
+        return handled.task;
+    };
+    [consumer startWithMessageHandler:messageHandler];
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.receivedMessageCount == 1;
+    } timeout:2]);
+
+    AWSTask *stop = [consumer stop];
+    [consumer startWithMessageHandler:messageHandler];
+    XCTAssertTrue(consumer.isRunning);
+    [stop waitUntilFinished];
+    XCTAssertEqualObjects(stop.error.domain, AWSSQSErrorDomain);
+
+    [handled setResult:nil];
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.deletedMessageCount == 1;
+    } timeout:2]);
+    stop = [consumer stop];
+    [stop waitUntilFinished];
+    XCTAssertNil(stop.error);
+    XCTAssertEqual([self.queue messageCount], 0);
+}
+
+- (void)testBatchingSendsFewerRequests {
+    NSUInteger const messageCount = 1000;
+
+    AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:self.SQS
+                                                          queueUrl:AWSSQSTestQueueUrl];
+    for (NSUInteger i = 0; i < messageCount; i++) {
+        [producer sendMessageBody:[NSString stringWithFormat:@"message-%lu", (unsigned long)i]];
+    }
+    [[producer flush] waitUntilFinished];
+    XCTAssertEqual([self.queue messageCount], messageCount);
+    XCTAssertEqual(producer.requestCount, messageCount / 10);
+    XCTAssertEqual(self.queue.sendRequestCount, messageCount / 10);
+
+    AWSSQSConsumer *consumer = [self consumer];
+    [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+        return nil;
+    }];
+    XCTAssertTrue([self waitFor:^BOOL{
+        return consumer.deletedMessageCount == messageCount;
+    } timeout:30]);
+    [[consumer stop] waitUntilFinished];
+
+    XCTAssertEqual([self.queue messageCount], 0);
+    XCTAssertLessThan(self.queue.receiveRequestCount, messageCount / 5);
+    XCTAssertLessThan([self.queue.deleteBatchSizes count], messageCount / 5);
+}
+
+- (void)testPerformanceOfUnbatchedSendAndReceive {
+    NSUInteger const messageCount = 200;
+
+    // One request per message, the way apps use the raw API.
+    [self measureBlock:^{
+        NSMutableArray<AWSTask *> *tasks = [NSMutableArray new];
+        for (NSUInteger i = 0; i < messageCount; i++) {
+            AWSSQSSendMessageRequest *request = [AWSSQSSendMessageRequest new];
+            request.queueUrl = AWSSQSTestQueueUrl;
+            request.messageBody = [NSString stringWithFormat:@"message-%lu", (unsigned long)i];
+            [tasks addObject:[self.SQS sendMessage:request]];
+        }
+        [[AWSTask taskForCompletionOfAllTasks:tasks] waitUntilFinished];
+
+        NSUInteger receivedCount = 0;
+        while (receivedCount < messageCount) {
+            AWSSQSReceiveMessageRequest *request = [AWSSQSReceiveMessageRequest new];
+            request.queueUrl = AWSSQSTestQueueUrl;
+            request.maxNumberOfMessages = @1;
+            request.visibilityTimeout = @30;
+            request.waitTimeSeconds = @1;
+            AWSTask<AWSSQSReceiveMessageResult *> *receive = [self.SQS receiveMessage:request];
+            [receive waitUntilFinished];
+            for (AWSSQSMessage *message in receive.result.messages) {
+                AWSSQSDeleteMessageRequest *deleteRequest = [AWSSQSDeleteMessageRequest new];
+                deleteRequest.queueUrl = AWSSQSTestQueueUrl;
+                deleteRequest.receiptHandle = message.receiptHandle;
+                [[self.SQS deleteMessage:deleteRequest] waitUntilFinished];
+                receivedCount++;
+            }
+        }
+        XCTAssertEqual([self.queue messageCount], 0);
+    }];
+}
+
+- (void)testPerformanceOfBatchedProducerAndConsumer {
+    NSUInteger const messageCount = 200;
+
+    [self measureBlock:^{
+        AWSSQSProducer *producer = [[AWSSQSProducer alloc] initWithSQS:self.SQS
+                                                              queueUrl:AWSSQSTestQueueUrl];
+        for (NSUInteger i = 0; i < messageCount; i++) {
+            [producer sendMessageBody:[NSString stringWithFormat:@"message-%lu", (unsigned long)i]];
+        }
+        [[producer flush] waitUntilFinished];
+
+        AWSSQSConsumer *consumer = [self consumer];
+        [consumer startWithMessageHandler:^AWSTask *(AWSSQSMessage *message) {
+            return nil;
+        }];
+        XCTAssertTrue([self waitFor:^BOOL{
+            return consumer.deletedMessageCount == messageCount;
+        } timeout:30]);
+        [[consumer stop] waitUntilFinished];
+        XCTAssertEqual([self.queue messageCount], 0);
+    }];
+}
+
+@end
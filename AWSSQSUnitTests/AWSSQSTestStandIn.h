@@ -0,0 +1,82 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "AWSSQS.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+FOUNDATION_EXPORT NSString *const AWSSQSTestQueueUrl;
+
+/**
+ A message of `AWSSQSTestStandIn`.
+ */
+@interface AWSSQSTestMessage : NSObject
+
+@property (nonatomic, strong) NSString *messageId;
+@property (nonatomic, strong) NSString *body;
+@property (nonatomic, strong, nullable) NSString *receiptHandle;
+@property (nonatomic, assign) NSTimeInterval visibleDate;
+@property (nonatomic, assign) NSUInteger receiveCount;
+
+@end
+
+/**
+ A local stand-in for Amazon SQS. Keeps a queue in memory and answers the batch and single message calls after
+ `requestDelay`. Receive requests wait for visible messages up to their wait time, like long polls.
+ */
+@interface AWSSQSTestStandIn : NSObject
+
+/**
+ How long every response takes, in milliseconds.
+ */
+@property (atomic, assign) int requestDelay;
+
+@property (nonatomic, strong, readonly) NSMutableArray<AWSSQSTestMessage *> *messages;
+@property (nonatomic, strong, readonly) NSMutableArray<NSNumber *> *sendBatchSizes;
+@property (nonatomic, strong, readonly) NSMutableArray<NSNumber *> *deleteBatchSizes;
+@property (nonatomic, strong, readonly) NSMutableArray<NSNumber *> *visibilityTimeouts;
+@property (atomic, assign, readonly) NSUInteger sendRequestCount;
+@property (atomic, assign, readonly) NSUInteger receiveRequestCount;
+@property (atomic, assign, readonly) NSUInteger receivesInFlight;
+@property (atomic, assign, readonly) NSUInteger mostReceivesInFlight;
+
+- (void)addMessageWithBody:(NSString *)body;
+
+- (NSUInteger)messageCount;
+
+- (NSUInteger)visibleMessageCount;
+
+/**
+ Completes with the result of `response` after `requestDelay`. `response` runs while the stand-in is locked.
+ */
+- (AWSTask *)respondWith:(id _Nullable (^)(void))response;
+
+- (AWSTask *)sendMessageBatch:(AWSSQSSendMessageBatchRequest *)request;
+- (AWSTask *)receiveMessage:(AWSSQSReceiveMessageRequest *)request;
+- (AWSTask *)deleteMessageBatch:(AWSSQSDeleteMessageBatchRequest *)request;
+- (AWSTask *)changeMessageVisibilityBatch:(AWSSQSChangeMessageVisibilityBatchRequest *)request;
+- (AWSTask *)sendMessage:(AWSSQSSendMessageRequest *)request;
+- (AWSTask *)deleteMessage:(AWSSQSDeleteMessageRequest *)request;
+
+/**
+ Partially mocks `SQS` so that the calls above are answered by the receiver. Call `stopMocking` on the returned mock
+ when the test ends.
+ */
+- (id)mockSQS:(AWSSQS *)SQS;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,257 @@
+//
+// Copyright 2010-2026 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#import "AWSSQSTestStandIn.h"
+#import "OCMock.h"
+
+NSString *const AWSSQSTestQueueUrl = @"https://sqs.us-east-1.amazonaws.com/123456789012/AWSSQSTestQueue";
+
+@implementation AWSSQSTestMessage
+
+@end
+
+@interface AWSSQSTestStandIn ()
+
+@property (atomic, assign, readwrite) NSUInteger sendRequestCount;
+@property (atomic, assign, readwrite) NSUInteger receiveRequestCount;
+@property (atomic, assign, readwrite) NSUInteger receivesInFlight;
+@property (atomic, assign, readwrite) NSUInteger mostReceivesInFlight;
+
+@end
+
+@implementation AWSSQSTestStandIn
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _messages = [NSMutableArray new];
+        _sendBatchSizes = [NSMutableArray new];
+        _deleteBatchSizes = [NSMutableArray new];
+        _visibilityTimeouts = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (void)addMessageWithBody:(NSString *)body {
+    AWSSQSTestMessage *message = [AWSSQSTestMessage new];
+    message.messageId = [NSUUID UUID].UUIDString;
+    message.body = body;
+    @synchronized (self) {
+        [self.messages addObject:message];
+    }
+}
+
+- (NSUInteger)messageCount {
+    @synchronized (self) {
+        return [self.messages count];
+    }
+}
+
+- (NSUInteger)visibleMessageCount {
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    @synchronized (self) {
+        return [[self.messages filteredArrayUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(AWSSQSTestMessage *message, NSDictionary *bindings) {
+            return message.visibleDate <= now;
+        }]] count];
+    }
+}
+
+- (AWSSQSTestMessage *)messageWithReceiptHandle:(NSString *)receiptHandle {
+    for (AWSSQSTestMessage *message in self.messages) {
+        if ([message.receiptHandle isEqualToString:receiptHandle]) {
+            return message;
+        }
+    }
+    return nil;
+}
+
+- (AWSTask *)respondWith:(id (^)(void))response {
+    return [[AWSTask taskWithDelay:self.requestDelay] continueWithBlock:^id(AWSTask *task) {
+        @synchronized (self) {
+            return response();
+        }
+    }];
+}
+
+- (AWSTask *)sendMessageBatch:(AWSSQSSendMessageBatchRequest *)request {
+    @synchronized (self) {
+        self.sendRequestCount++;
+    }
+    return [self respondWith:^id{
+        [self.sendBatchSizes addObject:@([request.entries count])];
+        AWSSQSSendMessageBatchResult *result = [AWSSQSSendMessageBatchResult new];
+        NSMutableArray *successful = [NSMutableArray new];
+        NSMutableArray *failed = [NSMutableArray new];
+        for (AWSSQSSendMessageBatchRequestEntry *entry in request.entries) {
+            if ([entry.messageBody isEqualToString:@"invalid"]) {
+                AWSSQSBatchResultErrorEntry *errorEntry = [AWSSQSBatchResultErrorEntry new];
+                errorEntry.identifier = entry.identifier;
+                errorEntry.code = @"InvalidMessageContents";
+                errorEntry.senderFault = @YES;
+                [failed addObject:errorEntry];
+                continue;
+            }
+            AWSSQSTestMessage *message = [AWSSQSTestMessage new];
+            message.messageId = [NSUUID UUID].UUIDString;
+            message.body = entry.messageBody;
+            [self.messages addObject:message];
+
+            AWSSQSSendMessageBatchResultEntry *resultEntry = [AWSSQSSendMessageBatchResultEntry new];
+            resultEntry.identifier = entry.identifier;
+            resultEntry.messageId = message.messageId;
+            [successful addObject:resultEntry];
+        }
+        result.successful = successful;
+        result.failed = failed;
+        return result;
+    }];
+}
+
+- (AWSTask *)receiveMessage:(AWSSQSReceiveMessageRequest *)request {
+    @synchronized (self) {
+        self.receiveRequestCount++;
+        self.receivesInFlight++;
+        self.mostReceivesInFlight = MAX(self.mostReceivesInFlight, self.receivesInFlight);
+    }
+    NSTimeInterval deadline = [NSDate timeIntervalSinceReferenceDate] + [request.waitTimeSeconds doubleValue];
+    return [[self respondWith:^id{
+        return nil;
+    }] continueWithBlock:^id(AWSTask *task) {
+        return [self receiveMessage:request deadline:deadline];
+    }];
+}
+
+- (AWSTask *)receiveMessage:(AWSSQSReceiveMessageRequest *)request
+                   deadline:(NSTimeInterval)deadline {
+    NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+    NSMutableArray<AWSSQSMessage *> *messages = [NSMutableArray new];
+    @synchronized (self) {
+        for (AWSSQSTestMessage *message in self.messages) {
+            if ([messages count] >= [request.maxNumberOfMessages unsignedIntegerValue]) {
+                break;
+            }
+            if (message.visibleDate > now) {
+                continue;
+            }
+            message.receiptHandle = [NSUUID UUID].UUIDString;
+            message.visibleDate = now + [request.visibilityTimeout doubleValue];
+            message.receiveCount++;
+
+            AWSSQSMessage *receivedMessage = [AWSSQSMessage new];
+            receivedMessage.messageId = message.messageId;
+            receivedMessage.body = message.body;
+            receivedMessage.receiptHandle = message.receiptHandle;
+            [messages addObject:receivedMessage];
+        }
+    }
+
+    if ([messages count] == 0 && now < deadline) {
+        return [[AWSTask taskWithDelay:5] continueWithBlock:^id(AWSTask *task) {
+            return [self receiveMessage:request deadline:deadline];
+        }];
+    }
+
+    @synchronized (self) {
+        self.receivesInFlight--;
+    }
+    AWSSQSReceiveMessageResult *result = [AWSSQSReceiveMessageResult new];
+    result.messages = messages;
+    return [AWSTask taskWithResult:result];
+}
+
+- (AWSTask *)deleteMessageBatch:(AWSSQSDeleteMessageBatchRequest *)request {
+    return [self respondWith:^id{
+        [self.deleteBatchSizes addObject:@([request.entries count])];
+        NSMutableArray *successful = [NSMutableArray new];
+        for (AWSSQSDeleteMessageBatchRequestEntry *entry in request.entries) {
+            AWSSQSTestMessage *message = [self messageWithReceiptHandle:entry.receiptHandle];
+            if (message) {
+                [self.messages removeObject:message];
+            }
+            AWSSQSDeleteMessageBatchResultEntry *resultEntry = [AWSSQSDeleteMessageBatchResultEntry new];
+            resultEntry.identifier = entry.identifier;
+            [successful addObject:resultEntry];
+        }
+        AWSSQSDeleteMessageBatchResult *result = [AWSSQSDeleteMessageBatchResult new];
+        result.successful = successful;
+        return result;
+    }];
+}
+
+- (AWSTask *)changeMessageVisibilityBatch:(AWSSQSChangeMessageVisibilityBatchRequest *)request {
+    return [self respondWith:^id{
+        NSTimeInterval now = [NSDate timeIntervalSinceReferenceDate];
+        NSMutableArray *successful = [NSMutableArray new];
+        for (AWSSQSChangeMessageVisibilityBatchRequestEntry *entry in request.entries) {
+            [self.visibilityTimeouts addObject:entry.visibilityTimeout];
+            [self messageWithReceiptHandle:entry.receiptHandle].visibleDate = now + [entry.visibilityTimeout doubleValue];
+            AWSSQSChangeMessageVisibilityBatchResultEntry *resultEntry = [AWSSQSChangeMessageVisibilityBatchResultEntry new];
+            resultEntry.identifier = entry.identifier;
+            [successful addObject:resultEntry];
+        }
+        AWSSQSChangeMessageVisibilityBatchResult *result = [AWSSQSChangeMessageVisibilityBatchResult new];
+        result.successful = successful;
+        return result;
+    }];
+}
+
+// One request per message, the way apps use the raw API.
+- (AWSTask *)sendMessage:(AWSSQSSendMessageRequest *)request {
+    @synchronized (self) {
+        self.sendRequestCount++;
+    }
+    return [self respondWith:^id{
+        AWSSQSTestMessage *message = [AWSSQSTestMessage new];
+        message.messageId = [NSUUID UUID].UUIDString;
+        message.body = request.messageBody;
+        [self.messages addObject:message];
+        AWSSQSSendMessageResult *result = [AWSSQSSendMessageResult new];
+        result.messageId = message.messageId;
+        return result;
+    }];
+}
+
+- (AWSTask *)deleteMessage:(AWSSQSDeleteMessageRequest *)request {
+    return [self respondWith:^id{
+        AWSSQSTestMessage *message = [self messageWithReceiptHandle:request.receiptHandle];
+        if (message) {
+            [self.messages removeObject:message];
+        }
+        return nil;
+    }];
+}
+
+- (void (^)(NSInvocation *))answerWithSelector:(SEL)selector {
+    AWSTask *(*answer)(id, SEL, id) = (AWSTask *(*)(id, SEL, id))[self methodForSelector:selector];
+    return ^(NSInvocation *invocation) {
+        __unsafe_unretained id request = nil;
+        [invocation getArgument:&request atIndex:2];
+        AWSTask *task = answer(self, selector, request);
+        [invocation retainArguments];
+        [invocation setReturnValue:&task];
+    };
+}
+
+- (id)mockSQS:(AWSSQS *)SQS {
+    id mockSQS = OCMPartialMock(SQS);
+    OCMStub([mockSQS sendMessageBatch:[OCMArg any]]).andDo([self answerWithSelector:@selector(sendMessageBatch:)]);
+    OCMStub([mockSQS receiveMessage:[OCMArg any]]).andDo([self answerWithSelector:@selector(receiveMessage:)]);
+    OCMStub([mockSQS deleteMessageBatch:[OCMArg any]]).andDo([self answerWithSelector:@selector(deleteMessageBatch:)]);
+    OCMStub([mockSQS changeMessageVisibilityBatch:[OCMArg any]]).andDo([self answerWithSelector:@selector(changeMessageVisibilityBatch:)]);
+    OCMStub([mockSQS sendMessage:[OCMArg any]]).andDo([self answerWithSelector:@selector(sendMessage:)]);
+    OCMStub([mockSQS deleteMessage:[OCMArg any]]).andDo([self answerWithSelector:@selector(deleteMessage:)]);
+    return mockSQS;
+}
+
+@end